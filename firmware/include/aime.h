@@ -9,22 +9,28 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-/* return true if accepts a byte, false if rejects */
-typedef void (*aime_putc_func)(uint8_t byte);
+#define AIME_MAX_INSTANCES 2
+
+/* one protocol instance per host port, port is passed back to putc */
+typedef struct aime_ctx aime_ctx_t;
+typedef void (*aime_putc_func)(int port, uint8_t byte);
 
-void aime_init(aime_putc_func putc_func);
+aime_ctx_t *aime_init(aime_putc_func putc_func, int port);
 
 void aime_virtual_aic(bool enable);
-void aime_sub_mode(int sub_mode);
-const char *aime_get_mode_string();
+void aime_sub_mode(aime_ctx_t *ctx, int sub_mode);
+const char *aime_get_mode_string(int sub_mode);
 
-bool aime_feed(int c);
+/* return true if accepts a byte, false if rejects */
+bool aime_feed(aime_ctx_t *ctx, int c);
 
-/* if aime is currently active */
+/* if this instance is currently active */
+bool aime_ctx_is_active(const aime_ctx_t *ctx);
+/* if any instance is currently active */
 bool aime_is_active();
 
-void aime_dtr_off();
+void aime_dtr_off(aime_ctx_t *ctx);
 
-uint32_t aime_led_color();
+uint32_t aime_led_color(const aime_ctx_t *ctx);
 
 #endif
@@ -9,18 +9,25 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-/* return true if accepts a byte, false if rejects */
-typedef void (*bana_putc_func)(uint8_t byte);
+#define BANA_MAX_INSTANCES 2
+
+/* one protocol instance per host port, port is passed back to putc */
+typedef struct bana_ctx bana_ctx_t;
+typedef void (*bana_putc_func)(int port, uint8_t byte);
 
-void bana_init(bana_putc_func putc_func);
+bana_ctx_t *bana_init(bana_putc_func putc_func, int port);
 
-bool bana_feed(int c);
+/* return true if accepts a byte, false if rejects */
+bool bana_feed(bana_ctx_t *ctx, int c);
 
-/* if bana is currently active */
+/* if this instance is currently active */
+bool bana_ctx_is_active(const bana_ctx_t *ctx);
+/* if any instance is currently active */
 bool bana_is_active();
 
-void bana_dtr_off();
+void bana_dtr_off(bana_ctx_t *ctx);
 
-const char *bana_get_led_pattern();
+/* LED command from the host, -1 if there isn't a new one */
+int bana_get_led_cmd(bana_ctx_t *ctx);
 
 #endif
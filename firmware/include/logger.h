@@ -0,0 +1,62 @@
+/*
+ * Deferred Binary Logger
+ * WHowe <github.com/whowechina>
+ *
+ * Log calls only store the format pointer and up to LOG_MAX_ARGS 32-bit
+ * arguments in a RAM ring, formatting and output are done later by
+ * logger_flush() from idle time. Format strings must be literals and
+ * "%s" arguments must point to constant strings, since they're read
+ * after the call returns. 64-bit arguments are not supported.
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARN 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_DEBUG 3
+
+/* records above this level are compiled out */
+#ifndef LOG_LEVEL_MAX
+#define LOG_LEVEL_MAX LOG_LEVEL_DEBUG
+#endif
+
+#define LOG_MAX_ARGS 6
+
+extern uint8_t logger_level;
+
+void logger_init();
+void logger_write(uint8_t level, const char *fmt, const uint32_t *args, int argc);
+void logger_hex(uint8_t level, const uint8_t *data, int len);
+
+void logger_set_level(uint8_t level);
+void logger_flush(uint32_t budget_us); // at least one record, then until budget is used
+uint32_t logger_dropped();
+
+#define LOG_ARGS(...) ((const uint32_t[]){ 0, ##__VA_ARGS__ })
+#define LOG_ARGC(...) (sizeof(LOG_ARGS(__VA_ARGS__)) / sizeof(uint32_t) - 1)
+
+#define LOG(level, fmt, ...) do { \
+    _Static_assert(LOG_ARGC(__VA_ARGS__) <= LOG_MAX_ARGS, "Too many log args"); \
+    if (((level) <= LOG_LEVEL_MAX) && ((level) <= logger_level)) { \
+        logger_write(level, fmt, LOG_ARGS(__VA_ARGS__) + 1, LOG_ARGC(__VA_ARGS__)); \
+    } \
+} while (0)
+
+#define LOG_HEX(level, data, len) do { \
+    if (((level) <= LOG_LEVEL_MAX) && ((level) <= logger_level)) { \
+        logger_hex(level, data, len); \
+    } \
+} while (0)
+
+#define LOG_ERROR(...) LOG(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(...) LOG(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(...) LOG(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+#endif
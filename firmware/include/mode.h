@@ -7,6 +7,7 @@
 #define MODE_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 typedef enum {
     MODE_AUTO = 0,
@@ -16,7 +17,17 @@ typedef enum {
     MODE_NONE = 0xff,
 } reader_mode_t;
 
-reader_mode_t mode_detect(const uint8_t *data, uint32_t len, uint32_t baudrate);
+/* Streaming detection: feed bytes one by one, it returns the winning mode
+ * once a candidate parser completes a checksum-valid frame. The bytes of
+ * that frame (and anything after it) can then be replayed to the parser. */
+#define MODE_MAX_DETECTORS 2
+typedef struct mode_detector mode_detector_t;
+
+mode_detector_t *mode_detect_init();
+void mode_detect_reset(mode_detector_t *d);
+reader_mode_t mode_detect_feed(mode_detector_t *d, uint8_t c, uint32_t baudrate);
+const uint8_t *mode_detect_replay(mode_detector_t *d, size_t *len);
+
 const char *mode_name(reader_mode_t mode);
 
 #endif
@@ -0,0 +1,144 @@
+/*
+ * RGB565 Row Blending Kernels
+ * WHowe <github.com/whowechina>
+ *
+ * A pixel is spread into a 32-bit word as 00000gggggg00000rrrrr000000bbbbb
+ * so a single multiply blends all three channels, alpha is 0..32.
+ * No clipping here, callers pass rows already clipped.
+ */
+
+#ifndef BLEND_H
+#define BLEND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define BLEND_MASK 0x07e0f81f
+
+static inline uint32_t blend_spread(uint16_t c)
+{
+    return (c | (c << 16)) & BLEND_MASK;
+}
+
+static inline uint16_t blend_pack(uint32_t s)
+{
+    return s | (s >> 16);
+}
+
+/* mix of bits depth to 0..32 */
+static inline uint32_t blend_alpha(uint8_t mix, uint8_t bits)
+{
+    return ((uint32_t)mix * 32 + (1 << (bits - 1))) >> bits;
+}
+
+static inline uint16_t blend_spread_mix(uint16_t bg, uint32_t fg, uint32_t alpha)
+{
+    uint32_t b = blend_spread(bg);
+    return blend_pack(((((fg - b) * alpha) >> 5) + b) & BLEND_MASK);
+}
+
+static inline uint16_t blend_mix(uint16_t bg, uint16_t fg, uint8_t mix, uint8_t bits)
+{
+    return blend_spread_mix(bg, blend_spread(fg), blend_alpha(mix, bits));
+}
+
+/* 16-bit memset, word stores for the aligned part */
+static inline void blend_fill(uint16_t *dst, uint16_t color, int count)
+{
+    if ((count > 0) && ((uintptr_t)dst & 2)) {
+        *dst++ = color;
+        count--;
+    }
+
+    uint32_t c32 = (color << 16) | color;
+    uint32_t *dst32 = (uint32_t *)dst;
+    for (; count >= 2; count -= 2) {
+        *dst32++ = c32;
+    }
+
+    if (count) {
+        *(uint16_t *)dst32 = color;
+    }
+}
+
+/* one color, one mix, two pixels per word */
+static inline void blend_row_const(uint16_t *dst, int count, uint16_t color,
+                                   uint8_t mix, uint8_t bits)
+{
+    if (mix == 0) {
+        return;
+    }
+    if (mix == (1 << bits) - 1) {
+        blend_fill(dst, color, count);
+        return;
+    }
+
+    uint32_t fg = blend_spread(color);
+    uint32_t alpha = blend_alpha(mix, bits);
+
+    if ((count > 0) && ((uintptr_t)dst & 2)) {
+        *dst = blend_spread_mix(*dst, fg, alpha);
+        dst++;
+        count--;
+    }
+
+    uint32_t *dst32 = (uint32_t *)dst;
+    for (; count >= 2; count -= 2) {
+        uint32_t pair = *dst32;
+        uint16_t lo = blend_spread_mix(pair & 0xffff, fg, alpha);
+        uint16_t hi = blend_spread_mix(pair >> 16, fg, alpha);
+        *dst32++ = (hi << 16) | lo;
+    }
+
+    if (count) {
+        uint16_t *last = (uint16_t *)dst32;
+        *last = blend_spread_mix(*last, fg, alpha);
+    }
+}
+
+/* one color, mix per pixel (glyphs), transparent and opaque skip the math */
+static inline void blend_row_alpha(uint16_t *dst, int count, uint16_t color,
+                                   const uint8_t *mix, uint8_t bits)
+{
+    uint32_t fg = blend_spread(color);
+    uint8_t opaque = (1 << bits) - 1;
+
+    for (int i = 0; i < count; i++) {
+        uint8_t m = mix[i];
+        if (m == 0) {
+            continue;
+        }
+        if (m == opaque) {
+            dst[i] = color;
+        } else {
+            dst[i] = blend_spread_mix(dst[i], fg, blend_alpha(m, bits));
+        }
+    }
+}
+
+/* color and mix per pixel (images), no mix means opaque */
+static inline void blend_row_pixels(uint16_t *dst, int count, const uint16_t *src,
+                                    const uint8_t *mix, uint8_t bits)
+{
+    if (!mix) {
+        for (int i = 0; i < count; i++) {
+            dst[i] = src[i];
+        }
+        return;
+    }
+
+    uint8_t opaque = (1 << bits) - 1;
+    for (int i = 0; i < count; i++) {
+        uint8_t m = mix[i];
+        if (m == 0) {
+            continue;
+        }
+        if (m == opaque) {
+            dst[i] = src[i];
+        } else {
+            dst[i] = blend_spread_mix(dst[i], blend_spread(src[i]), blend_alpha(m, bits));
+        }
+    }
+}
+
+#endif
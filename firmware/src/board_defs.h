@@ -20,6 +20,7 @@
 
 #define RGB_PIN 12
 #define RGB_ORDER GRB // or RGB
+#define RGB_NUM 64 // most WS2812 the strip port drives, buffers are sized to it
 #define LED_DEF { 25, 22, 13, 15 }
 
 #define KEYPAD_DEF { 6, 7, 8, 3, 4, 5, 0, 1, 2, 9, 10, 11 }
@@ -0,0 +1,182 @@
+/*
+ * CardIO HID Reporting
+ * WHowe <github.com/whowechina>
+ *
+ * Card transitions are queued as they happen and reported as soon as
+ * the HID endpoint is ready, removals are debounced.
+ */
+
+#include "cardio.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "tusb.h"
+#include "usb_descriptors.h"
+
+#include "config.h"
+#include "logger.h"
+
+#define CARDIO_QUEUE_SIZE 8
+
+typedef struct {
+    uint8_t report[9]; // report id + 8 bytes of id
+    uint64_t time; // when the transition was seen
+} cardio_event_t;
+
+static struct {
+    cardio_event_t events[CARDIO_QUEUE_SIZE];
+    int head;
+    int count;
+} queue;
+
+static uint8_t current[9];
+
+static struct {
+    bool pending;
+    uint64_t time;
+} removal;
+
+static uint64_t report_time;
+
+static struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t dropped;
+} latency;
+
+static void enqueue(const uint8_t report[9], uint64_t time)
+{
+    memcpy(current, report, 9);
+
+    if (queue.count == CARDIO_QUEUE_SIZE) {
+        /* keep the final state, the oldest pending transition goes */
+        queue.head = (queue.head + 1) % CARDIO_QUEUE_SIZE;
+        queue.count--;
+        latency.dropped++;
+    }
+
+    int tail = (queue.head + queue.count) % CARDIO_QUEUE_SIZE;
+    memcpy(queue.events[tail].report, report, 9);
+    queue.events[tail].time = time;
+    queue.count++;
+}
+
+static void enqueue_removal(uint64_t time)
+{
+    uint8_t report[9] = { current[0] }; // same report id, empty id
+    removal.pending = false;
+    enqueue(report, time);
+}
+
+static bool is_removal(const uint8_t report[9])
+{
+    static const uint8_t empty[8] = { 0 };
+    return memcmp(report + 1, empty, 8) == 0;
+}
+
+void cardio_update(const nfc_card_t *card)
+{
+    uint8_t report[9] = { 0 };
+
+    switch (card->card_type) {
+        case NFC_CARD_MIFARE:
+            report[0] = REPORT_ID_EAMU;
+            report[1] = 0xe0;
+            report[2] = 0x04;
+            if (card->len == 4) {
+                memcpy(report + 3, card->uid, 4);
+                memcpy(report + 7, card->uid, 2);
+            } else if (card->len == 7) {
+                memcpy(report + 3, card->uid + 1, 6);
+            }
+            break;
+        case NFC_CARD_FELICA:
+            report[0] = REPORT_ID_FELICA;
+            memcpy(report + 1, card->uid, 8);
+            break;
+        case NFC_CARD_VICINITY:
+            report[0] = REPORT_ID_EAMU;
+            memcpy(report + 1, card->uid, 8);
+            break;
+        default:
+            if (!is_removal(current) && !removal.pending) {
+                removal.pending = true;
+                removal.time = time_us_64();
+            }
+            return;
+    }
+
+    removal.pending = false;
+
+    if (memcmp(report, current, 9) == 0) {
+        return; // card came back within debounce time
+    }
+
+    enqueue(report, time_us_64());
+
+    LOG_INFO(" -> CardIO");
+    LOG_HEX(LOG_LEVEL_INFO, report + 1, 8);
+}
+
+/* reader protocol takes over, card goes away without debouncing */
+void cardio_clear()
+{
+    if (!is_removal(current)) {
+        enqueue_removal(time_us_64());
+    }
+}
+
+void cardio_report()
+{
+    uint64_t now = time_us_64();
+
+    if (removal.pending &&
+        (now - removal.time >= aic_cfg->cardio.debounce_ms * 1000ULL)) {
+        enqueue_removal(removal.time);
+    }
+
+    if (queue.count == 0) {
+        return;
+    }
+
+    if (!tud_hid_n_ready(0) ||
+        (now - report_time < aic_cfg->cardio.interval_ms * 1000ULL)) {
+        return;
+    }
+
+    cardio_event_t *event = &queue.events[queue.head];
+    if (!tud_hid_n_report(0, event->report[0], event->report + 1, 8)) {
+        return;
+    }
+
+    report_time = now;
+
+    uint32_t delay = now - event->time;
+    latency.count++;
+    latency.last_us = delay;
+    latency.sum_us += delay;
+    if (delay > latency.max_us) {
+        latency.max_us = delay;
+    }
+
+    queue.head = (queue.head + 1) % CARDIO_QUEUE_SIZE;
+    queue.count--;
+}
+
+cardio_stat_t cardio_get_stat()
+{
+    return (cardio_stat_t) {
+        .count = latency.count,
+        .last_us = latency.last_us,
+        .max_us = latency.max_us,
+        .avg_us = latency.count ? latency.sum_us / latency.count : 0,
+        .dropped = latency.dropped,
+    };
+}
@@ -0,0 +1,28 @@
+/*
+ * CardIO HID Reporting
+ * WHowe <github.com/whowechina>
+ */
+
+#ifndef CARDIO_H
+#define CARDIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "nfc.h"
+
+typedef struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint32_t avg_us;
+    uint32_t dropped;
+} cardio_stat_t;
+
+void cardio_update(const nfc_card_t *card);
+void cardio_clear();
+void cardio_report();
+
+cardio_stat_t cardio_get_stat();
+
+#endif
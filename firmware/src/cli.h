@@ -13,6 +13,7 @@ void cli_init(const char *prompt, const char *logo);
 void cli_register(const char *cmd, cmd_handler_t handler, const char *help);
 void cli_run();
 void cli_fps_count(int core);
+void cli_fps_detail(void (*detail)()); // extra lines for "fps" command
 
 int cli_extract_non_neg_int(const char *param, int len);
 int cli_match_prefix(const char *str[], int num, const char *prefix);
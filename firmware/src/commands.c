@@ -7,11 +7,17 @@
 #include "pico/stdio.h"
 #include "pico/stdlib.h"
 
+#include "board_defs.h"
 #include "config.h"
 #include "save.h"
 #include "cli.h"
 
 #include "keypad.h"
+#include "light.h"
+#include "st7789.h"
+#include "gui.h"
+#include "cardio.h"
+#include "logger.h"
 
 #include "aime.h"
 #include "bana.h"
@@ -46,16 +52,33 @@ static void display_nfc()
 static void display_light()
 {
     printf("[Light]\n");
-    printf("    RGB-%s, LED-%s\n",
+    printf("    RGB-%s, LED-%s, Dither-%s\n",
             aic_cfg->light.rgb ? "ON" : "OFF",
-            aic_cfg->light.led ? "ON" : "OFF");
+            aic_cfg->light.led ? "ON" : "OFF",
+            aic_cfg->light.dither ? "ON" : "OFF");
     printf("    Level: Idle-%d, Active-%d\n", aic_cfg->light.level_idle, aic_cfg->light.level_active);
+    printf("    Strip: %d of %d LEDs\n", aic_cfg->light.rgb_num, RGB_NUM);
+    light_stat_t stat = light_get_stat();
+    printf("    Refresh: %ld ticks, %ld skipped, %ld held back\n",
+           stat.count, stat.skipped, stat.busy);
+    printf("    Jitter: last %ldus, avg %ldus, max %ldus\n",
+           stat.jitter_last_us, stat.jitter_avg_us, stat.jitter_max_us);
+    printf("    Render: avg %ldus, max %ldus\n", stat.render_avg_us, stat.render_max_us);
 }
 
 static void display_lcd()
 {
     printf("[LCD]\n");
-    printf("    Backlight: %d\n", aic_cfg->lcd.backlight);
+    printf("    Backlight: %d, Target FPS: %d\n", aic_cfg->lcd.backlight, aic_cfg->lcd.fps);
+    if (aic_runtime.touch) {
+        st7789_stat_t stat = st7789_get_stat();
+        printf("    Flush: %ld bytes in %ld windows, avg %ld bytes/frame\n",
+               stat.last_bytes, stat.last_rects, stat.avg_bytes);
+        gui_touch_stat_t touch = gui_get_touch_stat();
+        printf("    Touch keys: %ld, Dropped samples: %ld\n", touch.count, touch.dropped);
+        printf("    Touch to HID: last %ldus, avg %ldus, max %ldus\n",
+               touch.last_us, touch.avg_us, touch.max_us);
+    }
 }
 
 static void display_reader()
@@ -63,12 +86,54 @@ static void display_reader()
     printf("[Reader]\n");
     printf("    Virtual AIC: %s\n", aic_cfg->reader.virtual_aic ? "ON" : "OFF");
     printf("    Mode: %s\n", mode_name(aic_cfg->reader.mode));
-    if (aic_cfg->reader.mode == MODE_AUTO) {
-        printf("    Detected: %s\n", mode_name(aic_runtime.mode));
+    for (int i = 0; i < READER_PORT_NUM; i++) {
+        reader_mode_t mode = aic_runtime.mode[i];
+        if (aic_cfg->reader.mode == MODE_AUTO) {
+            printf("    Port %d Detected: %s\n", i + 1, mode_name(mode));
+        }
+        if ((mode == MODE_AIME0) || (mode == MODE_AIME1)) {
+            printf("    Port %d AIME Pattern: %s\n", i + 1,
+                   aime_get_mode_string(mode == MODE_AIME0 ? 0 : 1));
+        }
     }
-    if ((aic_runtime.mode == MODE_AIME0) || (aic_runtime.mode == MODE_AIME1)) {
-        printf("    AIME Pattern: %s\n", aime_get_mode_string());
+}
+
+static void fps_detail()
+{
+    if (!aic_runtime.touch) {
+        return;
     }
+    gui_stat_t stat = gui_get_stat();
+    printf("GUI: %d/%d fps, %ld dropped\n", stat.fps, stat.target_fps, stat.dropped);
+    printf("    Render: avg %ldus, max %ldus\n", stat.render_avg, stat.render_max);
+    printf("    Flush wait: avg %ldus, max %ldus\n", stat.flush_avg, stat.flush_max);
+    printf("    Idle: avg %ldus\n", stat.idle_avg);
+}
+
+static void display_cardio()
+{
+    printf("[CardIO]\n");
+    printf("    Interval: %dms, Debounce: %dms\n",
+           aic_cfg->cardio.interval_ms, aic_cfg->cardio.debounce_ms);
+    cardio_stat_t stat = cardio_get_stat();
+    printf("    Reports: %ld, Dropped: %ld\n", stat.count, stat.dropped);
+    printf("    Latency: last %ldus, avg %ldus, max %ldus\n",
+           stat.last_us, stat.avg_us, stat.max_us);
+}
+
+static void display_flash()
+{
+    static const char *buckets[SAVE_STALL_BUCKETS] = {
+        "<1ms", "<2ms", "<5ms", "<10ms", "<20ms", "<50ms", "<100ms", "more"
+    };
+    printf("[Flash]\n");
+    save_stat_t stat = save_get_stat();
+    printf("    Stalls: %ld, last %ldus, max %ldus\n", stat.count, stat.last_us, stat.max_us);
+    printf("   ");
+    for (int i = 0; i < SAVE_STALL_BUCKETS; i++) {
+        printf(" %s %ld", buckets[i], stat.hist[i]);
+    }
+    printf("\n");
 }
 
 static void display_warning()
@@ -76,6 +141,9 @@ static void display_warning()
     if (keypad_is_stuck()) {
         printf("\nWarning: Keypad disabled due to key STUCK!\n");
     }
+    if (keypad_dropped_events() > 0) {
+        printf("\nWarning: %ld keypad events dropped.\n", keypad_dropped_events());
+    }
 }
 
 static void handle_display()
@@ -84,6 +152,8 @@ static void handle_display()
     display_light();
     display_lcd();
     display_reader();
+    display_cardio();
+    display_flash();
     display_warning();
 }
 
@@ -169,21 +239,85 @@ static void handle_mode(int argc, char *argv[])
     }
 
     aic_cfg->reader.mode = newmode;
-    aic_runtime.mode = (newmode == MODE_AUTO) ? MODE_NONE : newmode;
+    for (int i = 0; i < READER_PORT_NUM; i++) {
+        aic_runtime.mode[i] = (newmode == MODE_AUTO) ? MODE_NONE : newmode;
+    }
     config_changed();
     display_reader();
 }
 
+static bool light_fade_cli(int argc, char *argv[])
+{
+    char pattern[128];
+    int len = 0;
+    for (int i = 0; i < argc; i++) {
+        int n = snprintf(pattern + len, sizeof(pattern) - len, "%s, ", argv[i]);
+        if ((n < 0) || (n >= (int)sizeof(pattern) - len)) {
+            return false;
+        }
+        len += n;
+    }
+    light_fade_s(pattern);
+    return true;
+}
+
 static void handle_light(int argc, char *argv[])
 {
-    const char *usage = "Usage: light <rgb|led|both|off>\n";
-    if (argc != 1) {
+    const char *usage = "Usage: light <rgb|led|both|off>\n"
+                        "       light fade <repeat> <#rrggbb> <ms> [<#rrggbb> <ms>]\n"
+                        "       light pattern <id>\n"
+                        "       light idle\n"
+                        "       light dither <on|off>\n"
+                        "       light count <num>\n"
+                        "    repeat: -1 is endless\n"
+                        "    id: Bana LED command, like 0x04\n";
+    if (argc < 1) {
+        printf("%s", usage);
+        return;
+    }
+
+    const char *commands[] = { "rgb", "led", "both", "off", "fade", "pattern", "idle",
+                               "dither", "count" };
+    int match = cli_match_prefix(commands, 9, argv[0]);
+    if ((match == 4) && (argc >= 4) && (argc % 2 == 0)) {
+        if (!light_fade_cli(argc - 1, argv + 1)) {
+            printf("Pattern too long.\n");
+        }
+        return;
+    } else if ((match == 5) && (argc == 2)) {
+        if (!light_fade_pattern(strtol(argv[1], NULL, 0))) {
+            printf("No such pattern.\n");
+        }
+        return;
+    } else if ((match == 6) && (argc == 1)) {
+        light_release(LIGHT_LAYER_READER, 1000);
+        return;
+    } else if ((match == 7) && (argc == 2)) {
+        const char *on_off[] = { "on", "off" };
+        int on = cli_match_prefix(on_off, 2, argv[1]);
+        if (on < 0) {
+            printf("%s", usage);
+            return;
+        }
+        aic_cfg->light.dither = (on == 0);
+        config_changed();
+        display_light();
+        return;
+    } else if ((match == 8) && (argc == 2)) {
+        int num = cli_extract_non_neg_int(argv[1], 0);
+        if ((num < 1) || (num > RGB_NUM)) {
+            printf("Count must be [1..%d].\n", RGB_NUM);
+            return;
+        }
+        light_set_rgb_num(num);
+        config_changed();
+        display_light();
+        return;
+    } else if (argc != 1) {
         printf("%s", usage);
         return;
     }
 
-    const char *commands[] = { "rgb", "led", "both", "off" };
-    int match = cli_match_prefix(commands, 4, argv[0]);
     switch (match) {
         case 0:
             aic_cfg->light.rgb = true;
@@ -235,9 +369,10 @@ static void handle_level(int argc, char *argv[])
 
 static void handle_lcd(int argc, char *argv[])
 {
-    const char *usage = "Usage: lcd <backlight>\n"
-                        "    backlight: [0..255]\n";
-    if (argc != 1) {
+    const char *usage = "Usage: lcd <backlight> [fps]\n"
+                        "    backlight: [0..255]\n"
+                        "          fps: [10..60], target frame rate\n";
+    if ((argc < 1) || (argc > 2)) {
         printf(usage);
         return;
     }
@@ -248,7 +383,17 @@ static void handle_lcd(int argc, char *argv[])
         return;
     }
 
+    int fps = aic_cfg->lcd.fps;
+    if (argc == 2) {
+        fps = cli_extract_non_neg_int(argv[1], 0);
+        if ((fps < 10) || (fps > 60)) {
+            printf(usage);
+            return;
+        }
+    }
+
     aic_cfg->lcd.backlight = backlight;
+    aic_cfg->lcd.fps = fps;
     config_changed();
     display_lcd();
 }
@@ -272,15 +417,41 @@ static void handle_pn5180_tweak(int argc, char *argv[])
     config_changed();
 }
 
+static void handle_cardio(int argc, char *argv[])
+{
+    const char *usage = "Usage: cardio <interval> <debounce>\n"
+                        "    interval: min report interval [0..1000] ms\n"
+                        "    debounce: card removal debounce [0..1000] ms\n";
+    if (argc != 2) {
+        printf(usage);
+        return;
+    }
+
+    int interval = cli_extract_non_neg_int(argv[0], 0);
+    int debounce = cli_extract_non_neg_int(argv[1], 0);
+    if ((interval < 0) || (interval > 1000) ||
+        (debounce < 0) || (debounce > 1000)) {
+        printf(usage);
+        return;
+    }
+
+    aic_cfg->cardio.interval_ms = interval;
+    aic_cfg->cardio.debounce_ms = debounce;
+    config_changed();
+    display_cardio();
+}
+
 static void handle_debug()
 {
     aic_runtime.debug = !aic_runtime.debug;
     nfc_runtime.debug = aic_runtime.debug;
+    logger_set_level(aic_runtime.debug ? LOG_LEVEL_DEBUG : LOG_LEVEL_INFO);
     printf("Debug: %s\n", aic_runtime.debug ? "ON" : "OFF");
 }
 
 void commands_init()
 {
+    cli_fps_detail(fps_detail);
     cli_register("display", handle_display, "Display all settings.");
     cli_register("save", handle_save, "Save config to flash.");
     cli_register("factory", handle_factory_reset, "Reset everything to default.");
@@ -291,5 +462,6 @@ void commands_init()
     cli_register("level", handle_level, "Set light level.");
     cli_register("lcd", handle_lcd, "Touch LCD settings.");
     cli_register("pn5180_tweak", handle_pn5180_tweak, "PN5180 TX tweak.");
+    cli_register("cardio", handle_cardio, "CardIO report timing.");
     cli_register("debug", handle_debug, "Toggle debug.");
 }
@@ -9,26 +9,90 @@
 #include "config.h"
 #include "save.h"
 #include "mode.h"
+#include "board_defs.h"
 
 aic_cfg_t *aic_cfg;
 
 static aic_cfg_t default_cfg = {
-    .light = { .level_idle = 24, .level_active = 128, .rgb = true, .led = true },
+    .light = { .level_idle = 24, .level_active = 128, .rgb = true, .led = true,
+               .dither = true, .rgb_num = RGB_NUM },
     .reader = { .virtual_aic = true, .mode = MODE_AUTO },
-    .lcd = { .backlight = 200, },
+    .lcd = { .backlight = 200, .fps = 50, },
     .tweak = { .pn5180_tx = false },
+    .cardio = { .interval_ms = 20, .debounce_ms = 100 },
+    .version = CONFIG_VERSION,
 };
 
 aic_runtime_t aic_runtime;
 
+/* layout of the configs saved before the version field was added */
+typedef struct __attribute__((packed)) {
+    struct {
+        uint8_t level_idle;
+        uint8_t level_active;
+        bool rgb;
+        bool led;
+    } light;
+    struct {
+        bool virtual_aic;
+        uint8_t mode;
+    } reader;
+    struct {
+        uint8_t backlight;
+    } lcd;
+    struct {
+        bool pn5180_tx;
+    } tweak;
+    uint32_t reserved;
+} aic_cfg_v0_t;
+
+static void config_migrate()
+{
+    aic_cfg_v0_t old = *(aic_cfg_v0_t *)aic_cfg;
+
+    aic_cfg->light.level_idle = old.light.level_idle;
+    aic_cfg->light.level_active = old.light.level_active;
+    aic_cfg->light.rgb = old.light.rgb;
+    aic_cfg->light.led = old.light.led;
+    aic_cfg->reader.virtual_aic = old.reader.virtual_aic;
+    aic_cfg->reader.mode = old.reader.mode;
+    aic_cfg->lcd.backlight = old.lcd.backlight;
+    aic_cfg->tweak.pn5180_tx = old.tweak.pn5180_tx;
+
+    /* fields added since then have nothing saved */
+    aic_cfg->cardio = default_cfg.cardio;
+    aic_cfg->lcd.fps = default_cfg.lcd.fps;
+    aic_cfg->light.dither = default_cfg.light.dither;
+    aic_cfg->light.rgb_num = default_cfg.light.rgb_num;
+
+    aic_cfg->version = CONFIG_VERSION;
+}
+
 static void config_loaded()
 {
+    if (aic_cfg->version != CONFIG_VERSION) {
+        config_migrate();
+        config_changed();
+    }
     if ((aic_cfg->reader.mode != MODE_AIME0) &&
         (aic_cfg->reader.mode != MODE_AIME1) &&
         (aic_cfg->reader.mode != MODE_BANA)) {
         aic_cfg->reader.mode = MODE_AUTO;
         config_changed();
     }
+    if ((aic_cfg->light.rgb_num < 1) || (aic_cfg->light.rgb_num > RGB_NUM)) {
+        aic_cfg->light.rgb_num = default_cfg.light.rgb_num;
+        config_changed();
+    }
+    if ((aic_cfg->lcd.fps < 10) || (aic_cfg->lcd.fps > 60)) {
+        aic_cfg->lcd.fps = default_cfg.lcd.fps;
+        config_changed();
+    }
+    if ((aic_cfg->cardio.interval_ms > 1000) ||
+        (aic_cfg->cardio.debounce_ms > 1000)) {
+        aic_cfg->cardio = default_cfg.cardio;
+        config_changed();
+    }
 }
 
 void config_changed()
@@ -17,6 +17,8 @@ typedef struct __attribute__((packed)) {
         uint8_t level_active;
         bool rgb;
         bool led;
+        bool dither; // temporal dithering on the strip
+        uint8_t rgb_num; // WS2812 actually fitted, [1..RGB_NUM]
     } light;
     struct {
         bool virtual_aic;
@@ -24,17 +26,28 @@ typedef struct __attribute__((packed)) {
     } reader;
     struct {
         uint8_t backlight;
+        uint8_t fps; // target frame rate, [10..60]
     } lcd;
     struct {
         bool pn5180_tx;
     } tweak;
+    struct {
+        uint16_t interval_ms; // minimum time between two reports
+        uint16_t debounce_ms; // card removal debounce
+    } cardio;
+    uint8_t version; // layout version, 0 for configs saved before it existed
     uint32_t reserved;
 } aic_cfg_t;
 
+#define CONFIG_VERSION 1
+
+/* Reader CDC ports, each runs its own protocol */
+#define READER_PORT_NUM 2
+
 typedef volatile struct {
     bool debug;
     bool touch;
-    reader_mode_t mode;
+    reader_mode_t mode[READER_PORT_NUM];
 } aic_runtime_t;
 
 extern aic_cfg_t *aic_cfg;
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "hardware/gpio.h"
 #include "hardware/i2c.h"
@@ -81,13 +82,78 @@ static struct {
     uint16_t y;
 } reading;
 
+/* Samples are pushed from the INT interrupt and consumed by cst816t_read(),
+   one producer and one consumer, so free running indexes are enough */
+static struct {
+    cst816t_sample_t buf[CST816T_QUEUE_SIZE];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t dropped;
+} queue;
+
+static void queue_push(const cst816t_sample_t *sample)
+{
+    uint32_t head = queue.head;
+    if (head - queue.tail < CST816T_QUEUE_SIZE) {
+        queue.buf[head % CST816T_QUEUE_SIZE] = *sample;
+        queue.head = head + 1;
+        return;
+    }
+
+    /* full, the newest sample gives way if it's just a move, so presses
+       and releases are kept and only the path gets coarser */
+    cst816t_sample_t *newest = &queue.buf[(head - 1) % CST816T_QUEUE_SIZE];
+    const cst816t_sample_t *before = &queue.buf[(head - 2) % CST816T_QUEUE_SIZE];
+    if (newest->touched && before->touched) {
+        *newest = *sample;
+    } else {
+        queue.dropped++;
+    }
+}
+
 void cst816t_update()
 {
     uint8_t buf[6];
+    uint32_t now = time_us_32();
     cst816t_read_reg_n(0x01, buf, 6);
-    reading.touched = buf[1];
-    reading.x = ((buf[2] & 0x0f) << 8) | buf[3];
-    reading.y = ((buf[4] & 0x0f) << 8) | buf[5];
+
+    bool touched = buf[1];
+    uint16_t x = ((buf[2] & 0x0f) << 8) | buf[3];
+    uint16_t y = ((buf[4] & 0x0f) << 8) | buf[5];
+
+    /* INT keeps pulsing while a finger rests, only changes are queued */
+    if ((touched == reading.touched) && (x == reading.x) && (y == reading.y)) {
+        return;
+    }
+
+    reading.touched = touched;
+    reading.x = x;
+    reading.y = y;
+
+    queue_push(&(cst816t_sample_t) { now, touched, x, y });
+}
+
+uint32_t cst816t_dropped()
+{
+    return queue.dropped;
+}
+
+static void map_xy(uint16_t raw_x, uint16_t raw_y, uint16_t *out_x, uint16_t *out_y)
+{
+    int x = (raw_x - ctx.x1) * ctx.width / (ctx.x2 - ctx.x1);
+    int y = (raw_y - ctx.y1) * ctx.height / (ctx.y2 - ctx.y1);
+    if (x < 0) {
+        x = 0;
+    } else if (x >= ctx.width) {
+        x = ctx.width - 1;
+    }
+    if (y < 0) {
+        y = 0;
+    } else if (y >= ctx.height) {
+        y = ctx.height - 1;
+    }
+    *out_x = x;
+    *out_y = y;
 }
 
 cst816t_raw_t cst816t_read_raw()
@@ -107,21 +173,7 @@ cst816t_raw_t cst816t_read_raw()
         return raw;
     }
 
-    int x = (raw.raw_x - ctx.x1) * ctx.width / (ctx.x2 - ctx.x1);
-    int y = (raw.raw_y - ctx.y1) * ctx.height / (ctx.y2 - ctx.y1);
-    if (x < 0) {
-        x = 0;
-    } else if (x >= ctx.width) {
-        x = ctx.width - 1;
-    }
-    if (y < 0) {
-        y = 0;
-    } else if (y >= ctx.height) {
-        y = ctx.height - 1;
-    }
-
-    raw.x = x;
-    raw.y = y;
+    map_xy(raw.raw_x, raw.raw_y, &raw.x, &raw.y);
 
     raw.updated = true;
     old = raw;
@@ -129,55 +181,150 @@ cst816t_raw_t cst816t_read_raw()
     return raw;
 }
 
-cst816t_report_t cst816t_read()
+#define TAP_SLOP 10
+#define SLIDE_MIN 30
+#define FLICK_SPEED 400
+#define LONG_PRESS_US 400000
+#define HOLD_US 800000
+#define VELOCITY_WINDOW_US 100000
+#define TRAIL_SIZE 8
+
+static struct {
+    cst816t_report_t report;
+    uint32_t down_time;
+    bool moved;
+    bool held;
+    struct {
+        uint32_t time;
+        uint16_t x;
+        uint16_t y;
+    } trail[TRAIL_SIZE];
+    uint8_t trail_len;
+} rec;
+
+static void trail_add(uint32_t time, uint16_t x, uint16_t y)
+{
+    if (rec.trail_len == TRAIL_SIZE) {
+        memmove(rec.trail, rec.trail + 1, sizeof(rec.trail[0]) * (TRAIL_SIZE - 1));
+        rec.trail_len--;
+    }
+    rec.trail[rec.trail_len].time = time;
+    rec.trail[rec.trail_len].x = x;
+    rec.trail[rec.trail_len].y = y;
+    rec.trail_len++;
+}
+
+/* velocity over the last VELOCITY_WINDOW_US of the trail, in pixel/s */
+static void release_velocity(cst816t_report_t *report)
+{
+    report->vx = 0;
+    report->vy = 0;
+    for (int i = 0; i < rec.trail_len; i++) {
+        uint32_t dt = report->time - rec.trail[i].time;
+        if ((dt > 0) && (dt <= VELOCITY_WINDOW_US)) {
+            report->vx = (report->x - rec.trail[i].x) * 1000000 / (int32_t)dt;
+            report->vy = (report->y - rec.trail[i].y) * 1000000 / (int32_t)dt;
+            return;
+        }
+    }
+}
+
+static gesture_t release_gesture(const cst816t_report_t *report)
 {
-    cst816t_raw_t raw = cst816t_read_raw();
-
-    static struct {
-        cst816t_report_t old_report;
-        bool x_revert;
-        bool x_slide;
-        bool y_revert;
-        bool y_slide;
-    } ctx;
-
-    cst816t_report_t report = ctx.old_report;
-    report.updated = false;
-    if (report.gesture != GESTURE_NONE) {
-        report.gesture = GESTURE_NONE;
-        report.updated = true;
-    }
-
-    if (raw.updated) {
-        /* touch related changes */
-        report.x = raw.x;
-        report.y = raw.y;
-        report.touched = raw.touched;
-        if (!ctx.old_report.touched && report.touched) {
-            report.touch_x = report.x;
-            report.touch_y = report.y;
-        } else if (ctx.old_report.touched && !report.touched) {
-            report.release_x = report.x;
-            report.release_y = report.y;
-            int dx = report.release_x - report.touch_x;
-            int dy = report.release_y - report.touch_y;
-            if ((abs(dx) < 10) && (abs(dy) < 10)) {
-                report.gesture = GESTURE_TAP;
-            } else if (dx > 30) {
-                report.gesture = GESTURE_SLIDE_RIGHT;
-            } else if (dx < -30) {
-                report.gesture = GESTURE_SLIDE_LEFT;
-            }
+    if (!rec.moved) {
+        if (rec.held) {
+            return GESTURE_NONE;
         }
-        report.updated = true;
+        return report->duration < LONG_PRESS_US ? GESTURE_TAP : GESTURE_LONG_PRESS;
     }
 
-    if (0) {
-        /* timing */
-        report.updated = true;
+    int dx = report->release_x - report->touch_x;
+    int dy = report->release_y - report->touch_y;
+    if (abs(dx) >= abs(dy)) {
+        if ((abs(dx) > SLIDE_MIN) || (abs(report->vx) > FLICK_SPEED)) {
+            return dx > 0 ? GESTURE_SLIDE_RIGHT : GESTURE_SLIDE_LEFT;
+        }
+    } else {
+        if ((abs(dy) > SLIDE_MIN) || (abs(report->vy) > FLICK_SPEED)) {
+            return dy > 0 ? GESTURE_SLIDE_DOWN : GESTURE_SLIDE_UP;
+        }
     }
+    return GESTURE_NONE;
+}
+
+static void recognize(cst816t_report_t *report, const cst816t_sample_t *sample)
+{
+    bool was_touched = report->touched;
+
+    report->updated = true;
+    report->time = sample->time;
+    report->touched = sample->touched;
+    report->raw_x = sample->x;
+    report->raw_y = sample->y;
+    map_xy(sample->x, sample->y, &report->x, &report->y);
 
-    ctx.old_report = report;
+    if (!was_touched && report->touched) {
+        report->touch_x = report->x;
+        report->touch_y = report->y;
+        report->vx = 0;
+        report->vy = 0;
+        rec.down_time = sample->time;
+        rec.moved = false;
+        rec.held = false;
+        rec.trail_len = 0;
+    }
+
+    if (!was_touched && !report->touched) {
+        return;
+    }
+
+    report->duration = sample->time - rec.down_time;
+
+    if (report->touched) {
+        if ((abs(report->x - report->touch_x) >= TAP_SLOP) ||
+            (abs(report->y - report->touch_y) >= TAP_SLOP)) {
+            rec.moved = true;
+        }
+        trail_add(sample->time, report->x, report->y);
+        return;
+    }
+
+    report->release_x = report->x;
+    report->release_y = report->y;
+    release_velocity(report);
+    report->gesture = release_gesture(report);
+}
+
+/* Gestures are reported once, the next read clears it. At most one gesture
+   comes out per read, the remaining samples stay queued for the next one. */
+cst816t_report_t cst816t_read()
+{
+    cst816t_report_t *report = &rec.report;
+
+    report->updated = false;
+    if (report->gesture != GESTURE_NONE) {
+        report->gesture = GESTURE_NONE;
+        report->updated = true;
+    }
+
+    while ((report->gesture == GESTURE_NONE) && (queue.tail != queue.head)) {
+        uint32_t tail = queue.tail;
+        cst816t_sample_t sample = queue.buf[tail % CST816T_QUEUE_SIZE];
+        queue.tail = tail + 1;
+        recognize(report, &sample);
+    }
+
+    /* press-and-hold fires while the finger is still down */
+    if ((report->gesture == GESTURE_NONE) && report->touched && !rec.moved && !rec.held) {
+        uint32_t now = time_us_32();
+        if (now - rec.down_time >= HOLD_US) {
+            rec.held = true;
+            report->time = now;
+            report->duration = now - rec.down_time;
+            report->gesture = GESTURE_HOLD;
+            report->updated = true;
+        }
+    }
 
-    return report;
+    return *report;
 }
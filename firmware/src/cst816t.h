@@ -4,6 +4,9 @@
  * 
  */
 
+#ifndef CST816T_H
+#define CST816T_H
+
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -30,6 +33,8 @@ typedef enum {
     GESTURE_SLIDE_DOWN,
     GESTURE_SLIDE_LEFT,
     GESTURE_SLIDE_RIGHT,
+    GESTURE_LONG_PRESS,
+    GESTURE_HOLD,
 } gesture_t;
 
 typedef struct {
@@ -44,8 +49,26 @@ typedef struct {
     uint16_t release_y;
     uint16_t raw_x;
     uint16_t raw_y;
+    uint32_t time; // sample time (us) behind this report
+    uint32_t duration; // us since the touch started
+    int32_t vx; // release velocity, pixel/s
+    int32_t vy;
 } cst816t_report_t;
 
+#ifndef CST816T_QUEUE_SIZE
+#define CST816T_QUEUE_SIZE 16
+#endif
+
+typedef struct {
+    uint32_t time;
+    bool touched;
+    uint16_t x;
+    uint16_t y;
+} cst816t_sample_t;
+
 void cst816t_update();
+uint32_t cst816t_dropped();
 cst816t_raw_t cst816t_read_raw();
 cst816t_report_t cst816t_read();
+
+#endif
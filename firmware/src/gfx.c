@@ -1,21 +1,43 @@
 #include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "st7789.h"
 #include "rle.h"
 #include "gfx.h"
 
+/* rows are drawn in chunks of this many pixels */
+#define ROW_CHUNK 64
+
 void gfx_anima_draw(const anima_t *ani, int x, int y, int frame, const uint16_t pallete[16])
 {
     rle_decoder_t rle;
     rle_init(&rle, 
              &(rle_src_t){ ani->data + ani->index[frame % ani->frames], 
-                           RLE_RLE_X, 4, ani->size, 0x00 }
+                           ani->encoding, 4, ani->size, 0x00 }
             );
-                            
-    for (int j = 0; j < ani->height; j++) {
-        for (int i = 0; i < ani->width; i++) {
-            uint8_t value = rle_get_uint4(&rle);
-            st7789_pixel_raw(x + i, y + j, pallete[value]);
+
+    st7789_damage(x, y, ani->width, ani->height);
+    int bottom = st7789_band_bottom();
+
+    /* runs are written as spans, a run may cover several rows */
+    int i = 0;
+    int j = 0;
+    while ((j < ani->height) && (y + j < bottom)) {
+        uint8_t value;
+        uint32_t len = rle_get_run_uint4(&rle, &value);
+        if (len == 0) {
+            break;
+        }
+        while ((len > 0) && (j < ani->height)) {
+            int span = ani->width - i < len ? ani->width - i : len;
+            st7789_span_raw(x + i, y + j, span, pallete[value]);
+            i += span;
+            len -= span;
+            if (i == ani->width) {
+                i = 0;
+                j++;
+            }
         }
     }
 }
@@ -54,13 +76,177 @@ void gfx_anima_mix(const anima_t *ani, int x, int y, int frame, uint16_t color)
     rle_decoder_t rle;
     rle_init(&rle, 
              &(rle_src_t){ ani->data + ani->index[frame % ani->frames], 
-                           RLE_RLE_X, 4, ani->size, 0x00 }
+                           ani->encoding, 4, ani->size, 0x00 }
             );
 
-    for (int j = 0; j < ani->height; j++) {
-        for (int i = 0; i < ani->width; i++) {
-            uint8_t value = rle_get_uint4(&rle);
-            st7789_pixel(x + i, y + j, color, value, 4);
+    /* zero runs are transparent, only the position moves */
+    int pos = 0;
+    int total = ani->width * ani->height;
+    while (pos < total) {
+        uint8_t value;
+        uint32_t len = rle_get_run_uint4(&rle, &value);
+        if (len == 0) {
+            break;
+        }
+        if (value == 0) {
+            pos += len;
+            continue;
+        }
+        while ((len > 0) && (pos < total)) {
+            int i = pos % ani->width;
+            int span = ani->width - i < len ? ani->width - i : len;
+            st7789_span(x + i, y + pos / ani->width, span, color, value, 4);
+            pos += span;
+            len -= span;
+        }
+    }
+}
+
+static inline bool anima_is_delta(const anima_t *ani, int frame)
+{
+    return ani->delta_map && (ani->delta_map[frame / 8] & (1 << (frame % 8)));
+}
+
+/* x0 and x1 (exclusive) are in bytes */
+static inline void mark_dirty(anima_player_t *player, int row, int x0, int x1)
+{
+    int b0 = x0 * 2 / GFX_ANIMA_BLOCK;
+    int b1 = (x1 * 2 - 1) / GFX_ANIMA_BLOCK;
+    player->dirty[row] |= (0xffffffffu >> (31 - b1)) & (0xffffffffu << b0);
+}
+
+/* only bytes that really change are marked */
+static void player_decode_key(anima_player_t *player, int frame)
+{
+    const anima_t *ani = player->ani;
+    rle_decoder_t rle;
+    rle_init(&rle, &(rle_src_t){ ani->data + ani->index[frame],
+                                 ani->encoding, 4, ani->size, 0x00 });
+
+    int stride = ani->width / 2;
+    for (int i = 0; i < ani->height; i++) {
+        uint8_t *row = player->pixels + i * stride;
+        for (int j = 0; j < stride; j++) {
+            uint8_t value = rle_get_uint8(&rle);
+            if (row[j] != value) {
+                row[j] = value;
+                mark_dirty(player, i, j, j + 1);
+            }
+        }
+    }
+}
+
+/* spans of y, x, width (16 bit little endian) and 4bpp pixels, ends with y 0xffff */
+static void player_apply_delta(anima_player_t *player, int frame)
+{
+    const anima_t *ani = player->ani;
+    const uint8_t *data = ani->data + ani->index[frame];
+    int stride = ani->width / 2;
+
+    while (true) {
+        uint16_t y = data[0] | (data[1] << 8);
+        if (y == 0xffff) {
+            break;
+        }
+        uint16_t x = (data[2] | (data[3] << 8)) / 2;
+        uint16_t w = (data[4] | (data[5] << 8)) / 2;
+        memcpy(player->pixels + y * stride + x, data + 6, w);
+        mark_dirty(player, y, x, x + w);
+        data += 6 + w;
+    }
+}
+
+void gfx_anima_player_init(anima_player_t *player, const anima_t *ani, uint8_t *pixels)
+{
+    player->ani = ani;
+    player->pixels = pixels;
+    player->frame = -1;
+    memset(pixels, 0, ani->width * ani->height / 2);
+}
+
+void gfx_anima_player_update(anima_player_t *player, int frame, const uint16_t pallete[16])
+{
+    const anima_t *ani = player->ani;
+    memset(player->dirty, 0, sizeof(player->dirty));
+
+    player->repaint = (player->frame < 0) ||
+                      (memcmp(player->pallete, pallete, sizeof(player->pallete)) != 0);
+    memcpy(player->pallete, pallete, sizeof(player->pallete));
+
+    frame %= ani->frames;
+    if (frame == player->frame) {
+        return;
+    }
+
+    /* keep going from current frame if no keyframe is in between */
+    int start = frame;
+    while ((start > 0) && anima_is_delta(ani, start)) {
+        start--;
+    }
+    if ((player->frame >= start) && (player->frame < frame)) {
+        start = player->frame + 1;
+    } else {
+        player_decode_key(player, start);
+        start++;
+    }
+
+    for (int i = start; i <= frame; i++) {
+        player_apply_delta(player, i);
+    }
+    player->frame = frame;
+}
+
+void gfx_anima_player_damage(anima_player_t *player, int x, int y, int w, int h)
+{
+    const anima_t *ani = player->ani;
+    int x0 = x < 0 ? 0 : x / 2;
+    int x1 = x + w > ani->width ? ani->width / 2 : (x + w + 1) / 2;
+    int y0 = y < 0 ? 0 : y;
+    int y1 = y + h > ani->height ? ani->height : y + h;
+    for (int i = y0; (i < y1) && (x0 < x1); i++) {
+        mark_dirty(player, i, x0, x1);
+    }
+}
+
+void gfx_anima_player_draw(const anima_player_t *player, int x, int y)
+{
+    const anima_t *ani = player->ani;
+    int stride = ani->width / 2;
+    int top = st7789_band_top() - y;
+    int bottom = st7789_band_bottom() - y;
+    top = top < 0 ? 0 : top;
+    bottom = bottom > ani->height ? ani->height : bottom;
+
+    /* band buffers hold nothing from last frame, so paint all */
+    bool all = player->repaint || ST7789_BAND_HEIGHT;
+    const int block = GFX_ANIMA_BLOCK / 2; // in bytes
+
+    uint16_t pixels[ROW_CHUNK];
+    for (int i = top; i < bottom; i++) {
+        uint32_t dirty = all ? 0xffffffffu : player->dirty[i];
+        const uint8_t *row = player->pixels + i * stride;
+        int b = 0;
+        while (dirty >> b) {
+            /* one span for each run of dirty blocks */
+            while (!(dirty & (1u << b))) {
+                b++;
+            }
+            int x0 = b * block;
+            while ((b < 32) && (dirty & (1u << b))) {
+                b++;
+            }
+            int x1 = b * block < stride ? b * block : stride;
+            for (int j = x0; j < x1; j += ROW_CHUNK / 2) {
+                int count = x1 - j < ROW_CHUNK / 2 ? x1 - j : ROW_CHUNK / 2;
+                for (int k = 0; k < count; k++) {
+                    pixels[k * 2] = player->pallete[row[j + k] >> 4];
+                    pixels[k * 2 + 1] = player->pallete[row[j + k] & 0x0f];
+                }
+                st7789_span_pixels(x + j * 2, y + i, count * 2, pixels, NULL, 0);
+            }
+            if (b >= 32) {
+                break;
+            }
         }
     }
 }
@@ -76,32 +262,376 @@ void gfx_img_draw(int x, int y, const image_t *img)
         rle_init(&alpha_rle, &img->alpha);
     }
 
+    bool has_mix = img->alpha.input || img->pallete;
+    uint8_t mixbits = img->alpha.input ? img->alpha.bits : 8;
+
+    uint16_t pixels[ROW_CHUNK];
+    uint8_t mix[ROW_CHUNK];
+
     for (int i = 0; i < img->height; i++) {
-        for (int j = 0; j < img->width; j++) {
-            uint32_t pixel = rle_get(&pixels_rle);
-            uint32_t mix = 0xff;
-            uint32_t mixbits = 8;
-            if (img->alpha.input) {
-                mix = rle_get(&alpha_rle);
-                mixbits = img->alpha.bits;
-            }
-        
-            if (img->pallete) {
-                pixel = img->pallete[pixel];
-                if (!img->alpha.input) {
-                    mix = pixel >> 16;
+        for (int j = 0; j < img->width; j += ROW_CHUNK) {
+            int count = img->width - j < ROW_CHUNK ? img->width - j : ROW_CHUNK;
+            for (int k = 0; k < count; k++) {
+                uint32_t pixel = rle_get(&pixels_rle);
+                if (img->pallete) {
+                    pixel = img->pallete[pixel];
+                    mix[k] = pixel >> 16;
+                }
+                if (img->alpha.input) {
+                    mix[k] = rle_get(&alpha_rle);
+                }
+                pixels[k] = pixel;
+            }
+            st7789_span_pixels(x + j, y + i, count, pixels,
+                               has_mix ? mix : NULL, mixbits);
+        }
+    }
+}
+
+#if GFX_SPRITE_CACHE_SIZE
+/* Sprite cache, an image is decoded once into row spans:
+   uint16_t span count for each row, then the spans. Transparent pixels
+   are simply not covered. Each span has a 4 bytes header, a const span
+   (one color and one mix) then has the color, a pixels span has its
+   colors, followed by mixes when not all opaque. Mixes are kept as is,
+   so output is same as gfx_img_draw. */
+enum {
+    SPAN_CONST,
+    SPAN_OPAQUE,
+    SPAN_MIX,
+};
+
+typedef struct {
+    uint8_t x;
+    uint8_t len;
+    uint8_t kind;
+    uint8_t mix; // const span
+} sprite_span_t;
+
+/* runs shorter than this are cheaper as pixels */
+#define SPRITE_MIN_RUN 4
+#define SPRITE_MAX_WIDTH 240
+
+typedef struct {
+    const image_t *img;
+    uint32_t offset; // in arena
+    uint32_t size;
+    uint32_t last_used;
+} sprite_t;
+
+static struct {
+    uint8_t arena[GFX_SPRITE_CACHE_SIZE] __attribute__((aligned(4)));
+    uint32_t used;
+    sprite_t entries[GFX_SPRITE_CACHE_ENTRIES];
+    uint32_t stamp;
+    const image_t *too_big[GFX_SPRITE_CACHE_ENTRIES]; // not to measure again
+    uint8_t too_big_pos;
+} sprite_cache;
+
+static inline uint8_t img_mixbits(const image_t *img)
+{
+    return img->alpha.input ? img->alpha.bits : 8;
+}
+
+typedef struct {
+    rle_decoder_t pixels;
+    rle_decoder_t alpha;
+} img_decoder_t;
+
+static void img_decoder_init(img_decoder_t *dec, const image_t *img)
+{
+    rle_init(&dec->pixels, &img->pixels);
+    if (img->alpha.input) {
+        rle_init(&dec->alpha, &img->alpha);
+    }
+}
+
+/* images without pallete or alpha are opaque */
+static void img_decode_row(img_decoder_t *dec, const image_t *img,
+                           uint16_t *pixels, uint8_t *mix)
+{
+    uint8_t opaque = (1 << img_mixbits(img)) - 1;
+    for (int i = 0; i < img->width; i++) {
+        uint32_t pixel = rle_get(&dec->pixels);
+        mix[i] = opaque;
+        if (img->pallete) {
+            pixel = img->pallete[pixel];
+            mix[i] = pixel >> 16;
+        }
+        if (img->alpha.input) {
+            mix[i] = rle_get(&dec->alpha);
+        }
+        pixels[i] = pixel;
+    }
+}
+
+static inline int same_run(const uint16_t *pixels, const uint8_t *mix, int start, int end)
+{
+    int i = start + 1;
+    while ((i < end) && (pixels[i] == pixels[start]) && (mix[i] == mix[start])) {
+        i++;
+    }
+    return i - start;
+}
+
+/* Encodes one row into out (or only counts bytes when out is NULL) */
+static uint32_t sprite_encode_row(const uint16_t *pixels, const uint8_t *mix, int width,
+                                  uint8_t opaque, uint8_t *out)
+{
+    uint32_t pos = 2;
+    uint16_t count = 0;
+    int i = 0;
+
+    while (i < width) {
+        if (mix[i] == 0) {
+            i++;
+            continue;
+        }
+
+        sprite_span_t span = { .x = i };
+        int run = same_run(pixels, mix, i, width);
+        if (run >= SPRITE_MIN_RUN) {
+            span.kind = SPAN_CONST;
+            span.len = run;
+            span.mix = mix[i];
+        } else {
+            /* pixels until a transparent pixel or a long run */
+            span.kind = SPAN_OPAQUE;
+            int end = i;
+            while ((end < width) && (mix[end] != 0) &&
+                   (same_run(pixels, mix, end, width) < SPRITE_MIN_RUN)) {
+                if (mix[end] != opaque) {
+                    span.kind = SPAN_MIX;
                 }
+                end++;
+            }
+            span.len = end - i;
+        }
+
+        uint32_t data = span.kind == SPAN_CONST ? 2 :
+                        span.kind == SPAN_OPAQUE ? span.len * 2 :
+                        (span.len * 3 + 1) & ~1;
+        if (out) {
+            memcpy(out + pos, &span, sizeof(span));
+            int colors = span.kind == SPAN_CONST ? 1 : span.len;
+            memcpy(out + pos + sizeof(span), pixels + i, colors * 2);
+            if (span.kind == SPAN_MIX) {
+                memcpy(out + pos + sizeof(span) + span.len * 2, mix + i, span.len);
+            }
+        }
+        pos += sizeof(span) + data;
+        count++;
+        i += span.len;
+    }
+
+    if (out) {
+        memcpy(out, &count, 2);
+    }
+    return pos;
+}
+
+static uint32_t sprite_encode(const image_t *img, uint8_t *out)
+{
+    uint16_t pixels[SPRITE_MAX_WIDTH];
+    uint8_t mix[SPRITE_MAX_WIDTH];
+    uint8_t opaque = (1 << img_mixbits(img)) - 1;
+    img_decoder_t dec;
+    img_decoder_init(&dec, img);
+
+    uint32_t pos = 0;
+    for (int i = 0; i < img->height; i++) {
+        img_decode_row(&dec, img, pixels, mix);
+        pos += sprite_encode_row(pixels, mix, img->width, opaque, out ? out + pos : NULL);
+    }
+    return pos;
+}
+
+static void sprite_blit(const sprite_t *sprite, int x, int y)
+{
+    const image_t *img = sprite->img;
+    uint8_t bits = img_mixbits(img);
+    const uint8_t *data = sprite_cache.arena + sprite->offset;
+
+    for (int i = 0; i < img->height; i++) {
+        uint16_t count;
+        memcpy(&count, data, 2);
+        data += 2;
+        for (int j = 0; j < count; j++) {
+            const sprite_span_t *span = (const sprite_span_t *)data;
+            const uint16_t *pixels = (const uint16_t *)(data + sizeof(*span));
+            data += sizeof(*span);
+            if (span->kind == SPAN_CONST) {
+                st7789_span(x + span->x, y + i, span->len, pixels[0], span->mix, bits);
+                data += 2;
+            } else if (span->kind == SPAN_OPAQUE) {
+                st7789_span_pixels(x + span->x, y + i, span->len, pixels, NULL, 0);
+                data += span->len * 2;
+            } else {
+                const uint8_t *mix = data + span->len * 2;
+                st7789_span_pixels(x + span->x, y + i, span->len, pixels, mix, bits);
+                data += (span->len * 3 + 1) & ~1;
+            }
+        }
+    }
+}
+
+/* move sprites to the front of the arena, keeping their order */
+static void sprite_cache_compact()
+{
+    uint32_t pos = 0;
+    while (true) {
+        sprite_t *next = NULL;
+        for (int i = 0; i < GFX_SPRITE_CACHE_ENTRIES; i++) {
+            sprite_t *e = &sprite_cache.entries[i];
+            if (e->img && (e->offset >= pos) && (!next || (e->offset < next->offset))) {
+                next = e;
             }
+        }
+        if (!next) {
+            break;
+        }
+        if (next->offset != pos) {
+            memmove(sprite_cache.arena + pos, sprite_cache.arena + next->offset, next->size);
+            next->offset = pos;
+        }
+        pos += next->size;
+    }
+    sprite_cache.used = pos;
+}
 
-            st7789_pixel(x + j, y + i, pixel, mix, mixbits);
+/* LRU eviction until it fits */
+static sprite_t *sprite_cache_alloc(uint32_t size)
+{
+    if (size > GFX_SPRITE_CACHE_SIZE) {
+        return NULL;
+    }
+
+    while (true) {
+        sprite_t *lru = NULL;
+        sprite_t *slot = NULL;
+        uint32_t total = 0;
+        for (int i = 0; i < GFX_SPRITE_CACHE_ENTRIES; i++) {
+            sprite_t *e = &sprite_cache.entries[i];
+            if (!e->img) {
+                slot = slot ? slot : e;
+                continue;
+            }
+            total += e->size;
+            if (!lru || (e->last_used < lru->last_used)) {
+                lru = e;
+            }
         }
+
+        if (slot && (total + size <= GFX_SPRITE_CACHE_SIZE)) {
+            if (sprite_cache.used + size > GFX_SPRITE_CACHE_SIZE) {
+                sprite_cache_compact();
+            }
+            slot->offset = sprite_cache.used;
+            slot->size = size;
+            sprite_cache.used += size;
+            return slot;
+        }
+
+        if (!lru) {
+            return NULL;
+        }
+        lru->img = NULL;
     }
 }
 
+static const sprite_t *sprite_cache_get(const image_t *img)
+{
+    sprite_cache.stamp++;
+    for (int i = 0; i < GFX_SPRITE_CACHE_ENTRIES; i++) {
+        sprite_t *e = &sprite_cache.entries[i];
+        if (e->img == img) {
+            e->last_used = sprite_cache.stamp;
+            return e;
+        }
+    }
+
+    for (int i = 0; i < GFX_SPRITE_CACHE_ENTRIES; i++) {
+        if (sprite_cache.too_big[i] == img) {
+            return NULL;
+        }
+    }
+
+    sprite_t *e = NULL;
+    if (img->width <= SPRITE_MAX_WIDTH) {
+        /* size aligned so the next sprite's spans are aligned too */
+        e = sprite_cache_alloc((sprite_encode(img, NULL) + 3) & ~3);
+    }
+    if (!e) {
+        sprite_cache.too_big[sprite_cache.too_big_pos] = img;
+        sprite_cache.too_big_pos = (sprite_cache.too_big_pos + 1) % GFX_SPRITE_CACHE_ENTRIES;
+        return NULL;
+    }
+    sprite_encode(img, sprite_cache.arena + e->offset);
+    e->img = img;
+    e->last_used = sprite_cache.stamp;
+    return e;
+}
+
+bool gfx_img_cache_warm(const image_t *img)
+{
+    return sprite_cache_get(img) != NULL;
+}
+
+void gfx_img_draw_cached(int x, int y, const image_t *img)
+{
+    const sprite_t *sprite = sprite_cache_get(img);
+    if (sprite) {
+        sprite_blit(sprite, x, y);
+    } else {
+        gfx_img_draw(x, y, img);
+    }
+}
+#else
+bool gfx_img_cache_warm(const image_t *img)
+{
+    return false;
+}
+
+void gfx_img_draw_cached(int x, int y, const image_t *img)
+{
+    gfx_img_draw(x, y, img);
+}
+#endif
+
+
+static inline bool char_in_font(char c, const lv_font_t *font)
+{
+    return (c >= font->range_start) && (c - font->range_start < font->range_length);
+}
+
+static inline int char_advance(char c, const lv_font_t *font)
+{
+    return font->dsc[c - font->range_start].adv_w >> 4;
+}
+
+/* one glyph row of atlas spans, returns the next row */
+static const uint8_t *glyph_row_blit(const uint8_t *row, int x, int y, uint16_t color,
+                                     uint8_t bpp)
+{
+    uint8_t solid = (1 << bpp) - 1;
+    int count = *row++;
+    for (int i = 0; i < count; i++) {
+        x += *row++;
+        int len = *row & ~GLYPH_SPAN_SOLID;
+        if (*row++ & GLYPH_SPAN_SOLID) {
+            st7789_span(x, y, len, color, solid, bpp);
+        } else {
+            st7789_span_alpha(x, y, len, color, row, bpp);
+            row += len;
+        }
+        x += len;
+    }
+    return row;
+}
 
 void gfx_char_draw(int x, int y, char c, const lv_font_t *font, uint16_t color)
 {
-    if (c < font->range_start || c >= font->range_start + font->range_length) {
+    if (!char_in_font(c, font)) {
         return;
     }
 
@@ -110,24 +640,28 @@ void gfx_char_draw(int x, int y, char c, const lv_font_t *font, uint16_t color)
 
     uint8_t bpp = font->bit_per_pixel;
     uint8_t mask = (1L << bpp) - 1;
-    uint8_t off_y = font->line_height - font->base_line - dsc->box_h - dsc->ofs_y;
+    int off_y = font->line_height - font->base_line - dsc->box_h - dsc->ofs_y;
 
-    int crop_w = st7789_get_crop_width();
-    int crop_h = st7789_get_crop_height();
+    uint8_t mix[ROW_CHUNK];
+    int dot_x = x + dsc->ofs_x;
+
+    if (font->atlas) {
+        const uint8_t *row = font->atlas->data + font->atlas->index[c - font->range_start];
+        for (int i = 0; i < dsc->box_h; i++) {
+            row = glyph_row_blit(row, dot_x, y + off_y + i, color, bpp);
+        }
+        return;
+    }
 
     for (int i = 0; i < dsc->box_h; i++) {
         int dot_y = y + off_y + i;
-        if ((dot_y < 0) || (dot_y > crop_h)) {
-            continue;
-        }
-        for (int j = 0; j < dsc->box_w; j++) {
-            int dot_x = x + dsc->ofs_x + j;
-            if ((dot_x < 0) || (dot_x > crop_w)) {
-                break;
+        for (int j = 0; j < dsc->box_w; j += ROW_CHUNK) {
+            int count = dsc->box_w - j < ROW_CHUNK ? dsc->box_w - j : ROW_CHUNK;
+            for (int k = 0; k < count; k++) {
+                uint32_t bits = (i * dsc->box_w + j + k) * bpp;
+                mix[k] = (bitmap[bits / 8] >> ((8 - bpp) - (bits % 8))) & mask;
             }
-            uint16_t bits = (i * dsc->box_w + j) * bpp;
-            uint8_t mix = (bitmap[bits / 8] >> ((8 - bpp) - (bits % 8))) & mask;
-            st7789_pixel(dot_x, dot_y, color, mix, bpp);
+            st7789_span_alpha(dot_x + j, dot_y, count, color, mix, bpp);
         }
     }
 }
@@ -150,19 +684,128 @@ static uint16_t text_width(const char *text, const lv_font_t *font)
         } else if (*text == '\x02' || *text == '\x03') {
             continue;
         }
-        if (*text - font->range_start < font->range_length) {
-            width += (font->dsc[*text - font->range_start].adv_w >> 4) + spacing_x;
+        if (char_in_font(*text, font)) {
+            width += char_advance(*text, font) + spacing_x;
         }
     }
     return width;
 }
 
+/* Text layout cache
+ * Line widths and glyph pen positions of a string are measured once, so
+ * drawing walks the text only once. Strings too long for an entry are
+ * measured line by line as before.
+ */
+
+typedef struct {
+    uint32_t hash;
+    const lv_font_t *font;
+    int8_t spacing;
+    uint16_t len;
+    uint8_t lines;
+    uint16_t glyphs;
+    uint16_t width[GFX_TEXT_LAYOUT_LINES];
+    int16_t pos[GFX_TEXT_LAYOUT_GLYPHS]; // relative to line start
+    uint32_t last_used;
+    bool valid;
+} text_layout_t;
+
+static struct {
+    text_layout_t entries[GFX_TEXT_LAYOUT_ENTRIES];
+    uint32_t clock;
+} layout_cache;
+
+static uint32_t text_hash(const char *text, int len)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (int i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)text[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static bool layout_measure(text_layout_t *layout, const char *text)
+{
+    const lv_font_t *font = layout->font;
+    int pen = 0;
+
+    layout->lines = 1;
+    layout->glyphs = 0;
+    layout->width[0] = 0;
+    for (int i = 0; i < layout->len; i++) {
+        if (text[i] == '\x01') {
+            i += 3;
+            continue;
+        } else if ((text[i] == '\x02') || (text[i] == '\x03')) {
+            continue;
+        } else if (text[i] == '\n') {
+            if (layout->lines == GFX_TEXT_LAYOUT_LINES) {
+                return false;
+            }
+            layout->width[layout->lines++] = 0;
+            pen = 0;
+            continue;
+        }
+        if (!char_in_font(text[i], font)) {
+            continue;
+        }
+        if (layout->glyphs == GFX_TEXT_LAYOUT_GLYPHS) {
+            return false;
+        }
+        layout->pos[layout->glyphs++] = pen;
+        pen += char_advance(text[i], font) + layout->spacing;
+        layout->width[layout->lines - 1] = pen;
+    }
+    return true;
+}
+
+static const text_layout_t *text_layout_get(const char *text, const lv_font_t *font)
+{
+    int len = strlen(text);
+    uint32_t hash = text_hash(text, len);
+    layout_cache.clock++;
+
+    text_layout_t *lru = &layout_cache.entries[0];
+    for (int i = 0; i < GFX_TEXT_LAYOUT_ENTRIES; i++) {
+        text_layout_t *e = &layout_cache.entries[i];
+        if (e->valid && (e->hash == hash) && (e->len == len) &&
+            (e->font == font) && (e->spacing == spacing_x)) {
+            e->last_used = layout_cache.clock;
+            return e;
+        }
+        if (!e->valid || (lru->valid && (e->last_used < lru->last_used))) {
+            lru = e;
+        }
+    }
+
+    *lru = (text_layout_t) { .hash = hash, .font = font, .spacing = spacing_x, .len = len };
+    if (!layout_measure(lru, text)) {
+        return NULL;
+    }
+    lru->last_used = layout_cache.clock;
+    lru->valid = true;
+    return lru;
+}
+
+static int align_line(int x, int width, alignment_t align)
+{
+    if (align == ALIGN_CENTER) {
+        return x - width / 2;
+    } else if (align == ALIGN_RIGHT) {
+        return x - width;
+    }
+    return x;
+}
+
 void gfx_text_draw(int x, int y, const char *text,
                  const lv_font_t *font, uint16_t color, alignment_t align)
 {
+    const text_layout_t *layout = text_layout_get(text, font);
     uint16_t old_color = color;
     uint16_t curr_color = color;
     bool newline = true;
+    int line = 0;
+    int glyph = 0;
     int pos_x = x;
     for (; *text; text++) {
         if (*text == '\x01') { // set color
@@ -181,20 +824,323 @@ void gfx_text_draw(int x, int y, const char *text,
             continue;
         } else if (*text == '\n') { // line wrap
             newline = true;
-            pos_x = x;;
+            line++;
             y += font->line_height + spacing_y;
             continue;
         }
         if (newline) {
-            int width = text_width(text, font);
-            if (align == ALIGN_CENTER) {
-                pos_x -= width / 2;
-            } else if (align == ALIGN_RIGHT) {
-                pos_x -= width;
+            int width = layout ? layout->width[line] : text_width(text, font);
+            pos_x = align_line(x, width, align);
+            newline = false;
+        }
+        if (!char_in_font(*text, font)) {
+            continue;
+        }
+        if (layout) {
+            gfx_char_draw(pos_x + layout->pos[glyph++], y, *text, font, curr_color);
+        } else {
+            gfx_char_draw(pos_x, y, *text, font, curr_color);
+            pos_x += char_advance(*text, font) + spacing_x;
+        }
+    }
+}
+
+/* Rendered text cache
+ * Each run of same-color text on a line is rasterized once into a 4-bit
+ * alpha surface, color is applied at blit time so shadows share it too.
+ * Surfaces live in a fixed arena, least recently used ones are evicted
+ * and the arena is compacted on miss.
+ */
+
+typedef struct {
+    uint32_t hash;
+    const lv_font_t *font;
+    int8_t spacing;
+    uint16_t len;
+    int16_t ofs_x; // surface position relative to pen
+    int16_t ofs_y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t advance;
+    uint32_t offset; // in arena
+    uint32_t size;
+    uint32_t last_used; // frame
+    bool valid;
+} text_surface_t;
+
+static struct {
+    uint8_t arena[GFX_TEXT_CACHE_SIZE];
+    uint32_t used;
+    text_surface_t entries[GFX_TEXT_CACHE_ENTRIES];
+    uint32_t frame;
+} text_cache;
+
+void gfx_text_cache_next_frame()
+{
+    text_cache.frame++;
+}
+
+static inline uint8_t glyph_mix(const lv_font_t *font, const lv_font_dsc_t *dsc, int i, int j)
+{
+    const uint8_t *bitmap = font->bitmap + dsc->bitmap_index;
+    uint8_t bpp = font->bit_per_pixel;
+    uint32_t bits = (i * dsc->box_w + j) * bpp;
+    return (bitmap[bits / 8] >> ((8 - bpp) - (bits % 8))) & ((1 << bpp) - 1);
+}
+
+static void surface_measure(text_surface_t *s, const char *text, int len)
+{
+    const lv_font_t *font = s->font;
+    int x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+    int pen = 0;
+
+    for (int i = 0; i < len; i++) {
+        if (!char_in_font(text[i], font)) {
+            continue;
+        }
+        const lv_font_dsc_t *dsc = font->dsc + text[i] - font->range_start;
+        int gx = pen + dsc->ofs_x;
+        int gy = font->line_height - font->base_line - dsc->box_h - dsc->ofs_y;
+        if (dsc->box_w && dsc->box_h) {
+            x0 = gx < x0 ? gx : x0;
+            y0 = gy < y0 ? gy : y0;
+            x1 = gx + dsc->box_w > x1 ? gx + dsc->box_w : x1;
+            y1 = gy + dsc->box_h > y1 ? gy + dsc->box_h : y1;
+        }
+        pen += (dsc->adv_w >> 4) + s->spacing;
+    }
+
+    s->advance = pen;
+    if (x1 <= x0) {
+        s->ofs_x = s->ofs_y = s->w = s->h = 0;
+        return;
+    }
+    s->ofs_x = x0;
+    s->ofs_y = y0;
+    s->w = x1 - x0;
+    s->h = y1 - y0;
+}
+
+static void surface_render(text_surface_t *s, const char *text, int len)
+{
+    const lv_font_t *font = s->font;
+    uint8_t *mask = text_cache.arena + s->offset;
+    int stride = (s->w + 1) / 2;
+    int pen = 0;
+
+    memset(mask, 0, s->size);
+
+    for (int c = 0; c < len; c++) {
+        if (!char_in_font(text[c], font)) {
+            continue;
+        }
+        const lv_font_dsc_t *dsc = font->dsc + text[c] - font->range_start;
+        int gx = pen + dsc->ofs_x - s->ofs_x;
+        int gy = font->line_height - font->base_line - dsc->box_h - dsc->ofs_y - s->ofs_y;
+        for (int i = 0; i < dsc->box_h; i++) {
+            uint8_t *row = mask + (gy + i) * stride;
+            for (int j = 0; j < dsc->box_w; j++) {
+                uint8_t mix = glyph_mix(font, dsc, i, j);
+                mix = font->bit_per_pixel == 1 ? mix * 15 :
+                      font->bit_per_pixel == 2 ? mix * 5 : mix;
+                int px = gx + j;
+                uint8_t shift = (px & 1) ? 0 : 4;
+                uint8_t old = (row[px / 2] >> shift) & 0x0f;
+                if (mix > old) {
+                    row[px / 2] = (row[px / 2] & ~(0x0f << shift)) | (mix << shift);
+                }
             }
+        }
+        pen += (dsc->adv_w >> 4) + s->spacing;
+    }
+}
+
+static void surface_blit(const text_surface_t *s, int x, int y, uint16_t color)
+{
+    const uint8_t *mask = text_cache.arena + s->offset;
+    int stride = (s->w + 1) / 2;
+    uint8_t mix[ROW_CHUNK];
+
+    for (int i = 0; i < s->h; i++) {
+        const uint8_t *row = mask + i * stride;
+        for (int j = 0; j < s->w; j += ROW_CHUNK) {
+            int count = s->w - j < ROW_CHUNK ? s->w - j : ROW_CHUNK;
+            for (int k = 0; k < count; k++) {
+                int px = j + k;
+                mix[k] = (px & 1) ? row[px / 2] & 0x0f : row[px / 2] >> 4;
+            }
+            st7789_span_alpha(x + s->ofs_x + j, y + s->ofs_y + i, count, color, mix, 4);
+        }
+    }
+}
+
+/* move surfaces to the front of the arena, keeping their order */
+static void text_cache_compact()
+{
+    uint32_t pos = 0;
+    while (true) {
+        text_surface_t *next = NULL;
+        for (int i = 0; i < GFX_TEXT_CACHE_ENTRIES; i++) {
+            text_surface_t *e = &text_cache.entries[i];
+            if (e->valid && (e->offset >= pos) && (!next || (e->offset < next->offset))) {
+                next = e;
+            }
+        }
+        if (!next) {
+            break;
+        }
+        if (next->offset != pos) {
+            memmove(text_cache.arena + pos, text_cache.arena + next->offset, next->size);
+            next->offset = pos;
+        }
+        pos += next->size;
+    }
+    text_cache.used = pos;
+}
+
+/* LRU eviction, surfaces used in the current frame are kept */
+static text_surface_t *text_cache_alloc(uint32_t size)
+{
+    if (size > GFX_TEXT_CACHE_SIZE) {
+        return NULL;
+    }
+
+    while (true) {
+        text_surface_t *lru = NULL;
+        text_surface_t *slot = NULL;
+        uint32_t total = 0;
+        for (int i = 0; i < GFX_TEXT_CACHE_ENTRIES; i++) {
+            text_surface_t *e = &text_cache.entries[i];
+            if (!e->valid) {
+                slot = slot ? slot : e;
+                continue;
+            }
+            total += e->size;
+            if ((e->last_used != text_cache.frame) &&
+                (!lru || (e->last_used < lru->last_used))) {
+                lru = e;
+            }
+        }
+
+        if (slot && (total + size <= GFX_TEXT_CACHE_SIZE)) {
+            if (text_cache.used + size > GFX_TEXT_CACHE_SIZE) {
+                text_cache_compact();
+            }
+            slot->offset = text_cache.used;
+            slot->size = size;
+            text_cache.used += size;
+            return slot;
+        }
+
+        if (!lru) {
+            return NULL;
+        }
+        lru->valid = false;
+    }
+}
+
+static const text_surface_t *text_cache_get(const char *text, int len,
+                                            const lv_font_t *font)
+{
+    uint32_t hash = text_hash(text, len);
+    for (int i = 0; i < GFX_TEXT_CACHE_ENTRIES; i++) {
+        text_surface_t *e = &text_cache.entries[i];
+        if (e->valid && (e->hash == hash) && (e->len == len) &&
+            (e->font == font) && (e->spacing == spacing_x)) {
+            e->last_used = text_cache.frame;
+            return e;
+        }
+    }
+
+    text_surface_t s = { .hash = hash, .font = font, .spacing = spacing_x, .len = len };
+    surface_measure(&s, text, len);
+
+    text_surface_t *e = text_cache_alloc(s.h * ((s.w + 1) / 2));
+    if (!e) {
+        return NULL;
+    }
+    s.offset = e->offset;
+    s.size = e->size;
+    s.last_used = text_cache.frame;
+    s.valid = true;
+    *e = s;
+    surface_render(e, text, len);
+    return e;
+}
+
+static void text_run_draw(int x, int y, const char *text, int len,
+                          const lv_font_t *font, uint16_t color, int *advance)
+{
+    const text_surface_t *s = NULL;
+    if (font->bit_per_pixel <= 4) {
+        s = text_cache_get(text, len, font);
+    }
+
+    if (s) {
+        surface_blit(s, x, y, color);
+        *advance = s->advance;
+        return;
+    }
+
+    /* not cacheable, draw directly */
+    int pen = 0;
+    for (int i = 0; i < len; i++) {
+        if (char_in_font(text[i], font)) {
+            gfx_char_draw(x + pen, y, text[i], font, color);
+            pen += char_advance(text[i], font) + spacing_x;
+        }
+    }
+    *advance = pen;
+}
+
+void gfx_text_draw_cached(int x, int y, const char *text,
+                          const lv_font_t *font, uint16_t color, alignment_t align)
+{
+    const text_layout_t *layout = text_layout_get(text, font);
+    uint16_t old_color = color;
+    uint16_t curr_color = color;
+    bool newline = true;
+    int line = 0;
+    int pos_x = x;
+
+    while (*text) {
+        if (*text == '\x01') { // set color
+            old_color = curr_color;
+            curr_color = st7789_rgb565(st7789_rgb32(text[1], text[2], text[3]));
+            text += 4;
+            continue;
+        } else if (*text == '\x02') { // back to previous color
+            uint16_t tmp = curr_color;
+            curr_color = old_color;
+            old_color = tmp;
+            text++;
+            continue;
+        } else if (*text == '\x03') { // reset to default color
+            old_color = curr_color;
+            curr_color = color;
+            text++;
+            continue;
+        } else if (*text == '\n') { // line wrap
+            newline = true;
+            line++;
+            y += font->line_height + spacing_y;
+            text++;
+            continue;
+        }
+        if (newline) {
+            int width = layout ? layout->width[line] : text_width(text, font);
+            pos_x = align_line(x, width, align);
             newline = false;
         }
-        gfx_char_draw(pos_x, y, *text, font, curr_color);
-        pos_x += (font->dsc[*text - font->range_start].adv_w >> 4) + spacing_x;
+
+        int len = 0;
+        while (((uint8_t)text[len] > 0x03) && (text[len] != '\n')) {
+            len++;
+        }
+
+        int advance;
+        text_run_draw(pos_x, y, text, len, font, curr_color, &advance);
+        pos_x += advance;
+        text += len;
     }
 }
@@ -2,7 +2,9 @@
 #define GFX_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "rle.h"
+#include "st7789.h"
 
 typedef struct {
     uint16_t width;
@@ -11,6 +13,8 @@ typedef struct {
     uint32_t size;
     const uint32_t *index;
     const uint8_t *data;
+    rle_encoding_t encoding; // frames are 4bpp, RLE_RLE_X uses x = 0
+    const uint8_t *delta_map; // bit set for delta frames, only for anima player
 } anima_t;
 
 typedef struct {
@@ -26,6 +30,45 @@ void gfx_anima_mix(const anima_t *ani, int x, int y, int frame, uint16_t color);
 
 void gfx_img_draw(int x, int y, const image_t *img);
 
+/* Same as gfx_img_draw, but the image is decoded once into row spans and
+   kept in a LRU cache, later draws only copy spans. Images that don't fit
+   are drawn directly. Warming decodes ahead of the first draw. The cache
+   lives in the RAM band mode saves, the full frame build draws directly. */
+#ifndef GFX_SPRITE_CACHE_SIZE
+#if ST7789_BAND_HEIGHT
+#define GFX_SPRITE_CACHE_SIZE (32 * 1024)
+#else
+#define GFX_SPRITE_CACHE_SIZE 0
+#endif
+#endif
+#define GFX_SPRITE_CACHE_ENTRIES 4
+
+void gfx_img_draw_cached(int x, int y, const image_t *img);
+bool gfx_img_cache_warm(const image_t *img);
+
+/* Anima player keeps the shown frame as 4bpp pixels, only changed rows
+   and areas drawn over in the last frame are painted again. It also
+   plays delta frames, see tools/anima_delta.c for the format. */
+#define GFX_ANIMA_MAX_HEIGHT 280
+#define GFX_ANIMA_BLOCK 8 // pixels per dirty bit, width up to 32 blocks
+
+typedef struct {
+    const anima_t *ani;
+    uint8_t *pixels; // width * height / 2 bytes
+    int frame;
+    uint16_t pallete[16];
+    bool repaint;
+    uint32_t dirty[GFX_ANIMA_MAX_HEIGHT]; // bit per block in each row
+} anima_player_t;
+
+void gfx_anima_player_init(anima_player_t *player, const anima_t *ani, uint8_t *pixels);
+/* once per frame, moves to the frame and finds out what to paint */
+void gfx_anima_player_update(anima_player_t *player, int frame, const uint16_t pallete[16]);
+/* area (relative to the anima) that needs to be painted again */
+void gfx_anima_player_damage(anima_player_t *player, int x, int y, int w, int h);
+/* repeatable, so it works with band rendering */
+void gfx_anima_player_draw(const anima_player_t *player, int x, int y);
+
 typedef enum {
     PALLETE_GRAYSCALE,
     PALLETE_LIGHTNING,
@@ -44,6 +87,23 @@ typedef struct {
     int16_t ofs_y;         /**< y offset of the bounding box. Measured from the top of the line*/
 } lv_font_dsc_t;
 
+/* Glyph rows pre-expanded into alpha spans by tools/font_atlas.c, each row
+   is a span count, then per span: skip, length (bit 7 = solid) and one
+   alpha byte per pixel unless solid */
+typedef struct {
+    const uint32_t *index; // per glyph, into data
+    const uint8_t *data;
+} glyph_atlas_t;
+
+#define GLYPH_SPAN_SOLID 0x80
+
+/* font_atlas.c reads the fonts before their atlas exists */
+#ifdef FONT_ATLAS_BUILD
+#define LV_FONT_ATLAS(atlas) NULL
+#else
+#define LV_FONT_ATLAS(atlas) (&atlas)
+#endif
+
 typedef struct {
     uint8_t range_start;
     uint8_t range_length;
@@ -52,6 +112,7 @@ typedef struct {
     uint16_t base_line;
     const lv_font_dsc_t *dsc;
     const uint8_t *bitmap;
+    const glyph_atlas_t *atlas; // optional, bitmap is used without it
 } lv_font_t;
 
 /* char and text out only supports 1/2/4/8 bit-per-pixel */
@@ -75,7 +136,32 @@ void gfx_text_spacing(int dx, int dy);
 #define PREV_COLOR "\x02"
 #define RESET_COLOR "\x03"
 
+/* line widths and glyph positions of recent strings are kept, longer
+   strings are measured on every draw */
+#define GFX_TEXT_LAYOUT_ENTRIES 16
+#define GFX_TEXT_LAYOUT_LINES 8
+#define GFX_TEXT_LAYOUT_GLYPHS 96
+
 void gfx_text_draw(int x, int y, const char *text, const lv_font_t *font,
                    uint16_t color, alignment_t align);
 
+/* Same as gfx_text_draw, but text runs are rasterized once and kept in
+   a LRU cache, good for text that rarely changes. The full frame vram
+   leaves room for one page of surfaces, the status page is the largest
+   at about 11KB, runs that don't fit are drawn directly. */
+#ifndef GFX_TEXT_CACHE_SIZE
+#if ST7789_BAND_HEIGHT
+#define GFX_TEXT_CACHE_SIZE (32 * 1024)
+#else
+#define GFX_TEXT_CACHE_SIZE (12 * 1024)
+#endif
+#endif
+#define GFX_TEXT_CACHE_ENTRIES 48
+
+void gfx_text_draw_cached(int x, int y, const char *text, const lv_font_t *font,
+                          uint16_t color, alignment_t align);
+
+/* surfaces used in current frame are never evicted */
+void gfx_text_cache_next_frame();
+
 #endif
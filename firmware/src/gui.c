@@ -47,6 +47,7 @@ void gui_level(uint8_t level)
 static struct {
     nfc_card_name card;
     uint64_t time;
+    volatile bool warm; // image to be decoded into sprite cache
 } card_splash;
 
 static inline bool card_splash_active()
@@ -58,24 +59,68 @@ void gui_report_card(nfc_card_name card)
 {
     card_splash.card = card;
     card_splash.time = time_us_64();
+    card_splash.warm = true;
 }
 
-static int tapped_key = -1;
+/* Written by the touch handler on core1, read by HID on core0, seq goes
+   last so a new tap is never seen before its key */
+static struct {
+    volatile int key;
+    volatile uint32_t time;
+    volatile uint32_t seq;
+} tap;
+
+static struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+} touch_latency;
+
+/* Animations advance one step per ANIMA_STEP_US regardless of frame rate */
+#define ANIMA_STEP_US 16667
+
+/* Frame state is advanced once per frame, so rendering can be repeated
+   for each band without side effects */
+static struct {
+    uint32_t time;
+    uint32_t phase;
+    bool splash;
+    uint8_t glow[12];
+    uint32_t glow_start[12];
+    uint32_t tap_seq;
+} frame;
+
+static void update_keypad_glow()
+{
+    int tapped_key = -1;
+    if (frame.tap_seq != tap.seq) {
+        frame.tap_seq = tap.seq;
+        tapped_key = tap.key;
+    }
+
+    for (int key = 0; key < 12; key++) {
+        if (key == tapped_key) {
+            frame.glow[key] = 1;
+            frame.glow_start[key] = frame.time;
+        } else if ((frame.glow[key] > 0) && (frame.glow[key] < anima_glow.frames)) {
+            uint32_t step = 1 + (frame.time - frame.glow_start[key]) / ANIMA_STEP_US;
+            frame.glow[key] = step < anima_glow.frames ? step : anima_glow.frames;
+        }
+    }
+}
 
 static void draw_home_keypad()
 {
-    static uint8_t glow_frame[12] = { 0 };
+    const uint8_t *glow_frame = frame.glow;
     const char *signs_text = "7894561230:;";
 
-    uint32_t color = rgb32_from_hsv(time_us_32() / 100000, 200, 250);
+    uint32_t color = rgb32_from_hsv(frame.time / 100000, 200, 250);
     for (int row = 0; row < 4; row++) {
         for (int col = 0; col < 3; col++) {
             int key = row * 3 + col;
             int x = col * 80 + 24;
             int y = row * 70 + 26;
-            if (key == tapped_key) {
-                glow_frame[key] = 1;
-            }
             if ((glow_frame[key] > 0) && (glow_frame[key] < anima_glow.frames)) {
                 int tail = anima_glow.frames - glow_frame[key];
                 uint16_t glow_color = 0xffff;
@@ -83,7 +128,6 @@ static void draw_home_keypad()
                     glow_color = st7789_gray(tail * 0x30);
                 }
                 gfx_anima_mix(&anima_glow, x - 18, y - 20, glow_frame[key], glow_color);
-                glow_frame[key]++;
             }
             char c = signs_text[row * 3 + col];
             gfx_char_draw(x + 2, y + 2, c, &lv_conthrax, st7789_rgb565(0x101010));
@@ -94,7 +138,7 @@ static void draw_home_keypad()
 
 static void center_image(const image_t *img)
 {
-    gfx_img_draw(120 - img->width / 2, 140 - img->height / 2, img);
+    gfx_img_draw_cached(120 - img->width / 2, 140 - img->height / 2, img);
 }
 
 static void draw_home_aime()
@@ -107,36 +151,60 @@ static void draw_home_bana()
     center_image(&image_bana_reader);
 }
 
+static const image_t *card_image(nfc_card_name card)
+{
+    if (card == CARD_AIC_SEGA) {
+        return &image_aic_sega;
+    } else if (card == CARD_AIC_KONAMI){
+        return &image_aic_konami;
+    } else if (card == CARD_AIC_BANA) {
+        return &image_aic_bana;
+    } else if (card == CARD_AIC_NESICA) {
+        return &image_aic_nesica;
+    } else if (card == CARD_AIC) {
+        return &image_aic_generic;
+    } else if (card == CARD_MIFARE) {
+        return &image_mifare;
+    } else if (card == CARD_AIME) {
+        return &image_aime;
+    } else if (card == CARD_BANA) {
+        return &image_bana;
+    } else if (card == CARD_NESICA) {
+        return &image_nesica;
+    } else if (card == CARD_VICINITY) {
+        return &image_vicinity;
+    } else if (card == CARD_EAMUSE) {
+        return &image_eamuse;
+    }
+    return NULL;
+}
+
 static void draw_home_card()
 {
-    if (card_splash.card == CARD_AIC_SEGA) {
-        center_image(&image_aic_sega);
-    } else if (card_splash.card == CARD_AIC_KONAMI){
-        center_image(&image_aic_konami);
-    } else if (card_splash.card == CARD_AIC_BANA) {
-        center_image(&image_aic_bana);
-    } else if (card_splash.card == CARD_AIC_NESICA) {
-        center_image(&image_aic_nesica);
-    } else if (card_splash.card == CARD_AIC) {
-        center_image(&image_aic_generic);
-    } else if (card_splash.card == CARD_MIFARE) {
-        center_image(&image_mifare);
-    } else if (card_splash.card == CARD_AIME) {
-        center_image(&image_aime);
-    } else if (card_splash.card == CARD_BANA) {
-        center_image(&image_bana);
-    } else if (card_splash.card == CARD_NESICA) {
-        center_image(&image_nesica);
-    } else if (card_splash.card == CARD_VICINITY) {
-        center_image(&image_vicinity);
-    } else if (card_splash.card == CARD_EAMUSE) {
-        center_image(&image_eamuse);
+    const image_t *img = card_image(card_splash.card);
+    if (img) {
+        center_image(img);
+    }
+}
+
+/* Card is reported from the other core, so the image is decoded here
+   in the spare time before the next frame, not in the listener */
+static void warm_card_image()
+{
+    if (!card_splash.warm) {
+        return;
+    }
+    card_splash.warm = false;
+
+    const image_t *img = card_image(card_splash.card);
+    if (img) {
+        gfx_img_cache_warm(img);
     }
 }
 
 static void draw_home()
 {
-    if (card_splash_active()) {
+    if (frame.splash) {
         draw_home_card();
     } else if (aime_is_active()) {
         draw_home_aime();
@@ -147,26 +215,51 @@ static void draw_home()
     }
 }
 
+static void touch_latency_account(uint32_t delay)
+{
+    touch_latency.count++;
+    touch_latency.last_us = delay;
+    touch_latency.sum_us += delay;
+    if (delay > touch_latency.max_us) {
+        touch_latency.max_us = delay;
+    }
+}
+
+/* Called by HID when the endpoint is ready, a new tap is picked up right
+   away and held for 100ms, latency counts from the touch sample */
 uint16_t gui_keypad_read()
 {
+    static uint32_t seq;
     static int last_tapped = -1;
-    static uint64_t last_active;
-    uint64_t now = time_us_32();
+    static uint32_t last_active;
+    uint32_t now = time_us_32();
     const uint8_t map[] = { 6, 7, 8, 3, 4, 5, 0, 1, 2, 9, 10, 11 };
 
+    if (tap.seq != seq) {
+        seq = tap.seq;
+        last_tapped = tap.key;
+        last_active = now;
+        touch_latency_account(now - tap.time);
+    }
+
     if ((last_tapped >= 0) && (now - last_active < 100000)) {
         return 1 << map[last_tapped];
     }
-    
-    if (tapped_key >= 0) {
-        last_tapped = tapped_key;
-        last_active = now;
-        return 1 << map[tapped_key];
-    }
 
     return 0;
 }
 
+gui_touch_stat_t gui_get_touch_stat()
+{
+    return (gui_touch_stat_t) {
+        .count = touch_latency.count,
+        .last_us = touch_latency.last_us,
+        .max_us = touch_latency.max_us,
+        .avg_us = touch_latency.count ? touch_latency.sum_us / touch_latency.count : 0,
+        .dropped = cst816t_dropped(),
+    };
+}
+
 static bool proc_home(cst816t_report_t touch)
 {
     if (aime_is_active() || bana_is_active()) {
@@ -175,10 +268,13 @@ static bool proc_home(cst816t_report_t touch)
 
     switch (touch.gesture) {
         case GESTURE_NONE:
-            tapped_key = -1;
             break;
         case GESTURE_TAP:
-            tapped_key = touch.y / 70 * 3 + touch.x / 80;
+        case GESTURE_LONG_PRESS:
+        case GESTURE_HOLD:
+            tap.key = touch.y / 70 * 3 + touch.x / 80;
+            tap.time = touch.time;
+            tap.seq++;
             break;
         default:
             return false;
@@ -189,25 +285,25 @@ static bool proc_home(cst816t_report_t touch)
 
 static void status_title(int x, int y, const char *title, uint16_t color)
 {
-    gfx_text_draw(x + 1, y + 1, title, &lv_lts16, 0x0000, ALIGN_CENTER);
-    gfx_text_draw(x, y, title, &lv_lts16, color, ALIGN_CENTER);
+    gfx_text_draw_cached(x + 1, y + 1, title, &lv_lts16, 0x0000, ALIGN_CENTER);
+    gfx_text_draw_cached(x, y, title, &lv_lts16, color, ALIGN_CENTER);
 }
 
 static void draw_status()
 {
     gfx_text_spacing(1, 0);
 
-    char buf[32];
+    char buf[48]; // reader line with auto mode takes about 40
     status_title(120, 3, "Serial Number", st7789_rgb565(0x00c000));
     sprintf(buf, "%016llx", board_id_64());
-    gfx_text_draw(120, 22, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
+    gfx_text_draw_cached(120, 22, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
 
     status_title(120, 46, "Firmware Timestamp", st7789_rgb565(0x00c000));
-    gfx_text_draw(120, 66, built_time, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
+    gfx_text_draw_cached(120, 66, built_time, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
 
     status_title(120, 89, "NFC Module", st7789_rgb565(0x00c000));
     sprintf(buf, "%s (%s)", nfc_module_name(), nfc_module_version());
-    gfx_text_draw(120, 105, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
+    gfx_text_draw_cached(120, 105, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
 
     status_title(120, 132, "Light", st7789_rgb565(0x00c000));
     if (aic_cfg->light.rgb) {
@@ -215,20 +311,21 @@ static void draw_status()
     } else {
         sprintf(buf, "RGB: OFF");
     }
-    gfx_text_draw(120, 148, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
+    gfx_text_draw_cached(120, 148, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
 
     status_title(120, 175, "LCD", st7789_rgb565(0x00c000));
     sprintf(buf, "Backlight: %d", aic_cfg->lcd.backlight);
-    gfx_text_draw(120, 191, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
+    gfx_text_draw_cached(120, 191, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
 
     status_title(120, 218, "Reader", st7789_rgb565(0x00c000));
     int len = sprintf(buf, "Virtual AIC: %s\nMode: %s",
                       aic_cfg->reader.virtual_aic ? "ON" : "OFF",
                       mode_name(aic_cfg->reader.mode));
     if (aic_cfg->reader.mode == MODE_AUTO) {
-        sprintf(buf + len, " (%s)", mode_name(aic_runtime.mode));
+        snprintf(buf + len, sizeof(buf) - len, " (%s/%s)",
+                 mode_name(aic_runtime.mode[0]), mode_name(aic_runtime.mode[1]));
     }
-    gfx_text_draw(120, 234, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
+    gfx_text_draw_cached(120, 234, buf, &lv_lts18, st7789_rgb565(0xc0c0c0), ALIGN_CENTER);
 }
 
 static void draw_credits()
@@ -245,7 +342,7 @@ static void draw_credits()
         "JLCPCB    Raspberry\n\n"
         SET_COLOR(\x90\x90\x90) "and more...";
 
-    gfx_text_draw(120, 30, credits, &lv_lts14, st7789_rgb565(0xc0c060), ALIGN_CENTER);
+    gfx_text_draw_cached(120, 30, credits, &lv_lts14, st7789_rgb565(0xc0c060), ALIGN_CENTER);
 }
 
 static void gen_pallete(uint16_t pallete[16], uint32_t color)
@@ -260,32 +357,77 @@ static void gen_pallete(uint16_t pallete[16], uint32_t color)
     }
 }
 
-static void run_background()
+/* The persistent player keeps the background frame decoded (33.6KB), so
+   only changes and areas covered by last frame's foreground are painted,
+   and it's what plays delta frames. The full frame build has no RAM left
+   for it and band mode repaints everything anyway, so it's opt-in and the
+   background is drawn whole from the keyframes otherwise. */
+#ifndef GUI_BACKGROUND_PLAYER
+#define GUI_BACKGROUND_PLAYER 0
+#endif
+
+#if GUI_BACKGROUND_PLAYER
+static anima_player_t background;
+static uint8_t background_pixels[240 * 280 / 2];
+
+static void update_background()
 {
-    static int phase = 0;
-    phase++;
+    const anima_t *ani = frame.splash ? &anima_light : &anima_star;
+    if (background.ani != ani) {
+        gfx_anima_player_init(&background, ani, background_pixels);
+    }
+
+    if (frame.splash) {
+        gfx_anima_player_update(&background, frame.phase, gfx_anima_pallete(PALLETE_LIGHTNING));
+    } else {
+        uint16_t pallete[16];
+        uint32_t color = rgb32_from_hsv(frame.time / 100000 + 128, 200, 250);
+        gen_pallete(pallete, color);
+        gfx_anima_player_update(&background, frame.phase, pallete);
+    }
+
+    int x, y, w, h;
+    for (int i = 0; st7789_last_overlay(i, &x, &y, &w, &h); i++) {
+        gfx_anima_player_damage(&background, x, y, w, h);
+    }
+}
 
-    uint16_t pallete[16];
+static void run_background()
+{
+    st7789_scroll(0, 0);
+    gfx_anima_player_draw(&background, 0, 0);
+    st7789_overlay_begin();
+}
+#else
+static void update_background()
+{
+}
 
-    if (card_splash_active()) {
-        gen_pallete(pallete, 0x0000ff);
-        gfx_anima_draw(&anima_light, 0, 0, phase, gfx_anima_pallete(PALLETE_LIGHTNING));
+static void run_background()
+{
+    st7789_scroll(0, 0);
+    if (frame.splash) {
+        gfx_anima_draw(&anima_light, 0, 0, frame.phase, gfx_anima_pallete(PALLETE_LIGHTNING));
     } else {
-        uint32_t color = rgb32_from_hsv(time_us_32() / 100000 + 128, 200, 250);
+        uint16_t pallete[16];
+        uint32_t color = rgb32_from_hsv(frame.time / 100000 + 128, 200, 250);
         gen_pallete(pallete, color);
-        gfx_anima_draw(&anima_star, 0, 0, phase, pallete);
+        gfx_anima_draw(&anima_star, 0, 0, frame.phase, pallete);
     }
+    st7789_overlay_begin();
 }
+#endif
 
 typedef struct {
     void (*render)();
     bool (*proc)(cst816t_report_t touch);
+    bool animated; // changes every frame, not to be snapshotted
 } gui_page_t;
 
 static gui_page_t pages[] = {
-    {draw_home, proc_home},
-    {draw_status, NULL},
-    {draw_credits, NULL},
+    {draw_home, proc_home, true},
+    {draw_status, NULL, false},
+    {draw_credits, NULL, false},
 };
 
 #define PAGE_NUM (sizeof(pages) / sizeof(pages[0]))
@@ -305,20 +447,70 @@ static struct {
     bool sliding;
     slide_dir_t dir;
     int phase;
+    uint32_t start;
     int prev_page;
     const uint8_t *curve;
     size_t curve_len;
 } slide;
 
+/* Still pages are recorded once when a slide starts and replayed at each
+   phase. The memory is only there when band mode saves the framebuffer,
+   otherwise (or when a page doesn't fit) pages are rendered live. */
+#ifndef GUI_SNAPSHOT_SIZE
+#if ST7789_BAND_HEIGHT
+#define GUI_SNAPSHOT_SIZE (40 * 1024)
+#else
+#define GUI_SNAPSHOT_SIZE 0
+#endif
+#endif
+
+#if GUI_SNAPSHOT_SIZE
+static struct {
+    uint16_t buf[2][GUI_SNAPSHOT_SIZE / 2]; // for records to be aligned
+    size_t len[2];
+} snapshot;
+#endif
+
+static void take_snapshot(int slot, int page)
+{
+#if GUI_SNAPSHOT_SIZE
+    snapshot.len[slot] = 0;
+    if (pages[page].animated) {
+        return;
+    }
+    st7789_scroll(0, 0);
+    st7789_record_begin(snapshot.buf[slot], sizeof(snapshot.buf[slot]));
+    pages[page].render();
+    snapshot.len[slot] = st7789_record_end();
+#endif
+}
+
+static void render_page(int slot, int page)
+{
+#if GUI_SNAPSHOT_SIZE
+    if (snapshot.len[slot]) {
+        st7789_replay(snapshot.buf[slot], snapshot.len[slot]);
+        return;
+    }
+#endif
+    pages[page].render();
+}
+
 static void start_slide(slide_dir_t dir, int new_page, const uint8_t *curve, size_t curve_len)
 {
     slide.dir = dir;
     slide.prev_page = curr_page;
     slide.sliding = true;
     slide.phase = 0;
+    slide.start = time_us_32();
     curr_page = new_page;
     slide.curve = curve;
     slide.curve_len = curve_len;
+
+    take_snapshot(1, curr_page);
+    if (slide.prev_page != curr_page) {
+        take_snapshot(0, slide.prev_page);
+    }
 }
 
 static uint8_t scroll_curve[] = {
@@ -364,58 +556,74 @@ static void event_proc()
     default_proc(touch);
 }
 
-static void sliding_render()
+static void update_slide()
 {
     if (!slide.sliding) {
         return;
     }
 
+    slide.phase = (frame.time - slide.start) / ANIMA_STEP_US;
+    if (slide.phase >= slide.curve_len) {
+        slide.sliding = false;
+    }
+}
+
+static void sliding_render()
+{
+    if (!slide.sliding) {
+        return;
+    }
 
     int split = slide.curve[slide.phase];
 
     switch (slide.dir) {
         case SLIDE_LEFT:
             st7789_scroll(-split, 0);
-            pages[slide.prev_page].render();
+            render_page(0, slide.prev_page);
             st7789_scroll(240 - split, 0);
-            pages[curr_page].render();
+            render_page(1, curr_page);
             break;
         case SLIDE_RIGHT:
             st7789_scroll(split, 0);
-            pages[slide.prev_page].render();
+            render_page(0, slide.prev_page);
             st7789_scroll(split - 240, 0);
-            pages[curr_page].render();
+            render_page(1, curr_page);
             break;
         case SLIDE_UP:
             st7789_scroll(0, -split);
-            pages[slide.prev_page].render();
+            render_page(0, slide.prev_page);
             st7789_scroll(0, 280 - split);
-            pages[curr_page].render();
+            render_page(1, curr_page);
             break;
         case SLIDE_DOWN:
             st7789_scroll(0, split);
-            pages[slide.prev_page].render();
+            render_page(0, slide.prev_page);
             st7789_scroll(0, split - 280);
-            pages[curr_page].render();
+            render_page(1, curr_page);
             break;
         case HIT_LEFT:
             st7789_scroll(-split, 0);
-            pages[curr_page].render();
+            render_page(1, curr_page);
             break;
         case HIT_RIGHT:
             st7789_scroll(split, 0);
-            pages[curr_page].render();
+            render_page(1, curr_page);
             break;
     }
+}
 
-    slide.phase++;
-    if (slide.phase >= slide.curve_len) {
-        slide.sliding = false;
-        return;
-    }
+static void update_frame()
+{
+    frame.time = time_us_32();
+    gfx_text_cache_next_frame();
+    frame.phase = time_us_64() / ANIMA_STEP_US;
+    frame.splash = card_splash_active();
+    update_background();
+    update_keypad_glow();
+    update_slide();
 }
 
-void gui_loop()
+static void render_frame()
 {
     run_background();
 
@@ -424,12 +632,96 @@ void gui_loop()
     } else {
         pages[curr_page].render();
     }
+}
 
-    st7789_flush(false);
+static struct {
+    uint64_t next;
+    uint64_t last_end;
+    gui_stat_t stat;
+    struct {
+        uint32_t frames;
+        uint32_t dropped;
+        uint32_t render_us;
+        uint32_t flush_us;
+        uint32_t idle_us;
+        uint32_t render_max;
+        uint32_t flush_max;
+        uint64_t start;
+    } acc;
+} sched;
+
+static void sched_account(uint32_t render, uint32_t flush, uint32_t idle, uint64_t now)
+{
+    sched.acc.frames++;
+    sched.acc.render_us += render;
+    sched.acc.flush_us += flush;
+    sched.acc.idle_us += idle;
+    if (render > sched.acc.render_max) {
+        sched.acc.render_max = render;
+    }
+    if (flush > sched.acc.flush_max) {
+        sched.acc.flush_max = flush;
+    }
 
-    /* Control things when updating LCD */
-    gui_level(aic_cfg->lcd.backlight);
+    if (now - sched.acc.start < 1000000) {
+        return;
+    }
+
+    int n = sched.acc.frames;
+    sched.stat = (gui_stat_t) {
+        .fps = n,
+        .target_fps = aic_cfg->lcd.fps,
+        .dropped = sched.acc.dropped,
+        .render_avg = sched.acc.render_us / n,
+        .render_max = sched.acc.render_max,
+        .flush_avg = sched.acc.flush_us / n,
+        .flush_max = sched.acc.flush_max,
+        .idle_avg = sched.acc.idle_us / n,
+    };
+    memset(&sched.acc, 0, sizeof(sched.acc));
+    sched.acc.start = now;
+}
+
+/* Returns false when it's not time for a new frame yet. Frames that
+   couldn't make it in time are dropped, not queued, animations are
+   time based so they just jump ahead. */
+bool gui_loop()
+{
+    /* touch goes on every call, not every frame, so a tap is not
+       left waiting for the next frame to reach HID */
     event_proc();
 
+    uint64_t now = time_us_64();
+    if (now < sched.next) {
+        warm_card_image();
+        return false;
+    }
+
+    uint32_t period = 1000000 / aic_cfg->lcd.fps;
+    uint64_t late = now - sched.next;
+    if (sched.next && (late >= period)) {
+        sched.acc.dropped += late / period;
+    }
+    sched.next = (late >= period) ? now + period : sched.next + period;
+
+    uint32_t idle = sched.last_end ? now - sched.last_end : 0;
+
+    /* previous frame may still be flushing */
     st7789_vsync();
+    uint64_t flushed = time_us_64();
+
+    update_frame();
+    st7789_render(render_frame);
+
+    /* Control things when updating LCD */
+    gui_level(aic_cfg->lcd.backlight);
+
+    sched.last_end = time_us_64();
+    sched_account(sched.last_end - flushed, flushed - now, idle, sched.last_end);
+    return true;
+}
+
+gui_stat_t gui_get_stat()
+{
+    return sched.stat;
 }
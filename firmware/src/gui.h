@@ -15,8 +15,30 @@
 
 void gui_init();
 void gui_level(uint8_t level);
-void gui_loop();
+typedef struct {
+    uint16_t fps;
+    uint16_t target_fps;
+    uint32_t dropped;
+    uint32_t render_avg;
+    uint32_t render_max;
+    uint32_t flush_avg;
+    uint32_t flush_max;
+    uint32_t idle_avg;
+} gui_stat_t;
+
+bool gui_loop();
+gui_stat_t gui_get_stat();
+
+typedef struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint32_t avg_us;
+    uint32_t dropped;
+} gui_touch_stat_t;
+
+gui_touch_stat_t gui_get_touch_stat();
 uint16_t gui_keypad_read();
 void gui_report_card(nfc_card_name card);
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -12,6 +12,8 @@
 #include "hardware/gpio.h"
 #include "hardware/timer.h"
 #include "hardware/pwm.h"
+#include "hardware/structs/sio.h"
+#include "pico/time.h"
 
 #include "board_defs.h"
 
@@ -19,27 +21,90 @@ static const uint8_t keypad_gpio[] = KEYPAD_DEF;
 
 #define KEY_NUM (sizeof(keypad_gpio))
 
-static bool sw_val[KEY_NUM]; /* true if pressed */
-static uint64_t sw_freeze_time[KEY_NUM];
+static uint32_t key_gpio_mask;
 static bool keystuck = false;
 
+/* 2-bit vertical counters, a key flips after 4 consistent samples */
+#define SAMPLE_INTERVAL_US 1000
+static struct {
+    uint16_t state; /* debounced, bit set if pressed */
+    uint16_t cnt0;
+    uint16_t cnt1;
+    repeating_timer_t timer;
+} sampler;
+
+#define EVENT_QUEUE_SIZE 32
+static struct {
+    keypad_event_t events[EVENT_QUEUE_SIZE];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t dropped;
+} queue;
+
+static inline uint16_t sample_keys()
+{
+    uint32_t gpio = ~sio_hw->gpio_in & key_gpio_mask; /* active low */
+    uint16_t keys = 0;
+    for (int i = 0; i < KEY_NUM; i++) {
+        if (gpio & (1 << keypad_gpio[i])) {
+            keys |= (1 << i);
+        }
+    }
+    return keys;
+}
+
+static void queue_event(uint16_t keys, uint16_t changed, uint64_t time)
+{
+    uint32_t head = queue.head;
+    if (head - queue.tail >= EVENT_QUEUE_SIZE) {
+        queue.dropped++;
+        return;
+    }
+    queue.events[head % EVENT_QUEUE_SIZE] = (keypad_event_t) {
+        .keys = keys,
+        .changed = changed,
+        .time = time,
+    };
+    queue.head = head + 1;
+}
+
+static bool sampler_cb(repeating_timer_t *rt)
+{
+    uint16_t delta = sample_keys() ^ sampler.state;
+
+    /* counters run only while a key differs from its debounced state */
+    sampler.cnt1 = (sampler.cnt1 ^ sampler.cnt0) & delta;
+    sampler.cnt0 = ~sampler.cnt0 & delta;
+
+    uint16_t toggle = delta & ~(sampler.cnt0 | sampler.cnt1);
+    if (toggle) {
+        sampler.state ^= toggle;
+        queue_event(sampler.state, toggle, time_us_64());
+    }
+
+    return true;
+}
+
 void keypad_init()
 {
+    key_gpio_mask = 0;
     for (int i = 0; i < KEY_NUM; i++) {
-        sw_val[i] = false;
-        sw_freeze_time[i] = 0;
         int8_t gpio = keypad_gpio[i];
         gpio_init(gpio);
         gpio_set_function(gpio, GPIO_FUNC_SIO);
         gpio_set_dir(gpio, GPIO_IN);
         gpio_pull_up(gpio);
+        key_gpio_mask |= (1 << gpio);
     }
-    for (int i = 0; i < KEY_NUM; i++) {
-        if (gpio_get(keypad_gpio[i]) == 0) {
-            keystuck = true;
-            break;
-        }
+
+    sleep_us(10);
+    if (sample_keys()) {
+        keystuck = true;
+        return;
     }
+
+    /* runs from timer irq, so keys are sampled even when core0 is blocked */
+    add_repeating_timer_us(-SAMPLE_INTERVAL_US, sampler_cb, NULL, &sampler.timer);
 }
 
 uint8_t keypad_key_num()
@@ -52,39 +117,23 @@ bool keypad_is_stuck()
     return keystuck;
 }
 
-static uint16_t keypad_reading;
-
-/* If a switch flips, it freezes for a while */
-#define DEBOUNCE_FREEZE_TIME_US 20000
-void keypad_update()
+uint16_t keypad_read()
 {
-    if (keystuck) {
-        return;
-    }
-
-    uint64_t now = time_us_64();
-    uint16_t keys = 0;
-
-    for (int i = KEY_NUM - 1; i >= 0; i--) {
-        bool sw_pressed = !gpio_get(keypad_gpio[i]);
-        
-        if (now >= sw_freeze_time[i]) {
-            if (sw_pressed != sw_val[i]) {
-                sw_val[i] = sw_pressed;
-                sw_freeze_time[i] = now + DEBOUNCE_FREEZE_TIME_US;
-            }
-        }
+    return sampler.state;
+}
 
-        keys <<= 1;
-        if (sw_val[i]) {
-            keys |= 1;
-        }
+bool keypad_get_event(keypad_event_t *event)
+{
+    uint32_t tail = queue.tail;
+    if (tail == queue.head) {
+        return false;
     }
-
-    keypad_reading = keys;
+    *event = queue.events[tail % EVENT_QUEUE_SIZE];
+    queue.tail = tail + 1;
+    return true;
 }
 
-uint16_t keypad_read()
+uint32_t keypad_dropped_events()
 {
-    return keypad_reading;
+    return queue.dropped;
 }
@@ -9,10 +9,18 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+typedef struct {
+    uint16_t keys; /* key state after this event, bit set if pressed */
+    uint16_t changed;
+    uint64_t time; /* when the change was sampled */
+} keypad_event_t;
+
 void keypad_init();
 uint8_t keypad_key_num();
 bool keypad_is_stuck();
-void keypad_update();
 uint16_t keypad_read();
 
+bool keypad_get_event(keypad_event_t *event);
+uint32_t keypad_dropped_events();
+
 #endif
@@ -16,9 +16,11 @@
 
 #include "nfc.h"
 #include "aime.h"
+#include "logger.h"
 
 static bool debug = false;
-#define DEBUG(...) if (nfc_runtime.debug) printf(__VA_ARGS__)
+#define DEBUG(...) LOG_DEBUG(__VA_ARGS__)
+#define DEBUG_HEX(data, len) LOG_HEX(LOG_LEVEL_DEBUG, data, len)
 
 #define AIME_EXPIRE_US (1200 * 1000000ULL)
 #define AIME_FAST_EXPIRE_US (3 * 1000000ULL)
@@ -67,158 +69,185 @@ enum {
 const char *fw_version[] = { "TN32MSEC003S F/W Ver1.2", "\x94" };
 const char *hw_version[] = { "TN32MSEC003S H/W Ver3.0", "837-15396" };
 const char *led_info[] = { "15084\xFF\x10\x00\x12", "000-00000\xFF\x11\x40" };
-static int ver_mode = 1;
-static bool expecting_dtr_off = false;
-static uint64_t expected_dtr_off_time = 0;
-
-static struct {
-    bool enabled;
-    bool active; // currently active
-    uint8_t idm[8];
-    const uint8_t pmm[8];
-    const uint8_t syscode[2];
-} virtual_aic = { false, false, 
-                  "", "\x00\xf1\x00\x00\x00\x01\x43\x00", "\x88\xb4" };
-
-static void putc_trap(uint8_t byte)
+
+static bool virtual_aic_enabled = false;
+static const uint8_t virtual_aic_pmm[8] = "\x00\xf1\x00\x00\x00\x01\x43\x00";
+
+struct aime_ctx {
+    int port;
+    aime_putc_func putc;
+    int ver_mode;
+    bool expecting_dtr_off;
+    uint64_t expected_dtr_off_time;
+    uint64_t expire_time;
+    uint32_t led_color;
+    bool polling; // host asked for the RF field
+
+    struct {
+        bool active; // currently active
+        uint8_t idm[8];
+    } virtual_aic;
+
+    uint8_t mifare_keys[2][6]; // 'KeyA' and 'KeyB'
+
+    union __attribute__((packed)) {
+        struct {
+            uint8_t len;
+            uint8_t addr;
+            uint8_t seq;
+            uint8_t cmd;
+            uint8_t status;
+            uint8_t payload_len;
+            uint8_t payload[];
+        };
+        uint8_t raw[256];
+    } response;
+
+    union __attribute__((packed)) {
+        struct {
+            uint8_t len;
+            uint8_t addr;
+            uint8_t seq;
+            uint8_t cmd;
+            uint8_t payload_len;
+            union {
+                struct {
+                    uint8_t uid[4];
+                    uint8_t block_id;
+                } mifare;
+                struct {
+                    uint8_t idm[8];
+                    uint8_t len;
+                    uint8_t code;
+                    uint8_t data[0];
+                } felica;
+                uint8_t payload[250];
+            };
+        };
+        uint8_t raw[256];
+    } request;
+
+    struct {
+        bool active;
+        uint8_t len;
+        uint8_t check_sum;
+        bool escaping;
+        uint64_t time;
+    } req_ctx;
+};
+
+static aime_ctx_t instances[AIME_MAX_INSTANCES];
+static int instance_num = 0;
+
+static void putc_trap(int port, uint8_t byte)
 {
 }
 
-static aime_putc_func aime_putc = putc_trap;
-
-void aime_sub_mode(int sub_mode)
+void aime_sub_mode(aime_ctx_t *ctx, int sub_mode)
 {
-    ver_mode = (sub_mode == 0) ? 0 : 1;
+    ctx->ver_mode = (sub_mode == 0) ? 0 : 1;
 }
 
-const char *aime_get_mode_string()
+const char *aime_get_mode_string(int sub_mode)
 {
-    return hw_version[ver_mode];
+    return hw_version[(sub_mode == 0) ? 0 : 1];
 }
 
-void aime_init(aime_putc_func putc_func)
+aime_ctx_t *aime_init(aime_putc_func putc_func, int port)
 {
-    aime_putc = putc_func;
+    if (instance_num >= AIME_MAX_INSTANCES) {
+        return NULL;
+    }
+
+    aime_ctx_t *ctx = &instances[instance_num++];
+    ctx->port = port;
+    ctx->putc = putc_func ? putc_func : putc_trap;
+    ctx->ver_mode = 1;
+    return ctx;
 }
 
 void aime_virtual_aic(bool enable)
 {
-    virtual_aic.enabled = enable;
+    virtual_aic_enabled = enable;
 }
 
-static uint8_t mifare_keys[2][6]; // 'KeyA' and 'KeyB'
-
-static union __attribute__((packed)) {
-    struct {
-        uint8_t len;
-        uint8_t addr;
-        uint8_t seq;
-        uint8_t cmd;
-        uint8_t status;
-        uint8_t payload_len;
-        uint8_t payload[];
-    };
-    uint8_t raw[256];
-} response;
-
-static union __attribute__((packed)) {
-    struct {
-        uint8_t len;
-        uint8_t addr;
-        uint8_t seq;
-        uint8_t cmd;
-        uint8_t payload_len;
-        union {
-            struct {
-                uint8_t uid[4];
-                uint8_t block_id;
-            } mifare;
-            struct {
-                uint8_t idm[8];
-                uint8_t len;
-                uint8_t code;
-                uint8_t data[0];
-            } felica;
-            uint8_t payload[250];
-        };
-    };
-    uint8_t raw[256];
-} request;
-
-static struct {
-    bool active;
-    uint8_t len;
-    uint8_t check_sum;
-    bool escaping;
-    uint64_t time;
-} req_ctx;
-
-static void build_response(int payload_len)
+static void build_response(aime_ctx_t *ctx, int payload_len)
 {
-    response.len = payload_len + 6;
-    response.addr = request.addr;
-    response.seq = request.seq;
-    response.cmd = request.cmd;
-    response.status = STATUS_OK;
-    response.payload_len = payload_len;
+    ctx->response.len = payload_len + 6;
+    ctx->response.addr = ctx->request.addr;
+    ctx->response.seq = ctx->request.seq;
+    ctx->response.cmd = ctx->request.cmd;
+    ctx->response.status = STATUS_OK;
+    ctx->response.payload_len = payload_len;
 }
 
-static void send_response()
+static void send_response(aime_ctx_t *ctx)
 {
     uint8_t checksum = 0;
-    for (int i = 0; i < response.len; i++) {
-        checksum += response.raw[i];
+    for (int i = 0; i < ctx->response.len; i++) {
+        checksum += ctx->response.raw[i];
     }
-    response.raw[response.len] = checksum;
+    ctx->response.raw[ctx->response.len] = checksum;
 
-    aime_putc(0xe0); // sync
+    ctx->putc(ctx->port, 0xe0); // sync
 
-    for (int i = 0; i < response.len + 1; i++) {
-        uint8_t c = response.raw[i];
+    for (int i = 0; i < ctx->response.len + 1; i++) {
+        uint8_t c = ctx->response.raw[i];
         if (c == 0xe0 || c == 0xd0) {
-            aime_putc(0xd0); // escape
+            ctx->putc(ctx->port, 0xd0); // escape
             c--;
         }
-        aime_putc(c);
+        ctx->putc(ctx->port, c);
     }
 
-    DEBUG("\n\033[33m%6ld<< %02x:", time_us_32() / 1000, response.cmd);
-    for (int i = 0; i < response.payload_len; i++) {
-        DEBUG(" %02x", response.payload[i]);
-    }
+    DEBUG("\n\033[33m%6ld<< %02x:", time_us_32() / 1000, ctx->response.cmd);
+    DEBUG_HEX(ctx->response.payload, ctx->response.payload_len);
     DEBUG("\033[0m");
 }
 
-static void send_simple_response(uint8_t status)
+static void send_simple_response(aime_ctx_t *ctx, uint8_t status)
 {
-    build_response(0);
-    response.status = status;
-    send_response();
+    build_response(ctx, 0);
+    ctx->response.status = status;
+    send_response(ctx);
 }
 
-static void cmd_to_normal_mode()
+static void cmd_to_normal_mode(aime_ctx_t *ctx)
 {
-    send_simple_response(STATUS_INVALID_COMMAND);
+    send_simple_response(ctx, STATUS_INVALID_COMMAND);
 }
 
-static void cmd_fake_version(const char *version[])
+static void cmd_fake_version(aime_ctx_t *ctx, const char *version[])
 {
-    int len = strlen(version[ver_mode]);
-    build_response(len);
-    memcpy(response.payload, version[ver_mode], len);
-    send_response();
+    int len = strlen(version[ctx->ver_mode]);
+    build_response(ctx, len);
+    memcpy(ctx->response.payload, version[ctx->ver_mode], len);
+    send_response(ctx);
 }
 
-static void cmd_key_set(uint8_t key[6])
+static void cmd_key_set(aime_ctx_t *ctx, uint8_t key[6])
 {
-    memcpy(key, request.payload, 6);
-    send_simple_response(STATUS_OK);
+    memcpy(key, ctx->request.payload, 6);
+    send_simple_response(ctx, STATUS_OK);
+}
+
+/* the RF field is shared by all ports, it goes off only when no active
+   instance still polls */
+static bool polling_wanted()
+{
+    for (int i = 0; i < instance_num; i++) {
+        if (instances[i].polling && aime_ctx_is_active(&instances[i])) {
+            return true;
+        }
+    }
+    return false;
 }
 
-static void cmd_set_polling(bool enabled)
+static void cmd_set_polling(aime_ctx_t *ctx, bool enabled)
 {
-    nfc_rf_field(enabled);
-    send_simple_response(STATUS_OK);
+    ctx->polling = enabled;
+    nfc_rf_field(enabled || polling_wanted());
+    send_simple_response(ctx, STATUS_OK);
 }
 
 typedef struct __attribute__((packed)) {
@@ -234,27 +263,25 @@ typedef struct __attribute__((packed)) {
     };
 } card_info_t;
 
-static void handle_mifare_card(const uint8_t *uid, int len)
+static void handle_mifare_card(aime_ctx_t *ctx, const uint8_t *uid, int len)
 {
-    card_info_t *card = (card_info_t *) response.payload;
+    card_info_t *card = (card_info_t *) ctx->response.payload;
 
-    build_response(len > 4 ? 10 : 7);
+    build_response(ctx, len > 4 ? 10 : 7);
 
     card->count = 1;
     card->type = 0x10;
     card->id_len = len;
     memcpy(card->uid, uid, len);
 
-    printf("\nMIFARE Card:");
-    for (int i = 0; i < len; i++) {
-        printf(" %02x", uid[i]);
-    }
+    LOG_INFO("\nMIFARE Card:");
+    LOG_HEX(LOG_LEVEL_INFO, uid, len);
 }
 
-static void handle_felica_card(const uint8_t idm[8], const uint8_t pmm[8])
+static void handle_felica_card(aime_ctx_t *ctx, const uint8_t idm[8], const uint8_t pmm[8])
 {
-    build_response(19);
-    card_info_t *card = (card_info_t *) response.payload;
+    build_response(ctx, 19);
+    card_info_t *card = (card_info_t *) ctx->response.payload;
 
     card->count = 1;
     card->type = 0x20;
@@ -263,28 +290,28 @@ static void handle_felica_card(const uint8_t idm[8], const uint8_t pmm[8])
     memcpy(card->pmm, pmm, 8);
 }
 
-static void fake_felica_card()
+static void fake_felica_card(aime_ctx_t *ctx)
 {
-    build_response(19);
-    card_info_t *card = (card_info_t *) response.payload;
+    build_response(ctx, 19);
+    card_info_t *card = (card_info_t *) ctx->response.payload;
 
     card->count = 1;
     card->type = 0x20;
     card->id_len = 16;
-    memcpy(card->idm, virtual_aic.idm, 8);
-    memcpy(card->pmm, virtual_aic.pmm, 8);
+    memcpy(card->idm, ctx->virtual_aic.idm, 8);
+    memcpy(card->pmm, virtual_aic_pmm, 8);
 }
 
-static void handle_no_card()
+static void handle_no_card(aime_ctx_t *ctx)
 {
-    build_response(1);
-    card_info_t *card = (card_info_t *) response.payload;
+    build_response(ctx, 1);
+    card_info_t *card = (card_info_t *) ctx->response.payload;
 
     card->count = 0;
-    response.status = STATUS_OK;
+    ctx->response.status = STATUS_OK;
 }
 
-static void cmd_detect_card()
+static void cmd_detect_card(aime_ctx_t *ctx)
 {
     nfc_card_t card = nfc_detect_card();
     if (debug) {
@@ -293,262 +320,264 @@ static void cmd_detect_card()
 
     switch (card.card_type) {
         case NFC_CARD_MIFARE:
-            if (virtual_aic.enabled) {
-                printf("\nVirtual FeliCa from MIFARE.");
-                virtual_aic.active = true;
-                memcpy(virtual_aic.idm, "\x01\x01", 2);
+            if (virtual_aic_enabled) {
+                LOG_INFO("\nVirtual FeliCa from MIFARE.");
+                ctx->virtual_aic.active = true;
+                memcpy(ctx->virtual_aic.idm, "\x01\x01", 2);
                 if (card.len == 4) {
-                    memcpy(virtual_aic.idm + 2, card.uid, 4);
-                    memcpy(virtual_aic.idm + 6, card.uid, 2);
+                    memcpy(ctx->virtual_aic.idm + 2, card.uid, 4);
+                    memcpy(ctx->virtual_aic.idm + 6, card.uid, 2);
                 } else if (card.len == 7) {
-                    memcpy(virtual_aic.idm + 2, card.uid, 6);
+                    memcpy(ctx->virtual_aic.idm + 2, card.uid, 6);
                 }
-                fake_felica_card();
+                fake_felica_card(ctx);
             } else {
-                handle_mifare_card(card.uid, card.len);
+                handle_mifare_card(ctx, card.uid, card.len);
             }
             break;
         case NFC_CARD_FELICA:
-            if (virtual_aic.enabled) {
-                printf("\nVirtual FeliCa from FeliCa.");
-                virtual_aic.active = true;
-                memcpy(virtual_aic.idm, card.uid, 8);
-                fake_felica_card();
+            if (virtual_aic_enabled) {
+                LOG_INFO("\nVirtual FeliCa from FeliCa.");
+                ctx->virtual_aic.active = true;
+                memcpy(ctx->virtual_aic.idm, card.uid, 8);
+                fake_felica_card(ctx);
             } else {
-                handle_felica_card(card.uid, card.pmm);
+                handle_felica_card(ctx, card.uid, card.pmm);
             }
             break;
         case NFC_CARD_VICINITY:
-            if (virtual_aic.enabled) {
-                printf("\nVirtual FeliCa from 15693.");
-                virtual_aic.active = true;
-                memcpy(virtual_aic.idm, card.uid, 8);
-                virtual_aic.idm[0] = 0x01;
-                fake_felica_card();
+            if (virtual_aic_enabled) {
+                LOG_INFO("\nVirtual FeliCa from 15693.");
+                ctx->virtual_aic.active = true;
+                memcpy(ctx->virtual_aic.idm, card.uid, 8);
+                ctx->virtual_aic.idm[0] = 0x01;
+                fake_felica_card(ctx);
             }
             break;
         default:
-            handle_no_card();
+            handle_no_card(ctx);
             break;
     }
 
-    send_response();
+    send_response(ctx);
     if (card.card_type != NFC_CARD_NONE) {
         nfc_identify_last_card();
     }
 }
 
-static void cmd_card_select()
+static void cmd_card_select(aime_ctx_t *ctx)
 {
-    send_simple_response(STATUS_OK);
+    send_simple_response(ctx, STATUS_OK);
 }
 
-static void cmd_mifare_auth(int type)
+static void cmd_mifare_auth(aime_ctx_t *ctx, int type)
 {
-    const uint8_t *key = mifare_keys[type];
-    nfc_mifare_auth(request.mifare.uid, request.mifare.block_id,
+    const uint8_t *key = ctx->mifare_keys[type];
+    nfc_mifare_auth(ctx->request.mifare.uid, ctx->request.mifare.block_id,
                     type, key);
-    send_simple_response(STATUS_OK);
+    send_simple_response(ctx, STATUS_OK);
 }
 
-static void cmd_mifare_read()
+static void cmd_mifare_read(aime_ctx_t *ctx)
 {
-    build_response(16);
-    memset(response.payload, 0, 16);
-    nfc_mifare_read(request.mifare.block_id, response.payload);
-    send_response();
+    build_response(ctx, 16);
+    memset(ctx->response.payload, 0, 16);
+    nfc_mifare_read(ctx->request.mifare.block_id, ctx->response.payload);
+    send_response(ctx);
 }
 
-static void cmd_mifare_halt()
+static void cmd_mifare_halt(aime_ctx_t *ctx)
 {
-    send_simple_response(STATUS_OK);
+    send_simple_response(ctx, STATUS_OK);
 }
 
-static void cmd_felica()
+static void cmd_felica(aime_ctx_t *ctx)
 {
-    send_simple_response(STATUS_INVALID_COMMAND);
-    expecting_dtr_off = true;
-    expected_dtr_off_time = time_us_64() + 50000ULL;
+    send_simple_response(ctx, STATUS_INVALID_COMMAND);
+    ctx->expecting_dtr_off = true;
+    ctx->expected_dtr_off_time = time_us_64() + 50000ULL;
 }
 
-static uint32_t led_color;
-
-static void cmd_led_rgb()
+static void cmd_led_rgb(aime_ctx_t *ctx)
 {
-    uint8_t r = request.payload[0];
-    uint8_t g = request.payload[1];
-    uint8_t b = request.payload[2];
-    led_color = r << 16 | g << 8 | b;
+    uint8_t r = ctx->request.payload[0];
+    uint8_t g = ctx->request.payload[1];
+    uint8_t b = ctx->request.payload[2];
+    ctx->led_color = r << 16 | g << 8 | b;
 
-    build_response(0);
-    send_response();
+    build_response(ctx, 0);
+    send_response(ctx);
 
-    expecting_dtr_off = true;
-    expected_dtr_off_time = time_us_64() + 400000ULL;
+    ctx->expecting_dtr_off = true;
+    ctx->expected_dtr_off_time = time_us_64() + 400000ULL;
 }
 
-static void handle_frame()
+static void handle_frame(aime_ctx_t *ctx)
 {
-    DEBUG("\n\033[32mAime %d:%02x >>", request.payload_len, request.cmd);
-    for (int i = 0; i < request.payload_len; i++) {
-        DEBUG(" %02x", request.payload[i]);
-    }
+    DEBUG("\n\033[32mAime %d:%02x >>", ctx->request.payload_len, ctx->request.cmd);
+    DEBUG_HEX(ctx->request.payload, ctx->request.payload_len);
     DEBUG("\033[0m");
 
-    switch (request.cmd) {
+    switch (ctx->request.cmd) {
         case CMD_TO_NORMAL_MODE:
             DEBUG("\nAIME: cmd_to_normal");
-            cmd_to_normal_mode();
+            cmd_to_normal_mode(ctx);
             break;
         case CMD_GET_FW_VERSION:
             DEBUG("\nAIME: fw_version");
-            cmd_fake_version(fw_version);
+            cmd_fake_version(ctx, fw_version);
             break;
         case CMD_GET_HW_VERSION:
             DEBUG("\nAIME: hw_version");
-            cmd_fake_version(hw_version);
+            cmd_fake_version(ctx, hw_version);
             break;
         case CMD_MIFARE_KEY_SET_A:
             DEBUG("\nAIME: key A");
-            cmd_key_set(mifare_keys[0]);
+            cmd_key_set(ctx, ctx->mifare_keys[0]);
             break;
         case CMD_MIFARE_KEY_SET_B:
             DEBUG("\nAIME: key B");
-            cmd_key_set(mifare_keys[1]);
+            cmd_key_set(ctx, ctx->mifare_keys[1]);
             break;
 
         case CMD_START_POLLING:
-            cmd_set_polling(true);
+            cmd_set_polling(ctx, true);
             break;
         case CMD_STOP_POLLING:
-            cmd_set_polling(false);
+            cmd_set_polling(ctx, false);
             break;
         case CMD_CARD_DETECT:
-            cmd_detect_card();
+            cmd_detect_card(ctx);
             break;
 
         case CMD_FELICA_PUSH:
         case CMD_FELICA_OP:
             DEBUG("\nAIME: felica op");
-            cmd_felica();
+            cmd_felica(ctx);
             break;
 
         case CMD_CARD_SELECT:
             DEBUG("\nAIME: card select");
-            cmd_card_select();
+            cmd_card_select(ctx);
             break;
         
         case CMD_MIFARE_AUTHORIZE_A:
             DEBUG("\nAIME: auth A");
-            cmd_mifare_auth(0);
+            cmd_mifare_auth(ctx, 0);
             break;
 
         case CMD_MIFARE_AUTHORIZE_B:
             DEBUG("\nAIME: auth B");
-            cmd_mifare_auth(1);
+            cmd_mifare_auth(ctx, 1);
             break;
         
         case CMD_MIFARE_READ:
             DEBUG("\nAIME: mifare read");
-            cmd_mifare_read();
+            cmd_mifare_read(ctx);
             break;
 
         case CMD_CARD_HALT:
             DEBUG("\nAIME: mifare halt");
-            cmd_mifare_halt();
+            cmd_mifare_halt(ctx);
             break;
 
         case CMD_EXT_BOARD_INFO:
             DEBUG("\nAIME: led info");
-            cmd_fake_version(led_info);
+            cmd_fake_version(ctx, led_info);
             break;
         case CMD_EXT_BOARD_LED_RGB:
             DEBUG("\nAIME: led rgb");
-            cmd_led_rgb();
+            cmd_led_rgb(ctx);
             break;
 
         case CMD_SEND_HEX_DATA:
         case CMD_EXT_TO_NORMAL_MODE:
-            DEBUG("\nAIME: hex data or ex to normal: %d", request.cmd);
-            send_simple_response(STATUS_OK);
+            DEBUG("\nAIME: hex data or ex to normal: %d", ctx->request.cmd);
+            send_simple_response(ctx, STATUS_OK);
             break;
 
         default:
-            DEBUG("\nUnknown command: %02x [", request.cmd);
-            for (int i = 0; i < request.len; i++) {
-                DEBUG(" %02x", request.raw[i]);
-            }
+            DEBUG("\nUnknown command: %02x [", ctx->request.cmd);
+            DEBUG_HEX(ctx->request.raw, ctx->request.len);
             DEBUG("]");
-            send_simple_response(STATUS_OK);
+            send_simple_response(ctx, STATUS_OK);
             break;
     }
 }
 
-static uint64_t expire_time;
-
-bool aime_feed(int c)
+bool aime_feed(aime_ctx_t *ctx, int c)
 {
     if (c == 0xe0) {
-        req_ctx.active = true;
-        req_ctx.len = 0;
-        req_ctx.check_sum = 0;
-        req_ctx.escaping = false;
-        req_ctx.time = time_us_64();
+        ctx->req_ctx.active = true;
+        ctx->req_ctx.len = 0;
+        ctx->req_ctx.check_sum = 0;
+        ctx->req_ctx.escaping = false;
+        ctx->req_ctx.time = time_us_64();
         return true;
     }
 
-    if (!req_ctx.active) {
+    if (!ctx->req_ctx.active) {
         return false;
     }
 
     if (c == 0xd0) {
-        req_ctx.escaping = true;
+        ctx->req_ctx.escaping = true;
         return true;
     }
 
-    if (req_ctx.escaping) {
+    if (ctx->req_ctx.escaping) {
         c++;
-        req_ctx.escaping = false;
+        ctx->req_ctx.escaping = false;
     }
 
-    if (req_ctx.len != 0 && req_ctx.len == request.len) {
-        if (req_ctx.check_sum == c) {
-            handle_frame();
-            req_ctx.active = false;
-            expire_time = time_us_64() + AIME_EXPIRE_US;
+    if (ctx->req_ctx.len != 0 && ctx->req_ctx.len == ctx->request.len) {
+        if (ctx->req_ctx.check_sum == c) {
+            handle_frame(ctx);
+            ctx->req_ctx.active = false;
+            ctx->expire_time = time_us_64() + AIME_EXPIRE_US;
         }
         return true;
     }
 
-    request.raw[req_ctx.len] = c;
-    req_ctx.len++;
-    req_ctx.check_sum += c;
+    ctx->request.raw[ctx->req_ctx.len] = c;
+    ctx->req_ctx.len++;
+    ctx->req_ctx.check_sum += c;
 
     return true;
 }
 
+bool aime_ctx_is_active(const aime_ctx_t *ctx)
+{
+    return time_us_64() < ctx->expire_time;
+}
+
 bool aime_is_active()
 {
-    return time_us_64() < expire_time;
+    for (int i = 0; i < instance_num; i++) {
+        if (aime_ctx_is_active(&instances[i])) {
+            return true;
+        }
+    }
+    return false;
 }
 
-void aime_dtr_off()
+void aime_dtr_off(aime_ctx_t *ctx)
 {
-    if ((expecting_dtr_off) &&
-        (abs(time_us_64() - expected_dtr_off_time) < 70000ULL)) {
-        expecting_dtr_off = false;
+    if ((ctx->expecting_dtr_off) &&
+        (abs(time_us_64() - ctx->expected_dtr_off_time) < 70000ULL)) {
+        ctx->expecting_dtr_off = false;
         return;
     }
 
-    if (!aime_is_active()) {
+    if (!aime_ctx_is_active(ctx)) {
         return;
     }
 
-    DEBUG("\nAIME: DTR_OFF delta: %lld", time_us_64() - expected_dtr_off_time);
-    expire_time = time_us_64() + AIME_FAST_EXPIRE_US;
+    DEBUG("\nAIME: DTR_OFF delta: %ld", (int32_t)(time_us_64() - ctx->expected_dtr_off_time));
+    ctx->expire_time = time_us_64() + AIME_FAST_EXPIRE_US;
 }
 
-uint32_t aime_led_color()
+uint32_t aime_led_color(const aime_ctx_t *ctx)
 {
-    return led_color;
+    return ctx->led_color;
 }
@@ -16,31 +16,15 @@
 
 #include "nfc.h"
 #include "bana.h"
+#include "logger.h"
 
 static bool debug = false;
-#define DEBUG(...) if (nfc_runtime.debug) printf(__VA_ARGS__)
+#define DEBUG(...) LOG_DEBUG(__VA_ARGS__)
+#define DEBUG_HEX(data, len) LOG_HEX(LOG_LEVEL_DEBUG, data, len)
 
 #define BANA_EXPIRE_US (1200 * 1000000ULL)
 #define BANA_FAST_EXPIRE_US (3 * 1000000ULL)
 
-static void putc_trap(uint8_t byte)
-{
-}
-
-static bana_putc_func bana_putc = putc_trap;
-
-static void bana_puts(const char *str, size_t len)
-{
-    for (size_t i = 0; i < len; i++) {
-        bana_putc(str[i]);
-    }
-}
-
-void bana_init(bana_putc_func putc_func)
-{
-    bana_putc = putc_func;
-}
-
 typedef union __attribute__((packed)) {
     struct {
         struct {
@@ -73,13 +57,6 @@ typedef struct __attribute__((packed)) {
     };
 } card_report_t;
 
-static message_t request, response;
-
-static struct {
-    uint8_t frame_len;
-    uint32_t time;
-} req_ctx;
-
 typedef struct __attribute__((packed)) {
     uint8_t count;
     uint8_t type;
@@ -93,81 +70,114 @@ typedef struct __attribute__((packed)) {
     };
 } card_info_t;
 
-static uint64_t expire_time;
+struct bana_ctx {
+    int port;
+    bana_putc_func putc;
+    uint64_t expire_time;
+    message_t request;
+    message_t response;
+    struct {
+        uint8_t frame_len;
+        uint32_t time;
+    } req_ctx;
+    struct {
+        int led;
+        int beep;
+    } gpio;
+};
+
+static bana_ctx_t instances[BANA_MAX_INSTANCES];
+static int instance_num = 0;
+
+static void putc_trap(int port, uint8_t byte)
+{
+}
+
+bana_ctx_t *bana_init(bana_putc_func putc_func, int port)
+{
+    if (instance_num >= BANA_MAX_INSTANCES) {
+        return NULL;
+    }
+
+    bana_ctx_t *ctx = &instances[instance_num++];
+    ctx->port = port;
+    ctx->putc = putc_func ? putc_func : putc_trap;
+    return ctx;
+}
+
+static void bana_puts(bana_ctx_t *ctx, const char *str, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        ctx->putc(ctx->port, str[i]);
+    }
+}
 
-static void send_response()
+static void send_response(bana_ctx_t *ctx)
 {
     uint8_t checksum = 0xff;
-    for (int i = 0; i < response.hdr.len; i++) {
-        checksum += response.raw[5 + i];
+    for (int i = 0; i < ctx->response.hdr.len; i++) {
+        checksum += ctx->response.raw[5 + i];
     }
 
-    memcpy(response.hdr.padding, "\x00\x00\xff", 3);
-    response.hdr.len_check = ~response.hdr.len + 1;
+    memcpy(ctx->response.hdr.padding, "\x00\x00\xff", 3);
+    ctx->response.hdr.len_check = ~ctx->response.hdr.len + 1;
 
-    response.raw[5 + response.hdr.len] = ~checksum;
-    response.raw[6 + response.hdr.len] = 0;
+    ctx->response.raw[5 + ctx->response.hdr.len] = ~checksum;
+    ctx->response.raw[6 + ctx->response.hdr.len] = 0;
 
-    int total_len = 7 + response.hdr.len;
-    bana_puts((const char *)response.raw, total_len);
+    int total_len = 7 + ctx->response.hdr.len;
+    bana_puts(ctx, (const char *)ctx->response.raw, total_len);
 
-    DEBUG("\n\033[33m%6ld<< %02x", time_us_32() / 1000, response.cmd);
-    for (int i = 0; i < response.hdr.len - 2; i++) {
-        DEBUG(" %02x", response.data[i]);
-    }
+    DEBUG("\n\033[33m%6ld<< %02x", time_us_32() / 1000, ctx->response.cmd);
+    DEBUG_HEX(ctx->response.data, ctx->response.hdr.len - 2);
     DEBUG("\033[0m");
 }
 
-static void send_response_data(const void *data, int len)
+static void send_response_data(bana_ctx_t *ctx, const void *data, int len)
 {
-    response.hdr.len = 2 + len;
-    response.dir = 0xd5;
-    response.cmd = request.cmd + 1;
+    ctx->response.hdr.len = 2 + len;
+    ctx->response.dir = 0xd5;
+    ctx->response.cmd = ctx->request.cmd + 1;
     if (len) {
-        memcpy(response.data, data, len);
+        memcpy(ctx->response.data, data, len);
     }
-    send_response();
+    send_response(ctx);
 }
 
-static void send_simple_response()
+static void send_simple_response(bana_ctx_t *ctx)
 {
-    send_response_data(NULL, 0);
+    send_response_data(ctx, NULL, 0);
 }
 
-static void send_ack()
+static void send_ack(bana_ctx_t *ctx)
 {
-    bana_puts("\x00\x00\xff\x00\xff\x00", 6);
+    bana_puts(ctx, "\x00\x00\xff\x00\xff\x00", 6);
 }
 
-static struct {
-    int led;
-    int beep;
-} bana_gpio;
-
-static void cmd_gpio()
+static void cmd_gpio(bana_ctx_t *ctx)
 {
-    if (request.data[0] == 0x01) {
-        DEBUG("\nLED:%02x", request.data[1]);
-        bana_gpio.led = request.data[1];
-    } else if (request.data[0] == 0x08) {
-        DEBUG("\nBEEP:%02x", request.data[1]);
-        bana_gpio.beep = request.data[1];
+    if (ctx->request.data[0] == 0x01) {
+        DEBUG("\nLED:%02x", ctx->request.data[1]);
+        ctx->gpio.led = ctx->request.data[1];
+    } else if (ctx->request.data[0] == 0x08) {
+        DEBUG("\nBEEP:%02x", ctx->request.data[1]);
+        ctx->gpio.beep = ctx->request.data[1];
     }
 
-    send_simple_response(0x0e);
+    send_simple_response(ctx);
 }
 
-static void cmd_rf_field()
+static void cmd_rf_field(bana_ctx_t *ctx)
 {
-    if (memcmp(request.data, "\x01\x00", 2) == 0) {
+    if (memcmp(ctx->request.data, "\x01\x00", 2) == 0) {
         nfc_rf_field(false);
     } else {
         nfc_rf_field(true);
     }
-    send_simple_response(request.cmd);
+    send_simple_response(ctx);
 }
 
-static void handle_mifare(const uint8_t uid[4])
+static void handle_mifare(bana_ctx_t *ctx, const uint8_t uid[4])
 {
     card_report_t card;
 
@@ -179,10 +189,10 @@ static void handle_mifare(const uint8_t uid[4])
     card.mifare.unk = 0x04;
     memcpy(card.mifare.uid, uid, 4);
 
-    send_response_data(&card, 10);
+    send_response_data(ctx, &card, 10);
 }
 
-static void handle_felica(const uint8_t idm[8], const uint8_t pmm[8],
+static void handle_felica(bana_ctx_t *ctx, const uint8_t idm[8], const uint8_t pmm[8],
                           const uint8_t system_code[2])
 {
     card_report_t card;
@@ -193,36 +203,36 @@ static void handle_felica(const uint8_t idm[8], const uint8_t pmm[8],
     memcpy(card.felica.idm, idm, 8);
     memcpy(card.felica.pmm, pmm, 8);
     memcpy(card.felica.system_code, system_code, 2);
-    send_response_data(&card, sizeof(card));
+    send_response_data(ctx, &card, sizeof(card));
 }
 
-static void handle_no_card()
+static void handle_no_card(bana_ctx_t *ctx)
 {
-    send_response_data("\x00\x00\x00", 3);
+    send_response_data(ctx, "\x00\x00\x00", 3);
 }
 
-static void cmd_poll_card()
+static void cmd_poll_card(bana_ctx_t *ctx)
 {
-    bool mifare = (request.data[1] == 0);
-    bool felica = (request.data[1] == 1);
+    bool mifare = (ctx->request.data[1] == 0);
+    bool felica = (ctx->request.data[1] == 1);
     nfc_card_t card = nfc_detect_card_ex(mifare, felica, false);
     if (debug) {
         display_card(&card);
     }
     switch (card.card_type) {
         case NFC_CARD_MIFARE:
-            handle_mifare(card.uid);
+            handle_mifare(ctx, card.uid);
             break;
         case NFC_CARD_FELICA:
-            handle_felica(card.uid, card.pmm, card.syscode);
+            handle_felica(ctx, card.uid, card.pmm, card.syscode);
             break;
         default:
-            handle_no_card();
+            handle_no_card(ctx);
             break;
     }
 }
 
-static void cmd_mifare_auth(uint8_t key_id)
+static void cmd_mifare_auth(bana_ctx_t *ctx, uint8_t key_id)
 {
     typedef struct __attribute__((packed)) {
         uint8_t unk;
@@ -232,79 +242,79 @@ static void cmd_mifare_auth(uint8_t key_id)
         uint8_t uid[4];
     } auth_t;
 
-    auth_t *auth = (auth_t *)request.data;
+    auth_t *auth = (auth_t *)ctx->request.data;
 
     if (nfc_mifare_auth(auth->uid, auth->block, key_id, auth->key)) {
-        send_response_data("\x00", 1);
+        send_response_data(ctx, "\x00", 1);
     } else {
-        send_response_data("\x01", 1);
+        send_response_data(ctx, "\x01", 1);
     }
 }
 
-static void cmd_mifare_read()
+static void cmd_mifare_read(bana_ctx_t *ctx)
 {
     typedef struct __attribute__((packed)) {
         uint8_t unk;
         uint8_t cmd;
         uint8_t block;
     } read_t;
-    read_t *read = (read_t *)request.data;
+    read_t *read = (read_t *)ctx->request.data;
     struct __attribute__((packed)) {
         uint8_t status;
         uint8_t data[16];
     } resp;
     if (nfc_mifare_read(read->block, resp.data)) {
         resp.status = 0;
-        send_response_data(&resp, sizeof(resp));
+        send_response_data(ctx, &resp, sizeof(resp));
     } else {
-        send_response_data("\x14", 1);
+        send_response_data(ctx, "\x14", 1);
     }
 }
 
-static void cmd_mifare()
+static void cmd_mifare(bana_ctx_t *ctx)
 {
-    switch (request.data[1]) {
+    switch (ctx->request.data[1]) {
         case 0x60:
-            cmd_mifare_auth(0);
+            cmd_mifare_auth(ctx, 0);
             break;
         case 0x61:
-            cmd_mifare_auth(1);
+            cmd_mifare_auth(ctx, 1);
             break;
         case 0x30:
-            cmd_mifare_read();
+            cmd_mifare_read(ctx);
             break;
         default:
-            DEBUG("\nUnknown mifare cmd: %02x\n", request.data[0]);
-            send_ack();
+            DEBUG("\nUnknown mifare cmd: %02x\n", ctx->request.data[0]);
+            send_ack(ctx);
             break;
     }
 }
 
-static void cmd_commthru()
+static void cmd_commthru(bana_ctx_t *ctx)
 {
-    send_response_data("\x01", 1); // not sure if this is correct
+    send_response_data(ctx, "\x01", 1); // not sure if this is correct
 }
 
-static void cmd_select()
+static void cmd_select(bana_ctx_t *ctx)
 {
     nfc_select(0);
-    send_response_data("\x00", 1);
+    send_response_data(ctx, "\x00", 1);
     nfc_select(1);
 }
 
-static void cmd_deselect()
+static void cmd_deselect(bana_ctx_t *ctx)
 {
     nfc_deselect();
-    send_response_data("\x01\x00", 2);
+    send_response_data(ctx, "\x01\x00", 2);
 }
 
-static void cmd_release()
+static void cmd_release(bana_ctx_t *ctx)
 {
-    send_response_data("\x01\x00", 2);
+    send_response_data(ctx, "\x01\x00", 2);
 }
 
 /* https://github.com/chujohiroto/Raspberry-RCS620S/blob/master/rcs620s.py */
-static void cmd_felica_read(void *read_req)
+static void cmd_felica_read(bana_ctx_t *ctx, void *read_req)
 {
     typedef struct __attribute__((packed)) {
         uint8_t idm[8];
@@ -313,7 +323,7 @@ static void cmd_felica_read(void *read_req)
         uint8_t block_num;
         uint8_t block[0][2];
     } read_t;
-    read_t *read = (read_t *)(request.data + 4);
+    read_t *read = (read_t *)(ctx->request.data + 4);
 
     struct __attribute__((packed)) {
         uint8_t status;
@@ -346,10 +356,10 @@ static void cmd_felica_read(void *read_req)
         }
     }
 
-    send_response_data(&resp, 3 + 8 + 2 + 1 + block_num * 16);
+    send_response_data(ctx, &resp, 3 + 8 + 2 + 1 + block_num * 16);
 }
 
-static void cmd_felica()
+static void cmd_felica(bana_ctx_t *ctx)
 {
     typedef struct __attribute__((packed)) {
         uint16_t timeout;
@@ -357,155 +367,127 @@ static void cmd_felica()
         uint8_t cmd;
         uint8_t data[0];
     } felica_t;
-    felica_t *felica = (felica_t *)request.data;
-    if ((felica->cmd == 0x06) && (felica->len = request.hdr.len - 2)) {
-        cmd_felica_read(felica->data);
+    felica_t *felica = (felica_t *)ctx->request.data;
+    if ((felica->cmd == 0x06) && (felica->len = ctx->request.hdr.len - 2)) {
+        cmd_felica_read(ctx, felica->data);
     } else {
         DEBUG("\nBad felica cmd: %02x %d", felica->cmd, felica->len);
     }
 }
 
-static void handle_frame()
+static void handle_frame(bana_ctx_t *ctx)
 {
-    switch (request.cmd) {
+    switch (ctx->request.cmd) {
         case 0x18:
         case 0x12:
-            send_simple_response(request.cmd);
+            send_simple_response(ctx);
             break;
         case 0x0e:
-            cmd_gpio();
+            cmd_gpio(ctx);
             break;
         case 0x08:
             nfc_rf_field(false);
-            send_response_data("\0", 1);
+            send_response_data(ctx, "\0", 1);
             break;
         case 0x06:
-            if (request.data[1] == 0x1c) {
-                send_response_data("\xff\x3f\x0e\xf1\xff\x3f\x0e\xf1", 8);
+            if (ctx->request.data[1] == 0x1c) {
+                send_response_data(ctx, "\xff\x3f\x0e\xf1\xff\x3f\x0e\xf1", 8);
             } else {
-                send_response_data("\xdc\xf4\x3f\x11\x4d\x85\x61\xf1\x26\x6a\x87", 11);
+                send_response_data(ctx, "\xdc\xf4\x3f\x11\x4d\x85\x61\xf1\x26\x6a\x87", 11);
             }
             break;
         case 0x32:
-            cmd_rf_field();
+            cmd_rf_field(ctx);
             break;
         case 0x0c:
-            send_response_data("\x00\x06\x00", 3);
+            send_response_data(ctx, "\x00\x06\x00", 3);
             break;
         case 0x4a:
-            cmd_poll_card();
+            cmd_poll_card(ctx);
             break;
         case 0x40:
-            cmd_mifare();
+            cmd_mifare(ctx);
             break;
         case 0x42:
-            cmd_commthru();
+            cmd_commthru(ctx);
             break;
         case 0x44:
-            cmd_deselect();
+            cmd_deselect(ctx);
             break;
         case 0xa0:
-            cmd_felica();
+            cmd_felica(ctx);
             break;
         case 0x52:
-            cmd_release();
+            cmd_release(ctx);
             break;
         case 0x54:
-            cmd_select();
+            cmd_select(ctx);
             break;
         default:
-            printf("\nUnknown cmd: %02x (%d)\n", request.cmd, request.hdr.len);
-            send_ack();
+            LOG_INFO("\nUnknown cmd: %02x (%d)\n", ctx->request.cmd, ctx->request.hdr.len);
+            send_ack(ctx);
             break;
     }
 }
 
-bool bana_feed(int c)
+bool bana_feed(bana_ctx_t *ctx, int c)
 {
     uint32_t now = time_us_32();
 
-    if ((req_ctx.frame_len == sizeof(request)) ||
-        (now - req_ctx.time > 100000))  {
-        req_ctx.frame_len = 0;
+    if ((ctx->req_ctx.frame_len == sizeof(ctx->request)) ||
+        (now - ctx->req_ctx.time > 100000))  {
+        ctx->req_ctx.frame_len = 0;
     }
 
-    req_ctx.time = now;
-
-    request.raw[req_ctx.frame_len] = c;
-    req_ctx.frame_len++;
-
-    if ((req_ctx.frame_len == 1) && (request.raw[0] == 0x55)) {
-        req_ctx.frame_len = 0;
-    } if ((req_ctx.frame_len == 3) &&
-        (memcmp(request.hdr.padding, "\x00\x00\xff", 3) != 0)) {
-        request.raw[0] = request.raw[1];
-        request.raw[1] = request.raw[2];
-        req_ctx.frame_len--;
-    } if ((req_ctx.frame_len == 6) && (request.hdr.len == 0)) {
-        req_ctx.frame_len = 0;
-    } else if (req_ctx.frame_len == request.hdr.len + 7) {
-        handle_frame();
-        req_ctx.frame_len = 0;
-        expire_time = time_us_64() + BANA_EXPIRE_US;
+    ctx->req_ctx.time = now;
+
+    ctx->request.raw[ctx->req_ctx.frame_len] = c;
+    ctx->req_ctx.frame_len++;
+
+    if ((ctx->req_ctx.frame_len == 1) && (ctx->request.raw[0] == 0x55)) {
+        ctx->req_ctx.frame_len = 0;
+    } if ((ctx->req_ctx.frame_len == 3) &&
+        (memcmp(ctx->request.hdr.padding, "\x00\x00\xff", 3) != 0)) {
+        ctx->request.raw[0] = ctx->request.raw[1];
+        ctx->request.raw[1] = ctx->request.raw[2];
+        ctx->req_ctx.frame_len--;
+    } if ((ctx->req_ctx.frame_len == 6) && (ctx->request.hdr.len == 0)) {
+        ctx->req_ctx.frame_len = 0;
+    } else if (ctx->req_ctx.frame_len == ctx->request.hdr.len + 7) {
+        handle_frame(ctx);
+        ctx->req_ctx.frame_len = 0;
+        ctx->expire_time = time_us_64() + BANA_EXPIRE_US;
     }
     return true;
 }
 
-bool bana_is_active()
+bool bana_ctx_is_active(const bana_ctx_t *ctx)
 {
-    return time_us_64() < expire_time;
+    return time_us_64() < ctx->expire_time;
 }
 
-void bana_dtr_off()
+bool bana_is_active()
 {
-    if (!bana_is_active()) {
-        return;
+    for (int i = 0; i < instance_num; i++) {
+        if (bana_ctx_is_active(&instances[i])) {
+            return true;
+        }
     }
-    expire_time = time_us_64() + BANA_FAST_EXPIRE_US;
+    return false;
 }
 
-static const struct {
-    int cmd;
-    const char *pattern;
-} bana_led_patterns[] = {
-    { 0x00, " 1, #000000, 0" }, // off
-    { 0x01, " 1, #0000ff, 50" }, // blue
-    { 0x02, " 1, #ff0000, 50" }, // red
-    { 0x03, " 1, #00ff00, 50" }, // green
-    { 0x04, "-1, #0000ff, 100, #000000, 100" }, // fast blue flash
-    { 0x05, "-1, #0000ff, 500, #000000, 500" }, // slow blue flash
-    { 0x06, "-1, #0000ff, 200, #000000, 200" }, // regular blue flash
-    { 0x07, "-1, #0000ff, 200, #000000, 0, #000000, 1000" }, // blue flash with pause
-    { 0x08, "-1, #ffff00, 200, #000000, 200, #ff0000, 200, #000000, 200" }, // yellow and red cycle
-    { 0x09, "-1, #ff0000, 200, #000000, 200" }, // red on off flashing
-    { 0x0a, " 1, #ff0000, 300, #00ff00, 300, #0000ff, 300" }, // rgb cycle once
-    { 0x0b, "-1, #ff0000, 300, #00ff00, 300, #0000ff, 300" }, // rgb cycle endless
-    { 0x0c, "-1, #00ff00, 100, #0000ff, 100" }, // green blue epilepsy
-    { 0x0d, "-1, #00ff00, 100, #0000ff, 100" }, // green blue quick softer
-    { 0x0e, "-1, #ffffff, 300, #ff00ff, 300, #00ffff, 300" }, // white pink cyan
-    { 0x0f, "-1, #ff0000, 100, #00ff00, 100, #0000ff, 100" }, // rgb something
-    { 0x11, " 1, #00ff00, 200, #007f00, 200, #00ff00, 200, #007f00, 200, #0000ff, 200" }, // green to blue
-    { 0x14, " 1, #00ff00, 200, #00ff00, 1000, #000000, 0" }, // green then off
-    { 0x16, " 1, #ff0000, 200, #0000ff, 200" }, // red to blue
-    { 0x19, " 1, #ff0000, 200, #ff0000, 1000, #000000, 0" }, // red then off
-    { 0x1b, " 1, #0000ff, 200" } // to blue
-};
-
-const char *bana_get_led_pattern()
+void bana_dtr_off(bana_ctx_t *ctx)
 {
-    if (bana_gpio.led < 0) {
-        return NULL;
-    }
-
-    int cmd = bana_gpio.led;
-    bana_gpio.led = -1;
-
-    int patt_num = sizeof(bana_led_patterns) / sizeof(bana_led_patterns[0]);
-    for (int i = 0; i < patt_num; i++) {
-        if (bana_led_patterns[i].cmd == cmd) {
-            return bana_led_patterns[i].pattern;
-        }
+    if (!bana_ctx_is_active(ctx)) {
+        return;
     }
+    ctx->expire_time = time_us_64() + BANA_FAST_EXPIRE_US;
+}
 
-    return NULL;
+/* LED patterns are up to the firmware, the command is just passed on */
+int bana_get_led_cmd(bana_ctx_t *ctx)
+{
+    int cmd = ctx->gpio.led;
+    ctx->gpio.led = -1;
+    return cmd;
 }
@@ -0,0 +1,143 @@
+/*
+ * Deferred Binary Logger
+ * WHowe <github.com/whowechina>
+ */
+
+#include "logger.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/critical_section.h"
+#include "pico/time.h"
+
+#define LOG_RING_SIZE 128 /* records, power of 2 */
+
+typedef struct {
+    const char *fmt; /* NULL for hex data */
+    uint8_t level;
+    uint8_t len; /* number of args, or bytes for hex data */
+    union {
+        uint32_t args[LOG_MAX_ARGS];
+        uint8_t data[LOG_MAX_ARGS * 4];
+    };
+} log_record_t;
+
+static struct {
+    log_record_t records[LOG_RING_SIZE];
+    uint32_t head;
+    uint32_t tail;
+    uint32_t dropped;
+    uint32_t reported_dropped;
+    critical_section_t lock;
+} ring;
+
+uint8_t logger_level = LOG_LEVEL_INFO;
+
+void logger_init()
+{
+    critical_section_init(&ring.lock);
+}
+
+/* ring lock must be held */
+static log_record_t *alloc_record()
+{
+    if (ring.head - ring.tail >= LOG_RING_SIZE) {
+        ring.dropped++;
+        return NULL;
+    }
+    return &ring.records[ring.head++ % LOG_RING_SIZE];
+}
+
+void logger_write(uint8_t level, const char *fmt, const uint32_t *args, int argc)
+{
+    if (argc > LOG_MAX_ARGS) {
+        argc = LOG_MAX_ARGS;
+    }
+
+    critical_section_enter_blocking(&ring.lock);
+    log_record_t *record = alloc_record();
+    if (record) {
+        record->fmt = fmt;
+        record->level = level;
+        record->len = argc;
+        memcpy(record->args, args, argc * sizeof(uint32_t));
+    }
+    critical_section_exit(&ring.lock);
+}
+
+void logger_hex(uint8_t level, const uint8_t *data, int len)
+{
+    const int max_chunk = sizeof(ring.records[0].data);
+
+    while (len > 0) {
+        int chunk = len > max_chunk ? max_chunk : len;
+
+        critical_section_enter_blocking(&ring.lock);
+        log_record_t *record = alloc_record();
+        if (record) {
+            record->fmt = NULL;
+            record->level = level;
+            record->len = chunk;
+            memcpy(record->data, data, chunk);
+        }
+        critical_section_exit(&ring.lock);
+
+        if (!record) {
+            return;
+        }
+        data += chunk;
+        len -= chunk;
+    }
+}
+
+void logger_set_level(uint8_t level)
+{
+    logger_level = level;
+}
+
+uint32_t logger_dropped()
+{
+    return ring.dropped;
+}
+
+static void print_record(const log_record_t *record)
+{
+    if (!record->fmt) {
+        for (int i = 0; i < record->len; i++) {
+            printf(" %02x", record->data[i]);
+        }
+        return;
+    }
+
+    const uint32_t *a = record->args;
+    printf(record->fmt, a[0], a[1], a[2], a[3], a[4], a[5]);
+}
+
+/* called from idle time, never from the protocol paths, printing blocks
+   on stdio so it's bounded by time rather than by records */
+void logger_flush(uint32_t budget_us)
+{
+    uint32_t start = time_us_32();
+    do {
+        critical_section_enter_blocking(&ring.lock);
+        bool empty = (ring.tail == ring.head);
+        log_record_t record;
+        if (!empty) {
+            record = ring.records[ring.tail++ % LOG_RING_SIZE];
+        }
+        critical_section_exit(&ring.lock);
+
+        if (empty) {
+            break;
+        }
+        print_record(&record);
+    } while (time_us_32() - start < budget_us);
+
+    if (ring.dropped != ring.reported_dropped) {
+        printf("\n[Log: %ld records dropped]", ring.dropped - ring.reported_dropped);
+        ring.reported_dropped = ring.dropped;
+    }
+}
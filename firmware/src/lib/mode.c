@@ -2,6 +2,8 @@
  * COM Port Protocol Definition and Detection
  * WHowe <github.com/whowechina>
  *
+ * Aime and Bana candidate parsers run side by side over the byte stream,
+ * the first one completing a checksum-valid frame wins.
  */
 
 #include <stdint.h>
@@ -13,31 +15,243 @@
 
 #include "mode.h"
 
-static uint64_t last_detect_time;
+#define DETECT_BUF_SIZE 256
+#define DETECT_IDLE_US 100000
 
-reader_mode_t mode_detect(const uint8_t *data, uint32_t len, uint32_t baudrate)
+typedef struct {
+    bool active;
+    int start; // frame start in the detection buffer
+    int score; // bytes consistent with the protocol so far
+} candidate_t;
+
+struct mode_detector {
+    struct {
+        candidate_t cand;
+        int len;
+        uint8_t frame_len;
+        uint8_t check_sum;
+        bool escaping;
+    } aime;
+
+    struct {
+        candidate_t cand;
+        enum {
+            BANA_LEN,
+            BANA_LCS,
+            BANA_DATA,
+            BANA_DCS,
+        } state;
+        uint8_t frame_len;
+        int count;
+        uint8_t check_sum;
+        uint8_t tail[3]; // last 3 bytes, to catch the "00 00 ff" preamble
+    } bana;
+
+    uint8_t buf[DETECT_BUF_SIZE];
+    int pos;
+    int replay_start;
+    bool committed;
+    uint64_t time;
+};
+
+static mode_detector_t detectors[MODE_MAX_DETECTORS];
+static int detector_num = 0;
+
+void mode_detect_reset(mode_detector_t *d)
 {
-    last_detect_time = time_us_64();
+    memset(&d->aime, 0, sizeof(d->aime));
+    memset(&d->bana, 0, sizeof(d->bana));
+    d->bana.tail[2] = 0xff; // so 2 leading bytes are not taken as "00 00"
+    d->pos = 0;
+    d->replay_start = 0;
+    d->committed = false;
+}
 
-    if ((len > 2) && (data[0] == 0xe0) && (data[1] < 0x10)) {
-        return baudrate == 115200 ? MODE_AIME0 : MODE_AIME1;
+mode_detector_t *mode_detect_init()
+{
+    if (detector_num >= MODE_MAX_DETECTORS) {
+        return NULL;
     }
 
-    if ((len == 1) && (data[0] == 0x55)) {
-        return MODE_BANA;
+    mode_detector_t *d = &detectors[detector_num++];
+    mode_detect_reset(d);
+    return d;
+}
+
+/* returns true when a checksum-valid frame is completed */
+static bool aime_candidate(mode_detector_t *d, uint8_t c, int pos)
+{
+    if (c == 0xe0) {
+        d->aime.cand.active = true;
+        d->aime.cand.start = pos;
+        d->aime.cand.score = 1;
+        d->aime.len = 0;
+        d->aime.check_sum = 0;
+        d->aime.escaping = false;
+        return false;
     }
 
-    if ((len >= 3) && (memcmp(data, "\x00\x00\xff", 3) == 0)) {
-        return MODE_BANA;
+    if (!d->aime.cand.active) {
+        return false;
+    }
+
+    if (c == 0xd0) {
+        d->aime.escaping = true;
+        return false;
+    }
+
+    if (d->aime.escaping) {
+        c++;
+        d->aime.escaping = false;
+    }
+
+    if ((d->aime.len != 0) && (d->aime.len == d->aime.frame_len)) {
+        d->aime.cand.active = false;
+        return d->aime.check_sum == c;
+    }
+
+    if ((d->aime.len == 0) && (c < 5)) { // len, addr, seq, cmd, payload_len
+        d->aime.cand.active = false;
+        return false;
+    }
+
+    if (d->aime.len == 0) {
+        d->aime.frame_len = c;
+    }
+    d->aime.len++;
+    d->aime.check_sum += c;
+    d->aime.cand.score++;
+
+    return false;
+}
+
+static bool bana_candidate(mode_detector_t *d, uint8_t c, int pos)
+{
+    bool preamble = (memcmp(d->bana.tail + 1, "\x00\x00", 2) == 0) && (c == 0xff);
+
+    d->bana.tail[0] = d->bana.tail[1];
+    d->bana.tail[1] = d->bana.tail[2];
+    d->bana.tail[2] = c;
+
+    if (!d->bana.cand.active) {
+        if (preamble) {
+            d->bana.cand.active = true;
+            d->bana.cand.start = pos - 2;
+            d->bana.cand.score = 3;
+            d->bana.state = BANA_LEN;
+        }
+        return false;
+    }
+
+    d->bana.cand.score++;
+
+    switch (d->bana.state) {
+        case BANA_LEN:
+            d->bana.frame_len = c;
+            d->bana.state = BANA_LCS;
+            break;
+        case BANA_LCS:
+            if ((d->bana.frame_len == 0) || ((uint8_t)(d->bana.frame_len + c) != 0)) {
+                d->bana.cand.active = false; // ACK frame or bad length check
+                break;
+            }
+            d->bana.count = 0;
+            d->bana.check_sum = 0;
+            d->bana.state = BANA_DATA;
+            break;
+        case BANA_DATA:
+            if ((d->bana.count == 0) && (c != 0xd4)) { // host to reader only
+                d->bana.cand.active = false;
+                break;
+            }
+            d->bana.check_sum += c;
+            d->bana.count++;
+            if (d->bana.count == d->bana.frame_len) {
+                d->bana.state = BANA_DCS;
+            }
+            break;
+        case BANA_DCS:
+            d->bana.cand.active = false;
+            return (uint8_t)(d->bana.check_sum + c) == 0;
+    }
+
+    return false;
+}
+
+/* make room by dropping bytes no candidate still relies on */
+static void trim_buffer(mode_detector_t *d)
+{
+    int keep = d->pos;
+
+    /* the more confident one survives if both need the space */
+    candidate_t *best = NULL;
+    if (d->aime.cand.active) {
+        best = &d->aime.cand;
     }
-    if ((len >= 4) && (memcmp(data, "\x55\x00\x00\xff", 4) == 0)) {
+    if (d->bana.cand.active && (!best || (d->bana.cand.score > best->score))) {
+        best = &d->bana.cand;
+    }
+    if (best) {
+        keep = best->start;
+    }
+    if (keep == 0) {
+        mode_detect_reset(d);
+        return;
+    }
+
+    memmove(d->buf, d->buf + keep, d->pos - keep);
+    d->pos -= keep;
+
+    d->aime.cand.start -= keep;
+    d->bana.cand.start -= keep;
+    if (d->aime.cand.start < 0) {
+        d->aime.cand.active = false;
+    }
+    if (d->bana.cand.start < 0) {
+        d->bana.cand.active = false;
+    }
+}
+
+reader_mode_t mode_detect_feed(mode_detector_t *d, uint8_t c, uint32_t baudrate)
+{
+    uint64_t now = time_us_64();
+    if (d->committed || (now - d->time > DETECT_IDLE_US)) {
+        mode_detect_reset(d);
+    }
+    d->time = now;
+
+    if (d->pos == DETECT_BUF_SIZE) {
+        trim_buffer(d);
+    }
+
+    int pos = d->pos;
+    d->buf[d->pos++] = c;
+
+    if (aime_candidate(d, c, pos)) {
+        d->replay_start = d->aime.cand.start;
+        d->committed = true;
+        return baudrate == 115200 ? MODE_AIME0 : MODE_AIME1;
+    }
+
+    if (bana_candidate(d, c, pos)) {
+        d->replay_start = d->bana.cand.start;
+        d->committed = true;
         return MODE_BANA;
     }
 
-    last_detect_time = 0;
     return MODE_NONE;
 }
 
+const uint8_t *mode_detect_replay(mode_detector_t *d, size_t *len)
+{
+    if (!d->committed) {
+        *len = 0;
+        return NULL;
+    }
+    *len = d->pos - d->replay_start;
+    return d->buf + d->replay_start;
+}
+
 const char *mode_name(reader_mode_t mode)
 {
     switch (mode) {
@@ -54,4 +268,4 @@ const char *mode_name(reader_mode_t mode)
         default:
             return "Unknown";
     }
-}
\ No newline at end of file
+}
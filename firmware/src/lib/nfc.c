@@ -12,10 +12,12 @@
 #include "hardware/gpio.h"
 
 #include "nfc.h"
+#include "logger.h"
 #include "pn532.h"
 #include "pn5180.h"
 
-#define DEBUG(...) { if (nfc_runtime.debug) printf(__VA_ARGS__); }
+#define DEBUG(...) LOG_DEBUG(__VA_ARGS__)
+#define DEBUG_HEX(data, len) LOG_HEX(LOG_LEVEL_DEBUG, data, len)
 
 nfc_runtime_t nfc_runtime;
 
@@ -401,10 +403,8 @@ void nfc_identify_last_card()
 void display_card(const nfc_card_t *card)
 {
     if (card->card_type != NFC_CARD_NONE) {
-        printf("\n%s:", nfc_card_type_str(card->card_type));
-        for (int i = 0; i < card->len; i++) {
-            printf(" %02X", card->uid[i]);
-        }
+        LOG_INFO("\n%s:", (uintptr_t)nfc_card_type_str(card->card_type));
+        LOG_HEX(LOG_LEVEL_INFO, card->uid, card->len);
     }
 }
 
@@ -413,11 +413,9 @@ bool nfc_mifare_auth(const uint8_t uid[4], uint8_t block_id, uint8_t key_id, con
     if (!api[nfc_module].mifare_auth) {
         return false;
     }
-    printf("\nAuth block %d key %d %.6s [", block_id, key_id, key);
-    for (int i = 0; i < 6; i++) {
-        printf(" %02X", key[i]);
-    }
-    printf(" ]");
+    LOG_INFO("\nAuth block %d key %d [", block_id, key_id);
+    LOG_HEX(LOG_LEVEL_INFO, key, 6);
+    LOG_INFO(" ]");
     return api[nfc_module].mifare_auth(uid, block_id, key_id, key);
 }
 
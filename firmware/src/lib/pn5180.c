@@ -15,8 +15,9 @@
 
 #include "nfc.h"
 #include "pn5180.h"
+#include "logger.h"
 
-#define DEBUG(...) { if (nfc_runtime.debug) printf(__VA_ARGS__); }
+#define DEBUG(...) LOG_DEBUG(__VA_ARGS__)
 
 #define IO_TIMEOUT_US 1000
 #define PN5180_I2C_ADDRESS 0x24
@@ -463,7 +463,7 @@ bool pn532_felica_write(uint16_t svc_code, uint16_t block_id, const uint8_t bloc
 
     DEBUG("\nPN532 Felica WRITE success ");
     for (int i = 0; i < result; i++) {
-        printf(" %02x", readbuf[i]);
+        DEBUG(" %02x", readbuf[i]);
     }
     return false;
 }
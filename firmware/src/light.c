@@ -16,43 +16,43 @@
 #include "hardware/timer.h"
 #include "hardware/pwm.h"
 #include "hardware/dma.h"
+#include "pico/time.h"
+#include "pico/critical_section.h"
 
 #include "ws2812.pio.h"
 
 #include "board_defs.h"
 #include "config.h"
 
-static uint32_t rgb_buf[64];
+/* double buffered, frames are built in the back buffer while DMA may still
+   be reading the front one */
+static uint32_t rgb_buf[2][RGB_NUM];
+static int rgb_front;
 static uint8_t led_gpio[] = LED_DEF;
-#define RGB_NUM (sizeof(rgb_buf) / sizeof(rgb_buf[0]))
 #define LED_NUM (sizeof(led_gpio))
 static uint16_t led_buf[LED_NUM];
 static int rgb_dma;
 static dma_channel_config rgb_dma_cfg;
 
-static inline uint32_t rgb32(uint32_t c1, uint32_t c2, uint32_t c3, bool gamma_fix)
-{
-    if (gamma_fix) {
-        c1 = ((c1 + 1) * (c1 + 1) - 1) >> 8;
-        c2 = ((c2 + 1) * (c2 + 1) - 1) >> 8;
-        c3 = ((c3 + 1) * (c3 + 1) - 1) >> 8;
-    }
-    
-    return (c1 << 16) | (c2 << 8) | (c3 << 0);    
-}
+#define REFRESH_INTERVAL_US 4000 // 250Hz
 
-/* translate RGB to local RGB channel order */
-static inline uint32_t rgb2local(uint32_t color, bool gamma_fix)
+/* buffers are sized to the board, loops and DMA run on what's fitted */
+static inline int rgb_num()
 {
-    uint8_t r = (color >> 16) & 0xff;
-    uint8_t g = (color >> 8) & 0xff;
-    uint8_t b = color & 0xff;
+    return aic_cfg->light.rgb_num;
+}
 
+/* translate RGB to local RGB channel order, usable in compile time tables,
+   gamma is applied later by the layer lookup tables */
 #if BUTTON_RGB_ORDER == GRB
-    return rgb32(g, r, b, gamma_fix);
+#define RGB2LOCAL(rgb) (((rgb) & 0xff00) << 8 | ((rgb) >> 8 & 0xff00) | ((rgb) & 0xff))
 #else
-    return rgb32(r, g, b, gamma_fix);
+#define RGB2LOCAL(rgb) ((rgb) & 0xffffff)
 #endif
+
+static inline uint32_t rgb2local(uint32_t color)
+{
+    return RGB2LOCAL(color);
 }
 
 uint32_t rgb32_from_hsv(uint8_t h, uint8_t s, uint8_t v)
@@ -86,22 +86,15 @@ uint32_t rgb32_from_hsv(uint8_t h, uint8_t s, uint8_t v)
     }
 }
 
-static inline uint32_t apply_level(uint32_t color, uint8_t level)
-{
-    unsigned c1 = (color >> 16) & 0xff;
-    unsigned c2 = (color >> 8) & 0xff;
-    unsigned c3 = color & 0xff;
-
-    c1 = c1 * level / 255;
-    c2 = c2 * level / 255;
-    c3 = c3 * level / 255;
-
-    return c1 << 16 | c2 << 8 | c3;
-}
+/* 16 bit square law gamma, (c + 1)^2 - 1, keeps the low end that an 8 bit
+   result would round away */
+static uint16_t gamma16[256];
 
-static inline uint16_t apply_gray_level(uint8_t gray, uint8_t level)
+static void generate_gamma()
 {
-    return gray * level;
+    for (int i = 0; i < 256; i++) {
+        gamma16[i] = (i + 1) * (i + 1) - 1;
+    }
 }
 
 /* 6 segment regular hsv color wheel, better color cycle
@@ -125,52 +118,253 @@ static inline uint8_t lerp8b(uint8_t a, uint8_t b, uint8_t t)
     return a + (b - a) * t / 255;
 }
 
-static uint32_t lerp(uint32_t a, uint32_t b, int pos, int range)
+static uint8_t ease(light_ease_t ease, uint8_t t)
+{
+    switch (ease) {
+        case EASE_IN:
+            return t * t / 255;
+        case EASE_OUT:
+            return 255 - (255 - t) * (255 - t) / 255;
+        case EASE_STEP:
+            return 0;
+        default:
+            return t;
+    }
+}
+
+static uint32_t lerp(uint32_t a, uint32_t b, uint8_t t)
 {
-    uint8_t t = pos * 255 / range;
     uint32_t c1 = lerp8b((a >> 16) & 0xff, (b >> 16) & 0xff, t);
     uint32_t c2 = lerp8b((a >> 8) & 0xff, (b >> 8) & 0xff, t);
     uint32_t c3 = lerp8b(a & 0xff, b & 0xff, t);
     return c1 << 16 | c2 << 8 | c3;
 }
 
-static enum {
-    MODE_FADE,
-    MODE_RAINBOW,
-} light_mode = MODE_RAINBOW;
+/* Layers are composited bottom up into one color per pixel, pixels are the
+   RGB strip followed by the PWM LEDs. Colors are 8 bit codes in local channel
+   order, each layer's lookup table turns a code into 16 bit output with its
+   gamma and level. Alpha and opacity are 0..255. */
+#define PIXEL_NUM (RGB_NUM + LED_NUM)
+
+typedef struct {
+    uint32_t color[PIXEL_NUM];
+    uint8_t alpha[PIXEL_NUM];
+    uint16_t lut[256];
+    uint8_t level;
+    bool gamma;
+    bool lut_valid;
+    struct {
+        uint8_t current;
+        uint8_t from;
+        uint8_t to;
+        uint32_t elapsed;
+        uint32_t duration;
+    } opacity;
+    bool dirty;
+} layer_t;
+
+static layer_t layers[LIGHT_LAYER_NUM];
+static uint16_t composed[PIXEL_NUM][3];
+
+/* the refresh timer irq renders from all the light states, the public calls
+   come from either core, so both sides take this lock */
+static critical_section_t light_lock;
+
+/* the only place with divisions, runs when a layer's level changes */
+static void layer_lut(layer_t *layer, uint8_t level, bool gamma)
+{
+    if (layer->lut_valid && (layer->level == level) && (layer->gamma == gamma)) {
+        return;
+    }
+    for (int i = 0; i < 256; i++) {
+        uint32_t linear = gamma ? gamma16[i] : i * 257;
+        layer->lut[i] = linear * level / 255;
+    }
+    layer->level = level;
+    layer->gamma = gamma;
+    layer->lut_valid = true;
+    layer->dirty = true;
+}
+
+static void layer_fill(layer_t *layer, uint32_t color)
+{
+    for (int i = 0; i < PIXEL_NUM; i++) {
+        layer->color[i] = color;
+        layer->alpha[i] = 0xff;
+    }
+    layer->dirty = true;
+}
+
+static void layer_opacity(light_layer_t id, uint8_t to, uint32_t fade_ms)
+{
+    layer_t *layer = &layers[id];
+    layer->opacity.from = layer->opacity.current;
+    layer->opacity.to = to;
+    layer->opacity.elapsed = 0;
+    layer->opacity.duration = fade_ms * 1000;
+    if (fade_ms == 0) {
+        layer->opacity.current = to;
+        layer->dirty = true;
+    }
+}
+
+static inline bool layer_visible(light_layer_t id)
+{
+    return layers[id].opacity.current || layers[id].opacity.to;
+}
+
+void light_release(light_layer_t layer, uint32_t fade_ms)
+{
+    critical_section_enter_blocking(&light_lock);
+    layer_opacity(layer, 0, fade_ms);
+    critical_section_exit(&light_lock);
+}
+
+static void opacity_control(uint32_t delta_us)
+{
+    for (int i = 0; i < LIGHT_LAYER_NUM; i++) {
+        layer_t *layer = &layers[i];
+        if (layer->opacity.current == layer->opacity.to) {
+            continue;
+        }
+        layer->opacity.elapsed += delta_us;
+        if (layer->opacity.elapsed >= layer->opacity.duration) {
+            layer->opacity.current = layer->opacity.to;
+        } else {
+            int range = layer->opacity.to - layer->opacity.from;
+            layer->opacity.current = layer->opacity.from +
+                range * (int64_t)layer->opacity.elapsed / layer->opacity.duration;
+        }
+        layer->dirty = true;
+    }
+}
+
+static void composite_pixel(int i)
+{
+    uint32_t c1 = 0, c2 = 0, c3 = 0;
+    for (int l = 0; l < LIGHT_LAYER_NUM; l++) {
+        const layer_t *layer = &layers[l];
+        uint32_t opacity = layer->opacity.current;
+        uint32_t alpha = layer->alpha[i] * (opacity + (opacity >> 7)) >> 8;
+        if (alpha == 0) {
+            continue;
+        }
+        uint32_t w = alpha + (alpha >> 7); // 0..256
+        uint32_t color = layer->color[i];
+        c1 = (c1 * (256 - w) + layer->lut[(color >> 16) & 0xff] * w) >> 8;
+        c2 = (c2 * (256 - w) + layer->lut[(color >> 8) & 0xff] * w) >> 8;
+        c3 = (c3 * (256 - w) + layer->lut[color & 0xff] * w) >> 8;
+    }
+    composed[i][0] = c1;
+    composed[i][1] = c2;
+    composed[i][2] = c3;
+}
+
+/* one pass over the fitted pixels, only when some layer has changed */
+static bool composite()
+{
+    bool dirty = false;
+    for (int i = 0; i < LIGHT_LAYER_NUM; i++) {
+        dirty |= layers[i].dirty;
+        layers[i].dirty = false;
+    }
+    if (!dirty) {
+        return false;
+    }
+
+    for (int i = 0; i < rgb_num(); i++) {
+        composite_pixel(i);
+    }
+    for (int i = RGB_NUM; i < PIXEL_NUM; i++) {
+        composite_pixel(i);
+    }
+    return true;
+}
 
 static struct {
     int repeat;
+    const light_step_t *steps;
     int step_num;
     int curr_step;
+    uint32_t from;
     uint32_t color;
-    int elapsed;
-    struct {
-        uint32_t from;
-        uint32_t to;
-        int duration;
-    } steps[32];
+    uint32_t elapsed; // us
 } fading;
 
+#define FADE_CUSTOM_MAX 32
+static light_step_t fade_custom[FADE_CUSTOM_MAX];
+
+#define STEP(rgb, ms) { RGB2LOCAL(rgb), ms, EASE_LINEAR }
+#define PATTERN(repeat, ...) { repeat, \
+    sizeof((const light_step_t[]) { __VA_ARGS__ }) / sizeof(light_step_t), \
+    (const light_step_t[]) { __VA_ARGS__ } }
+
+/* Bana LED commands, the pattern id is the command */
+static const light_pattern_t patterns[LIGHT_PATTERN_NUM] = {
+    [0x00] = PATTERN(1, STEP(0x000000, 0)), // off
+    [0x01] = PATTERN(1, STEP(0x0000ff, 50)), // blue
+    [0x02] = PATTERN(1, STEP(0xff0000, 50)), // red
+    [0x03] = PATTERN(1, STEP(0x00ff00, 50)), // green
+    [0x04] = PATTERN(-1, STEP(0x0000ff, 100), STEP(0x000000, 100)), // fast blue flash
+    [0x05] = PATTERN(-1, STEP(0x0000ff, 500), STEP(0x000000, 500)), // slow blue flash
+    [0x06] = PATTERN(-1, STEP(0x0000ff, 200), STEP(0x000000, 200)), // regular blue flash
+    [0x07] = PATTERN(-1, STEP(0x0000ff, 200), STEP(0x000000, 0),
+                         STEP(0x000000, 1000)), // blue flash with pause
+    [0x08] = PATTERN(-1, STEP(0xffff00, 200), STEP(0x000000, 200),
+                         STEP(0xff0000, 200), STEP(0x000000, 200)), // yellow and red cycle
+    [0x09] = PATTERN(-1, STEP(0xff0000, 200), STEP(0x000000, 200)), // red on off flashing
+    [0x0a] = PATTERN(1, STEP(0xff0000, 300), STEP(0x00ff00, 300),
+                        STEP(0x0000ff, 300)), // rgb cycle once
+    [0x0b] = PATTERN(-1, STEP(0xff0000, 300), STEP(0x00ff00, 300),
+                         STEP(0x0000ff, 300)), // rgb cycle endless
+    [0x0c] = PATTERN(-1, STEP(0x00ff00, 100), STEP(0x0000ff, 100)), // green blue epilepsy
+    [0x0d] = PATTERN(-1, STEP(0x00ff00, 100), STEP(0x0000ff, 100)), // green blue quick softer
+    [0x0e] = PATTERN(-1, STEP(0xffffff, 300), STEP(0xff00ff, 300),
+                         STEP(0x00ffff, 300)), // white pink cyan
+    [0x0f] = PATTERN(-1, STEP(0xff0000, 100), STEP(0x00ff00, 100),
+                         STEP(0x0000ff, 100)), // rgb something
+    [0x11] = PATTERN(1, STEP(0x00ff00, 200), STEP(0x007f00, 200), STEP(0x00ff00, 200),
+                        STEP(0x007f00, 200), STEP(0x0000ff, 200)), // green to blue
+    [0x14] = PATTERN(1, STEP(0x00ff00, 200), STEP(0x00ff00, 1000),
+                        STEP(0x000000, 0)), // green then off
+    [0x16] = PATTERN(1, STEP(0xff0000, 200), STEP(0x0000ff, 200)), // red to blue
+    [0x19] = PATTERN(1, STEP(0xff0000, 200), STEP(0xff0000, 1000),
+                        STEP(0x000000, 0)), // red then off
+    [0x1b] = PATTERN(1, STEP(0x0000ff, 200)), // to blue
+};
+
+/* light lock must be held */
+static void fade_start(const light_step_t *steps, int step_num, int repeat)
+{
+    fading.steps = steps;
+    fading.step_num = step_num;
+    fading.repeat = repeat;
+    fading.curr_step = 0;
+    fading.from = fading.color;
+    fading.elapsed = 0;
+
+    layer_opacity(LIGHT_LAYER_READER, 0xff, 0);
+}
+
 void light_fade_n(int repeat, int count, ...)
 {
     va_list args;
     va_start(args, count);
 
+    if (count > FADE_CUSTOM_MAX) {
+        count = FADE_CUSTOM_MAX;
+    }
+
+    critical_section_enter_blocking(&light_lock);
     for (int i = 0; i < count; i++) {
-        fading.steps[i].from = i == 0 ? fading.color : fading.steps[i - 1].to;
-        fading.steps[i].to = rgb2local(va_arg(args, uint32_t), true);
-        fading.steps[i].duration = va_arg(args, int);
+        fade_custom[i].color = rgb2local(va_arg(args, uint32_t));
+        fade_custom[i].duration = va_arg(args, int);
+        fade_custom[i].ease = EASE_LINEAR;
     }
+    fade_start(fade_custom, count, repeat);
+    critical_section_exit(&light_lock);
 
     va_end(args);
-
-    fading.repeat = repeat;
-    fading.step_num = count;
-    fading.curr_step = 0;
-    fading.elapsed = 0;
-
-    light_mode = MODE_FADE;
 }
 
 void light_fade(uint32_t color, uint32_t fading_ms)
@@ -178,6 +372,18 @@ void light_fade(uint32_t color, uint32_t fading_ms)
     light_fade_n(1, 1, color, fading_ms);
 }
 
+bool light_fade_pattern(int id)
+{
+    if ((id < 0) || (id >= LIGHT_PATTERN_NUM) || (patterns[id].step_num == 0)) {
+        return false;
+    }
+
+    critical_section_enter_blocking(&light_lock);
+    fade_start(patterns[id].steps, patterns[id].step_num, patterns[id].repeat);
+    critical_section_exit(&light_lock);
+    return true;
+}
+
 static uint32_t htoi(const char *s)
 {
     uint32_t result = 0;
@@ -199,14 +405,15 @@ static uint32_t htoi(const char *s)
     return result;
 }
 
-static int parse_integers(const char *str, int32_t *output)
+static int parse_integers(const char *str, int32_t *output, int max)
 {
     static char patt[256];
     strncpy(patt, str, sizeof(patt) - 1);
     patt[sizeof(patt) - 1] = '\0';
 
     int count = 0;
-    for (char *token = strtok(patt, ", "); token; token = strtok(NULL, ", ")) {
+    for (char *token = strtok(patt, ", "); token && (count < max);
+         token = strtok(NULL, ", ")) {
         if (token[0] == '#') {
             output[count] = htoi(token + 1);
         } else {
@@ -218,98 +425,150 @@ static int parse_integers(const char *str, int32_t *output)
     return count;
 }
 
+/* text patterns are for the CLI, "repeat, #rrggbb, ms, #rrggbb, ms..." */
 void light_fade_s(const char *pattern)
 {
-    static int32_t param[100];
+    static int32_t param[FADE_CUSTOM_MAX * 2 + 1];
 
     if (!pattern) {
         return;
     }
 
-    int param_num = parse_integers(pattern, param);
+    int param_num = parse_integers(pattern, param, sizeof(param) / sizeof(param[0]));
 
     if ((param_num < 3) || (param_num % 2 != 1)) {
         return;
     }
-    
-    fading.repeat = param[0];
-    fading.step_num = (param_num - 1) / 2;
-    for (int i = 0; i < fading.step_num; i++) {
-        fading.steps[i].from = i == 0 ? fading.color : fading.steps[i - 1].to;
-        fading.steps[i].to = rgb2local(param[i * 2 + 1], true);
-        fading.steps[i].duration = param[i * 2 + 2];
-    }
-    fading.curr_step = 0;
-    fading.elapsed = 0;
 
-    light_mode = MODE_FADE;
+    int step_num = (param_num - 1) / 2;
+
+    critical_section_enter_blocking(&light_lock);
+    for (int i = 0; i < step_num; i++) {
+        fade_custom[i].color = rgb2local(param[i * 2 + 1]);
+        fade_custom[i].duration = param[i * 2 + 2];
+        fade_custom[i].ease = EASE_LINEAR;
+    }
+    fade_start(fade_custom, step_num, param[0]);
+    critical_section_exit(&light_lock);
 }
 
-static void fade_control(uint32_t delta_ms)
+static void fade_control(uint32_t delta_us)
 {
     if (fading.repeat == 0) {
         return;
     }
 
-    fading.elapsed += delta_ms;
-    if (fading.elapsed > fading.steps[fading.curr_step].duration) {
-        fading.elapsed = 0;
-        fading.color = fading.steps[fading.curr_step].to;
+    const light_step_t *step = &fading.steps[fading.curr_step];
+    uint32_t duration = step->duration * 1000;
+
+    fading.elapsed += delta_us;
+    if (fading.elapsed >= duration) {
+        /* overshoot carries into the next step, so timing doesn't drift */
+        fading.elapsed -= duration;
+        fading.color = step->color;
+        fading.from = fading.color;
         fading.curr_step++;
         if (fading.curr_step == fading.step_num) {
             fading.curr_step = 0;
-            fading.steps[0].from = fading.color;
             if (fading.repeat > 0) {
                 fading.repeat--;
             }
         }
         return;
     }
-    
-    uint32_t color = lerp(fading.steps[fading.curr_step].from,
-                          fading.steps[fading.curr_step].to,
-                          fading.elapsed,
-                          fading.steps[fading.curr_step].duration);
 
-    fading.color = color;
+    uint8_t t = (uint64_t)fading.elapsed * 255 / duration;
+    fading.color = lerp(fading.from, step->color, ease(step->ease, t));
 }
 
+/* the fade engine plays on the reader layer */
 static void fade_render()
 {
-    uint32_t color = apply_level(fading.color, aic_cfg->light.level_active);
-
-    if (aic_cfg->light.rgb) {
-        for (int i = 0; i < RGB_NUM; i++) {
-            rgb_buf[i] = color << 8;
-        }
-    } else {
-        memset(rgb_buf, 0, sizeof(rgb_buf));
-    }
-
-    uint16_t gray = (fading.color >> 16) | (fading.color >> 8) | fading.color;
-    gray = apply_gray_level(gray, aic_cfg->light.level_active);
-    if (aic_cfg->light.led) {
-        for (int i = 0; i < LED_NUM; i++) {
-            led_buf[i] = gray;
-        }
-    } else {
-        memset(led_buf, 0, sizeof(led_buf));
+    static uint32_t rendered = 0xffffffff;
+    layer_t *layer = &layers[LIGHT_LAYER_READER];
+    layer_lut(layer, aic_cfg->light.level_active, true);
+    if (fading.color != rendered) {
+        layer_fill(layer, fading.color);
+        rendered = fading.color;
     }
 }
 
-static void fade_update(uint32_t delta_ms)
+static void fade_update(uint32_t delta_us)
 {
-    if (light_mode != MODE_FADE) {
+    if (!layer_visible(LIGHT_LAYER_READER)) {
         fading.color = 0x000000;
         fading.repeat = 0;
         return;
     }
 
-    fade_control(delta_ms);
+    fade_control(delta_us);
     fade_render();
 }
 
-static struct {
+/* the host writes straight into its layer under the light lock, the next
+   refresh picks it up */
+static void host_write(int first, int count)
+{
+    layer_t *layer = &layers[LIGHT_LAYER_HID];
+    for (int i = first; i < first + count; i++) {
+        layer->alpha[i] = 0xff;
+    }
+    layer->dirty = true;
+    layer_opacity(LIGHT_LAYER_HID, 0xff, 0);
+}
+
+static bool host_range(int first, int *count)
+{
+    if ((first < 0) || (first >= PIXEL_NUM) || (*count <= 0)) {
+        return false;
+    }
+    if (*count > PIXEL_NUM - first) {
+        *count = PIXEL_NUM - first;
+    }
+    return true;
+}
+
+void light_host_fill(int first, int count, uint32_t color)
+{
+    if (!host_range(first, &count)) {
+        return;
+    }
+    uint32_t local = rgb2local(color);
+    critical_section_enter_blocking(&light_lock);
+    for (int i = first; i < first + count; i++) {
+        layers[LIGHT_LAYER_HID].color[i] = local;
+    }
+    host_write(first, count);
+    critical_section_exit(&light_lock);
+}
+
+void light_host_pixels(int first, int count, const uint8_t *rgb)
+{
+    if (!host_range(first, &count)) {
+        return;
+    }
+    uint32_t *color = layers[LIGHT_LAYER_HID].color;
+    critical_section_enter_blocking(&light_lock);
+    for (int i = first; i < first + count; i++, rgb += 3) {
+        color[i] = RGB2LOCAL(rgb[0] << 16 | rgb[1] << 8 | rgb[2]);
+    }
+    host_write(first, count);
+    critical_section_exit(&light_lock);
+}
+
+void light_host_color(uint32_t color)
+{
+    light_host_fill(0, PIXEL_NUM, color);
+}
+
+static void host_update()
+{
+    if (layer_visible(LIGHT_LAYER_HID)) {
+        layer_lut(&layers[LIGHT_LAYER_HID], aic_cfg->light.level_active, true);
+    }
+}
+
+typedef struct {
     struct {
         int current;
         int from;
@@ -321,28 +580,56 @@ static struct {
         int to;
     } level;
     int smooth_ms;
-    int elapsed;
-} rainbow = { { 1, 1, 1 }, { 255, 255, 255 }, 0, 0 };
+    uint32_t elapsed; // us
+    uint32_t rotator; // 8.8 fixed point color wheel position
+    uint32_t rendered; // wheel index last rendered
+} rainbow_t;
 
-void light_rainbow(int8_t speed, uint32_t smooth_ms, uint8_t level)
+static rainbow_t idle_rainbow = { { 1, 1, 1 }, { 255, 255, 255 }, .rendered = UINT32_MAX };
+static rainbow_t burst_rainbow = { { 1, 1, 1 }, { 255, 255, 255 }, .rendered = UINT32_MAX };
+
+static void rainbow_set(rainbow_t *rainbow, int8_t speed, uint32_t smooth_ms, uint8_t level)
 {
     if (smooth_ms != 0) {
-        rainbow.speed.from = rainbow.speed.current;
-        rainbow.speed.to = speed;
+        rainbow->speed.from = rainbow->speed.current;
+        rainbow->speed.to = speed;
 
-        rainbow.level.from = rainbow.level.current;
-        rainbow.level.to = level;
+        rainbow->level.from = rainbow->level.current;
+        rainbow->level.to = level;
 
-        rainbow.smooth_ms = smooth_ms;
-        rainbow.elapsed = 0;
+        rainbow->smooth_ms = smooth_ms;
+        rainbow->elapsed = 0;
     } else {
-        rainbow.speed.current = speed;
-        rainbow.level.current = level;
-        rainbow.smooth_ms = 0;
-        rainbow.elapsed = 0;
+        rainbow->speed.current = speed;
+        rainbow->speed.to = speed;
+        rainbow->level.current = level;
+        rainbow->level.to = level;
+        rainbow->smooth_ms = 0;
+        rainbow->elapsed = 0;
+    }
+}
+
+void light_rainbow(int8_t speed, uint32_t smooth_ms, uint8_t level)
+{
+    critical_section_enter_blocking(&light_lock);
+    rainbow_set(&idle_rainbow, speed, smooth_ms, level);
+    critical_section_exit(&light_lock);
+}
+
+/* a fast rainbow over everything else but the host, it fades away slowly
+   after the card leaves */
+void light_card_burst(bool on)
+{
+    critical_section_enter_blocking(&light_lock);
+    if (on) {
+        burst_rainbow.rotator = idle_rainbow.rotator;
+        rainbow_set(&burst_rainbow, 30, 0, aic_cfg->light.level_active);
+        layer_opacity(LIGHT_LAYER_CARD, 0xff, 0);
+    } else if (layer_visible(LIGHT_LAYER_CARD)) {
+        rainbow_set(&burst_rainbow, 1, 3000, aic_cfg->light.level_idle);
+        layer_opacity(LIGHT_LAYER_CARD, 0, 3000);
     }
-    
-    light_mode = MODE_RAINBOW;
+    critical_section_exit(&light_lock);
 }
 
 static int fast_sqrt(int x)
@@ -366,83 +653,240 @@ static int fast_sqrt(int x)
     return result;
 }
 
-static void rainbow_control(uint32_t delta_ms)
+static void rainbow_control(rainbow_t *rainbow, uint32_t delta_us)
 {
-    if ((rainbow.smooth_ms == 0) || (rainbow.elapsed == rainbow.smooth_ms)) {
+    uint32_t smooth_us = rainbow->smooth_ms * 1000;
+    if ((smooth_us == 0) || (rainbow->elapsed == smooth_us)) {
         return;
     }
 
-    rainbow.elapsed += delta_ms;
-    if (rainbow.elapsed > rainbow.smooth_ms) {
-        rainbow.elapsed = rainbow.smooth_ms;
+    rainbow->elapsed += delta_us;
+    if (rainbow->elapsed > smooth_us) {
+        rainbow->elapsed = smooth_us;
     }
 
     /* non linear speed change for better visual */
-    int range = rainbow.speed.to - rainbow.speed.from;
-    int progress = fast_sqrt(rainbow.elapsed * 10000 / rainbow.smooth_ms);
-    rainbow.speed.current = rainbow.speed.from + range * progress / 100;
+    int range = rainbow->speed.to - rainbow->speed.from;
+    int progress = fast_sqrt((uint64_t)rainbow->elapsed * 10000 / smooth_us);
+    rainbow->speed.current = rainbow->speed.from + range * progress / 100;
 
-    range = rainbow.level.to - rainbow.level.from;
-    progress = rainbow.elapsed * 100 / rainbow.smooth_ms;
-    rainbow.level.current = rainbow.level.from + range * progress / 100;
+    range = rainbow->level.to - rainbow->level.from;
+    progress = (uint64_t)rainbow->elapsed * 100 / smooth_us;
+    rainbow->level.current = rainbow->level.from + range * progress / 100;
 }
 
 #define RAINBOW_PITCH 37
+#define RAINBOW_FRAME_US 33333 // speed is in wheel steps per 30Hz frame
 
-static void rainbow_render()
+static void rainbow_render(rainbow_t *rainbow, layer_t *layer, uint32_t delta_us)
 {
-    static uint64_t last = 0;
-    uint64_t now = time_us_64();
-    if (now - last < 33333) { // no faster than 30Hz
+    int32_t step = rainbow->speed.current * (int32_t)delta_us * 256 / RAINBOW_FRAME_US;
+    rainbow->rotator = (rainbow->rotator + step) & (COLOR_WHEEL_SIZE * 256 - 1);
+
+    /* the wheel is not gamma corrected, level goes into the table */
+    layer_lut(layer, rainbow->level.current, false);
+
+    uint32_t rotator = rainbow->rotator >> 8;
+    if (rotator == rainbow->rendered) {
         return;
     }
-    last = now;
+    rainbow->rendered = rotator;
 
-    static uint32_t rotator = 0;
-    rotator = (rotator + rainbow.speed.current) % COLOR_WHEEL_SIZE;
+    for (int i = 0; i < rgb_num(); i++) {
+        uint32_t index = (rotator + RAINBOW_PITCH * i) % COLOR_WHEEL_SIZE;
+        layer->color[i] = color_wheel[index];
+        layer->alpha[i] = 0xff;
+    }
 
-    if (aic_cfg->light.rgb) {
-        for (int i = 0; i < RGB_NUM; i++) {
-            uint32_t index = (rotator + RAINBOW_PITCH * i) % COLOR_WHEEL_SIZE;
-            rgb_buf[i] = apply_level(color_wheel[index], rainbow.level.current) << 8;
+    for (int i = 0; i < LED_NUM; i++) {
+        uint32_t index = (rotator + RAINBOW_PITCH * i) % COLOR_WHEEL_SIZE;
+        uint8_t gray = gray_wheel[index];
+        layer->color[RGB_NUM + i] = gray << 16 | gray << 8 | gray;
+        layer->alpha[RGB_NUM + i] = 0xff;
+    }
+
+    layer->dirty = true;
+}
+
+static void rainbow_update(rainbow_t *rainbow, light_layer_t id, uint32_t delta_us)
+{
+    if (!layer_visible(id)) {
+        rainbow->rendered = UINT32_MAX;
+        return;
+    }
+    rainbow_control(rainbow, delta_us);
+    rainbow_render(rainbow, &layers[id], delta_us);
+}
+
+/* 16 bit to the strip's 8 bit. With dithering the dropped fraction is kept
+   per channel and added to the next refresh, so at low levels a color
+   between two codes shows as their average over a few frames. */
+static uint8_t dither_error[RGB_NUM][3];
+
+static inline uint8_t quantize(uint16_t value, uint8_t *error)
+{
+    uint32_t sum = value + *error;
+    *error = sum & 0xff;
+    return sum > 0xffff ? 0xff : sum >> 8;
+}
+
+static inline uint8_t round8(uint16_t value)
+{
+    return value >= 0xff80 ? 0xff : (value + 0x80) >> 8;
+}
+
+/* composed colors to WS2812 words and PWM levels, the strip goes into the
+   back buffer */
+static void output(bool *rgb_changed, bool *led_changed)
+{
+    uint32_t *back = rgb_buf[!rgb_front];
+    int num = rgb_num();
+    if (!aic_cfg->light.rgb) {
+        memset(back, 0, num * sizeof(back[0]));
+    } else if (aic_cfg->light.dither) {
+        for (int i = 0; i < num; i++) {
+            back[i] = (uint32_t)quantize(composed[i][0], &dither_error[i][0]) << 24 |
+                      quantize(composed[i][1], &dither_error[i][1]) << 16 |
+                      quantize(composed[i][2], &dither_error[i][2]) << 8;
         }
     } else {
-        memset(rgb_buf, 0, sizeof(rgb_buf));
+        for (int i = 0; i < num; i++) {
+            back[i] = (uint32_t)round8(composed[i][0]) << 24 |
+                      round8(composed[i][1]) << 16 |
+                      round8(composed[i][2]) << 8;
+        }
+    }
+    *rgb_changed = (memcmp(back, rgb_buf[rgb_front], num * sizeof(back[0])) != 0);
+
+    /* PWM is 16 bit already, no dithering needed */
+    *led_changed = false;
+    for (int i = 0; i < LED_NUM; i++) {
+        const uint16_t *c = composed[RGB_NUM + i];
+        uint16_t gray = c[0] > c[1] ? c[0] : c[1];
+        gray = gray > c[2] ? gray : c[2];
+        uint16_t level = aic_cfg->light.led ? gray : 0;
+        *led_changed |= (led_buf[i] != level);
+        led_buf[i] = level;
+    }
+}
+
+static struct {
+    repeating_timer_t timer;
+    uint64_t last;
+    uint32_t count;
+    uint32_t jitter_last;
+    uint32_t jitter_max;
+    uint64_t jitter_sum;
+    uint32_t render_max;
+    uint64_t render_sum;
+    uint32_t busy;
+    uint32_t skipped;
+} refresh;
+
+/* an unchanged frame touches neither the DMA nor the PWM */
+static void drive_led(bool rgb_changed, bool led_changed)
+{
+    if (!rgb_changed && !led_changed) {
+        refresh.skipped++;
+        return;
+    }
+
+    if (rgb_changed) {
+        /* a frame still shifting out stays, the back buffer is tried again
+           on the next tick */
+        if (dma_channel_is_busy(rgb_dma)) {
+            refresh.busy++;
+        } else {
+            rgb_front = !rgb_front;
+            dma_channel_configure(rgb_dma, &rgb_dma_cfg,
+                                  &pio0_hw->txf[0],
+                                  rgb_buf[rgb_front],
+                                  rgb_num(),
+                                  true);
+        }
     }
 
-    if (aic_cfg->light.led) {
+    if (led_changed) {
         for (int i = 0; i < LED_NUM; i++) {
-            uint32_t index = (rotator + RAINBOW_PITCH * i) % COLOR_WHEEL_SIZE;
-            led_buf[i] = apply_gray_level(gray_wheel[index], rainbow.level.current);
+            pwm_set_gpio_level(led_gpio[i], led_buf[i]);
         }
-    } else {
-        memset(led_buf, 0, sizeof(led_buf));
     }
 }
 
-static void rainbow_update(uint32_t delta_ms)
+/* LEDs past a shorter count would keep their last color, so a frame of
+   zeros goes over the whole strip before the count shrinks */
+void light_set_rgb_num(int num)
 {
-    if (light_mode != MODE_RAINBOW) {
-        rainbow.smooth_ms = 0;
-        rainbow.speed.current = rainbow.speed.to;
-        rainbow.level.current = rainbow.level.to;
-        return;
+    critical_section_enter_blocking(&light_lock);
+    if (num < rgb_num()) {
+        dma_channel_wait_for_finish_blocking(rgb_dma);
+        rgb_front = !rgb_front;
+        memset(rgb_buf[rgb_front], 0, sizeof(rgb_buf[rgb_front]));
+        dma_channel_configure(rgb_dma, &rgb_dma_cfg,
+                              &pio0_hw->txf[0],
+                              rgb_buf[rgb_front],
+                              RGB_NUM,
+                              true);
     }
-    rainbow_control(delta_ms);
-    rainbow_render();
+    aic_cfg->light.rgb_num = num;
+    critical_section_exit(&light_lock);
 }
 
-static void drive_led()
+static void light_render(uint32_t delta_us)
 {
-    dma_channel_configure(rgb_dma, &rgb_dma_cfg,
-                          &pio0_hw->txf[0],
-                          rgb_buf,
-                          RGB_NUM,
-                          true);
-                        
-    for (int i = 0; i < LED_NUM; i++) {
-        pwm_set_gpio_level(led_gpio[i], led_buf[i]);
+    fade_update(delta_us);
+    host_update();
+    rainbow_update(&idle_rainbow, LIGHT_LAYER_IDLE, delta_us);
+    rainbow_update(&burst_rainbow, LIGHT_LAYER_CARD, delta_us);
+    opacity_control(delta_us);
+
+    composite();
+
+    bool rgb_changed, led_changed;
+    output(&rgb_changed, &led_changed);
+    drive_led(rgb_changed, led_changed);
+}
+
+static bool refresh_cb(repeating_timer_t *rt)
+{
+    uint64_t now = time_us_64();
+    uint32_t delta_us = now - refresh.last;
+    refresh.last = now;
+
+    uint32_t jitter = abs((int32_t)delta_us - REFRESH_INTERVAL_US);
+    refresh.count++;
+    refresh.jitter_last = jitter;
+    refresh.jitter_sum += jitter;
+    if (jitter > refresh.jitter_max) {
+        refresh.jitter_max = jitter;
     }
+
+    critical_section_enter_blocking(&light_lock);
+    light_render(delta_us);
+    critical_section_exit(&light_lock);
+
+    uint32_t render = time_us_64() - now;
+    refresh.render_sum += render;
+    if (render > refresh.render_max) {
+        refresh.render_max = render;
+    }
+
+    return true;
+}
+
+light_stat_t light_get_stat()
+{
+    uint32_t count = refresh.count;
+    return (light_stat_t) {
+        .count = count,
+        .jitter_last_us = refresh.jitter_last,
+        .jitter_max_us = refresh.jitter_max,
+        .jitter_avg_us = count ? refresh.jitter_sum / count : 0,
+        .render_max_us = refresh.render_max,
+        .render_avg_us = count ? refresh.render_sum / count : 0,
+        .busy = refresh.busy,
+        .skipped = refresh.skipped,
+    };
 }
 
 void light_init()
@@ -471,20 +915,13 @@ void light_init()
     channel_config_set_dreq(&rgb_dma_cfg, DREQ_PIO0_TX0);
 
     generate_color_wheel();
-}
+    generate_gamma();
 
-void light_update()
-{
-    static uint64_t last_time = 0;
-    uint64_t now = time_us_64();
-    if (now - last_time < 4000) { // no faster than 250Hz
-        return;
-    }
-    uint32_t delta_ms = (now - last_time) / 1000;
-    last_time = now;
+    critical_section_init(&light_lock);
 
-    fade_update(delta_ms);
-    rainbow_update(delta_ms);
+    layer_opacity(LIGHT_LAYER_IDLE, 0xff, 0);
 
-    drive_led();
+    /* runs from timer irq at a fixed rate, whatever the GUI frame time is */
+    refresh.last = time_us_64();
+    add_repeating_timer_us(-REFRESH_INTERVAL_US, refresh_cb, NULL, &refresh.timer);
 }
@@ -13,14 +13,69 @@
 #include "config.h"
 
 void light_init();
-void light_update();
+void light_set_rgb_num(int num); // WS2812 fitted, the caller saves the config
+
+/* refresh runs from a timer irq, jitter is the deviation from its period */
+typedef struct {
+    uint32_t count;
+    uint32_t jitter_last_us;
+    uint32_t jitter_max_us;
+    uint32_t jitter_avg_us;
+    uint32_t render_max_us;
+    uint32_t render_avg_us;
+    uint32_t busy; // strip frames held back while DMA was still busy
+    uint32_t skipped; // unchanged frames, nothing pushed
+} light_stat_t;
+
+light_stat_t light_get_stat();
 
 uint32_t rgb32_from_hsv(uint8_t h, uint8_t s, uint8_t v);
 
+typedef enum {
+    EASE_LINEAR,
+    EASE_IN,
+    EASE_OUT,
+    EASE_STEP, // holds, then jumps at the end
+} light_ease_t;
+
+/* color is in local channel order, gamma is applied on output */
+typedef struct {
+    uint32_t color;
+    uint16_t duration;
+    uint8_t ease;
+} light_step_t;
+
+typedef struct {
+    int8_t repeat; // -1 is endless
+    uint8_t step_num;
+    const light_step_t *steps;
+} light_pattern_t;
+
+#define LIGHT_PATTERN_NUM 0x20
+
 void light_fade(uint32_t color, uint32_t fading_ms);
 void light_fade_n(int repeat, int count, ...);
 void light_fade_s(const char *pattern);
+/* compiled patterns, ids are Bana LED commands, false if there's no such */
+bool light_fade_pattern(int id);
 
 void light_rainbow(int8_t speed, uint32_t smooth_ms, uint8_t level);
 
+/* layers in priority order, higher ones cover the lower ones */
+typedef enum {
+    LIGHT_LAYER_IDLE, // rainbow
+    LIGHT_LAYER_READER, // fades and patterns
+    LIGHT_LAYER_CARD, // card arrival burst
+    LIGHT_LAYER_HID, // host override
+    LIGHT_LAYER_NUM
+} light_layer_t;
+
+void light_card_burst(bool on);
+/* host layer, pixels are the strip followed by the PWM LEDs */
+void light_host_color(uint32_t color);
+void light_host_fill(int first, int count, uint32_t color);
+void light_host_pixels(int first, int count, const uint8_t *rgb);
+/* fades the layer out, lower layers show through */
+void light_release(light_layer_t layer, uint32_t fade_ms);
+
 #endif
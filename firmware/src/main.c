@@ -35,32 +35,15 @@
 #include "commands.h"
 #include "light.h"
 #include "keypad.h"
+#include "cardio.h"
+#include "logger.h"
 #include "gui.h"
 
-#define DEBUG(...) if (aic_runtime.debug) printf(__VA_ARGS__)
+#define DEBUG(...) LOG_DEBUG(__VA_ARGS__)
+#define DEBUG_HEX(data, len) LOG_HEX(LOG_LEVEL_DEBUG, data, len)
 
-static struct {
-    uint8_t current[9];
-    uint8_t reported[9];
-    uint64_t report_time;
-} hid_cardio;
-
-void report_hid_cardio()
-{
-    if (!tud_hid_ready()) {
-        return;
-    }
-
-    uint64_t now = time_us_64();
-
-    if ((memcmp(hid_cardio.current, hid_cardio.reported, 9) != 0) &&
-        (now - hid_cardio.report_time > 1000000)) {
-
-        tud_hid_n_report(0x00, hid_cardio.current[0], hid_cardio.current + 1, 8);
-        memcpy(hid_cardio.reported, hid_cardio.current, 9);
-        hid_cardio.report_time = now;
-    }
-}
+/* log output per core0 pass, the reader ports share the core */
+#define LOG_FLUSH_BUDGET_US 300
 
 struct __attribute__((packed)) {
     uint8_t modifier;
@@ -69,14 +52,8 @@ struct __attribute__((packed)) {
 
 static const char keymap[12] = KEYPAD_NKRO_MAP;
 
-void report_hid_key()
+static void update_hid_nkro(uint16_t keys)
 {
-    if (!tud_hid_ready()) {
-        return;
-    }
-
-    uint16_t keys = aic_runtime.touch ? gui_keypad_read() : keypad_read();
-
     for (int i = 0; i < keypad_key_num(); i++) {
         uint8_t code = keymap[i];
         uint8_t byte = code / 8;
@@ -87,12 +64,49 @@ void report_hid_key()
             hid_nkro.keymap[byte] &= ~(1 << bit);
         }
     }
-    tud_hid_n_report(1, 0, &hid_nkro, sizeof(hid_nkro));
+}
+
+/* one report per key event so short taps survive a busy endpoint */
+void report_hid_key()
+{
+    static uint16_t reported_keys;
+    static struct {
+        bool valid;
+        uint16_t keys;
+    } pending;
+
+    if (!tud_hid_n_ready(1)) {
+        return;
+    }
+
+    if (aic_runtime.touch) {
+        pending.keys = gui_keypad_read();
+        pending.valid = true;
+    } else if (!pending.valid) {
+        keypad_event_t event = { 0 };
+        pending.valid = keypad_get_event(&event);
+        pending.keys = event.keys;
+    }
+
+    if (!pending.valid) {
+        return;
+    }
+
+    if (pending.keys == reported_keys) {
+        pending.valid = false;
+        return;
+    }
+
+    update_hid_nkro(pending.keys);
+    if (tud_hid_n_report(1, 0, &hid_nkro, sizeof(hid_nkro))) {
+        reported_keys = pending.keys;
+        pending.valid = false;
+    }
 }
 
 void report_usb_hid()
 {
-    report_hid_cardio();
+    cardio_report();
     report_hid_key();
 }
 
@@ -111,6 +125,12 @@ static bool reader_is_active()
     return aime_is_active() || bana_is_active();
 }
 
+/* flash sector erases wait for this */
+static bool reader_is_idle()
+{
+    return !reader_is_active();
+}
+
 static void light_mode_update()
 {
     static bool was_cardio = true;
@@ -118,7 +138,21 @@ static void light_mode_update()
     static uint8_t last_level;
     bool level_changed = (last_level != aic_cfg->light.level_idle);
 
-    if (cardio && (!was_cardio || level_changed)) {
+    static bool was_hid = false;
+    bool hid = hid_is_active();
+
+    if (cardio && !was_cardio) {
+        light_release(LIGHT_LAYER_READER, 1000);
+    } else if (!cardio && was_cardio) {
+        light_release(LIGHT_LAYER_CARD, 200);
+    }
+
+    if (was_hid && !hid) {
+        light_release(LIGHT_LAYER_HID, 1000);
+    }
+    was_hid = hid;
+
+    if (level_changed) {
         light_rainbow(1, 1000, aic_cfg->light.level_idle);
         last_level = aic_cfg->light.level_idle;
     }
@@ -134,20 +168,19 @@ static void core1_init()
     }
 }
 
-static mutex_t core1_io_lock;
 static void core1_loop()
 {
     uint64_t next_frame = 0;
 
+    /* flash saves park core1 for the erase or program only */
+    multicore_lockout_victim_init();
     core1_init();
 
     while (1) {
-        if (mutex_try_enter(&core1_io_lock, NULL)) {
-            if (aic_runtime.touch) {
-                gui_loop();
-            }
-            light_update();
-            mutex_exit(&core1_io_lock);
+        /* gui_loop returns at once if a frame is not due, lights are
+           refreshed from their own timer */
+        if (aic_runtime.touch) {
+            gui_loop();
         }
         light_mode_update();
         cli_fps_count(1);
@@ -161,43 +194,10 @@ void card_name_update_cb(nfc_card_name card_name)
     gui_report_card(card_name);
 }
 
-static void update_cardio(nfc_card_t *card)
-{
-    switch (card->card_type) {
-        case NFC_CARD_MIFARE:
-            hid_cardio.current[0] = REPORT_ID_EAMU;
-            hid_cardio.current[1] = 0xe0;
-            hid_cardio.current[2] = 0x04;
-            if (card->len == 4) {
-                memcpy(hid_cardio.current + 3, card->uid, 4);
-                memcpy(hid_cardio.current + 7, card->uid, 2);
-            } else if (card->len == 7) {
-                memcpy(hid_cardio.current + 3, card->uid + 1, 6);
-            }
-            break;
-        case NFC_CARD_FELICA:
-            hid_cardio.current[0] = REPORT_ID_FELICA;
-            memcpy(hid_cardio.current + 1, card->uid, 8);
-           break;
-        case NFC_CARD_VICINITY:
-            hid_cardio.current[0] = REPORT_ID_EAMU;
-            memcpy(hid_cardio.current + 1, card->uid, 8);
-            break;
-        default:
-            memset(hid_cardio.current, 0, 9);
-            return;
-    }
-
-    printf(" -> CardIO ");
-    for (int i = 1; i < 9; i++) {
-        printf("%02X", hid_cardio.current[i]);
-    }
-}
-
 static void cardio_run()
 {
     if (aime_is_active() || bana_is_active()) {
-        memset(hid_cardio.current, 0, 9);
+        cardio_clear();
         return;
     }
 
@@ -217,110 +217,178 @@ static void cardio_run()
     old_card = card;
 
     if (!reader_is_active() && !hid_is_active()) {
-        if (card.card_type != NFC_CARD_NONE) {
-            light_rainbow(30, 0, aic_cfg->light.level_active);
-        } else {
-            light_rainbow(1, 3000, aic_cfg->light.level_idle);
-        }
+        light_card_burst(card.card_type != NFC_CARD_NONE);
     }
 
     display_card(&card);
-    update_cardio(&card);
+    cardio_update(&card);
 }
 
-const int reader_intf = 1;
+/* CDC 0 is the CLI, each of the rest runs its own protocol instance */
 static struct {
+    uint8_t intf;
     uint8_t buf[64];
     int pos;
-} reader;
+    bool was_active;
+    mode_detector_t *detector;
+    aime_ctx_t *aime;
+    bana_ctx_t *bana;
+} readers[READER_PORT_NUM];
 
-static void cdc_reader_putc(uint8_t byte)
+static void cdc_reader_putc(int port, uint8_t byte)
 {
-    tud_cdc_n_write(reader_intf, &byte, 1);
-    tud_cdc_n_write_flush(reader_intf);
+    tud_cdc_n_write(readers[port].intf, &byte, 1);
+    tud_cdc_n_write_flush(readers[port].intf);
+}
+
+static void reader_init()
+{
+    aime_virtual_aic(aic_cfg->reader.virtual_aic);
+    for (int i = 0; i < READER_PORT_NUM; i++) {
+        readers[i].intf = i + 1;
+        readers[i].was_active = true; // so first time mode will be cleared
+        readers[i].detector = mode_detect_init();
+        readers[i].aime = aime_init(cdc_reader_putc, i);
+        readers[i].bana = bana_init(cdc_reader_putc, i);
+    }
+}
+
+static bool reader_port_is_active(int port)
+{
+    return aime_ctx_is_active(readers[port].aime) ||
+           bana_ctx_is_active(readers[port].bana);
 }
 
 static void reader_poll_data()
 {
-    if (tud_cdc_n_available(reader_intf)) {
-        int count = tud_cdc_n_read(reader_intf, reader.buf + reader.pos,
-                                   sizeof(reader.buf) - reader.pos);
+    for (int port = 0; port < READER_PORT_NUM; port++) {
+        uint8_t intf = readers[port].intf;
+        if (!tud_cdc_n_available(intf)) {
+            continue;
+        }
+        uint8_t *buf = readers[port].buf;
+        int pos = readers[port].pos;
+        int count = tud_cdc_n_read(intf, buf + pos, sizeof(readers[port].buf) - pos);
         if (count > 0) {
             uint32_t now = time_us_32();
-            DEBUG("\n\033[32m%6ld>>", now / 1000);
-            for (int i = 0; i < count; i++) {
-                DEBUG(" %02X", reader.buf[reader.pos + i]);
-            }
+            DEBUG("\n\033[32m%6ld%c>>", now / 1000, 'A' + port);
+            DEBUG_HEX(buf + pos, count);
             DEBUG("\033[0m");
-            reader.pos += count;
+            readers[port].pos += count;
         }
     }
 }
 
-static void reader_detect_mode()
+static void reader_feed(int port, const uint8_t *buf, int count)
+{
+    reader_mode_t mode = aic_runtime.mode[port];
+    switch (mode) {
+        case MODE_AIME0:
+        case MODE_AIME1:
+            aime_sub_mode(readers[port].aime, mode == MODE_AIME0 ? 0 : 1);
+            for (int i = 0; i < count; i++) {
+                aime_feed(readers[port].aime, buf[i]);
+            }
+            break;
+        case MODE_BANA:
+            for (int i = 0; i < count; i++) {
+                bana_feed(readers[port].bana, buf[i]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void reader_detect_mode(int port)
 {
     if (aic_cfg->reader.mode == MODE_AUTO) {
-        static bool was_active = true; // so first time mode will be cleared
-        bool is_active = aime_is_active() || bana_is_active();
-        if (was_active && !is_active) {
-            aic_runtime.mode = MODE_NONE;
+        bool is_active = reader_port_is_active(port);
+        if (readers[port].was_active && !is_active) {
+            aic_runtime.mode[port] = MODE_NONE;
         }
-        was_active = is_active;
+        readers[port].was_active = is_active;
     } else {
-        aic_runtime.mode = aic_cfg->reader.mode;
+        aic_runtime.mode[port] = aic_cfg->reader.mode;
     }
 
-    if (aic_runtime.mode == MODE_NONE) {
-        cdc_line_coding_t coding;
-        tud_cdc_n_get_line_coding(reader_intf, &coding);
-        aic_runtime.mode = mode_detect(reader.buf, reader.pos, coding.bit_rate);
-        if ((reader.pos > 10) && (aic_runtime.mode == MODE_NONE)) {
-            reader.pos = 0; // drop the buffer
+    if (aic_runtime.mode[port] != MODE_NONE) {
+        return;
+    }
+
+    cdc_line_coding_t coding;
+    tud_cdc_n_get_line_coding(readers[port].intf, &coding);
+
+    uint8_t *buf = readers[port].buf;
+    for (int i = 0; i < readers[port].pos; i++) {
+        mode_detector_t *detector = readers[port].detector;
+        reader_mode_t mode = mode_detect_feed(detector, buf[i], coding.bit_rate);
+        if (mode == MODE_NONE) {
+            continue;
         }
+
+        aic_runtime.mode[port] = mode;
+        DEBUG("\nMode detected on port %d: %s", port, (uintptr_t)mode_name(mode));
+
+        /* the winning frame may span several packets, replay it in full */
+        size_t len;
+        const uint8_t *replay = mode_detect_replay(detector, &len);
+        reader_feed(port, replay, len);
+
+        readers[port].pos -= i + 1;
+        memmove(buf, buf + i + 1, readers[port].pos);
+        return;
     }
 
+    readers[port].pos = 0; // detector keeps its own copy
 }
 
 static void reader_light()
 {
     static uint32_t old_color = 0;
-    if (aime_is_active()) {
-        uint32_t color = aime_led_color();
-        if (old_color != color) {
-            light_fade(color, 100);
-            old_color = color;
+
+    for (int port = 0; port < READER_PORT_NUM; port++) {
+        if (aime_ctx_is_active(readers[port].aime)) {
+            uint32_t color = aime_led_color(readers[port].aime);
+            if (old_color != color) {
+                light_fade(color, 100);
+                old_color = color;
+            }
+            return;
+        } else if (bana_ctx_is_active(readers[port].bana)) {
+            light_fade_pattern(bana_get_led_cmd(readers[port].bana));
+            return;
         }
-    } else if (bana_is_active()) {
-        light_fade_s(bana_get_led_pattern());
     }
+
+    /* the reader layer gets released, next reader color fades in again */
+    old_color = 0;
+}
+
+/* a host command waiting on any reader port goes before log output */
+static bool reader_rx_pending()
+{
+    for (int port = 0; port < READER_PORT_NUM; port++) {
+        if (tud_cdc_n_available(readers[port].intf)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 static void reader_run()
 {
     reader_poll_data();
-    reader_detect_mode();
-
-    if (reader.pos > 0) {
-        uint8_t buf[64];
-        memcpy(buf, reader.buf, reader.pos);
-        int count = reader.pos;
-        switch (aic_runtime.mode) {
-            case MODE_AIME0:
-            case MODE_AIME1:
-                reader.pos = 0;
-                aime_sub_mode(aic_runtime.mode == MODE_AIME0 ? 0 : 1);
-                for (int i = 0; i < count; i++) {
-                    aime_feed(buf[i]);
-                }
-                break;
-            case MODE_BANA:
-                reader.pos = 0;
-                for (int i = 0; i < count; i++) {
-                    bana_feed(buf[i]);
-                }
-                break;
-            default:
-                break;
+
+    for (int port = 0; port < READER_PORT_NUM; port++) {
+        reader_detect_mode(port);
+
+        int count = readers[port].pos;
+        if ((count > 0) && (aic_runtime.mode[port] != MODE_NONE)) {
+            uint8_t buf[64];
+            memcpy(buf, readers[port].buf, count);
+            readers[port].pos = 0;
+            reader_feed(port, buf, count);
         }
     }
 
@@ -329,7 +397,6 @@ static void reader_run()
 
 void wait_loop()
 {
-    keypad_update();
     report_hid_key();
 
     tud_task();
@@ -348,10 +415,12 @@ static void core0_loop()
         reader_run();
         cardio_run();
 
-        keypad_update();
         report_usb_hid();
     
         save_loop();
+        if (!reader_rx_pending()) {
+            logger_flush(LOG_FLUSH_BUDGET_US);
+        }
         cli_fps_count(0);
         sleep_ms(1);
     }
@@ -378,9 +447,9 @@ void init()
     tusb_init();
     stdio_init_all();
 
+    logger_init();
     config_init();
-    mutex_init(&core1_io_lock);
-    save_init(0xca340a1c, &core1_io_lock);
+    save_init(0xca340a1c, reader_is_idle);
 
     identify_touch();
 
@@ -400,9 +469,7 @@ void init()
     nfc_pn5180_tx_tweak(aic_cfg->tweak.pn5180_tx);
     nfc_set_card_name_listener(card_name_update_cb);
 
-    aime_init(cdc_reader_putc);
-    aime_virtual_aic(aic_cfg->reader.virtual_aic);
-    bana_init(cdc_reader_putc);
+    reader_init();
 
     cli_init("aic_pico>", "\n     << AIC Pico >>\n"
                             " https://github.com/whowechina\n\n");
@@ -459,7 +526,7 @@ uint16_t tud_hid_get_report_cb(uint8_t itf, uint8_t report_id,
                                hid_report_type_t report_type, uint8_t *buffer,
                                uint16_t reqlen)
 {
-    printf("Get from USB %d-%d\n", report_id, report_type);
+    LOG_INFO("\nGet from USB %d-%d", report_id, report_type);
     return 0;
 }
 
@@ -469,25 +536,47 @@ void tud_hid_set_report_cb(uint8_t itf, uint8_t report_id,
                            hid_report_type_t report_type, uint8_t const *buffer,
                            uint16_t bufsize)
 {
-    if ((report_id == REPORT_ID_LIGHTS) &&
-        (report_type == HID_REPORT_TYPE_OUTPUT)) {
-        if (bufsize >= 3) {
-            last_hid_time = time_us_64();
-            light_fade(buffer[0] << 16 | buffer[1] << 8 | buffer[2], 0);
+    /* OUT endpoint data still has the report id in front */
+    if ((report_id == 0) && (report_type == HID_REPORT_TYPE_INVALID) && (bufsize > 0)) {
+        report_id = buffer[0];
+        report_type = HID_REPORT_TYPE_OUTPUT;
+        buffer++;
+        bufsize--;
+    }
+
+    if (report_type != HID_REPORT_TYPE_OUTPUT) {
+        return;
+    }
+
+    if ((report_id == REPORT_ID_LIGHTS) && (bufsize >= 3)) {
+        last_hid_time = time_us_64();
+        light_host_color(buffer[0] << 16 | buffer[1] << 8 | buffer[2]);
+    } else if ((report_id == REPORT_ID_LIGHTS_ZONE) && (bufsize >= 5)) {
+        last_hid_time = time_us_64();
+        uint8_t first = buffer[0];
+        uint8_t count = buffer[1];
+        const uint8_t *rgb = buffer + 2;
+        if (count & LIGHT_ZONE_FILL) {
+            light_host_fill(first, count & ~LIGHT_ZONE_FILL, rgb[0] << 16 | rgb[1] << 8 | rgb[2]);
+        } else {
+            int max = (bufsize - 2) / 3;
+            light_host_pixels(first, count < max ? count : max, rgb);
         }
     }
 }
 
 void tud_cdc_line_state_cb(uint8_t itf, bool dtr, bool rts)
 {
-    if (itf != reader_intf) {
-        return;
-    }
+    for (int port = 0; port < READER_PORT_NUM; port++) {
+        if (itf != readers[port].intf) {
+            continue;
+        }
 
-    DEBUG("\nReader Line State: %d %d", dtr, rts);
+        DEBUG("\nReader %d Line State: %d %d", port, dtr, rts);
 
-    if (!dtr) {
-        aime_dtr_off();
-        bana_dtr_off();
+        if (!dtr) {
+            aime_dtr_off(readers[port].aime);
+            bana_dtr_off(readers[port].bana);
+        }
     }
 }
@@ -722,4 +722,5 @@ const anima_t anima_glow = {
     .size = sizeof(anima_glow_data),
     .index = anima_glow_index,
     .data = anima_glow_data,
+    .encoding = RLE_RLE_X,
 };
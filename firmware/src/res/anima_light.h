@@ -9334,5 +9334,6 @@ const anima_t anima_light = {
     .frames = 24,
     .index = anima_light_index,
     .data = anima_light_data,
+    .encoding = RLE_RLE_X,
     .size = sizeof(anima_light_data),
 };
@@ -5743,4 +5743,5 @@ const anima_t anima_star = {
     .size = sizeof(anima_star_data),
     .index = anima_star_index,
     .data = anima_star_data,
+    .encoding = RLE_RLE_X,
 };
@@ -777,6 +777,10 @@ static const lv_font_dsc_t conthrax_dsc[] = {
     {.bitmap_index = 6302, .adv_w = 217, .box_w = 8, .box_h = 7, .ofs_x = 8, .ofs_y = 6}
 };
 
+#ifndef FONT_ATLAS_BUILD
+#include "font_conthrax_atlas.h"
+#endif
+
 static const lv_font_t lv_conthrax = {
     .range_start = 48,
     .range_length = 12,
@@ -785,4 +789,5 @@ static const lv_font_t lv_conthrax = {
     .base_line = 0,
     .dsc = conthrax_dsc,
     .bitmap = conthrax_bitmap,
+    .atlas = LV_FONT_ATLAS(conthrax_atlas),
 };
@@ -0,0 +1,247 @@
+/* Generated by font_atlas.c, glyph rows as alpha spans: span count,
+   then skip, length (bit 7 = solid) and alpha bytes unless solid. */
+
+#include <stdint.h>
+#include "../gfx.h"
+
+static const uint8_t conthrax_atlas_data[] = {
+    0x03, 0x04, 0x06, 0x15, 0x72, 0xad, 0xdb, 0xed, 0xfb, 0x00, 0x87, 0x00, 0x06, 0xfb, 0xed, 0xdb,
+    0xae, 0x73, 0x16, 0x03, 0x02, 0x03, 0x01, 0x73, 0xf9, 0x00, 0x91, 0x00, 0x03, 0xf9, 0x77, 0x02,
+    0x03, 0x02, 0x01, 0x80, 0x00, 0x95, 0x00, 0x01, 0x85, 0x03, 0x01, 0x02, 0x29, 0xfd, 0x00, 0x95,
+    0x00, 0x02, 0xfe, 0x2e, 0x05, 0x01, 0x01, 0x92, 0x00, 0x85, 0x00, 0x0d, 0xbc, 0x7f, 0x64, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x64, 0x7f, 0xba, 0x00, 0x85, 0x00, 0x01, 0x98, 0x06, 0x01,
+    0x01, 0xd2, 0x00, 0x84, 0x00, 0x01, 0x6d, 0x0d, 0x01, 0x68, 0x00, 0x84, 0x00, 0x01, 0xd8, 0x02,
+    0x00, 0x07, 0x05, 0xfc, 0xff, 0xff, 0xff, 0xe2, 0x04, 0x0d, 0x07, 0x02, 0xdd, 0xff, 0xff, 0xff,
+    0xfe, 0x0a, 0x06, 0x00, 0x01, 0x14, 0x00, 0x84, 0x00, 0x01, 0xb6, 0x0f, 0x01, 0xb0, 0x00, 0x84,
+    0x00, 0x01, 0x1a, 0x06, 0x00, 0x01, 0x20, 0x00, 0x84, 0x00, 0x01, 0xa0, 0x0f, 0x01, 0x99, 0x00,
+    0x84, 0x00, 0x01, 0x28, 0x06, 0x00, 0x01, 0x23, 0x00, 0x84, 0x00, 0x01, 0x97, 0x0f, 0x01, 0x8f,
+    0x00, 0x84, 0x00, 0x01, 0x2b, 0x06, 0x00, 0x01, 0x23, 0x00, 0x84, 0x00, 0x01, 0x97, 0x0f, 0x01,
+    0x8f, 0x00, 0x84, 0x00, 0x01, 0x2b, 0x06, 0x00, 0x01, 0x23, 0x00, 0x84, 0x00, 0x01, 0x97, 0x0f,
+    0x01, 0x8f, 0x00, 0x84, 0x00, 0x01, 0x2b, 0x06, 0x00, 0x01, 0x23, 0x00, 0x84, 0x00, 0x01, 0x97,
+    0x0f, 0x01, 0x8f, 0x00, 0x84, 0x00, 0x01, 0x2b, 0x06, 0x00, 0x01, 0x23, 0x00, 0x84, 0x00, 0x01,
+    0x97, 0x0f, 0x01, 0x8f, 0x00, 0x84, 0x00, 0x01, 0x2b, 0x06, 0x00, 0x01, 0x20, 0x00, 0x84, 0x00,
+    0x01, 0xa0, 0x0f, 0x01, 0x99, 0x00, 0x84, 0x00, 0x01, 0x28, 0x06, 0x00, 0x01, 0x14, 0x00, 0x84,
+    0x00, 0x01, 0xb6, 0x0f, 0x01, 0xb0, 0x00, 0x84, 0x00, 0x01, 0x1a, 0x02, 0x00, 0x07, 0x05, 0xfc,
+    0xff, 0xff, 0xff, 0xe2, 0x04, 0x0d, 0x07, 0x02, 0xdd, 0xff, 0xff, 0xff, 0xfe, 0x0a, 0x06, 0x01,
+    0x01, 0xd3, 0x00, 0x84, 0x00, 0x01, 0x6d, 0x0d, 0x01, 0x68, 0x00, 0x84, 0x00, 0x01, 0xd9, 0x05,
+    0x01, 0x01, 0x93, 0x00, 0x85, 0x00, 0x0d, 0xbb, 0x7d, 0x64, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x63, 0x7d, 0xb9, 0x00, 0x85, 0x00, 0x01, 0x99, 0x03, 0x01, 0x02, 0x29, 0xfe, 0x00, 0x95,
+    0x00, 0x02, 0xfe, 0x2f, 0x03, 0x02, 0x01, 0x80, 0x00, 0x95, 0x00, 0x01, 0x86, 0x03, 0x02, 0x03,
+    0x01, 0x75, 0xf9, 0x00, 0x91, 0x00, 0x03, 0xfa, 0x7a, 0x02, 0x03, 0x04, 0x06, 0x16, 0x73, 0xb0,
+    0xdd, 0xef, 0xfb, 0x00, 0x87, 0x00, 0x06, 0xfc, 0xf0, 0xde, 0xb1, 0x75, 0x18, 0x01, 0x00, 0x09,
+    0x2b, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xe6, 0x98, 0x07, 0x03, 0x00, 0x01, 0x43, 0x00, 0x87, 0x00,
+    0x01, 0x6e, 0x03, 0x00, 0x01, 0x43, 0x00, 0x87, 0x00, 0x01, 0xa1, 0x03, 0x00, 0x01, 0x3e, 0x00,
+    0x87, 0x00, 0x01, 0xab, 0x03, 0x00, 0x04, 0x05, 0x53, 0x5b, 0x7d, 0x00, 0x84, 0x00, 0x01, 0xab,
+    0x03, 0x03, 0x01, 0x08, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00,
+    0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00,
+    0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01,
+    0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03,
+    0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01,
+    0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84,
+    0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07,
+    0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03,
+    0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab,
+    0x03, 0x03, 0x01, 0x07, 0x00, 0x84, 0x00, 0x01, 0xab, 0x01, 0x03, 0x06, 0x02, 0xe6, 0xff, 0xff,
+    0xff, 0x8c, 0x03, 0x01, 0x02, 0x4c, 0xfc, 0x00, 0x90, 0x00, 0x04, 0xf5, 0xcf, 0xa6, 0x30, 0x03,
+    0x01, 0x01, 0x67, 0x00, 0x94, 0x00, 0x02, 0xfc, 0x7a, 0x03, 0x01, 0x01, 0x67, 0x00, 0x95, 0x00,
+    0x02, 0xfd, 0x35, 0x03, 0x01, 0x01, 0x62, 0x00, 0x96, 0x00, 0x01, 0xa3, 0x03, 0x01, 0x13, 0x0f,
+    0x58, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x61, 0xad, 0x00, 0x84, 0x00, 0x01, 0xcc, 0x01, 0x13, 0x06, 0x0a, 0xf6, 0xff, 0xff, 0xff, 0xea,
+    0x01, 0x14, 0x05, 0xd0, 0xff, 0xff, 0xff, 0xeb, 0x01, 0x14, 0x05, 0xda, 0xff, 0xff, 0xff, 0xe6,
+    0x03, 0x13, 0x01, 0x30, 0x00, 0x84, 0x00, 0x01, 0xc3, 0x03, 0x03, 0x11, 0x26, 0x7c, 0xa4, 0xc5,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xd2, 0xfe, 0x00, 0x84, 0x00,
+    0x01, 0x9b, 0x03, 0x02, 0x02, 0x77, 0xf8, 0x00, 0x93, 0x00, 0x02, 0xfb, 0x2c, 0x03, 0x01, 0x01,
+    0x46, 0x00, 0x94, 0x00, 0x02, 0xfc, 0x74, 0x03, 0x01, 0x01, 0xd0, 0x00, 0x91, 0x00, 0x04, 0xf7,
+    0xd2, 0xa7, 0x2f, 0x01, 0x00, 0x08, 0x07, 0xfd, 0xff, 0xff, 0xff, 0xe9, 0x41, 0x01, 0x03, 0x00,
+    0x01, 0x2a, 0x00, 0x84, 0x00, 0x01, 0x9f, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00, 0x01, 0x7f,
+    0x03, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00, 0x01, 0x7f, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00,
+    0x01, 0x80, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00, 0x14, 0xc9, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x35, 0x03, 0x00,
+    0x01, 0x3b, 0x00, 0x97, 0x00, 0x01, 0xde, 0x03, 0x00, 0x01, 0x30, 0x00, 0x97, 0x00, 0x01, 0xe3,
+    0x03, 0x00, 0x02, 0x0c, 0xf0, 0x00, 0x96, 0x00, 0x01, 0xe3, 0x03, 0x01, 0x03, 0x48, 0xd0, 0xf7,
+    0x00, 0x94, 0x00, 0x01, 0xc1, 0x03, 0x00, 0x02, 0x4c, 0xfc, 0x00, 0x90, 0x00, 0x04, 0xf6, 0xe3,
+    0xb1, 0x40, 0x03, 0x00, 0x01, 0x67, 0x00, 0x95, 0x00, 0x01, 0xa2, 0x03, 0x00, 0x01, 0x67, 0x00,
+    0x96, 0x00, 0x01, 0x55, 0x03, 0x00, 0x01, 0x62, 0x00, 0x96, 0x00, 0x01, 0xb2, 0x03, 0x00, 0x13,
+    0x0e, 0x58, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5c, 0x6a, 0xb3, 0x00, 0x84, 0x00, 0x01, 0xd6, 0x01, 0x12, 0x06, 0x01, 0xcf, 0xff, 0xff, 0xff,
+    0xf2, 0x01, 0x13, 0x05, 0xa5, 0xff, 0xff, 0xff, 0xf3, 0x01, 0x13, 0x05, 0xad, 0xff, 0xff, 0xff,
+    0xd0, 0x01, 0x12, 0x06, 0x2c, 0xee, 0xff, 0xff, 0xff, 0x9b, 0x01, 0x00, 0x18, 0x17, 0xbd, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc9, 0xdd, 0xfe,
+    0xff, 0xff, 0xff, 0xf9, 0x38, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x95, 0x00, 0x01, 0x67, 0x03, 0x00,
+    0x01, 0x3b, 0x00, 0x95, 0x00, 0x02, 0xb7, 0x06, 0x03, 0x00, 0x02, 0x24, 0xf5, 0x00, 0x95, 0x00,
+    0x01, 0x7c, 0x03, 0x10, 0x03, 0x02, 0x1a, 0x74, 0x00, 0x84, 0x00, 0x01, 0xe0, 0x03, 0x13, 0x01,
+    0xbb, 0x00, 0x84, 0x00, 0x01, 0x0d, 0x03, 0x13, 0x01, 0x9c, 0x00, 0x84, 0x00, 0x01, 0x1f, 0x03,
+    0x13, 0x01, 0xa0, 0x00, 0x84, 0x00, 0x01, 0x1f, 0x03, 0x12, 0x02, 0x01, 0xd1, 0x00, 0x84, 0x00,
+    0x01, 0x15, 0x03, 0x00, 0x13, 0x0e, 0x58, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x6a, 0xb5, 0x00, 0x84, 0x00, 0x01, 0xf6, 0x03, 0x00, 0x01,
+    0x62, 0x00, 0x96, 0x00, 0x01, 0xcf, 0x03, 0x00, 0x01, 0x67, 0x00, 0x96, 0x00, 0x01, 0x5a, 0x03,
+    0x00, 0x01, 0x67, 0x00, 0x95, 0x00, 0x02, 0xaa, 0x02, 0x03, 0x00, 0x02, 0x4b, 0xfc, 0x00, 0x90,
+    0x00, 0x04, 0xfd, 0xed, 0xc0, 0x57, 0x01, 0x0f, 0x09, 0x01, 0x54, 0xc6, 0xeb, 0xff, 0xff, 0xef,
+    0xa9, 0x0d, 0x03, 0x0e, 0x02, 0x1c, 0xbc, 0x00, 0x87, 0x00, 0x01, 0x78, 0x03, 0x0d, 0x02, 0x5a,
+    0xef, 0x00, 0x88, 0x00, 0x01, 0xac, 0x03, 0x0b, 0x02, 0x12, 0xa9, 0x00, 0x8a, 0x00, 0x01, 0xc2,
+    0x03, 0x0a, 0x02, 0x47, 0xe5, 0x00, 0x85, 0x00, 0x07, 0xd9, 0x75, 0xfd, 0xff, 0xff, 0xff, 0xc3,
+    0x03, 0x08, 0x02, 0x0a, 0x94, 0x00, 0x86, 0x00, 0x08, 0x94, 0x09, 0x00, 0xf7, 0xff, 0xff, 0xff,
+    0xc3, 0x04, 0x07, 0x02, 0x36, 0xd9, 0x00, 0x85, 0x00, 0x02, 0xe5, 0x46, 0x03, 0x05, 0xf7, 0xff,
+    0xff, 0xff, 0xc3, 0x04, 0x05, 0x03, 0x04, 0x7f, 0xfb, 0x00, 0x85, 0x00, 0x02, 0xa9, 0x12, 0x04,
+    0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x04, 0x04, 0x02, 0x27, 0xca, 0x00, 0x85, 0x00, 0x02, 0xef,
+    0x5a, 0x06, 0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x04, 0x02, 0x03, 0x01, 0x6b, 0xf6, 0x00, 0x85,
+    0x00, 0x02, 0xbc, 0x1c, 0x07, 0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x04, 0x01, 0x02, 0x1a, 0xb9,
+    0x00, 0x85, 0x00, 0x03, 0xf7, 0x6f, 0x01, 0x08, 0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x04, 0x00,
+    0x02, 0x1d, 0xe4, 0x00, 0x85, 0x00, 0x02, 0xcd, 0x2a, 0x0a, 0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3,
+    0x04, 0x00, 0x01, 0xa4, 0x00, 0x84, 0x00, 0x03, 0xfc, 0x84, 0x05, 0x0b, 0x05, 0xf7, 0xff, 0xff,
+    0xff, 0xc3, 0x04, 0x00, 0x01, 0xce, 0x00, 0x84, 0x00, 0x01, 0x8a, 0x0d, 0x05, 0xf7, 0xff, 0xff,
+    0xff, 0xc3, 0x03, 0x00, 0x01, 0xd7, 0x00, 0x99, 0x00, 0x02, 0xec, 0x09, 0x03, 0x00, 0x01, 0xd7,
+    0x00, 0x9a, 0x00, 0x01, 0x17, 0x03, 0x00, 0x01, 0xc9, 0x00, 0x9a, 0x00, 0x01, 0x17, 0x03, 0x00,
+    0x02, 0x56, 0xf8, 0x00, 0x98, 0x00, 0x02, 0xfc, 0x0d, 0x01, 0x01, 0x1a, 0x09, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0xf9, 0xff,
+    0xff, 0xff, 0xcc, 0x23, 0x23, 0x15, 0x01, 0x13, 0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x01, 0x13,
+    0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x01, 0x13, 0x05, 0xf7, 0xff, 0xff, 0xff, 0xc3, 0x01, 0x13,
+    0x05, 0xd4, 0xff, 0xff, 0xff, 0xa2, 0x03, 0x01, 0x03, 0x4d, 0xd2, 0xf7, 0x00, 0x93, 0x00, 0x02,
+    0xed, 0x0a, 0x03, 0x00, 0x02, 0x0e, 0xf3, 0x00, 0x96, 0x00, 0x01, 0x17, 0x03, 0x00, 0x01, 0x33,
+    0x00, 0x97, 0x00, 0x01, 0x17, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x97, 0x00, 0x01, 0x12, 0x03, 0x00,
+    0x01, 0x3b, 0x00, 0x84, 0x00, 0x13, 0xc7, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x49, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00,
+    0x01, 0x80, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00, 0x01, 0x7f, 0x03, 0x00, 0x01, 0x3b, 0x00,
+    0x84, 0x00, 0x01, 0x7f, 0x03, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00, 0x01, 0x87, 0x03, 0x00, 0x01,
+    0x3b, 0x00, 0x84, 0x00, 0x12, 0xf5, 0xc8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xbe, 0x97, 0x6b, 0x0b, 0x03, 0x00, 0x01, 0x32, 0x00, 0x95, 0x00, 0x02, 0xdf,
+    0x3e, 0x03, 0x00, 0x02, 0x0e, 0xf4, 0x00, 0x95, 0x00, 0x02, 0xe8, 0x0e, 0x03, 0x01, 0x03, 0x4e,
+    0xd3, 0xf7, 0x00, 0x94, 0x00, 0x01, 0x80, 0x03, 0x12, 0x02, 0x0b, 0x71, 0x00, 0x84, 0x00, 0x01,
+    0xb4, 0x01, 0x13, 0x06, 0x02, 0xec, 0xff, 0xff, 0xff, 0xda, 0x01, 0x14, 0x05, 0xcf, 0xff, 0xff,
+    0xff, 0xeb, 0x01, 0x14, 0x05, 0xd4, 0xff, 0xff, 0xff, 0xeb, 0x01, 0x13, 0x06, 0x0f, 0xfb, 0xff,
+    0xff, 0xff, 0xe7, 0x03, 0x00, 0x14, 0x02, 0x50, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x61, 0xb2, 0x00, 0x84, 0x00, 0x01, 0xc4, 0x03,
+    0x00, 0x01, 0x2e, 0x00, 0x97, 0x00, 0x01, 0x9a, 0x03, 0x00, 0x01, 0x33, 0x00, 0x96, 0x00, 0x02,
+    0xf9, 0x27, 0x03, 0x00, 0x01, 0x33, 0x00, 0x95, 0x00, 0x02, 0xf9, 0x6c, 0x03, 0x00, 0x02, 0x1e,
+    0xf4, 0x00, 0x91, 0x00, 0x04, 0xf4, 0xcd, 0xa2, 0x2a, 0x03, 0x04, 0x06, 0x15, 0x72, 0xad, 0xdb,
+    0xed, 0xfb, 0x00, 0x8d, 0x00, 0x02, 0xf1, 0x0f, 0x03, 0x02, 0x03, 0x01, 0x73, 0xf9, 0x00, 0x93,
+    0x00, 0x01, 0x1f, 0x03, 0x02, 0x01, 0x80, 0x00, 0x95, 0x00, 0x01, 0x1f, 0x03, 0x01, 0x02, 0x29,
+    0xfd, 0x00, 0x95, 0x00, 0x01, 0x1a, 0x03, 0x01, 0x01, 0x92, 0x00, 0x85, 0x00, 0x11, 0xba, 0x7e,
+    0x64, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x4c, 0x03,
+    0x01, 0x01, 0xd2, 0x00, 0x84, 0x00, 0x01, 0x69, 0x01, 0x00, 0x07, 0x05, 0xfc, 0xff, 0xff, 0xff,
+    0xe0, 0x03, 0x03, 0x00, 0x01, 0x14, 0x00, 0x84, 0x00, 0x01, 0xb5, 0x03, 0x00, 0x01, 0x20, 0x00,
+    0x84, 0x00, 0x01, 0x9f, 0x03, 0x00, 0x01, 0x23, 0x00, 0x84, 0x00, 0x12, 0xd7, 0x9b, 0x9b, 0x9b,
+    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x94, 0x72, 0x4d, 0x0a, 0x03, 0x00,
+    0x01, 0x23, 0x00, 0x95, 0x00, 0x02, 0xdf, 0x47, 0x03, 0x00, 0x01, 0x23, 0x00, 0x96, 0x00, 0x02,
+    0xf7, 0x1d, 0x03, 0x00, 0x01, 0x23, 0x00, 0x97, 0x00, 0x01, 0x97, 0x04, 0x00, 0x01, 0x23, 0x00,
+    0x84, 0x00, 0x01, 0x97, 0x0c, 0x07, 0x06, 0x49, 0xfc, 0xff, 0xff, 0xff, 0xcb, 0x04, 0x00, 0x01,
+    0x20, 0x00, 0x84, 0x00, 0x01, 0x9e, 0x0e, 0x05, 0xc6, 0xff, 0xff, 0xff, 0xec, 0x04, 0x00, 0x01,
+    0x14, 0x00, 0x84, 0x00, 0x01, 0xb4, 0x0e, 0x05, 0xb7, 0xff, 0xff, 0xff, 0xfb, 0x02, 0x00, 0x07,
+    0x05, 0xfc, 0xff, 0xff, 0xff, 0xdb, 0x01, 0x0d, 0x05, 0xb8, 0xff, 0xff, 0xff, 0xfb, 0x04, 0x01,
+    0x01, 0xd3, 0x00, 0x84, 0x00, 0x01, 0x55, 0x0d, 0x05, 0xd5, 0xff, 0xff, 0xff, 0xf5, 0x05, 0x01,
+    0x01, 0x93, 0x00, 0x84, 0x00, 0x0e, 0xfc, 0x9c, 0x5e, 0x44, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x42, 0x8b, 0x00, 0x84, 0x00, 0x01, 0xd5, 0x03, 0x01, 0x02, 0x29, 0xfe, 0x00, 0x95,
+    0x00, 0x01, 0xb0, 0x03, 0x02, 0x01, 0x80, 0x00, 0x95, 0x00, 0x01, 0x3f, 0x03, 0x02, 0x03, 0x01,
+    0x75, 0xf9, 0x00, 0x91, 0x00, 0x02, 0xfe, 0x8d, 0x03, 0x04, 0x06, 0x16, 0x73, 0xb0, 0xdd, 0xef,
+    0xfb, 0x00, 0x89, 0x00, 0x04, 0xf3, 0xcf, 0xaa, 0x3b, 0x03, 0x00, 0x02, 0x2b, 0xf7, 0x00, 0x95,
+    0x00, 0x03, 0xf6, 0xad, 0x05, 0x03, 0x00, 0x01, 0x43, 0x00, 0x98, 0x00, 0x01, 0x51, 0x03, 0x00,
+    0x01, 0x43, 0x00, 0x98, 0x00, 0x01, 0x67, 0x03, 0x00, 0x01, 0x33, 0x00, 0x98, 0x00, 0x01, 0x67,
+    0x03, 0x01, 0x14, 0x16, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xcf, 0x00, 0x84, 0x00, 0x01, 0x5c, 0x03, 0x13, 0x02, 0x56,
+    0xfd, 0x00, 0x84, 0x00, 0x01, 0x34, 0x03, 0x12, 0x02, 0x46, 0xf9, 0x00, 0x84, 0x00, 0x02, 0xbb,
+    0x01, 0x03, 0x11, 0x02, 0x38, 0xf4, 0x00, 0x84, 0x00, 0x02, 0xe3, 0x1a, 0x03, 0x10, 0x02, 0x2c,
+    0xee, 0x00, 0x84, 0x00, 0x02, 0xed, 0x2a, 0x03, 0x0f, 0x02, 0x21, 0xe5, 0x00, 0x84, 0x00, 0x02,
+    0xf6, 0x3a, 0x03, 0x0e, 0x02, 0x17, 0xdb, 0x00, 0x84, 0x00, 0x02, 0xfb, 0x4c, 0x03, 0x0d, 0x02,
+    0x0f, 0xd0, 0x00, 0x85, 0x00, 0x01, 0x61, 0x03, 0x0c, 0x02, 0x09, 0xc3, 0x00, 0x85, 0x00, 0x01,
+    0x78, 0x03, 0x0b, 0x02, 0x04, 0xb5, 0x00, 0x85, 0x00, 0x01, 0x91, 0x03, 0x0a, 0x02, 0x01, 0xa5,
+    0x00, 0x85, 0x00, 0x02, 0xa7, 0x01, 0x03, 0x0a, 0x01, 0x92, 0x00, 0x85, 0x00, 0x02, 0xbb, 0x06,
+    0x03, 0x09, 0x01, 0x80, 0x00, 0x85, 0x00, 0x02, 0xcc, 0x0c, 0x03, 0x08, 0x01, 0x6d, 0x00, 0x85,
+    0x00, 0x02, 0xdb, 0x16, 0x03, 0x07, 0x02, 0x5a, 0xfe, 0x00, 0x84, 0x00, 0x02, 0xe7, 0x22, 0x03,
+    0x06, 0x02, 0x4a, 0xfb, 0x00, 0x84, 0x00, 0x02, 0xf1, 0x30, 0x03, 0x05, 0x02, 0x3c, 0xf6, 0x00,
+    0x84, 0x00, 0x02, 0xf8, 0x41, 0x03, 0x04, 0x02, 0x2f, 0xf0, 0x00, 0x84, 0x00, 0x02, 0xfd, 0x55,
+    0x03, 0x04, 0x01, 0xad, 0x00, 0x84, 0x00, 0x02, 0xef, 0x60, 0x03, 0x03, 0x04, 0x40, 0xac, 0xce,
+    0xed, 0x00, 0x8d, 0x00, 0x04, 0xf5, 0xe0, 0xac, 0x37, 0x03, 0x02, 0x01, 0xa3, 0x00, 0x95, 0x00,
+    0x01, 0x90, 0x03, 0x01, 0x01, 0x56, 0x00, 0x97, 0x00, 0x01, 0x43, 0x03, 0x01, 0x01, 0xba, 0x00,
+    0x97, 0x00, 0x01, 0xa4, 0x05, 0x01, 0x01, 0xdd, 0x00, 0x84, 0x00, 0x0f, 0xb6, 0x65, 0x54, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x67, 0xc1, 0x00, 0x84, 0x00, 0x01, 0xc8,
+    0x02, 0x01, 0x06, 0xf9, 0xff, 0xff, 0xff, 0xd6, 0x02, 0x0d, 0x06, 0x07, 0xe6, 0xff, 0xff, 0xff,
+    0xe5, 0x02, 0x01, 0x05, 0xfb, 0xff, 0xff, 0xff, 0xaa, 0x0f, 0x05, 0xbe, 0xff, 0xff, 0xff, 0xe7,
+    0x02, 0x01, 0x05, 0xdd, 0xff, 0xff, 0xff, 0xab, 0x0f, 0x05, 0xbf, 0xff, 0xff, 0xff, 0xc8, 0x02,
+    0x01, 0x06, 0xa9, 0xff, 0xff, 0xff, 0xdd, 0x08, 0x0d, 0x06, 0x0f, 0xeb, 0xff, 0xff, 0xff, 0x94,
+    0x03, 0x01, 0x01, 0x54, 0x00, 0x84, 0x00, 0x14, 0xdb, 0x94, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x82, 0x97, 0xe2, 0xff, 0xff, 0xff, 0xfd, 0x42, 0x03, 0x02, 0x01, 0x84,
+    0x00, 0x95, 0x00, 0x01, 0x6f, 0x03, 0x02, 0x01, 0x80, 0x00, 0x94, 0x00, 0x02, 0xfe, 0x6f, 0x03,
+    0x01, 0x01, 0x66, 0x00, 0x97, 0x00, 0x01, 0x54, 0x04, 0x01, 0x08, 0xdb, 0xff, 0xff, 0xff, 0xfe,
+    0x6c, 0x17, 0x01, 0x09, 0x03, 0x02, 0x1a, 0x77, 0x00, 0x84, 0x00, 0x01, 0xca, 0x04, 0x00, 0x01,
+    0x10, 0x00, 0x84, 0x00, 0x01, 0xba, 0x0f, 0x06, 0xc4, 0xff, 0xff, 0xff, 0xfc, 0x02, 0x06, 0x00,
+    0x01, 0x22, 0x00, 0x84, 0x00, 0x01, 0xa0, 0x0f, 0x01, 0xa8, 0x00, 0x84, 0x00, 0x01, 0x12, 0x06,
+    0x00, 0x01, 0x23, 0x00, 0x84, 0x00, 0x01, 0xa2, 0x0f, 0x01, 0xab, 0x00, 0x84, 0x00, 0x01, 0x13,
+    0x06, 0x00, 0x01, 0x1b, 0x00, 0x84, 0x00, 0x01, 0xcc, 0x0e, 0x02, 0x02, 0xd6, 0x00, 0x84, 0x00,
+    0x01, 0x0b, 0x05, 0x00, 0x02, 0x02, 0xfa, 0x00, 0x84, 0x00, 0x0f, 0xab, 0x61, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x63, 0xb4, 0x00, 0x84, 0x00, 0x01, 0xeb, 0x03,
+    0x01, 0x01, 0xd7, 0x00, 0x97, 0x00, 0x01, 0xc5, 0x03, 0x01, 0x01, 0x65, 0x00, 0x97, 0x00, 0x01,
+    0x52, 0x03, 0x01, 0x02, 0x04, 0xb2, 0x00, 0x95, 0x00, 0x01, 0xa3, 0x03, 0x03, 0x04, 0x5c, 0xb2,
+    0xd9, 0xfb, 0x00, 0x8d, 0x00, 0x04, 0xf9, 0xd6, 0xaf, 0x50, 0x03, 0x03, 0x04, 0x3d, 0xab, 0xcf,
+    0xf2, 0x00, 0x89, 0x00, 0x06, 0xf7, 0xea, 0xd2, 0xa2, 0x5c, 0x08, 0x03, 0x02, 0x01, 0x9c, 0x00,
+    0x92, 0x00, 0x02, 0xe9, 0x4b, 0x03, 0x01, 0x01, 0x58, 0x00, 0x94, 0x00, 0x02, 0xfd, 0x47, 0x03,
+    0x01, 0x01, 0xda, 0x00, 0x95, 0x00, 0x02, 0xe7, 0x06, 0x03, 0x00, 0x13, 0x08, 0xfe, 0xff, 0xff,
+    0xff, 0xef, 0x62, 0x39, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x47, 0x63, 0xbc, 0x00,
+    0x85, 0x00, 0x01, 0x58, 0x06, 0x00, 0x01, 0x29, 0x00, 0x84, 0x00, 0x01, 0x8c, 0x0d, 0x01, 0x95,
+    0x00, 0x84, 0x00, 0x01, 0x98, 0x06, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00, 0x01, 0x70, 0x0d, 0x01,
+    0x1b, 0x00, 0x84, 0x00, 0x01, 0xc8, 0x04, 0x00, 0x01, 0x3b, 0x00, 0x84, 0x00, 0x01, 0x70, 0x0e,
+    0x05, 0xef, 0xff, 0xff, 0xff, 0xda, 0x04, 0x00, 0x01, 0x30, 0x00, 0x84, 0x00, 0x01, 0x84, 0x0e,
+    0x05, 0xd8, 0xff, 0xff, 0xff, 0xe8, 0x02, 0x00, 0x08, 0x0b, 0xfe, 0xff, 0xff, 0xff, 0xe2, 0x2e,
+    0x01, 0x0c, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xeb, 0x03, 0x01, 0x01, 0xd7, 0x00, 0x96, 0x00, 0x01,
+    0xeb, 0x03, 0x01, 0x01, 0x47, 0x00, 0x96, 0x00, 0x01, 0xeb, 0x03, 0x02, 0x02, 0x65, 0xea, 0x00,
+    0x94, 0x00, 0x01, 0xeb, 0x01, 0x03, 0x16, 0x0e, 0x54, 0x76, 0x95, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b,
+    0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xed, 0xff, 0xff, 0xff, 0xeb, 0x01, 0x14, 0x05,
+    0xd6, 0xff, 0xff, 0xff, 0xe8, 0x01, 0x14, 0x05, 0xed, 0xff, 0xff, 0xff, 0xda, 0x03, 0x13, 0x01,
+    0x1a, 0x00, 0x84, 0x00, 0x01, 0xc8, 0x03, 0x12, 0x02, 0x02, 0x9d, 0x00, 0x84, 0x00, 0x01, 0x99,
+    0x03, 0x01, 0x12, 0x12, 0x59, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5c, 0x69, 0x82, 0xd2, 0x00, 0x85, 0x00, 0x01, 0x59, 0x03, 0x01, 0x01, 0x72, 0x00, 0x95,
+    0x00, 0x02, 0xe7, 0x06, 0x03, 0x01, 0x01, 0x77, 0x00, 0x94, 0x00, 0x02, 0xfd, 0x49, 0x03, 0x01,
+    0x01, 0x77, 0x00, 0x93, 0x00, 0x02, 0xea, 0x4c, 0x03, 0x01, 0x02, 0x5b, 0xfd, 0x00, 0x8d, 0x00,
+    0x06, 0xf9, 0xec, 0xd4, 0xa5, 0x5e, 0x09, 0x02, 0x02, 0x0b, 0x06, 0x7b, 0xc0, 0xec, 0xec, 0xec,
+    0xec, 0xe6, 0xbb, 0x6b, 0x02, 0x06, 0x0b, 0x06, 0x7b, 0xc0, 0xec, 0xec, 0xec, 0xec, 0xe6, 0xbb,
+    0x6b, 0x02, 0x06, 0x01, 0x02, 0x1b, 0xd5, 0x00, 0x89, 0x00, 0x02, 0xc6, 0x0d, 0x04, 0x02, 0x1b,
+    0xd5, 0x00, 0x89, 0x00, 0x02, 0xc6, 0x0d, 0x06, 0x01, 0x01, 0xac, 0x00, 0x8b, 0x00, 0x01, 0x8e,
+    0x04, 0x01, 0xac, 0x00, 0x8b, 0x00, 0x01, 0x8e, 0x01, 0x00, 0x20, 0x2b, 0xff, 0xff, 0xff, 0xbf,
+    0x41, 0x41, 0x41, 0x41, 0x49, 0xd1, 0xff, 0xff, 0xfc, 0x12, 0x00, 0x00, 0x2b, 0xff, 0xff, 0xff,
+    0xbf, 0x41, 0x41, 0x41, 0x41, 0x49, 0xd1, 0xff, 0xff, 0xfc, 0x12, 0x03, 0x00, 0x05, 0x59, 0xff,
+    0xff, 0xfc, 0x17, 0x05, 0x0c, 0x33, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x59, 0xff, 0xff, 0xfc,
+    0x17, 0x05, 0x05, 0x33, 0xff, 0xff, 0xff, 0x3c, 0x03, 0x00, 0x04, 0x7f, 0xff, 0xff, 0xe3, 0x06,
+    0x0b, 0x03, 0xfc, 0xff, 0xff, 0x63, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xe3, 0x06, 0x05, 0x03, 0xfc,
+    0xff, 0xff, 0x63, 0x03, 0x00, 0x04, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b,
+    0x00, 0x00, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04, 0x87,
+    0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x87, 0xff, 0xff, 0xdb, 0x07,
+    0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff,
+    0xff, 0x6b, 0x00, 0x00, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00,
+    0x04, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x87, 0xff, 0xff,
+    0xdb, 0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a,
+    0xf7, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b,
+    0x03, 0x00, 0x04, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x87,
+    0xff, 0xff, 0xdb, 0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04, 0x87, 0xff, 0xff, 0xdb,
+    0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x04, 0xf7, 0xff,
+    0xff, 0x6b, 0x03, 0x00, 0x04, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b, 0x00,
+    0x00, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04, 0x87, 0xff,
+    0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x04,
+    0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff,
+    0x6b, 0x00, 0x00, 0x87, 0xff, 0xff, 0xdb, 0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04,
+    0x87, 0xff, 0xff, 0xdb, 0x07, 0x0a, 0xf7, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x87, 0xff, 0xff, 0xdb,
+    0x07, 0x04, 0xf7, 0xff, 0xff, 0x6b, 0x03, 0x00, 0x04, 0x7f, 0xff, 0xff, 0xe3, 0x06, 0x0b, 0x03,
+    0xfc, 0xff, 0xff, 0x63, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xe3, 0x06, 0x05, 0x03, 0xfc, 0xff, 0xff,
+    0x63, 0x03, 0x00, 0x05, 0x59, 0xff, 0xff, 0xfc, 0x17, 0x05, 0x0c, 0x33, 0xff, 0xff, 0xff, 0x3c,
+    0x00, 0x00, 0x59, 0xff, 0xff, 0xfc, 0x17, 0x05, 0x05, 0x33, 0xff, 0xff, 0xff, 0x3c, 0x01, 0x00,
+    0x20, 0x2b, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x40, 0x40, 0x40, 0x48, 0xd1, 0xff, 0xff, 0xfc, 0x12,
+    0x00, 0x00, 0x2b, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x40, 0x40, 0x40, 0x48, 0xd1, 0xff, 0xff, 0xfc,
+    0x12, 0x06, 0x01, 0x01, 0xac, 0x00, 0x8b, 0x00, 0x01, 0x8e, 0x04, 0x01, 0xac, 0x00, 0x8b, 0x00,
+    0x01, 0x8e, 0x06, 0x01, 0x02, 0x1c, 0xd6, 0x00, 0x89, 0x00, 0x02, 0xc6, 0x0d, 0x04, 0x02, 0x1c,
+    0xd6, 0x00, 0x89, 0x00, 0x02, 0xc6, 0x0d, 0x02, 0x02, 0x0b, 0x07, 0x7c, 0xc2, 0xed, 0xed, 0xed,
+    0xed, 0xe8, 0xbc, 0x6d, 0x02, 0x06, 0x0b, 0x07, 0x7c, 0xc2, 0xed, 0xed, 0xed, 0xed, 0xe8, 0xbc,
+    0x6d, 0x02, 0x01, 0x00, 0x08, 0x73, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x1c, 0x03, 0x00, 0x01,
+    0x93, 0x00, 0x86, 0x00, 0x01, 0x23, 0x03, 0x00, 0x01, 0x93, 0x00, 0x86, 0x00, 0x01, 0x23, 0x03,
+    0x00, 0x01, 0x93, 0x00, 0x86, 0x00, 0x01, 0x23, 0x03, 0x00, 0x01, 0x93, 0x00, 0x86, 0x00, 0x01,
+    0x23, 0x03, 0x00, 0x01, 0x93, 0x00, 0x86, 0x00, 0x01, 0x23, 0x03, 0x00, 0x01, 0x93, 0x00, 0x86,
+    0x00, 0x01, 0x23,
+};
+
+static const uint32_t conthrax_atlas_index[] = {
+    0, 381, 594, 869, 1142, 1462, 1737, 2057,
+    2314, 2666, 2983, 3570,
+};
+
+static const glyph_atlas_t conthrax_atlas = {
+    .index = conthrax_atlas_index,
+    .data = conthrax_atlas_data,
+};
+
@@ -4396,6 +4396,10 @@ static const lv_font_dsc_t lts20_dsc[] = {
     {.bitmap_index = 6519, .adv_w = 196, .box_w = 12, .box_h = 4, .ofs_x = 0, .ofs_y = 6}
 };
 
+#ifndef FONT_ATLAS_BUILD
+#include "font_ltsaeada_atlas.h"
+#endif
+
 static const lv_font_t lv_lts13 = {
     .range_start = 32,
     .range_length = 95,
@@ -4404,6 +4408,7 @@ static const lv_font_t lv_lts13 = {
     .base_line = 3,
     .dsc = lts13_dsc,
     .bitmap = lts13_bitmap,
+    .atlas = LV_FONT_ATLAS(lts13_atlas),
 };
 
 static const lv_font_t lv_lts14 = {
@@ -4414,6 +4419,7 @@ static const lv_font_t lv_lts14 = {
     .base_line = 3,
     .dsc = lts14_dsc,
     .bitmap = lts14_bitmap,
+    .atlas = LV_FONT_ATLAS(lts14_atlas),
 };
 
 static const lv_font_t lv_lts16 = {
@@ -4424,6 +4430,7 @@ static const lv_font_t lv_lts16 = {
     .base_line = 4,
     .dsc = lts16_dsc,
     .bitmap = lts16_bitmap,
+    .atlas = LV_FONT_ATLAS(lts16_atlas),
 };
 
 static const lv_font_t lv_lts18 = {
@@ -4434,6 +4441,7 @@ static const lv_font_t lv_lts18 = {
     .base_line = 4,
     .dsc = lts18_dsc,
     .bitmap = lts18_bitmap,
+    .atlas = LV_FONT_ATLAS(lts18_atlas),
 };
 
 static const lv_font_t lv_lts20 = {
@@ -4444,4 +4452,5 @@ static const lv_font_t lv_lts20 = {
     .base_line = 4,
     .dsc = lts20_dsc,
     .bitmap = lts20_bitmap,
+    .atlas = LV_FONT_ATLAS(lts20_atlas),
 };
@@ -0,0 +1,2729 @@
+/* Generated by font_atlas.c, glyph rows as alpha spans: span count,
+   then skip, length (bit 7 = solid) and alpha bytes unless solid. */
+
+#include <stdint.h>
+#include "../gfx.h"
+
+static const uint8_t lts13_atlas_data[] = {
+    0x01, 0x00, 0x02, 0x04, 0x0d, 0x01, 0x00, 0x03, 0x07, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x06, 0x0f,
+    0x01, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x05, 0x0f, 0x01, 0x00, 0x02, 0x04, 0x0f,
+    0x01, 0x00, 0x02, 0x03, 0x0d, 0x01, 0x00, 0x02, 0x03, 0x0a, 0x01, 0x00, 0x03, 0x05, 0x0e, 0x01,
+    0x01, 0x00, 0x04, 0x04, 0x0c, 0x03, 0x0d, 0x01, 0x00, 0x04, 0x06, 0x0e, 0x04, 0x0f, 0x01, 0x00,
+    0x04, 0x06, 0x0e, 0x04, 0x0f, 0x01, 0x00, 0x04, 0x01, 0x03, 0x00, 0x04, 0x01, 0x02, 0x05, 0x07,
+    0x09, 0x00, 0x08, 0x07, 0x01, 0x02, 0x05, 0x0c, 0x07, 0x00, 0x0e, 0x05, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x01, 0x06, 0x05, 0x0f, 0x04, 0x07, 0x0f, 0x03, 0x01, 0x01,
+    0x05, 0x04, 0x0f, 0x00, 0x06, 0x0d, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x85, 0x00, 0x01, 0x0d, 0x01,
+    0x00, 0x07, 0x01, 0x0b, 0x0b, 0x03, 0x0c, 0x09, 0x02, 0x01, 0x01, 0x05, 0x0c, 0x07, 0x00, 0x0d,
+    0x05, 0x01, 0x01, 0x05, 0x0c, 0x03, 0x00, 0x0d, 0x02, 0x00, 0x01, 0x04, 0x01, 0x08, 0x01, 0x03,
+    0x02, 0x02, 0x08, 0x01, 0x01, 0x06, 0x04, 0x0c, 0x0f, 0x0e, 0x09, 0x02, 0x01, 0x00, 0x07, 0x02,
+    0x0f, 0x0c, 0x0a, 0x0b, 0x0d, 0x0a, 0x01, 0x00, 0x05, 0x05, 0x0f, 0x02, 0x06, 0x04, 0x01, 0x00,
+    0x05, 0x02, 0x0f, 0x0b, 0x0a, 0x03, 0x01, 0x01, 0x06, 0x03, 0x0a, 0x0f, 0x0f, 0x09, 0x02, 0x01,
+    0x03, 0x04, 0x0a, 0x05, 0x0d, 0x0d, 0x01, 0x00, 0x07, 0x02, 0x02, 0x00, 0x0b, 0x00, 0x06, 0x0f,
+    0x01, 0x00, 0x07, 0x07, 0x0f, 0x0b, 0x0d, 0x08, 0x0e, 0x0c, 0x01, 0x01, 0x06, 0x06, 0x0c, 0x0f,
+    0x0e, 0x0a, 0x01, 0x01, 0x02, 0x02, 0x01, 0x09, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x09, 0x01,
+    0x0b, 0x0f, 0x0b, 0x01, 0x00, 0x00, 0x06, 0x0a, 0x01, 0x00, 0x09, 0x08, 0x0a, 0x01, 0x0a, 0x08,
+    0x00, 0x03, 0x0f, 0x04, 0x01, 0x00, 0x08, 0x07, 0x09, 0x00, 0x09, 0x07, 0x00, 0x0d, 0x08, 0x01,
+    0x00, 0x07, 0x01, 0x0b, 0x0e, 0x0b, 0x00, 0x0a, 0x0c, 0x01, 0x04, 0x06, 0x06, 0x0f, 0x04, 0x0c,
+    0x0d, 0x06, 0x01, 0x03, 0x08, 0x02, 0x0f, 0x05, 0x0b, 0x06, 0x01, 0x0e, 0x01, 0x01, 0x03, 0x08,
+    0x0d, 0x0a, 0x00, 0x0d, 0x01, 0x00, 0x0b, 0x04, 0x01, 0x02, 0x09, 0x09, 0x0d, 0x00, 0x00, 0x0b,
+    0x07, 0x03, 0x0e, 0x02, 0x01, 0x02, 0x08, 0x0e, 0x03, 0x00, 0x00, 0x02, 0x0d, 0x0e, 0x07, 0x01,
+    0x01, 0x06, 0x06, 0x0d, 0x0f, 0x0e, 0x09, 0x01, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x0b, 0x06, 0x08,
+    0x0c, 0x05, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x06, 0x01, 0x03, 0x01, 0x01, 0x05, 0x00, 0x85, 0x00,
+    0x01, 0x0a, 0x01, 0x00, 0x08, 0x02, 0x0e, 0x0b, 0x05, 0x03, 0x0a, 0x0e, 0x01, 0x02, 0x00, 0x02,
+    0x08, 0x0e, 0x03, 0x02, 0x08, 0x0e, 0x01, 0x00, 0x07, 0x08, 0x0f, 0x01, 0x00, 0x00, 0x08, 0x0e,
+    0x01, 0x00, 0x07, 0x03, 0x0f, 0x0d, 0x07, 0x08, 0x0f, 0x0b, 0x01, 0x01, 0x05, 0x04, 0x0c, 0x0f,
+    0x0d, 0x08, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x06, 0x0e, 0x01, 0x00, 0x02, 0x06,
+    0x0e, 0x01, 0x00, 0x02, 0x01, 0x03, 0x01, 0x02, 0x02, 0x0c, 0x03, 0x01, 0x01, 0x03, 0x06, 0x0f,
+    0x01, 0x01, 0x01, 0x02, 0x0d, 0x09, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x03, 0x01, 0x00, 0x02, 0x06,
+    0x0f, 0x01, 0x00, 0x02, 0x08, 0x0e, 0x01, 0x00, 0x02, 0x08, 0x0e, 0x01, 0x00, 0x02, 0x06, 0x0f,
+    0x01, 0x00, 0x03, 0x03, 0x0f, 0x03, 0x01, 0x01, 0x02, 0x0d, 0x09, 0x01, 0x01, 0x03, 0x06, 0x0f,
+    0x01, 0x01, 0x02, 0x02, 0x0c, 0x03, 0x01, 0x01, 0x02, 0x0b, 0x06, 0x01, 0x01, 0x03, 0x08, 0x0f,
+    0x01, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x07, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x08,
+    0x0e, 0x01, 0x02, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x02, 0x02,
+    0x08, 0x0e, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x07, 0x01, 0x01, 0x03,
+    0x08, 0x0f, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x06, 0x01, 0x01, 0x02, 0x01, 0x0a, 0x01, 0x00, 0x05,
+    0x07, 0x0c, 0x0e, 0x0d, 0x01, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x0f, 0x0a, 0x01, 0x00, 0x05, 0x05,
+    0x08, 0x0d, 0x09, 0x01, 0x01, 0x02, 0x01, 0x03, 0x00, 0x01, 0x02, 0x02, 0x04, 0x0d, 0x01, 0x02,
+    0x02, 0x05, 0x0e, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01,
+    0x03, 0x07, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x02, 0x04, 0x0e, 0x01, 0x02, 0x02, 0x03, 0x0b, 0x01,
+    0x00, 0x03, 0x03, 0x0e, 0x02, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x02, 0x01, 0x00, 0x02, 0x06, 0x0a,
+    0x00, 0x00, 0x01, 0x00, 0x05, 0x08, 0x0f, 0x0f, 0x0f, 0x0d, 0x01, 0x00, 0x05, 0x01, 0x03, 0x03,
+    0x03, 0x02, 0x01, 0x00, 0x03, 0x02, 0x0a, 0x01, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x02, 0x01, 0x04,
+    0x02, 0x0d, 0x02, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x01, 0x01, 0x03, 0x02, 0x0b, 0x0b, 0x01, 0x02,
+    0x03, 0x01, 0x0f, 0x05, 0x01, 0x02, 0x02, 0x07, 0x0f, 0x01, 0x02, 0x02, 0x0d, 0x09, 0x01, 0x01,
+    0x03, 0x02, 0x0f, 0x04, 0x01, 0x01, 0x02, 0x08, 0x0e, 0x01, 0x01, 0x02, 0x0e, 0x08, 0x01, 0x00,
+    0x03, 0x03, 0x0f, 0x02, 0x01, 0x00, 0x02, 0x09, 0x0d, 0x01, 0x00, 0x02, 0x0b, 0x06, 0x01, 0x02,
+    0x05, 0x05, 0x0c, 0x0f, 0x0c, 0x03, 0x01, 0x01, 0x07, 0x06, 0x0f, 0x0a, 0x07, 0x0c, 0x0f, 0x03,
+    0x02, 0x01, 0x02, 0x0e, 0x0a, 0x03, 0x02, 0x0d, 0x0c, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x03, 0x03,
+    0x02, 0x07, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x05, 0x0f, 0x01, 0x02, 0x00,
+    0x03, 0x03, 0x0f, 0x03, 0x03, 0x02, 0x07, 0x0f, 0x02, 0x01, 0x02, 0x0e, 0x0a, 0x03, 0x02, 0x0d,
+    0x0c, 0x01, 0x01, 0x07, 0x06, 0x0f, 0x0a, 0x07, 0x0c, 0x0f, 0x03, 0x01, 0x02, 0x05, 0x05, 0x0c,
+    0x0f, 0x0c, 0x03, 0x01, 0x00, 0x04, 0x0b, 0x0f, 0x0f, 0x02, 0x01, 0x00, 0x04, 0x03, 0x08, 0x0f,
+    0x04, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x04, 0x01, 0x01, 0x03,
+    0x02, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x04, 0x01,
+    0x01, 0x03, 0x02, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x04, 0x01, 0x01, 0x05, 0x06, 0x0d,
+    0x0f, 0x0d, 0x05, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x09, 0x06, 0x0b, 0x0f, 0x03, 0x01, 0x01, 0x06,
+    0x02, 0x00, 0x00, 0x01, 0x0f, 0x06, 0x01, 0x04, 0x03, 0x04, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x02,
+    0x0e, 0x09, 0x01, 0x02, 0x03, 0x02, 0x0e, 0x0a, 0x01, 0x01, 0x03, 0x02, 0x0e, 0x0a, 0x01, 0x00,
+    0x07, 0x02, 0x0e, 0x0e, 0x06, 0x06, 0x06, 0x02, 0x03, 0x00, 0x01, 0x07, 0x00, 0x85, 0x00, 0x01,
+    0x09, 0x01, 0x01, 0x05, 0x08, 0x0d, 0x0f, 0x0d, 0x07, 0x01, 0x00, 0x07, 0x02, 0x0c, 0x09, 0x06,
+    0x0a, 0x0f, 0x04, 0x01, 0x03, 0x04, 0x01, 0x05, 0x0f, 0x04, 0x01, 0x02, 0x04, 0x09, 0x0f, 0x0f,
+    0x08, 0x01, 0x02, 0x05, 0x01, 0x04, 0x0a, 0x0f, 0x02, 0x01, 0x05, 0x02, 0x0f, 0x07, 0x01, 0x00,
+    0x07, 0x02, 0x05, 0x00, 0x00, 0x01, 0x0f, 0x08, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x0b, 0x07, 0x0c,
+    0x0f, 0x02, 0x01, 0x01, 0x05, 0x05, 0x0d, 0x0f, 0x0d, 0x04, 0x01, 0x03, 0x02, 0x07, 0x0b, 0x01,
+    0x02, 0x03, 0x02, 0x0f, 0x07, 0x01, 0x02, 0x02, 0x0b, 0x0d, 0x01, 0x01, 0x06, 0x05, 0x0f, 0x03,
+    0x00, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0e, 0x0a, 0x01, 0x01, 0x0b, 0x0b, 0x03, 0x00, 0x01, 0x06,
+    0x00, 0x85, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x07, 0x01, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x0b, 0x01,
+    0x05, 0x02, 0x0b, 0x0b, 0x01, 0x05, 0x02, 0x0b, 0x0b, 0x03, 0x01, 0x01, 0x0e, 0x00, 0x84, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x05, 0x0f, 0x0a, 0x06, 0x06, 0x06, 0x01, 0x01, 0x02, 0x0f, 0x06, 0x01,
+    0x01, 0x05, 0x0f, 0x0f, 0x0f, 0x0d, 0x06, 0x01, 0x01, 0x06, 0x02, 0x03, 0x04, 0x09, 0x0f, 0x06,
+    0x01, 0x05, 0x02, 0x0b, 0x0b, 0x02, 0x00, 0x02, 0x01, 0x02, 0x03, 0x02, 0x0d, 0x0a, 0x01, 0x00,
+    0x07, 0x05, 0x0f, 0x0a, 0x06, 0x0a, 0x0f, 0x05, 0x01, 0x01, 0x05, 0x06, 0x0d, 0x0f, 0x0d, 0x05,
+    0x01, 0x03, 0x02, 0x07, 0x0b, 0x01, 0x02, 0x03, 0x03, 0x0d, 0x01, 0x01, 0x02, 0x04, 0x0d, 0x0f,
+    0x0f, 0x09, 0x01, 0x01, 0x06, 0x08, 0x0c, 0x04, 0x07, 0x0f, 0x08, 0x01, 0x00, 0x07, 0x02, 0x0f,
+    0x03, 0x00, 0x00, 0x09, 0x0e, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x06, 0x0f, 0x01, 0x00,
+    0x07, 0x06, 0x0f, 0x04, 0x00, 0x00, 0x09, 0x0e, 0x01, 0x00, 0x07, 0x01, 0x0e, 0x0d, 0x05, 0x08,
+    0x0f, 0x07, 0x01, 0x01, 0x05, 0x03, 0x0b, 0x0f, 0x0d, 0x07, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85,
+    0x00, 0x01, 0x0c, 0x01, 0x00, 0x07, 0x02, 0x06, 0x06, 0x06, 0x07, 0x0f, 0x08, 0x01, 0x04, 0x02,
+    0x08, 0x0e, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x06, 0x01, 0x03, 0x02, 0x0b, 0x0d, 0x01, 0x02, 0x03,
+    0x04, 0x0f, 0x04, 0x01, 0x02, 0x02, 0x0d, 0x0c, 0x01, 0x01, 0x03, 0x06, 0x0f, 0x03, 0x01, 0x01,
+    0x02, 0x0a, 0x08, 0x01, 0x01, 0x05, 0x06, 0x0d, 0x0f, 0x0d, 0x06, 0x01, 0x00, 0x07, 0x03, 0x0f,
+    0x0b, 0x07, 0x0b, 0x0f, 0x03, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x06, 0x01, 0x06, 0x0f, 0x03, 0x01,
+    0x01, 0x05, 0x08, 0x0f, 0x0f, 0x0f, 0x08, 0x01, 0x00, 0x07, 0x02, 0x0f, 0x0a, 0x05, 0x0a, 0x0e,
+    0x02, 0x02, 0x00, 0x02, 0x07, 0x0f, 0x03, 0x02, 0x0f, 0x07, 0x01, 0x00, 0x07, 0x08, 0x0f, 0x01,
+    0x00, 0x01, 0x0f, 0x08, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x0c, 0x07, 0x0c, 0x0f, 0x03, 0x01, 0x01,
+    0x05, 0x05, 0x0d, 0x0f, 0x0d, 0x04, 0x01, 0x01, 0x05, 0x02, 0x0b, 0x0f, 0x0e, 0x08, 0x01, 0x00,
+    0x07, 0x01, 0x0e, 0x0c, 0x05, 0x07, 0x0f, 0x09, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x03, 0x00, 0x00,
+    0x09, 0x0f, 0x01, 0x00, 0x07, 0x06, 0x0f, 0x01, 0x00, 0x00, 0x08, 0x0f, 0x01, 0x00, 0x07, 0x02,
+    0x0f, 0x09, 0x01, 0x03, 0x0e, 0x0b, 0x03, 0x01, 0x01, 0x06, 0x00, 0x84, 0x00, 0x01, 0x02, 0x01,
+    0x03, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x03, 0x02, 0x0c, 0x0b, 0x01, 0x02, 0x03, 0x03, 0x0d, 0x01,
+    0x01, 0x00, 0x03, 0x02, 0x0a, 0x01, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x03, 0x02, 0x0a, 0x01, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x02, 0x01, 0x00, 0x03, 0x02, 0x0a,
+    0x01, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x02,
+    0x01, 0x00, 0x03, 0x02, 0x0f, 0x02, 0x01, 0x00, 0x02, 0x06, 0x0a, 0x00, 0x01, 0x03, 0x03, 0x01,
+    0x0a, 0x05, 0x01, 0x02, 0x04, 0x04, 0x0e, 0x0c, 0x02, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x08, 0x01,
+    0x00, 0x03, 0x07, 0x0f, 0x06, 0x01, 0x01, 0x03, 0x0a, 0x0f, 0x06, 0x01, 0x02, 0x04, 0x05, 0x0f,
+    0x0a, 0x01, 0x01, 0x03, 0x03, 0x02, 0x0c, 0x06, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x01,
+    0x02, 0x01, 0x00, 0x06, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x00, 0x01, 0x08, 0x00,
+    0x85, 0x00, 0x01, 0x02, 0x01, 0x00, 0x06, 0x01, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x03,
+    0x06, 0x0a, 0x01, 0x01, 0x00, 0x04, 0x02, 0x0c, 0x0e, 0x04, 0x01, 0x02, 0x03, 0x08, 0x0f, 0x08,
+    0x01, 0x03, 0x03, 0x06, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x06, 0x0f, 0x0a, 0x01, 0x00, 0x04, 0x01,
+    0x0a, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x06, 0x0c, 0x02, 0x01, 0x00, 0x06, 0x01, 0x09, 0x0e, 0x0f,
+    0x0c, 0x03, 0x01, 0x00, 0x06, 0x09, 0x0d, 0x09, 0x07, 0x0d, 0x0e, 0x01, 0x04, 0x02, 0x09, 0x0e,
+    0x01, 0x03, 0x03, 0x0a, 0x0e, 0x04, 0x01, 0x02, 0x03, 0x05, 0x0e, 0x01, 0x01, 0x02, 0x02, 0x07,
+    0x09, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02, 0x06, 0x07, 0x01, 0x02, 0x02, 0x09, 0x0b,
+    0x01, 0x02, 0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0c, 0x07, 0x01, 0x01, 0x08, 0x04, 0x0e, 0x06, 0x01,
+    0x00, 0x02, 0x0a, 0x0c, 0x01, 0x01, 0x09, 0x0e, 0x03, 0x06, 0x0e, 0x0d, 0x0a, 0x05, 0x09, 0x08,
+    0x01, 0x00, 0x0a, 0x03, 0x0b, 0x02, 0x0e, 0x02, 0x01, 0x0d, 0x07, 0x02, 0x0c, 0x01, 0x00, 0x0a,
+    0x06, 0x09, 0x04, 0x0a, 0x00, 0x00, 0x09, 0x07, 0x02, 0x0d, 0x01, 0x00, 0x0a, 0x03, 0x0b, 0x02,
+    0x0e, 0x02, 0x02, 0x0d, 0x07, 0x09, 0x09, 0x01, 0x01, 0x09, 0x0e, 0x03, 0x06, 0x0d, 0x0c, 0x0a,
+    0x0e, 0x0a, 0x01, 0x01, 0x01, 0x07, 0x04, 0x0e, 0x06, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x06,
+    0x02, 0x0a, 0x0d, 0x0e, 0x0c, 0x06, 0x01, 0x04, 0x02, 0x0d, 0x08, 0x01, 0x03, 0x04, 0x06, 0x0f,
+    0x0f, 0x01, 0x01, 0x03, 0x04, 0x0d, 0x0b, 0x0f, 0x08, 0x01, 0x02, 0x05, 0x04, 0x0f, 0x04, 0x09,
+    0x0e, 0x01, 0x02, 0x06, 0x0b, 0x0d, 0x00, 0x03, 0x0f, 0x06, 0x01, 0x01, 0x07, 0x03, 0x0f, 0x08,
+    0x00, 0x00, 0x0c, 0x0d, 0x03, 0x01, 0x01, 0x0a, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x00, 0x09,
+    0x01, 0x0f, 0x0a, 0x03, 0x03, 0x03, 0x04, 0x0e, 0x0b, 0x02, 0x00, 0x03, 0x07, 0x0f, 0x02, 0x04,
+    0x03, 0x07, 0x0f, 0x02, 0x03, 0x00, 0x01, 0x02, 0x00, 0x84, 0x00, 0x02, 0x0b, 0x02, 0x01, 0x00,
+    0x07, 0x04, 0x0f, 0x08, 0x06, 0x08, 0x0e, 0x0e, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x02, 0x00, 0x00,
+    0x05, 0x0f, 0x02, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x02, 0x00, 0x01, 0x0a, 0x0e, 0x03, 0x00, 0x01,
+    0x04, 0x00, 0x85, 0x00, 0x01, 0x08, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x05, 0x03, 0x03, 0x07, 0x0f,
+    0x05, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x02, 0x0d, 0x0a, 0x01, 0x00, 0x08, 0x04, 0x0f,
+    0x07, 0x06, 0x06, 0x0a, 0x0f, 0x07, 0x03, 0x00, 0x01, 0x04, 0x00, 0x84, 0x00, 0x02, 0x0e, 0x08,
+    0x01, 0x02, 0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0c, 0x06, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0d, 0x08,
+    0x06, 0x0a, 0x0f, 0x07, 0x02, 0x01, 0x02, 0x0e, 0x0b, 0x04, 0x02, 0x02, 0x02, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x02, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x02, 0x01,
+    0x02, 0x0e, 0x0b, 0x04, 0x02, 0x02, 0x02, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0d, 0x08, 0x07, 0x0a,
+    0x0f, 0x07, 0x01, 0x02, 0x06, 0x02, 0x0a, 0x0e, 0x0f, 0x0c, 0x06, 0x01, 0x00, 0x07, 0x03, 0x0f,
+    0x0f, 0x0f, 0x0e, 0x0b, 0x03, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x08, 0x06, 0x08, 0x0d, 0x0f, 0x06,
+    0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x02, 0x03, 0x03, 0x01, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x04, 0x02, 0x0e, 0x08,
+    0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x01, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x02, 0x03, 0x03, 0x0a, 0x0f, 0x01, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x07, 0x06, 0x08, 0x0d, 0x0f,
+    0x06, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x0f, 0x0f, 0x0e, 0x0b, 0x03, 0x03, 0x00, 0x01, 0x03, 0x00,
+    0x85, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x08, 0x06, 0x06, 0x06, 0x04, 0x01, 0x00,
+    0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x03, 0x03, 0x00, 0x01, 0x04, 0x00, 0x85,
+    0x00, 0x01, 0x07, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x05, 0x03, 0x03, 0x03, 0x01, 0x00, 0x03, 0x04,
+    0x0f, 0x02, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x07, 0x06, 0x06, 0x06, 0x03, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x85, 0x00, 0x01, 0x0b, 0x03, 0x00, 0x01, 0x03, 0x00, 0x85, 0x00, 0x01, 0x0b, 0x01, 0x00,
+    0x07, 0x04, 0x0f, 0x08, 0x06, 0x06, 0x06, 0x04, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00,
+    0x03, 0x04, 0x0f, 0x03, 0x03, 0x00, 0x01, 0x04, 0x00, 0x85, 0x00, 0x01, 0x07, 0x01, 0x00, 0x06,
+    0x04, 0x0f, 0x05, 0x03, 0x03, 0x03, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04,
+    0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x02, 0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0c,
+    0x06, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0d, 0x08, 0x06, 0x0a, 0x0f, 0x08, 0x02, 0x01, 0x02, 0x0e,
+    0x0b, 0x04, 0x02, 0x01, 0x02, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01,
+    0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x05, 0x0e, 0x0f, 0x0f, 0x0f, 0x07, 0x01, 0x00, 0x0a, 0x04,
+    0x0f, 0x02, 0x00, 0x00, 0x03, 0x04, 0x05, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0e, 0x0b, 0x04, 0x03,
+    0x08, 0x0f, 0x02, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0d, 0x08, 0x07, 0x0b, 0x0f, 0x07, 0x01, 0x02,
+    0x06, 0x02, 0x0a, 0x0e, 0x0e, 0x0c, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x01, 0x03, 0x03, 0x02,
+    0x0e, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x03, 0x0f, 0x02, 0x02, 0x00, 0x03,
+    0x04, 0x0f, 0x02, 0x03, 0x03, 0x03, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x03, 0x03, 0x03,
+    0x04, 0x0f, 0x02, 0x03, 0x00, 0x01, 0x04, 0x00, 0x87, 0x00, 0x01, 0x02, 0x01, 0x00, 0x09, 0x04,
+    0x0f, 0x05, 0x03, 0x03, 0x03, 0x06, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03,
+    0x03, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x03, 0x0f, 0x02, 0x02, 0x00,
+    0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x03, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x01, 0x01,
+    0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f,
+    0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01,
+    0x04, 0x02, 0x04, 0x0d, 0x01, 0x04, 0x02, 0x06, 0x0f, 0x01, 0x04, 0x02, 0x06, 0x0f, 0x01, 0x04,
+    0x02, 0x06, 0x0f, 0x01, 0x04, 0x02, 0x06, 0x0f, 0x01, 0x04, 0x02, 0x06, 0x0f, 0x01, 0x04, 0x02,
+    0x09, 0x0e, 0x01, 0x00, 0x06, 0x09, 0x0e, 0x09, 0x08, 0x0f, 0x0a, 0x01, 0x00, 0x06, 0x01, 0x09,
+    0x0e, 0x0e, 0x0a, 0x01, 0x01, 0x00, 0x07, 0x02, 0x0e, 0x01, 0x00, 0x00, 0x06, 0x0d, 0x01, 0x00,
+    0x07, 0x04, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x06, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x02, 0x07, 0x0f,
+    0x06, 0x01, 0x00, 0x05, 0x04, 0x0f, 0x0a, 0x0f, 0x07, 0x01, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x0d,
+    0x0d, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x05, 0x02, 0x0f, 0x09, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x02,
+    0x00, 0x06, 0x0f, 0x04, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x02, 0x00, 0x00, 0x0a, 0x0e, 0x01, 0x01,
+    0x00, 0x08, 0x04, 0x0f, 0x02, 0x00, 0x00, 0x01, 0x0d, 0x04, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x01,
+    0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04,
+    0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00,
+    0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x07, 0x06, 0x06, 0x06, 0x03, 0x03, 0x00,
+    0x01, 0x03, 0x00, 0x85, 0x00, 0x01, 0x0b, 0x02, 0x01, 0x02, 0x0c, 0x09, 0x04, 0x03, 0x03, 0x0e,
+    0x03, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x06, 0x01, 0x00, 0x0a, 0x01,
+    0x0f, 0x0f, 0x07, 0x00, 0x00, 0x01, 0x0f, 0x0f, 0x08, 0x01, 0x00, 0x0a, 0x02, 0x0f, 0x0a, 0x0e,
+    0x00, 0x00, 0x07, 0x0e, 0x0c, 0x09, 0x01, 0x00, 0x0a, 0x04, 0x0f, 0x03, 0x0f, 0x04, 0x00, 0x0d,
+    0x08, 0x0b, 0x0b, 0x01, 0x00, 0x0a, 0x05, 0x0f, 0x00, 0x0a, 0x0a, 0x03, 0x0f, 0x01, 0x0a, 0x0c,
+    0x01, 0x00, 0x0a, 0x07, 0x0f, 0x00, 0x04, 0x0f, 0x0b, 0x0b, 0x00, 0x08, 0x0d, 0x01, 0x00, 0x0a,
+    0x08, 0x0e, 0x00, 0x00, 0x0e, 0x0f, 0x05, 0x00, 0x07, 0x0f, 0x01, 0x00, 0x0a, 0x09, 0x0c, 0x00,
+    0x00, 0x07, 0x0e, 0x00, 0x00, 0x06, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x04, 0x03, 0x03, 0x01,
+    0x0e, 0x02, 0x01, 0x00, 0x09, 0x04, 0x0f, 0x0e, 0x01, 0x00, 0x00, 0x02, 0x0f, 0x04, 0x01, 0x00,
+    0x09, 0x04, 0x0f, 0x0e, 0x0c, 0x00, 0x00, 0x02, 0x0f, 0x04, 0x01, 0x00, 0x09, 0x04, 0x0f, 0x05,
+    0x0f, 0x08, 0x00, 0x02, 0x0f, 0x04, 0x01, 0x00, 0x09, 0x04, 0x0f, 0x02, 0x06, 0x0f, 0x04, 0x02,
+    0x0f, 0x04, 0x01, 0x00, 0x09, 0x04, 0x0f, 0x02, 0x00, 0x09, 0x0e, 0x04, 0x0f, 0x04, 0x01, 0x00,
+    0x09, 0x04, 0x0f, 0x02, 0x00, 0x00, 0x0d, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x09, 0x04, 0x0f, 0x02,
+    0x00, 0x00, 0x02, 0x0f, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x05, 0x0f,
+    0x04, 0x01, 0x02, 0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0c, 0x06, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0d,
+    0x08, 0x06, 0x0a, 0x0f, 0x0a, 0x02, 0x01, 0x02, 0x0e, 0x0b, 0x04, 0x03, 0x05, 0x0f, 0x05, 0x02,
+    0x00, 0x03, 0x04, 0x0f, 0x02, 0x05, 0x02, 0x0c, 0x0a, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x06, 0x02,
+    0x0a, 0x0c, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x05, 0x02, 0x0c, 0x0a, 0x02, 0x01, 0x02, 0x0e,
+    0x0b, 0x04, 0x03, 0x05, 0x0f, 0x05, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0d, 0x08, 0x07, 0x0a, 0x0f,
+    0x0a, 0x01, 0x02, 0x06, 0x02, 0x0a, 0x0e, 0x0f, 0x0c, 0x06, 0x03, 0x00, 0x01, 0x02, 0x00, 0x84,
+    0x00, 0x02, 0x0c, 0x03, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x08, 0x06, 0x07, 0x0d, 0x0f, 0x01, 0x01,
+    0x00, 0x08, 0x04, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02,
+    0x03, 0x02, 0x0f, 0x07, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x03, 0x01, 0x02, 0x09, 0x0f, 0x03, 0x03,
+    0x00, 0x01, 0x04, 0x00, 0x85, 0x00, 0x01, 0x07, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x06, 0x04, 0x04,
+    0x01, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x02, 0x06,
+    0x02, 0x0a, 0x0d, 0x0f, 0x0c, 0x06, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0d, 0x08, 0x06, 0x0a, 0x0f,
+    0x0a, 0x02, 0x01, 0x02, 0x0e, 0x0b, 0x04, 0x03, 0x05, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x03, 0x05, 0x02, 0x0c, 0x0a, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x06, 0x02, 0x0a, 0x0d, 0x02, 0x00,
+    0x03, 0x04, 0x0f, 0x02, 0x05, 0x02, 0x0c, 0x0b, 0x02, 0x00, 0x03, 0x01, 0x0e, 0x0b, 0x04, 0x03,
+    0x04, 0x0f, 0x06, 0x01, 0x01, 0x08, 0x05, 0x0f, 0x0c, 0x07, 0x06, 0x09, 0x0f, 0x0b, 0x01, 0x02,
+    0x06, 0x03, 0x0b, 0x0e, 0x0f, 0x0e, 0x07, 0x01, 0x05, 0x03, 0x0b, 0x0c, 0x02, 0x01, 0x05, 0x04,
+    0x02, 0x0d, 0x0f, 0x0a, 0x01, 0x07, 0x02, 0x02, 0x01, 0x03, 0x00, 0x01, 0x02, 0x00, 0x84, 0x00,
+    0x02, 0x0d, 0x05, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x08, 0x06, 0x07, 0x0c, 0x0f, 0x02, 0x01, 0x00,
+    0x08, 0x04, 0x0f, 0x02, 0x00, 0x00, 0x01, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x03, 0x01,
+    0x02, 0x08, 0x0f, 0x03, 0x03, 0x00, 0x01, 0x04, 0x00, 0x85, 0x00, 0x01, 0x08, 0x01, 0x00, 0x07,
+    0x04, 0x0f, 0x06, 0x04, 0x0a, 0x0f, 0x01, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x02, 0x00, 0x01, 0x0f,
+    0x09, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x02, 0x00, 0x00, 0x08, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x04,
+    0x0f, 0x02, 0x03, 0x02, 0x0d, 0x04, 0x01, 0x01, 0x06, 0x03, 0x0c, 0x0f, 0x0e, 0x0a, 0x02, 0x01,
+    0x00, 0x07, 0x01, 0x0f, 0x0d, 0x07, 0x08, 0x0d, 0x0b, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x03, 0x01,
+    0x00, 0x04, 0x01, 0x0f, 0x0b, 0x04, 0x01, 0x01, 0x06, 0x02, 0x09, 0x0f, 0x0f, 0x09, 0x02, 0x01,
+    0x04, 0x03, 0x03, 0x0c, 0x0e, 0x02, 0x00, 0x02, 0x02, 0x03, 0x03, 0x03, 0x06, 0x0f, 0x01, 0x01,
+    0x00, 0x07, 0x06, 0x0f, 0x0b, 0x07, 0x09, 0x0e, 0x0d, 0x01, 0x01, 0x06, 0x05, 0x0c, 0x0f, 0x0e,
+    0x0a, 0x01, 0x03, 0x00, 0x01, 0x09, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x00, 0x08, 0x02, 0x06,
+    0x06, 0x0e, 0x0b, 0x06, 0x06, 0x01, 0x01, 0x03, 0x02, 0x0d, 0x08, 0x01, 0x03, 0x02, 0x0d, 0x08,
+    0x01, 0x03, 0x02, 0x0d, 0x08, 0x01, 0x03, 0x02, 0x0d, 0x08, 0x01, 0x03, 0x02, 0x0d, 0x08, 0x01,
+    0x03, 0x02, 0x0d, 0x08, 0x01, 0x03, 0x02, 0x0d, 0x08, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x01, 0x03,
+    0x02, 0x03, 0x0e, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x05, 0x0f, 0x01, 0x02, 0x00,
+    0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x05, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03,
+    0x03, 0x05, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x03, 0x03, 0x05, 0x0f, 0x01, 0x02,
+    0x00, 0x03, 0x03, 0x0f, 0x03, 0x03, 0x02, 0x06, 0x0f, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x07, 0x03,
+    0x02, 0x0a, 0x0e, 0x01, 0x01, 0x07, 0x09, 0x0f, 0x08, 0x05, 0x0a, 0x0f, 0x06, 0x01, 0x02, 0x05,
+    0x07, 0x0d, 0x0f, 0x0d, 0x06, 0x02, 0x00, 0x02, 0x07, 0x0b, 0x05, 0x02, 0x08, 0x0a, 0x02, 0x00,
+    0x03, 0x05, 0x0f, 0x03, 0x03, 0x03, 0x01, 0x0f, 0x08, 0x02, 0x01, 0x02, 0x0e, 0x0a, 0x03, 0x03,
+    0x07, 0x0f, 0x01, 0x01, 0x01, 0x07, 0x07, 0x0f, 0x01, 0x00, 0x00, 0x0e, 0x09, 0x01, 0x02, 0x06,
+    0x0f, 0x08, 0x00, 0x05, 0x0f, 0x02, 0x01, 0x02, 0x05, 0x08, 0x0e, 0x00, 0x0c, 0x0b, 0x01, 0x02,
+    0x05, 0x02, 0x0f, 0x09, 0x0f, 0x04, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x0d, 0x01, 0x03, 0x03, 0x03,
+    0x0e, 0x05, 0x03, 0x00, 0x02, 0x0a, 0x08, 0x03, 0x02, 0x0d, 0x0b, 0x03, 0x02, 0x0a, 0x08, 0x02,
+    0x00, 0x07, 0x09, 0x0e, 0x00, 0x00, 0x02, 0x0f, 0x0f, 0x03, 0x02, 0x0f, 0x07, 0x01, 0x00, 0x0c,
+    0x05, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x0f, 0x04, 0x00, 0x04, 0x0f, 0x02, 0x01, 0x01, 0x0a, 0x0f,
+    0x06, 0x00, 0x0b, 0x0b, 0x0d, 0x09, 0x00, 0x08, 0x0e, 0x01, 0x01, 0x0a, 0x0c, 0x0b, 0x00, 0x0f,
+    0x06, 0x09, 0x0d, 0x00, 0x0d, 0x09, 0x01, 0x01, 0x0a, 0x07, 0x0f, 0x04, 0x0f, 0x02, 0x04, 0x0f,
+    0x03, 0x0f, 0x05, 0x01, 0x01, 0x0a, 0x03, 0x0f, 0x0c, 0x0e, 0x00, 0x00, 0x0f, 0x0c, 0x0f, 0x01,
+    0x01, 0x02, 0x08, 0x0e, 0x0f, 0x09, 0x00, 0x00, 0x0c, 0x0f, 0x0c, 0x01, 0x02, 0x08, 0x09, 0x0f,
+    0x04, 0x00, 0x00, 0x06, 0x0f, 0x07, 0x01, 0x00, 0x08, 0x04, 0x0d, 0x01, 0x00, 0x00, 0x03, 0x0e,
+    0x02, 0x01, 0x00, 0x07, 0x01, 0x0e, 0x0b, 0x00, 0x00, 0x0d, 0x0d, 0x01, 0x01, 0x06, 0x05, 0x0f,
+    0x06, 0x09, 0x0f, 0x03, 0x01, 0x02, 0x04, 0x09, 0x0f, 0x0f, 0x07, 0x01, 0x02, 0x03, 0x02, 0x0f,
+    0x0f, 0x01, 0x02, 0x04, 0x0b, 0x0e, 0x0f, 0x09, 0x01, 0x01, 0x06, 0x07, 0x0f, 0x04, 0x07, 0x0f,
+    0x05, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x08, 0x00, 0x00, 0x0b, 0x0e, 0x01, 0x02, 0x00, 0x02, 0x07,
+    0x0c, 0x03, 0x03, 0x01, 0x0d, 0x04, 0x02, 0x00, 0x02, 0x08, 0x0b, 0x04, 0x02, 0x0c, 0x05, 0x01,
+    0x00, 0x08, 0x04, 0x0f, 0x07, 0x00, 0x00, 0x0a, 0x0f, 0x02, 0x01, 0x01, 0x06, 0x08, 0x0f, 0x03,
+    0x05, 0x0f, 0x06, 0x01, 0x02, 0x04, 0x0d, 0x0e, 0x0f, 0x0a, 0x01, 0x02, 0x04, 0x02, 0x0f, 0x0e,
+    0x01, 0x01, 0x03, 0x02, 0x0c, 0x0a, 0x01, 0x03, 0x02, 0x0c, 0x0a, 0x01, 0x03, 0x02, 0x0c, 0x0a,
+    0x01, 0x03, 0x02, 0x0c, 0x09, 0x03, 0x00, 0x01, 0x02, 0x00, 0x85, 0x00, 0x01, 0x0d, 0x01, 0x01,
+    0x06, 0x06, 0x06, 0x06, 0x09, 0x0f, 0x08, 0x01, 0x04, 0x02, 0x0d, 0x0d, 0x01, 0x03, 0x03, 0x08,
+    0x0f, 0x04, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x02, 0x02, 0x0c, 0x0e, 0x01, 0x01, 0x03,
+    0x07, 0x0f, 0x04, 0x01, 0x00, 0x07, 0x02, 0x0f, 0x0d, 0x06, 0x06, 0x06, 0x05, 0x03, 0x00, 0x01,
+    0x06, 0x00, 0x86, 0x00, 0x01, 0x01, 0x01, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x0e, 0x01, 0x00, 0x04,
+    0x04, 0x0f, 0x08, 0x05, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02,
+    0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04,
+    0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00,
+    0x03, 0x04, 0x0f, 0x03, 0x01, 0x00, 0x04, 0x04, 0x0f, 0x0f, 0x0f, 0x01, 0x01, 0x03, 0x04, 0x04,
+    0x03, 0x01, 0x00, 0x02, 0x0b, 0x06, 0x01, 0x00, 0x02, 0x09, 0x0d, 0x01, 0x00, 0x03, 0x03, 0x0f,
+    0x03, 0x01, 0x01, 0x02, 0x0e, 0x08, 0x01, 0x01, 0x02, 0x08, 0x0e, 0x01, 0x01, 0x03, 0x02, 0x0f,
+    0x04, 0x01, 0x02, 0x02, 0x0c, 0x09, 0x01, 0x02, 0x02, 0x07, 0x0f, 0x01, 0x02, 0x03, 0x01, 0x0f,
+    0x05, 0x01, 0x03, 0x02, 0x0b, 0x0b, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x01, 0x01, 0x04, 0x02, 0x0d,
+    0x02, 0x01, 0x00, 0x04, 0x06, 0x0f, 0x0f, 0x0a, 0x01, 0x00, 0x04, 0x01, 0x06, 0x0c, 0x0c, 0x01,
+    0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02,
+    0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02,
+    0x0a, 0x0c, 0x01, 0x01, 0x03, 0x01, 0x0b, 0x0c, 0x01, 0x00, 0x04, 0x07, 0x0f, 0x0f, 0x0c, 0x01,
+    0x00, 0x04, 0x01, 0x04, 0x04, 0x02, 0x01, 0x03, 0x02, 0x04, 0x01, 0x01, 0x02, 0x03, 0x03, 0x0f,
+    0x0b, 0x01, 0x02, 0x04, 0x0c, 0x0a, 0x0f, 0x06, 0x01, 0x01, 0x06, 0x07, 0x0e, 0x00, 0x06, 0x0e,
+    0x01, 0x01, 0x00, 0x07, 0x02, 0x0f, 0x05, 0x00, 0x00, 0x0c, 0x0a, 0x02, 0x00, 0x02, 0x06, 0x0a,
+    0x03, 0x02, 0x02, 0x0d, 0x00, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x01, 0x0b, 0x01, 0x00,
+    0x07, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x02, 0x04, 0x02, 0x01, 0x00, 0x03,
+    0x09, 0x0f, 0x04, 0x01, 0x01, 0x02, 0x07, 0x0c, 0x01, 0x01, 0x07, 0x02, 0x0b, 0x0f, 0x0c, 0x04,
+    0x0d, 0x04, 0x01, 0x01, 0x07, 0x0d, 0x0d, 0x05, 0x06, 0x0d, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x05,
+    0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x06, 0x02, 0x00, 0x02, 0x07, 0x0e, 0x04, 0x02, 0x0f, 0x06,
+    0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x06, 0x01, 0x01, 0x07, 0x0d, 0x0d,
+    0x05, 0x06, 0x0d, 0x0f, 0x06, 0x01, 0x01, 0x07, 0x02, 0x0b, 0x0f, 0x0d, 0x04, 0x0f, 0x05, 0x01,
+    0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00,
+    0x07, 0x06, 0x0f, 0x05, 0x0d, 0x0e, 0x0b, 0x02, 0x01, 0x00, 0x07, 0x06, 0x0f, 0x0d, 0x05, 0x05,
+    0x0d, 0x0d, 0x01, 0x00, 0x08, 0x06, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x0f, 0x04, 0x02, 0x00, 0x02,
+    0x06, 0x0f, 0x04, 0x02, 0x0e, 0x06, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x0f,
+    0x04, 0x01, 0x01, 0x06, 0x0b, 0x0d, 0x06, 0x06, 0x0d, 0x0c, 0x01, 0x01, 0x06, 0x01, 0x09, 0x0e,
+    0x0e, 0x0a, 0x01, 0x01, 0x01, 0x05, 0x01, 0x0a, 0x0e, 0x0e, 0x0a, 0x01, 0x01, 0x06, 0x0d, 0x0d,
+    0x05, 0x06, 0x09, 0x01, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x01, 0x01, 0x00, 0x02, 0x07, 0x0e, 0x01,
+    0x00, 0x03, 0x04, 0x0f, 0x01, 0x01, 0x01, 0x06, 0x0d, 0x0d, 0x05, 0x06, 0x0a, 0x01, 0x01, 0x01,
+    0x05, 0x01, 0x0a, 0x0e, 0x0f, 0x0a, 0x01, 0x06, 0x02, 0x0c, 0x04, 0x01, 0x06, 0x02, 0x0f, 0x06,
+    0x01, 0x06, 0x02, 0x0f, 0x06, 0x01, 0x01, 0x07, 0x02, 0x0b, 0x0f, 0x0c, 0x04, 0x0f, 0x06, 0x01,
+    0x01, 0x07, 0x0d, 0x0d, 0x05, 0x06, 0x0d, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00,
+    0x00, 0x03, 0x0f, 0x06, 0x02, 0x00, 0x02, 0x07, 0x0e, 0x04, 0x02, 0x0f, 0x05, 0x01, 0x00, 0x08,
+    0x04, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x02, 0x01, 0x01, 0x06, 0x0d, 0x0d, 0x05, 0x06, 0x0d,
+    0x0b, 0x01, 0x01, 0x05, 0x01, 0x0a, 0x0e, 0x0e, 0x09, 0x01, 0x01, 0x05, 0x01, 0x0a, 0x0e, 0x0d,
+    0x07, 0x01, 0x01, 0x06, 0x0d, 0x0d, 0x06, 0x08, 0x0f, 0x07, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x02,
+    0x00, 0x00, 0x09, 0x0d, 0x03, 0x00, 0x01, 0x07, 0x00, 0x85, 0x00, 0x01, 0x0d, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x02, 0x01, 0x01, 0x06, 0x0d, 0x0d, 0x06, 0x06, 0x0a, 0x04, 0x01, 0x01, 0x06, 0x01,
+    0x0a, 0x0e, 0x0f, 0x0b, 0x02, 0x01, 0x02, 0x04, 0x0b, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x04, 0x07,
+    0x0f, 0x05, 0x03, 0x01, 0x00, 0x05, 0x09, 0x0f, 0x0f, 0x0f, 0x0d, 0x01, 0x00, 0x05, 0x01, 0x0a,
+    0x0e, 0x03, 0x02, 0x01, 0x01, 0x02, 0x08, 0x0d, 0x01, 0x01, 0x02, 0x08, 0x0d, 0x01, 0x01, 0x02,
+    0x08, 0x0d, 0x01, 0x01, 0x02, 0x08, 0x0d, 0x01, 0x01, 0x02, 0x07, 0x0d, 0x01, 0x01, 0x07, 0x02,
+    0x0b, 0x0f, 0x0c, 0x04, 0x0d, 0x04, 0x01, 0x01, 0x07, 0x0d, 0x0d, 0x05, 0x06, 0x0d, 0x0f, 0x06,
+    0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x06, 0x02, 0x00, 0x02, 0x07, 0x0e,
+    0x04, 0x02, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x06, 0x01,
+    0x01, 0x07, 0x0d, 0x0d, 0x05, 0x06, 0x0d, 0x0f, 0x06, 0x01, 0x01, 0x07, 0x02, 0x0b, 0x0f, 0x0d,
+    0x04, 0x0f, 0x05, 0x01, 0x05, 0x03, 0x03, 0x0f, 0x03, 0x01, 0x01, 0x06, 0x0a, 0x0b, 0x06, 0x05,
+    0x0d, 0x0d, 0x01, 0x01, 0x06, 0x04, 0x0b, 0x0f, 0x0e, 0x0a, 0x01, 0x01, 0x00, 0x02, 0x04, 0x0c,
+    0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x06, 0x06, 0x0f, 0x08,
+    0x0e, 0x0e, 0x07, 0x01, 0x00, 0x07, 0x06, 0x0f, 0x0b, 0x04, 0x08, 0x0f, 0x05, 0x01, 0x00, 0x07,
+    0x06, 0x0f, 0x02, 0x00, 0x00, 0x0d, 0x09, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x0a, 0x0b,
+    0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x0a, 0x0b, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02,
+    0x0a, 0x0b, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x09, 0x0b, 0x01, 0x00, 0x03, 0x03, 0x0e,
+    0x01, 0x01, 0x00, 0x03, 0x02, 0x0a, 0x01, 0x00, 0x01, 0x00, 0x02, 0x02, 0x0e, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x01, 0x01,
+    0x00, 0x03, 0x04, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x03, 0x0f,
+    0x01, 0x01, 0x01, 0x03, 0x02, 0x0e, 0x03, 0x01, 0x01, 0x03, 0x01, 0x0a, 0x02, 0x00, 0x01, 0x02,
+    0x02, 0x0d, 0x02, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x03, 0x01,
+    0x01, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x01, 0x0f,
+    0x03, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x03, 0x01, 0x00, 0x04,
+    0x01, 0x09, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x0a, 0x0e, 0x06, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01,
+    0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x06, 0x06, 0x0f, 0x00, 0x00,
+    0x0a, 0x08, 0x01, 0x00, 0x06, 0x06, 0x0f, 0x00, 0x0a, 0x0e, 0x02, 0x01, 0x00, 0x05, 0x06, 0x0f,
+    0x0a, 0x0f, 0x02, 0x01, 0x00, 0x05, 0x06, 0x0f, 0x0e, 0x0f, 0x06, 0x01, 0x00, 0x06, 0x06, 0x0f,
+    0x02, 0x08, 0x0f, 0x02, 0x01, 0x00, 0x06, 0x06, 0x0f, 0x00, 0x00, 0x0c, 0x0c, 0x01, 0x00, 0x07,
+    0x06, 0x0f, 0x00, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x06,
+    0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f,
+    0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01,
+    0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x0a, 0x04, 0x0d, 0x0a, 0x0f,
+    0x0c, 0x02, 0x08, 0x0e, 0x0d, 0x04, 0x01, 0x00, 0x0b, 0x06, 0x0f, 0x0b, 0x05, 0x0d, 0x0f, 0x0c,
+    0x05, 0x0b, 0x0f, 0x01, 0x01, 0x00, 0x0b, 0x06, 0x0f, 0x01, 0x00, 0x05, 0x0f, 0x04, 0x00, 0x03,
+    0x0f, 0x04, 0x01, 0x00, 0x0b, 0x06, 0x0f, 0x00, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x00, 0x0f, 0x05,
+    0x01, 0x00, 0x0b, 0x06, 0x0f, 0x00, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x00, 0x0f, 0x05, 0x01, 0x00,
+    0x0b, 0x06, 0x0f, 0x00, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x00, 0x0f, 0x05, 0x01, 0x00, 0x0b, 0x06,
+    0x0f, 0x00, 0x00, 0x03, 0x0f, 0x02, 0x00, 0x00, 0x0f, 0x04, 0x01, 0x00, 0x06, 0x04, 0x0d, 0x08,
+    0x0e, 0x0e, 0x07, 0x01, 0x00, 0x07, 0x06, 0x0f, 0x0b, 0x04, 0x08, 0x0f, 0x05, 0x01, 0x00, 0x07,
+    0x06, 0x0f, 0x02, 0x00, 0x00, 0x0d, 0x09, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x0a, 0x0b,
+    0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x0a, 0x0b, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02,
+    0x0a, 0x0b, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x09, 0x0b, 0x01, 0x01, 0x06, 0x01, 0x0a,
+    0x0e, 0x0e, 0x09, 0x01, 0x01, 0x01, 0x06, 0x0d, 0x0d, 0x05, 0x06, 0x0d, 0x0c, 0x01, 0x00, 0x08,
+    0x04, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x02, 0x00, 0x02, 0x07, 0x0e, 0x04, 0x02, 0x0f,
+    0x05, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01, 0x01, 0x06, 0x0d,
+    0x0d, 0x05, 0x06, 0x0e, 0x0b, 0x01, 0x01, 0x06, 0x01, 0x0a, 0x0e, 0x0e, 0x09, 0x01, 0x01, 0x02,
+    0x05, 0x09, 0x0e, 0x0e, 0x0a, 0x01, 0x01, 0x01, 0x06, 0x0b, 0x0d, 0x05, 0x05, 0x0d, 0x0c, 0x01,
+    0x00, 0x08, 0x03, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x0f, 0x04, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x04,
+    0x02, 0x0e, 0x06, 0x01, 0x00, 0x08, 0x06, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x0f, 0x04, 0x01, 0x00,
+    0x07, 0x06, 0x0f, 0x0d, 0x06, 0x06, 0x0d, 0x0d, 0x01, 0x00, 0x07, 0x06, 0x0f, 0x05, 0x0d, 0x0f,
+    0x0b, 0x02, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x04,
+    0x0c, 0x01, 0x01, 0x05, 0x01, 0x0a, 0x0e, 0x0e, 0x09, 0x01, 0x01, 0x06, 0x0d, 0x0d, 0x05, 0x06,
+    0x0d, 0x0b, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x02, 0x02, 0x00, 0x02,
+    0x07, 0x0e, 0x04, 0x02, 0x0f, 0x05, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f,
+    0x06, 0x01, 0x01, 0x07, 0x0d, 0x0d, 0x05, 0x06, 0x0d, 0x0f, 0x06, 0x01, 0x01, 0x07, 0x02, 0x0b,
+    0x0f, 0x0d, 0x04, 0x0f, 0x06, 0x01, 0x06, 0x02, 0x0f, 0x06, 0x01, 0x06, 0x02, 0x0f, 0x06, 0x01,
+    0x06, 0x02, 0x0d, 0x04, 0x01, 0x01, 0x04, 0x03, 0x0c, 0x0f, 0x08, 0x01, 0x00, 0x05, 0x01, 0x0e,
+    0x0b, 0x04, 0x01, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00,
+    0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x01, 0x04,
+    0x0b, 0x0f, 0x0d, 0x06, 0x01, 0x00, 0x05, 0x06, 0x0f, 0x05, 0x07, 0x08, 0x01, 0x00, 0x03, 0x06,
+    0x0f, 0x06, 0x01, 0x01, 0x04, 0x07, 0x0e, 0x0e, 0x06, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x01, 0x01,
+    0x00, 0x06, 0x05, 0x08, 0x05, 0x0a, 0x0f, 0x01, 0x01, 0x00, 0x05, 0x04, 0x0d, 0x0f, 0x0e, 0x05,
+    0x01, 0x01, 0x02, 0x03, 0x08, 0x01, 0x01, 0x02, 0x07, 0x0e, 0x01, 0x00, 0x04, 0x09, 0x0f, 0x0f,
+    0x0f, 0x01, 0x00, 0x04, 0x01, 0x09, 0x0e, 0x03, 0x01, 0x01, 0x02, 0x07, 0x0e, 0x01, 0x01, 0x02,
+    0x07, 0x0e, 0x01, 0x01, 0x02, 0x07, 0x0e, 0x01, 0x01, 0x02, 0x07, 0x0e, 0x01, 0x01, 0x02, 0x07,
+    0x0e, 0x02, 0x00, 0x02, 0x04, 0x0d, 0x03, 0x02, 0x08, 0x08, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03,
+    0x02, 0x0a, 0x0a, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x03, 0x02, 0x0a, 0x0a, 0x02, 0x00, 0x02, 0x06,
+    0x0f, 0x03, 0x02, 0x0a, 0x0a, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x02, 0x00, 0x00, 0x0d, 0x09, 0x01,
+    0x00, 0x07, 0x01, 0x0e, 0x0b, 0x04, 0x08, 0x0f, 0x04, 0x01, 0x01, 0x05, 0x03, 0x0c, 0x0f, 0x0d,
+    0x06, 0x02, 0x00, 0x02, 0x0a, 0x07, 0x03, 0x02, 0x09, 0x07, 0x01, 0x00, 0x07, 0x08, 0x0f, 0x00,
+    0x00, 0x02, 0x0f, 0x05, 0x01, 0x00, 0x06, 0x01, 0x0f, 0x06, 0x00, 0x09, 0x0e, 0x01, 0x01, 0x05,
+    0x09, 0x0d, 0x01, 0x0f, 0x07, 0x01, 0x01, 0x05, 0x02, 0x0f, 0x0b, 0x0f, 0x01, 0x01, 0x02, 0x03,
+    0x0b, 0x0f, 0x09, 0x01, 0x02, 0x03, 0x03, 0x0e, 0x02, 0x01, 0x00, 0x0b, 0x09, 0x07, 0x00, 0x00,
+    0x03, 0x0d, 0x01, 0x00, 0x00, 0x0a, 0x07, 0x01, 0x00, 0x0b, 0x07, 0x0f, 0x00, 0x00, 0x09, 0x0f,
+    0x07, 0x00, 0x02, 0x0f, 0x05, 0x01, 0x00, 0x0a, 0x01, 0x0f, 0x05, 0x00, 0x0f, 0x0d, 0x0d, 0x00,
+    0x07, 0x0e, 0x01, 0x01, 0x09, 0x0b, 0x0b, 0x05, 0x0f, 0x03, 0x0f, 0x03, 0x0d, 0x08, 0x01, 0x01,
+    0x09, 0x04, 0x0f, 0x0c, 0x0a, 0x00, 0x0c, 0x0c, 0x0f, 0x02, 0x01, 0x02, 0x07, 0x0e, 0x0f, 0x04,
+    0x00, 0x06, 0x0f, 0x0c, 0x02, 0x02, 0x02, 0x07, 0x0c, 0x03, 0x02, 0x0e, 0x05, 0x01, 0x00, 0x07,
+    0x09, 0x09, 0x00, 0x00, 0x02, 0x0d, 0x02, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x07, 0x01, 0x0d, 0x0c,
+    0x01, 0x01, 0x05, 0x06, 0x0f, 0x0d, 0x0e, 0x01, 0x01, 0x02, 0x03, 0x0c, 0x0f, 0x06, 0x01, 0x01,
+    0x05, 0x06, 0x0f, 0x0d, 0x0e, 0x01, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x08, 0x01, 0x0d, 0x0c, 0x01,
+    0x00, 0x07, 0x09, 0x0a, 0x00, 0x00, 0x02, 0x0e, 0x02, 0x02, 0x00, 0x02, 0x0a, 0x07, 0x03, 0x02,
+    0x09, 0x07, 0x01, 0x00, 0x07, 0x08, 0x0e, 0x00, 0x00, 0x01, 0x0f, 0x05, 0x01, 0x00, 0x06, 0x01,
+    0x0f, 0x06, 0x00, 0x08, 0x0e, 0x01, 0x01, 0x05, 0x0a, 0x0c, 0x00, 0x0e, 0x08, 0x01, 0x01, 0x05,
+    0x03, 0x0f, 0x09, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x0c, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x06, 0x0f,
+    0x03, 0x01, 0x02, 0x02, 0x09, 0x0c, 0x01, 0x00, 0x04, 0x01, 0x06, 0x0f, 0x05, 0x01, 0x00, 0x03,
+    0x09, 0x0f, 0x09, 0x03, 0x00, 0x01, 0x08, 0x00, 0x84, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x06, 0x01,
+    0x03, 0x03, 0x06, 0x0f, 0x0a, 0x01, 0x03, 0x02, 0x0d, 0x0d, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x02,
+    0x01, 0x01, 0x03, 0x06, 0x0f, 0x05, 0x01, 0x00, 0x06, 0x03, 0x0f, 0x0c, 0x03, 0x03, 0x03, 0x03,
+    0x00, 0x01, 0x07, 0x00, 0x85, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x0e, 0x0e, 0x01, 0x00,
+    0x04, 0x01, 0x0f, 0x0c, 0x05, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x04, 0x0f,
+    0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01,
+    0x00, 0x04, 0x02, 0x0f, 0x08, 0x01, 0x01, 0x01, 0x03, 0x0b, 0x0f, 0x0f, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x01, 0x00, 0x02, 0x03, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x0c,
+    0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01,
+    0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00,
+    0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x0c, 0x01, 0x00, 0x02, 0x02, 0x08, 0x01, 0x00, 0x04,
+    0x06, 0x0f, 0x0b, 0x01, 0x01, 0x00, 0x04, 0x01, 0x08, 0x0f, 0x09, 0x01, 0x02, 0x02, 0x0b, 0x0c,
+    0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01,
+    0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x02, 0x02, 0x0a, 0x0c, 0x01, 0x01,
+    0x03, 0x03, 0x0e, 0x0a, 0x01, 0x00, 0x04, 0x07, 0x0f, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x01, 0x04,
+    0x01, 0x00, 0x01, 0x01, 0x07, 0x0a, 0x0f, 0x0c, 0x05, 0x00, 0x09, 0x05, 0x01, 0x00, 0x07, 0x06,
+    0x0a, 0x01, 0x06, 0x0e, 0x0f, 0x0c, 0x01, 0x05, 0x01, 0x01,
+};
+
+static const uint32_t lts13_atlas_index[] = {
+    0, 0, 48, 76, 153, 252, 351, 434,
+    454, 518, 584, 616, 655, 673, 690, 702,
+    766, 851, 907, 977, 1050, 1113, 1184, 1258,
+    1315, 1398, 1472, 1499, 1532, 1576, 1613, 1657,
+    1712, 1814, 1892, 1984, 2059, 2155, 2229, 2296,
+    2391, 2489, 2543, 2596, 2682, 2743, 2855, 2961,
+    3050, 3133, 3241, 3334, 3410, 3465, 3557, 3634,
+    3750, 3830, 3893, 3958, 4033, 4097, 4166, 4212,
+    4232, 4248, 4319, 4403, 4454, 4537, 4597, 4652,
+    4747, 4827, 4881, 4954, 5031, 5081, 5178, 5243,
+    5310, 5393, 5476, 5517, 5568, 5617, 5681, 5737,
+    5821, 5881, 5955, 6008, 6081, 6141, 6209,
+};
+
+static const glyph_atlas_t lts13_atlas = {
+    .index = lts13_atlas_index,
+    .data = lts13_atlas_data,
+};
+
+static const uint8_t lts14_atlas_data[] = {
+    0x01, 0x00, 0x03, 0x04, 0x0e, 0x02, 0x01, 0x00, 0x03, 0x06, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x06,
+    0x0f, 0x04, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x02, 0x01, 0x00,
+    0x03, 0x03, 0x0f, 0x01, 0x01, 0x00, 0x02, 0x02, 0x0f, 0x01, 0x00, 0x03, 0x02, 0x0b, 0x01, 0x01,
+    0x00, 0x03, 0x04, 0x0e, 0x02, 0x01, 0x00, 0x05, 0x03, 0x0d, 0x01, 0x0e, 0x03, 0x01, 0x00, 0x05,
+    0x05, 0x0f, 0x02, 0x0f, 0x05, 0x01, 0x00, 0x05, 0x05, 0x0f, 0x02, 0x0f, 0x05, 0x01, 0x00, 0x05,
+    0x01, 0x04, 0x00, 0x04, 0x01, 0x01, 0x02, 0x05, 0x04, 0x0c, 0x00, 0x03, 0x0e, 0x01, 0x02, 0x05,
+    0x09, 0x0b, 0x00, 0x08, 0x0d, 0x03, 0x00, 0x01, 0x02, 0x00, 0x86, 0x00, 0x01, 0x0d, 0x01, 0x01,
+    0x07, 0x03, 0x0f, 0x07, 0x03, 0x0e, 0x08, 0x02, 0x01, 0x01, 0x06, 0x02, 0x0f, 0x03, 0x00, 0x0f,
+    0x04, 0x03, 0x00, 0x01, 0x09, 0x00, 0x86, 0x00, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x09, 0x0d,
+    0x03, 0x08, 0x0e, 0x03, 0x01, 0x01, 0x05, 0x0a, 0x0a, 0x00, 0x08, 0x0c, 0x01, 0x01, 0x05, 0x0a,
+    0x06, 0x00, 0x09, 0x08, 0x00, 0x01, 0x04, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x0b, 0x01, 0x01, 0x06,
+    0x03, 0x0b, 0x0e, 0x0f, 0x0b, 0x05, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0e, 0x08, 0x0d, 0x0b, 0x0f,
+    0x02, 0x01, 0x00, 0x05, 0x04, 0x0f, 0x05, 0x02, 0x09, 0x01, 0x00, 0x05, 0x01, 0x0f, 0x0d, 0x08,
+    0x08, 0x01, 0x01, 0x06, 0x03, 0x09, 0x0f, 0x0f, 0x0c, 0x06, 0x01, 0x03, 0x05, 0x07, 0x07, 0x09,
+    0x0f, 0x06, 0x01, 0x00, 0x08, 0x02, 0x03, 0x00, 0x09, 0x02, 0x00, 0x0f, 0x09, 0x01, 0x00, 0x08,
+    0x06, 0x0f, 0x0c, 0x0d, 0x08, 0x0c, 0x0f, 0x04, 0x01, 0x01, 0x06, 0x05, 0x0b, 0x0f, 0x0f, 0x0c,
+    0x05, 0x01, 0x03, 0x01, 0x0c, 0x01, 0x03, 0x01, 0x03, 0x02, 0x01, 0x04, 0x0a, 0x0f, 0x0d, 0x03,
+    0x03, 0x02, 0x0c, 0x05, 0x01, 0x00, 0x09, 0x07, 0x0b, 0x01, 0x06, 0x0d, 0x00, 0x00, 0x0a, 0x0d,
+    0x01, 0x00, 0x09, 0x07, 0x0a, 0x00, 0x05, 0x0d, 0x00, 0x07, 0x0f, 0x02, 0x01, 0x01, 0x07, 0x0a,
+    0x0e, 0x0c, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x04, 0x07, 0x01, 0x0e, 0x08, 0x07, 0x0e, 0x0c, 0x03,
+    0x01, 0x04, 0x07, 0x0c, 0x0b, 0x03, 0x0e, 0x02, 0x05, 0x0d, 0x01, 0x03, 0x09, 0x09, 0x0e, 0x01,
+    0x06, 0x0a, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x02, 0x09, 0x06, 0x0f, 0x03, 0x00, 0x03, 0x0e, 0x03,
+    0x06, 0x0e, 0x02, 0x02, 0x02, 0x0c, 0x06, 0x03, 0x04, 0x08, 0x0e, 0x0d, 0x04, 0x01, 0x01, 0x06,
+    0x05, 0x0c, 0x0f, 0x0e, 0x0c, 0x04, 0x01, 0x00, 0x07, 0x02, 0x0f, 0x0c, 0x07, 0x07, 0x0a, 0x0c,
+    0x01, 0x00, 0x04, 0x02, 0x0f, 0x08, 0x02, 0x03, 0x01, 0x01, 0x03, 0x00, 0x86, 0x00, 0x01, 0x03,
+    0x01, 0x00, 0x08, 0x01, 0x0e, 0x0c, 0x06, 0x03, 0x05, 0x0f, 0x08, 0x01, 0x00, 0x08, 0x07, 0x0f,
+    0x01, 0x00, 0x00, 0x01, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x07, 0x0f, 0x01, 0x00, 0x00, 0x02, 0x0f,
+    0x06, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x0d, 0x07, 0x07, 0x0c, 0x0f, 0x03, 0x01, 0x01, 0x06, 0x03,
+    0x0b, 0x0e, 0x0e, 0x0b, 0x03, 0x01, 0x00, 0x02, 0x03, 0x0d, 0x01, 0x00, 0x02, 0x05, 0x0f, 0x01,
+    0x00, 0x02, 0x05, 0x0f, 0x01, 0x00, 0x02, 0x01, 0x04, 0x01, 0x02, 0x02, 0x0a, 0x07, 0x01, 0x01,
+    0x03, 0x05, 0x0f, 0x04, 0x01, 0x01, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x06, 0x01,
+    0x00, 0x03, 0x05, 0x0f, 0x03, 0x01, 0x00, 0x02, 0x07, 0x0f, 0x01, 0x00, 0x02, 0x08, 0x0f, 0x01,
+    0x00, 0x03, 0x05, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x06, 0x01, 0x01, 0x02, 0x0d, 0x0c,
+    0x01, 0x01, 0x03, 0x05, 0x0f, 0x04, 0x01, 0x02, 0x02, 0x0a, 0x07, 0x01, 0x01, 0x02, 0x0a, 0x07,
+    0x01, 0x01, 0x03, 0x08, 0x0f, 0x02, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x02, 0x09,
+    0x0f, 0x01, 0x02, 0x03, 0x06, 0x0f, 0x02, 0x01, 0x02, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x02, 0x03,
+    0x03, 0x0f, 0x04, 0x01, 0x02, 0x03, 0x06, 0x0f, 0x02, 0x01, 0x02, 0x02, 0x09, 0x0f, 0x01, 0x01,
+    0x03, 0x01, 0x0f, 0x0a, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x02, 0x01, 0x01, 0x02, 0x0a, 0x07, 0x01,
+    0x02, 0x01, 0x0d, 0x01, 0x00, 0x05, 0x06, 0x0c, 0x0f, 0x0c, 0x06, 0x01, 0x00, 0x05, 0x01, 0x0e,
+    0x0f, 0x0d, 0x01, 0x01, 0x00, 0x05, 0x05, 0x07, 0x0f, 0x07, 0x05, 0x01, 0x02, 0x01, 0x04, 0x00,
+    0x01, 0x02, 0x03, 0x01, 0x0f, 0x02, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x03, 0x03, 0x00, 0x01, 0x08,
+    0x00, 0x85, 0x00, 0x01, 0x09, 0x01, 0x01, 0x06, 0x03, 0x04, 0x0f, 0x05, 0x03, 0x01, 0x01, 0x02,
+    0x03, 0x01, 0x0f, 0x02, 0x01, 0x03, 0x02, 0x0e, 0x01, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x04, 0x01,
+    0x00, 0x03, 0x01, 0x0e, 0x04, 0x01, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x01, 0x08,
+    0x00, 0x84, 0x00, 0x01, 0x03, 0x01, 0x01, 0x04, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x03, 0x01,
+    0x0a, 0x02, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x04, 0x01, 0x04, 0x02, 0x09, 0x08, 0x01, 0x03, 0x03,
+    0x01, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x01, 0x01, 0x03, 0x02, 0x0d, 0x0a, 0x01, 0x02,
+    0x03, 0x04, 0x0f, 0x04, 0x01, 0x02, 0x02, 0x0a, 0x0e, 0x01, 0x02, 0x02, 0x0f, 0x08, 0x01, 0x01,
+    0x03, 0x06, 0x0f, 0x02, 0x01, 0x01, 0x02, 0x0c, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x05, 0x01,
+    0x00, 0x02, 0x09, 0x0e, 0x01, 0x00, 0x02, 0x0a, 0x07, 0x01, 0x02, 0x05, 0x03, 0x0b, 0x0e, 0x0d,
+    0x08, 0x01, 0x01, 0x07, 0x04, 0x0f, 0x0c, 0x07, 0x09, 0x0f, 0x0c, 0x02, 0x01, 0x02, 0x0d, 0x0c,
+    0x03, 0x03, 0x05, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x06, 0x04, 0x02, 0x0e, 0x09, 0x02,
+    0x00, 0x03, 0x04, 0x0f, 0x04, 0x04, 0x02, 0x0d, 0x0b, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x06, 0x04,
+    0x02, 0x0e, 0x09, 0x02, 0x01, 0x02, 0x0d, 0x0d, 0x03, 0x03, 0x05, 0x0f, 0x05, 0x01, 0x01, 0x07,
+    0x04, 0x0f, 0x0c, 0x07, 0x09, 0x0f, 0x0c, 0x01, 0x02, 0x05, 0x03, 0x0b, 0x0f, 0x0d, 0x08, 0x01,
+    0x00, 0x04, 0x0b, 0x0f, 0x0f, 0x06, 0x01, 0x00, 0x04, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x02,
+    0x0f, 0x08, 0x01, 0x02, 0x02, 0x0f, 0x08, 0x01, 0x02, 0x02, 0x0f, 0x08, 0x01, 0x02, 0x02, 0x0f,
+    0x08, 0x01, 0x02, 0x02, 0x0f, 0x08, 0x01, 0x02, 0x02, 0x0f, 0x08, 0x01, 0x02, 0x02, 0x0f, 0x08,
+    0x01, 0x01, 0x05, 0x05, 0x0c, 0x0f, 0x0e, 0x09, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x0b, 0x06, 0x09,
+    0x0f, 0x0a, 0x02, 0x01, 0x01, 0x02, 0x03, 0x02, 0x0b, 0x0e, 0x01, 0x05, 0x02, 0x0d, 0x0a, 0x01,
+    0x04, 0x03, 0x0b, 0x0e, 0x02, 0x01, 0x02, 0x04, 0x01, 0x0c, 0x0e, 0x02, 0x01, 0x01, 0x04, 0x01,
+    0x0d, 0x0d, 0x01, 0x01, 0x00, 0x07, 0x02, 0x0e, 0x0f, 0x07, 0x06, 0x06, 0x05, 0x03, 0x00, 0x01,
+    0x07, 0x00, 0x86, 0x00, 0x01, 0x01, 0x01, 0x01, 0x06, 0x07, 0x0d, 0x0f, 0x0e, 0x0a, 0x02, 0x01,
+    0x00, 0x07, 0x01, 0x0d, 0x0a, 0x07, 0x08, 0x0f, 0x0c, 0x01, 0x04, 0x03, 0x03, 0x0d, 0x0b, 0x01,
+    0x02, 0x05, 0x06, 0x0f, 0x0f, 0x0d, 0x01, 0x01, 0x03, 0x04, 0x03, 0x08, 0x0f, 0x09, 0x01, 0x05,
+    0x02, 0x08, 0x0f, 0x02, 0x00, 0x02, 0x01, 0x05, 0x03, 0x02, 0x0a, 0x0f, 0x01, 0x00, 0x07, 0x04,
+    0x0f, 0x0c, 0x07, 0x0a, 0x0f, 0x0a, 0x01, 0x01, 0x05, 0x04, 0x0c, 0x0f, 0x0e, 0x08, 0x01, 0x03,
+    0x03, 0x04, 0x0e, 0x02, 0x01, 0x03, 0x02, 0x0d, 0x0c, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x02, 0x01,
+    0x01, 0x07, 0x03, 0x0f, 0x06, 0x00, 0x02, 0x0d, 0x01, 0x01, 0x01, 0x07, 0x0d, 0x0c, 0x01, 0x01,
+    0x06, 0x0f, 0x03, 0x03, 0x00, 0x01, 0x05, 0x00, 0x86, 0x00, 0x01, 0x03, 0x01, 0x00, 0x08, 0x01,
+    0x04, 0x04, 0x04, 0x04, 0x08, 0x0f, 0x03, 0x01, 0x05, 0x03, 0x04, 0x0f, 0x03, 0x01, 0x05, 0x03,
+    0x04, 0x0f, 0x03, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x84, 0x00, 0x01, 0x08, 0x01, 0x01, 0x06, 0x0f,
+    0x0b, 0x06, 0x06, 0x06, 0x02, 0x01, 0x01, 0x02, 0x0f, 0x09, 0x01, 0x01, 0x06, 0x0f, 0x0f, 0x0f,
+    0x0e, 0x0a, 0x02, 0x01, 0x01, 0x06, 0x02, 0x03, 0x04, 0x07, 0x0e, 0x0d, 0x01, 0x05, 0x03, 0x05,
+    0x0f, 0x03, 0x02, 0x01, 0x01, 0x03, 0x03, 0x03, 0x06, 0x0f, 0x03, 0x01, 0x00, 0x07, 0x04, 0x0f,
+    0x0b, 0x06, 0x08, 0x0f, 0x0c, 0x01, 0x01, 0x06, 0x05, 0x0c, 0x0f, 0x0e, 0x09, 0x01, 0x01, 0x03,
+    0x03, 0x03, 0x0e, 0x02, 0x01, 0x02, 0x03, 0x01, 0x0d, 0x05, 0x01, 0x02, 0x05, 0x0b, 0x0f, 0x0f,
+    0x0d, 0x03, 0x01, 0x01, 0x07, 0x07, 0x0e, 0x05, 0x05, 0x0d, 0x0f, 0x01, 0x01, 0x00, 0x08, 0x01,
+    0x0f, 0x04, 0x00, 0x00, 0x02, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x05, 0x0f, 0x02, 0x03, 0x02, 0x0f,
+    0x09, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x05, 0x00, 0x00, 0x03, 0x0f, 0x06, 0x01, 0x01, 0x06, 0x0e,
+    0x0e, 0x06, 0x06, 0x0d, 0x0e, 0x01, 0x01, 0x06, 0x02, 0x0a, 0x0e, 0x0e, 0x0a, 0x01, 0x03, 0x00,
+    0x01, 0x08, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x00, 0x08, 0x02, 0x06, 0x06, 0x06, 0x06, 0x0d,
+    0x0f, 0x01, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x06, 0x01, 0x04, 0x02, 0x0d, 0x0d, 0x01, 0x03, 0x03,
+    0x07, 0x0f, 0x03, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x01, 0x01,
+    0x01, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x01, 0x02, 0x08, 0x0b, 0x01, 0x01, 0x06, 0x05, 0x0c, 0x0f,
+    0x0e, 0x0a, 0x01, 0x01, 0x00, 0x07, 0x02, 0x0f, 0x0c, 0x07, 0x08, 0x0f, 0x0a, 0x01, 0x00, 0x07,
+    0x02, 0x0f, 0x08, 0x01, 0x03, 0x0e, 0x0a, 0x01, 0x01, 0x05, 0x06, 0x0f, 0x0f, 0x0f, 0x0d, 0x01,
+    0x00, 0x07, 0x01, 0x0e, 0x0c, 0x05, 0x08, 0x0f, 0x08, 0x02, 0x00, 0x02, 0x07, 0x0f, 0x03, 0x02,
+    0x08, 0x0f, 0x01, 0x00, 0x07, 0x08, 0x0f, 0x02, 0x00, 0x00, 0x08, 0x0f, 0x01, 0x00, 0x07, 0x02,
+    0x0f, 0x0d, 0x08, 0x0a, 0x0f, 0x0a, 0x01, 0x01, 0x05, 0x04, 0x0c, 0x0f, 0x0e, 0x09, 0x01, 0x01,
+    0x06, 0x01, 0x0a, 0x0e, 0x0e, 0x0b, 0x03, 0x01, 0x01, 0x07, 0x0d, 0x0e, 0x06, 0x05, 0x0c, 0x0f,
+    0x02, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x04, 0x00, 0x00, 0x01, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x05,
+    0x0f, 0x02, 0x03, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0b, 0x02, 0x01, 0x09, 0x0f,
+    0x03, 0x01, 0x01, 0x06, 0x05, 0x0e, 0x0f, 0x0f, 0x0f, 0x09, 0x01, 0x03, 0x03, 0x02, 0x0c, 0x0d,
+    0x01, 0x03, 0x03, 0x08, 0x0f, 0x02, 0x01, 0x03, 0x02, 0x0e, 0x05, 0x01, 0x00, 0x03, 0x01, 0x0a,
+    0x02, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x0a, 0x02,
+    0x01, 0x00, 0x03, 0x03, 0x0e, 0x04, 0x01, 0x00, 0x03, 0x01, 0x0a, 0x02, 0x01, 0x00, 0x03, 0x03,
+    0x0e, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x04, 0x01, 0x00, 0x03, 0x01, 0x0e,
+    0x04, 0x01, 0x00, 0x02, 0x04, 0x0b, 0x00, 0x01, 0x04, 0x02, 0x06, 0x0b, 0x01, 0x02, 0x04, 0x02,
+    0x0c, 0x0f, 0x05, 0x01, 0x01, 0x04, 0x07, 0x0f, 0x0b, 0x01, 0x01, 0x00, 0x03, 0x06, 0x0f, 0x09,
+    0x01, 0x01, 0x03, 0x09, 0x0f, 0x09, 0x01, 0x02, 0x04, 0x04, 0x0d, 0x0d, 0x04, 0x01, 0x04, 0x02,
+    0x09, 0x0d, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x01, 0x09, 0x01, 0x00, 0x07, 0x01, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x01, 0x09, 0x01,
+    0x01, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0b, 0x02, 0x01, 0x00,
+    0x04, 0x01, 0x0b, 0x0f, 0x06, 0x01, 0x02, 0x04, 0x06, 0x0f, 0x0c, 0x02, 0x01, 0x03, 0x03, 0x02,
+    0x0f, 0x0d, 0x01, 0x02, 0x04, 0x04, 0x0e, 0x0d, 0x03, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x08, 0x01,
+    0x00, 0x03, 0x06, 0x0d, 0x03, 0x01, 0x00, 0x06, 0x01, 0x08, 0x0d, 0x0f, 0x0d, 0x07, 0x01, 0x00,
+    0x07, 0x09, 0x0e, 0x09, 0x06, 0x0a, 0x0f, 0x05, 0x01, 0x04, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x03,
+    0x03, 0x07, 0x0f, 0x09, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x05, 0x01, 0x02, 0x02, 0x04, 0x0e, 0x01,
+    0x03, 0x01, 0x03, 0x01, 0x02, 0x02, 0x04, 0x0a, 0x01, 0x02, 0x03, 0x06, 0x0e, 0x01, 0x01, 0x02,
+    0x07, 0x01, 0x09, 0x0c, 0x0f, 0x0d, 0x0b, 0x04, 0x01, 0x01, 0x09, 0x02, 0x0e, 0x08, 0x02, 0x00,
+    0x01, 0x05, 0x0d, 0x08, 0x01, 0x01, 0x0a, 0x0d, 0x05, 0x03, 0x0d, 0x0e, 0x09, 0x0d, 0x01, 0x0d,
+    0x04, 0x01, 0x00, 0x0b, 0x02, 0x0d, 0x00, 0x0e, 0x05, 0x00, 0x07, 0x0f, 0x00, 0x08, 0x08, 0x01,
+    0x00, 0x0b, 0x05, 0x0b, 0x01, 0x0f, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x07, 0x09, 0x01, 0x00, 0x0b,
+    0x02, 0x0d, 0x00, 0x0e, 0x06, 0x00, 0x08, 0x0f, 0x02, 0x0d, 0x05, 0x01, 0x01, 0x09, 0x0d, 0x06,
+    0x03, 0x0c, 0x0d, 0x09, 0x0e, 0x0d, 0x07, 0x01, 0x01, 0x08, 0x02, 0x0e, 0x08, 0x02, 0x00, 0x01,
+    0x04, 0x01, 0x01, 0x02, 0x07, 0x01, 0x09, 0x0d, 0x0f, 0x0d, 0x0a, 0x02, 0x01, 0x04, 0x03, 0x09,
+    0x0e, 0x01, 0x01, 0x03, 0x04, 0x02, 0x0f, 0x0f, 0x08, 0x01, 0x03, 0x05, 0x09, 0x0f, 0x0b, 0x0f,
+    0x01, 0x01, 0x02, 0x06, 0x01, 0x0f, 0x09, 0x02, 0x0f, 0x08, 0x01, 0x02, 0x06, 0x09, 0x0f, 0x02,
+    0x00, 0x0b, 0x0e, 0x01, 0x01, 0x08, 0x01, 0x0f, 0x0c, 0x00, 0x00, 0x05, 0x0f, 0x07, 0x03, 0x01,
+    0x01, 0x08, 0x00, 0x86, 0x00, 0x01, 0x0e, 0x01, 0x01, 0x09, 0x0f, 0x0d, 0x03, 0x03, 0x03, 0x03,
+    0x08, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x05, 0x05, 0x02, 0x0d, 0x0d, 0x03, 0x00, 0x01,
+    0x02, 0x00, 0x84, 0x00, 0x02, 0x0d, 0x07, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x09, 0x06, 0x07, 0x0b,
+    0x0f, 0x07, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x03, 0x02, 0x0e, 0x0b, 0x01, 0x00, 0x08, 0x03,
+    0x0f, 0x05, 0x00, 0x00, 0x05, 0x0f, 0x07, 0x03, 0x00, 0x01, 0x03, 0x00, 0x86, 0x00, 0x01, 0x01,
+    0x01, 0x00, 0x08, 0x03, 0x0f, 0x07, 0x03, 0x03, 0x05, 0x0c, 0x0e, 0x02, 0x00, 0x03, 0x03, 0x0f,
+    0x05, 0x03, 0x03, 0x05, 0x0f, 0x03, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x09, 0x06, 0x06, 0x08, 0x0e,
+    0x0f, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x85, 0x00, 0x02, 0x0c, 0x03, 0x01, 0x02, 0x07, 0x01,
+    0x09, 0x0d, 0x0f, 0x0d, 0x0a, 0x02, 0x01, 0x01, 0x09, 0x03, 0x0f, 0x0e, 0x09, 0x06, 0x08, 0x0e,
+    0x0f, 0x02, 0x02, 0x01, 0x03, 0x0d, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x01, 0x00, 0x03, 0x03, 0x0f,
+    0x05, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x02, 0x01, 0x03,
+    0x0d, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x09, 0x03, 0x0f, 0x0e, 0x09, 0x06, 0x08, 0x0d,
+    0x0f, 0x02, 0x01, 0x02, 0x07, 0x01, 0x09, 0x0d, 0x0f, 0x0d, 0x0a, 0x02, 0x03, 0x00, 0x01, 0x02,
+    0x00, 0x84, 0x00, 0x02, 0x0c, 0x08, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x09, 0x06, 0x07, 0x0a, 0x0f,
+    0x0d, 0x01, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x03, 0x03, 0x03, 0x0f, 0x0b, 0x02, 0x00, 0x03,
+    0x03, 0x0f, 0x05, 0x04, 0x02, 0x08, 0x0f, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x03, 0x05,
+    0x0f, 0x02, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x02, 0x08, 0x0f, 0x02, 0x00, 0x03, 0x03,
+    0x0f, 0x05, 0x03, 0x03, 0x03, 0x0f, 0x0b, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x09, 0x06, 0x07, 0x0a,
+    0x0f, 0x0e, 0x01, 0x03, 0x00, 0x01, 0x02, 0x00, 0x84, 0x00, 0x02, 0x0c, 0x08, 0x03, 0x00, 0x01,
+    0x02, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x09, 0x06, 0x06, 0x06, 0x06,
+    0x01, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x03, 0x00, 0x01,
+    0x03, 0x00, 0x85, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x02,
+    0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x09, 0x06, 0x06, 0x06, 0x06,
+    0x03, 0x00, 0x01, 0x02, 0x00, 0x86, 0x00, 0x01, 0x04, 0x03, 0x00, 0x01, 0x02, 0x00, 0x86, 0x00,
+    0x01, 0x04, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x09, 0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x00, 0x03,
+    0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x03, 0x00, 0x01, 0x03, 0x00, 0x85, 0x00,
+    0x01, 0x0e, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x03, 0x03,
+    0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x02,
+    0x07, 0x01, 0x09, 0x0d, 0x0f, 0x0d, 0x0a, 0x03, 0x01, 0x01, 0x09, 0x03, 0x0f, 0x0e, 0x09, 0x06,
+    0x08, 0x0d, 0x0f, 0x02, 0x02, 0x01, 0x03, 0x0d, 0x0d, 0x01, 0x04, 0x01, 0x03, 0x02, 0x00, 0x03,
+    0x03, 0x0f, 0x05, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x06, 0x05, 0x0f, 0x03, 0x00,
+    0x00, 0x07, 0x00, 0x84, 0x00, 0x01, 0x03, 0x01, 0x00, 0x0b, 0x03, 0x0f, 0x05, 0x00, 0x00, 0x01,
+    0x04, 0x04, 0x0a, 0x0f, 0x01, 0x02, 0x01, 0x03, 0x0d, 0x0d, 0x01, 0x03, 0x03, 0x01, 0x0d, 0x0c,
+    0x01, 0x01, 0x09, 0x03, 0x0f, 0x0e, 0x09, 0x06, 0x08, 0x0e, 0x0f, 0x02, 0x01, 0x02, 0x07, 0x01,
+    0x09, 0x0d, 0x0f, 0x0d, 0x09, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x03, 0x04, 0x02, 0x09, 0x0a,
+    0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x02, 0x0b, 0x0c, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x04, 0x02, 0x0b, 0x0c, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x02, 0x0c, 0x0c, 0x03, 0x00,
+    0x01, 0x03, 0x00, 0x87, 0x00, 0x01, 0x0c, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x07, 0x03, 0x03, 0x03,
+    0x03, 0x0c, 0x0c, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x02, 0x0b, 0x0c, 0x02, 0x00, 0x03,
+    0x03, 0x0f, 0x05, 0x04, 0x02, 0x0b, 0x0c, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x04, 0x02, 0x0b,
+    0x0c, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x03, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03,
+    0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01,
+    0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f,
+    0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x05, 0x02, 0x0d, 0x05, 0x01, 0x04, 0x03, 0x01,
+    0x0f, 0x07, 0x01, 0x04, 0x03, 0x01, 0x0f, 0x07, 0x01, 0x04, 0x03, 0x01, 0x0f, 0x07, 0x01, 0x04,
+    0x03, 0x01, 0x0f, 0x07, 0x01, 0x04, 0x03, 0x01, 0x0f, 0x07, 0x01, 0x04, 0x03, 0x04, 0x0f, 0x06,
+    0x01, 0x00, 0x07, 0x08, 0x0f, 0x0a, 0x07, 0x0d, 0x0f, 0x01, 0x01, 0x00, 0x06, 0x01, 0x09, 0x0e,
+    0x0f, 0x0c, 0x03, 0x01, 0x00, 0x08, 0x02, 0x0e, 0x03, 0x00, 0x00, 0x02, 0x0d, 0x06, 0x01, 0x00,
+    0x08, 0x03, 0x0f, 0x05, 0x00, 0x02, 0x0e, 0x0c, 0x01, 0x01, 0x00, 0x06, 0x03, 0x0f, 0x05, 0x04,
+    0x0f, 0x0b, 0x01, 0x00, 0x05, 0x03, 0x0f, 0x0a, 0x0f, 0x0c, 0x01, 0x00, 0x06, 0x03, 0x0f, 0x0f,
+    0x0d, 0x0f, 0x03, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x08, 0x00, 0x0c, 0x0e, 0x01, 0x01, 0x00, 0x07,
+    0x03, 0x0f, 0x05, 0x00, 0x02, 0x0e, 0x0c, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x05, 0x00, 0x00, 0x04,
+    0x0f, 0x08, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x03, 0x02, 0x07, 0x0d, 0x01, 0x00, 0x03, 0x02,
+    0x0e, 0x03, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00,
+    0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x09, 0x06, 0x06, 0x06, 0x06,
+    0x03, 0x00, 0x01, 0x02, 0x00, 0x86, 0x00, 0x01, 0x04, 0x02, 0x01, 0x02, 0x0a, 0x0c, 0x05, 0x02,
+    0x09, 0x0d, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x05, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x02, 0x01,
+    0x03, 0x0f, 0x0f, 0x0c, 0x03, 0x04, 0x08, 0x0f, 0x0f, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0a,
+    0x0f, 0x02, 0x00, 0x00, 0x0e, 0x0a, 0x0f, 0x05, 0x01, 0x00, 0x0b, 0x03, 0x0f, 0x04, 0x0d, 0x09,
+    0x00, 0x05, 0x0f, 0x02, 0x0f, 0x06, 0x01, 0x00, 0x0b, 0x04, 0x0f, 0x03, 0x06, 0x0f, 0x01, 0x0c,
+    0x0a, 0x00, 0x0f, 0x08, 0x01, 0x00, 0x0b, 0x06, 0x0f, 0x02, 0x00, 0x0f, 0x0a, 0x0f, 0x03, 0x00,
+    0x0e, 0x09, 0x01, 0x00, 0x0b, 0x08, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x0d, 0x00, 0x00, 0x0d, 0x0b,
+    0x01, 0x00, 0x0b, 0x09, 0x0f, 0x00, 0x00, 0x02, 0x0f, 0x06, 0x00, 0x00, 0x0b, 0x0c, 0x02, 0x00,
+    0x03, 0x02, 0x0e, 0x06, 0x04, 0x02, 0x07, 0x0c, 0x02, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x04, 0x03,
+    0x02, 0x09, 0x0e, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x0e, 0x0e, 0x02, 0x00, 0x00, 0x09, 0x0e, 0x01,
+    0x00, 0x09, 0x03, 0x0f, 0x06, 0x0d, 0x0d, 0x00, 0x00, 0x09, 0x0e, 0x01, 0x00, 0x09, 0x03, 0x0f,
+    0x05, 0x02, 0x0f, 0x0b, 0x00, 0x09, 0x0e, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x05, 0x00, 0x04, 0x0f,
+    0x08, 0x09, 0x0e, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x05, 0x00, 0x00, 0x07, 0x0f, 0x0e, 0x0e, 0x02,
+    0x00, 0x03, 0x03, 0x0f, 0x05, 0x03, 0x03, 0x0a, 0x0f, 0x0e, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x04,
+    0x04, 0x02, 0x0c, 0x0e, 0x01, 0x02, 0x07, 0x01, 0x09, 0x0d, 0x0f, 0x0d, 0x0a, 0x02, 0x01, 0x01,
+    0x09, 0x03, 0x0f, 0x0e, 0x09, 0x06, 0x08, 0x0d, 0x0f, 0x06, 0x02, 0x01, 0x03, 0x0d, 0x0d, 0x01,
+    0x04, 0x03, 0x0b, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x05, 0x03, 0x02, 0x0f, 0x06,
+    0x02, 0x00, 0x03, 0x05, 0x0f, 0x03, 0x06, 0x02, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x05, 0x03, 0x02, 0x0f, 0x06, 0x02, 0x01, 0x03, 0x0d, 0x0d, 0x01, 0x04, 0x03, 0x0b, 0x0f, 0x02,
+    0x01, 0x01, 0x09, 0x03, 0x0f, 0x0f, 0x09, 0x06, 0x08, 0x0e, 0x0f, 0x05, 0x01, 0x02, 0x07, 0x01,
+    0x09, 0x0d, 0x0f, 0x0d, 0x0a, 0x02, 0x03, 0x00, 0x01, 0x02, 0x00, 0x84, 0x00, 0x02, 0x0d, 0x08,
+    0x01, 0x00, 0x08, 0x03, 0x0f, 0x09, 0x06, 0x06, 0x0a, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x03, 0x0f,
+    0x05, 0x03, 0x02, 0x0b, 0x0f, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x03, 0x02, 0x09, 0x0f, 0x01,
+    0x00, 0x08, 0x03, 0x0f, 0x06, 0x01, 0x01, 0x05, 0x0f, 0x0c, 0x03, 0x00, 0x01, 0x03, 0x00, 0x85,
+    0x00, 0x02, 0x0c, 0x02, 0x01, 0x00, 0x06, 0x03, 0x0f, 0x08, 0x04, 0x04, 0x02, 0x01, 0x00, 0x03,
+    0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x02, 0x07, 0x01, 0x09, 0x0d, 0x0f,
+    0x0d, 0x0a, 0x02, 0x01, 0x01, 0x09, 0x03, 0x0f, 0x0e, 0x09, 0x06, 0x08, 0x0d, 0x0f, 0x05, 0x02,
+    0x01, 0x03, 0x0d, 0x0d, 0x01, 0x04, 0x03, 0x0b, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x05, 0x03, 0x02, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x05, 0x0f, 0x03, 0x06, 0x02, 0x0f, 0x09, 0x02,
+    0x00, 0x03, 0x03, 0x0f, 0x05, 0x05, 0x03, 0x02, 0x0f, 0x07, 0x02, 0x01, 0x03, 0x0e, 0x0d, 0x01,
+    0x04, 0x03, 0x0b, 0x0f, 0x02, 0x01, 0x01, 0x09, 0x04, 0x0f, 0x0e, 0x08, 0x05, 0x07, 0x0d, 0x0f,
+    0x06, 0x01, 0x02, 0x07, 0x02, 0x0a, 0x0d, 0x0f, 0x0f, 0x0b, 0x04, 0x01, 0x05, 0x03, 0x06, 0x0f,
+    0x06, 0x01, 0x06, 0x04, 0x09, 0x0f, 0x0f, 0x05, 0x01, 0x07, 0x02, 0x01, 0x03, 0x03, 0x00, 0x01,
+    0x02, 0x00, 0x84, 0x00, 0x03, 0x0e, 0x09, 0x01, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x09, 0x06, 0x06,
+    0x09, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x03, 0x02, 0x0a, 0x0f, 0x01, 0x00, 0x08,
+    0x03, 0x0f, 0x06, 0x01, 0x01, 0x04, 0x0e, 0x0c, 0x03, 0x00, 0x01, 0x03, 0x00, 0x85, 0x00, 0x02,
+    0x0d, 0x02, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x08, 0x04, 0x06, 0x0f, 0x08, 0x01, 0x00, 0x08, 0x03,
+    0x0f, 0x05, 0x00, 0x00, 0x0a, 0x0f, 0x02, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x05, 0x00, 0x00, 0x02,
+    0x0f, 0x0b, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x03, 0x02, 0x07, 0x0d, 0x01, 0x01, 0x06, 0x03,
+    0x0b, 0x0e, 0x0f, 0x0d, 0x06, 0x01, 0x00, 0x08, 0x01, 0x0e, 0x0e, 0x07, 0x07, 0x0b, 0x0f, 0x03,
+    0x01, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x00, 0x05, 0x01, 0x0e, 0x0d, 0x05, 0x01, 0x01, 0x01,
+    0x06, 0x02, 0x08, 0x0e, 0x0f, 0x0c, 0x05, 0x01, 0x04, 0x04, 0x02, 0x07, 0x0f, 0x06, 0x02, 0x00,
+    0x02, 0x01, 0x03, 0x04, 0x02, 0x0f, 0x0a, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x0c, 0x07, 0x06, 0x0c,
+    0x0f, 0x05, 0x01, 0x01, 0x06, 0x04, 0x0b, 0x0e, 0x0f, 0x0c, 0x05, 0x03, 0x00, 0x01, 0x08, 0x00,
+    0x86, 0x00, 0x01, 0x0d, 0x01, 0x00, 0x08, 0x02, 0x06, 0x06, 0x0c, 0x0f, 0x06, 0x06, 0x04, 0x01,
+    0x03, 0x02, 0x0a, 0x0e, 0x01, 0x03, 0x02, 0x0a, 0x0e, 0x01, 0x03, 0x02, 0x0a, 0x0e, 0x01, 0x03,
+    0x02, 0x0a, 0x0e, 0x01, 0x03, 0x02, 0x0a, 0x0e, 0x01, 0x03, 0x02, 0x0a, 0x0e, 0x01, 0x03, 0x02,
+    0x09, 0x0e, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x03, 0x04, 0x02, 0x0b, 0x08, 0x02, 0x00, 0x03, 0x03,
+    0x0f, 0x05, 0x04, 0x02, 0x0d, 0x0b, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x02, 0x0d, 0x0b,
+    0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x02, 0x0d, 0x0b, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x04, 0x02, 0x0d, 0x0b, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x04, 0x02, 0x0e, 0x0a, 0x02, 0x01,
+    0x02, 0x0f, 0x0a, 0x03, 0x03, 0x03, 0x0f, 0x07, 0x01, 0x01, 0x08, 0x08, 0x0f, 0x0a, 0x06, 0x07,
+    0x0e, 0x0e, 0x01, 0x01, 0x02, 0x06, 0x06, 0x0c, 0x0f, 0x0e, 0x0a, 0x01, 0x02, 0x00, 0x02, 0x06,
+    0x0c, 0x05, 0x03, 0x01, 0x0d, 0x04, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x04, 0x03, 0x08, 0x0f,
+    0x02, 0x02, 0x01, 0x02, 0x0c, 0x0d, 0x04, 0x02, 0x0e, 0x0a, 0x01, 0x01, 0x08, 0x05, 0x0f, 0x05,
+    0x00, 0x00, 0x07, 0x0f, 0x03, 0x01, 0x02, 0x06, 0x0d, 0x0c, 0x00, 0x00, 0x0e, 0x0b, 0x01, 0x02,
+    0x06, 0x05, 0x0f, 0x03, 0x05, 0x0f, 0x03, 0x01, 0x03, 0x04, 0x0e, 0x0b, 0x0d, 0x0c, 0x01, 0x03,
+    0x04, 0x06, 0x0f, 0x0f, 0x04, 0x01, 0x04, 0x02, 0x0d, 0x0b, 0x03, 0x00, 0x02, 0x09, 0x0a, 0x03,
+    0x03, 0x07, 0x0f, 0x03, 0x03, 0x02, 0x0d, 0x06, 0x02, 0x00, 0x02, 0x09, 0x0f, 0x03, 0x08, 0x0d,
+    0x0f, 0x09, 0x00, 0x00, 0x04, 0x0f, 0x05, 0x01, 0x00, 0x0c, 0x04, 0x0f, 0x04, 0x00, 0x01, 0x0f,
+    0x0f, 0x0d, 0x00, 0x00, 0x08, 0x0f, 0x01, 0x01, 0x0b, 0x0f, 0x09, 0x00, 0x06, 0x0f, 0x08, 0x0f,
+    0x02, 0x00, 0x0d, 0x0b, 0x01, 0x01, 0x0b, 0x0a, 0x0e, 0x00, 0x0a, 0x0d, 0x01, 0x0f, 0x07, 0x01,
+    0x0f, 0x06, 0x01, 0x01, 0x0b, 0x05, 0x0f, 0x03, 0x0f, 0x08, 0x00, 0x0c, 0x0b, 0x06, 0x0f, 0x01,
+    0x01, 0x01, 0x0a, 0x01, 0x0f, 0x0b, 0x0f, 0x04, 0x00, 0x07, 0x0f, 0x0c, 0x0d, 0x01, 0x02, 0x09,
+    0x0b, 0x0f, 0x0f, 0x00, 0x00, 0x03, 0x0f, 0x0f, 0x08, 0x02, 0x02, 0x03, 0x06, 0x0f, 0x09, 0x03,
+    0x03, 0x0d, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x02, 0x0a, 0x0a, 0x01, 0x00,
+    0x08, 0x01, 0x0e, 0x0d, 0x01, 0x00, 0x07, 0x0f, 0x06, 0x01, 0x01, 0x06, 0x03, 0x0f, 0x0b, 0x04,
+    0x0f, 0x0a, 0x01, 0x02, 0x04, 0x06, 0x0f, 0x0f, 0x0d, 0x01, 0x03, 0x03, 0x0e, 0x0f, 0x05, 0x01,
+    0x02, 0x05, 0x09, 0x0f, 0x0e, 0x0e, 0x01, 0x01, 0x01, 0x06, 0x05, 0x0f, 0x08, 0x02, 0x0f, 0x0c,
+    0x01, 0x00, 0x08, 0x02, 0x0f, 0x0b, 0x00, 0x00, 0x05, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x06, 0x0d,
+    0x01, 0x03, 0x02, 0x08, 0x0d, 0x02, 0x00, 0x02, 0x07, 0x0c, 0x04, 0x02, 0x06, 0x0e, 0x01, 0x00,
+    0x08, 0x03, 0x0f, 0x0a, 0x00, 0x00, 0x03, 0x0f, 0x0a, 0x01, 0x01, 0x06, 0x07, 0x0f, 0x07, 0x01,
+    0x0e, 0x0d, 0x01, 0x02, 0x05, 0x0a, 0x0f, 0x0d, 0x0f, 0x02, 0x01, 0x03, 0x03, 0x0d, 0x0f, 0x05,
+    0x01, 0x03, 0x02, 0x08, 0x0f, 0x01, 0x03, 0x02, 0x08, 0x0f, 0x01, 0x03, 0x02, 0x08, 0x0f, 0x01,
+    0x03, 0x02, 0x08, 0x0f, 0x03, 0x00, 0x01, 0x02, 0x00, 0x86, 0x00, 0x01, 0x05, 0x01, 0x01, 0x07,
+    0x06, 0x06, 0x06, 0x07, 0x0f, 0x0f, 0x01, 0x01, 0x04, 0x03, 0x08, 0x0f, 0x05, 0x01, 0x03, 0x03,
+    0x03, 0x0f, 0x0a, 0x01, 0x03, 0x03, 0x0e, 0x0e, 0x01, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x03, 0x01,
+    0x01, 0x03, 0x05, 0x0f, 0x08, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0f, 0x06, 0x06, 0x06, 0x06, 0x02,
+    0x03, 0x00, 0x01, 0x06, 0x00, 0x86, 0x00, 0x01, 0x09, 0x01, 0x00, 0x05, 0x02, 0x0f, 0x0f, 0x0f,
+    0x03, 0x01, 0x00, 0x04, 0x03, 0x0f, 0x09, 0x06, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00,
+    0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03,
+    0x0f, 0x05, 0x01, 0x00, 0x04, 0x03, 0x0f, 0x06, 0x01, 0x01, 0x00, 0x05, 0x03, 0x0f, 0x0f, 0x0f,
+    0x04, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x01, 0x00, 0x02, 0x0a, 0x07, 0x01, 0x00, 0x02, 0x09,
+    0x0e, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x01, 0x02, 0x0c, 0x0b, 0x01, 0x01, 0x03, 0x06,
+    0x0f, 0x02, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x08, 0x01, 0x02, 0x02, 0x0a, 0x0e, 0x01, 0x02, 0x03,
+    0x04, 0x0f, 0x04, 0x01, 0x03, 0x02, 0x0d, 0x0a, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x01, 0x01, 0x03,
+    0x03, 0x01, 0x0f, 0x07, 0x01, 0x04, 0x02, 0x09, 0x08, 0x01, 0x00, 0x04, 0x06, 0x0f, 0x0f, 0x0e,
+    0x01, 0x00, 0x05, 0x01, 0x06, 0x0b, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x01, 0x01, 0x02,
+    0x03, 0x07, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x01,
+    0x01, 0x02, 0x03, 0x07, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x07,
+    0x0f, 0x01, 0x01, 0x01, 0x04, 0x01, 0x08, 0x0f, 0x01, 0x01, 0x00, 0x05, 0x06, 0x0f, 0x0f, 0x0f,
+    0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x03, 0x01, 0x03, 0x02, 0x02, 0x04, 0x01, 0x02, 0x04, 0x01,
+    0x0e, 0x0f, 0x02, 0x01, 0x02, 0x04, 0x0a, 0x0d, 0x0b, 0x0c, 0x01, 0x01, 0x06, 0x05, 0x0f, 0x03,
+    0x01, 0x0e, 0x07, 0x01, 0x00, 0x08, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x05, 0x0f, 0x03, 0x02, 0x00,
+    0x02, 0x06, 0x0c, 0x04, 0x02, 0x0a, 0x08, 0x00, 0x03, 0x00, 0x01, 0x09, 0x00, 0x86, 0x00, 0x01,
+    0x02, 0x01, 0x00, 0x07, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x02, 0x04, 0x02,
+    0x01, 0x00, 0x03, 0x08, 0x0f, 0x06, 0x01, 0x01, 0x02, 0x06, 0x0e, 0x01, 0x01, 0x07, 0x01, 0x0a,
+    0x0e, 0x0e, 0x09, 0x06, 0x0c, 0x01, 0x01, 0x07, 0x0c, 0x0e, 0x07, 0x05, 0x0a, 0x0f, 0x0f, 0x02,
+    0x00, 0x03, 0x04, 0x0f, 0x04, 0x03, 0x02, 0x0c, 0x0f, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x04, 0x02,
+    0x08, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x04, 0x03, 0x02, 0x0c, 0x0f, 0x01, 0x01, 0x07, 0x0c,
+    0x0e, 0x06, 0x05, 0x0a, 0x0f, 0x0f, 0x01, 0x01, 0x07, 0x01, 0x0a, 0x0e, 0x0e, 0x09, 0x08, 0x0f,
+    0x01, 0x00, 0x02, 0x03, 0x0d, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f,
+    0x01, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x04, 0x0b, 0x0f, 0x0d, 0x06, 0x01, 0x00, 0x08, 0x05, 0x0f,
+    0x0e, 0x07, 0x05, 0x0a, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x05, 0x0f, 0x05, 0x03, 0x02, 0x0b, 0x0d,
+    0x02, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x03, 0x02, 0x07, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x05,
+    0x03, 0x02, 0x0b, 0x0d, 0x01, 0x01, 0x07, 0x0a, 0x0f, 0x07, 0x05, 0x0a, 0x0f, 0x05, 0x01, 0x02,
+    0x05, 0x08, 0x0d, 0x0f, 0x0c, 0x05, 0x01, 0x02, 0x05, 0x09, 0x0d, 0x0f, 0x0c, 0x04, 0x01, 0x01,
+    0x06, 0x0c, 0x0e, 0x07, 0x05, 0x09, 0x06, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x00, 0x02,
+    0x06, 0x0f, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x01, 0x06, 0x0c, 0x0e, 0x06, 0x05, 0x08,
+    0x06, 0x01, 0x02, 0x05, 0x09, 0x0d, 0x0f, 0x0d, 0x04, 0x01, 0x06, 0x02, 0x05, 0x0c, 0x01, 0x06,
+    0x02, 0x08, 0x0f, 0x01, 0x06, 0x02, 0x08, 0x0f, 0x01, 0x01, 0x07, 0x01, 0x0a, 0x0e, 0x0e, 0x09,
+    0x08, 0x0f, 0x01, 0x01, 0x07, 0x0c, 0x0e, 0x07, 0x05, 0x0a, 0x0f, 0x0f, 0x02, 0x00, 0x03, 0x04,
+    0x0f, 0x04, 0x03, 0x02, 0x0c, 0x0f, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x04, 0x02, 0x08, 0x0e, 0x02,
+    0x00, 0x03, 0x03, 0x0f, 0x04, 0x03, 0x02, 0x0c, 0x0b, 0x01, 0x01, 0x07, 0x0c, 0x0e, 0x07, 0x05,
+    0x0a, 0x0f, 0x03, 0x01, 0x02, 0x05, 0x09, 0x0d, 0x0f, 0x0c, 0x04, 0x01, 0x01, 0x06, 0x01, 0x09,
+    0x0e, 0x0e, 0x0b, 0x02, 0x01, 0x01, 0x07, 0x0c, 0x0e, 0x07, 0x06, 0x0d, 0x0e, 0x01, 0x01, 0x00,
+    0x08, 0x04, 0x0f, 0x05, 0x00, 0x00, 0x02, 0x0f, 0x06, 0x03, 0x00, 0x01, 0x06, 0x00, 0x86, 0x00,
+    0x01, 0x06, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x01, 0x06, 0x0c, 0x0e, 0x08, 0x05, 0x08,
+    0x0a, 0x01, 0x02, 0x05, 0x09, 0x0d, 0x0f, 0x0d, 0x06, 0x01, 0x02, 0x04, 0x09, 0x0e, 0x0f, 0x07,
+    0x01, 0x01, 0x04, 0x05, 0x0f, 0x07, 0x03, 0x03, 0x00, 0x01, 0x09, 0x00, 0x84, 0x00, 0x01, 0x03,
+    0x01, 0x00, 0x05, 0x01, 0x08, 0x0f, 0x04, 0x03, 0x01, 0x01, 0x02, 0x06, 0x0f, 0x01, 0x01, 0x02,
+    0x06, 0x0f, 0x01, 0x01, 0x02, 0x06, 0x0f, 0x01, 0x01, 0x02, 0x06, 0x0f, 0x01, 0x01, 0x02, 0x06,
+    0x0f, 0x01, 0x01, 0x07, 0x01, 0x0a, 0x0e, 0x0e, 0x09, 0x06, 0x0c, 0x01, 0x01, 0x07, 0x0c, 0x0e,
+    0x07, 0x05, 0x0a, 0x0f, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x04, 0x03, 0x02, 0x0c, 0x0f, 0x02,
+    0x00, 0x02, 0x06, 0x0f, 0x04, 0x02, 0x08, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x04, 0x03, 0x02,
+    0x0c, 0x0f, 0x01, 0x01, 0x07, 0x0c, 0x0e, 0x06, 0x05, 0x0a, 0x0f, 0x0f, 0x01, 0x01, 0x07, 0x01,
+    0x0a, 0x0e, 0x0e, 0x09, 0x09, 0x0f, 0x01, 0x06, 0x02, 0x0b, 0x0c, 0x01, 0x01, 0x07, 0x09, 0x0b,
+    0x07, 0x05, 0x09, 0x0f, 0x06, 0x01, 0x01, 0x06, 0x03, 0x0a, 0x0e, 0x0f, 0x0d, 0x06, 0x01, 0x00,
+    0x02, 0x03, 0x0e, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01,
+    0x00, 0x07, 0x05, 0x0f, 0x08, 0x0d, 0x0f, 0x0b, 0x01, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x0d, 0x05,
+    0x05, 0x0e, 0x0c, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x04, 0x00, 0x00, 0x07, 0x0f, 0x02, 0x01, 0x00,
+    0x08, 0x05, 0x0f, 0x02, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00,
+    0x00, 0x03, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01,
+    0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x04,
+    0x01, 0x00, 0x03, 0x01, 0x0a, 0x02, 0x00, 0x01, 0x00, 0x03, 0x01, 0x0e, 0x02, 0x01, 0x00, 0x03,
+    0x03, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01,
+    0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x02, 0x0f,
+    0x03, 0x01, 0x01, 0x03, 0x01, 0x0e, 0x06, 0x01, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x01, 0x02, 0x02,
+    0x0d, 0x04, 0x01, 0x02, 0x02, 0x0f, 0x06, 0x01, 0x02, 0x02, 0x0f, 0x06, 0x01, 0x02, 0x02, 0x0f,
+    0x06, 0x01, 0x02, 0x02, 0x0f, 0x06, 0x01, 0x02, 0x02, 0x0f, 0x06, 0x01, 0x02, 0x02, 0x0f, 0x06,
+    0x01, 0x01, 0x03, 0x01, 0x0f, 0x06, 0x01, 0x00, 0x04, 0x01, 0x08, 0x0f, 0x03, 0x01, 0x00, 0x03,
+    0x0b, 0x0e, 0x07, 0x01, 0x00, 0x02, 0x03, 0x0e, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00,
+    0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x06, 0x05, 0x0f, 0x01, 0x00, 0x06, 0x0e, 0x01, 0x00, 0x06,
+    0x05, 0x0f, 0x01, 0x06, 0x0f, 0x07, 0x01, 0x00, 0x05, 0x05, 0x0f, 0x09, 0x0f, 0x06, 0x01, 0x00,
+    0x05, 0x05, 0x0f, 0x0f, 0x0e, 0x0b, 0x01, 0x00, 0x06, 0x05, 0x0f, 0x05, 0x04, 0x0f, 0x08, 0x01,
+    0x00, 0x07, 0x05, 0x0f, 0x01, 0x00, 0x07, 0x0f, 0x04, 0x01, 0x00, 0x07, 0x05, 0x0f, 0x01, 0x00,
+    0x00, 0x0a, 0x09, 0x01, 0x00, 0x02, 0x03, 0x0e, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00,
+    0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01,
+    0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05,
+    0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00,
+    0x0b, 0x03, 0x0e, 0x09, 0x0e, 0x0d, 0x06, 0x02, 0x0c, 0x0f, 0x0b, 0x02, 0x01, 0x00, 0x0b, 0x05,
+    0x0f, 0x0c, 0x05, 0x0a, 0x0f, 0x0f, 0x08, 0x06, 0x0e, 0x0c, 0x01, 0x00, 0x0b, 0x05, 0x0f, 0x04,
+    0x00, 0x00, 0x0f, 0x0c, 0x00, 0x00, 0x08, 0x0f, 0x01, 0x00, 0x0c, 0x05, 0x0f, 0x01, 0x00, 0x00,
+    0x0d, 0x09, 0x00, 0x00, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x0d,
+    0x09, 0x00, 0x00, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x0d, 0x09,
+    0x00, 0x00, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x0d, 0x09, 0x00,
+    0x00, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x07, 0x03, 0x0e, 0x07, 0x0d, 0x0f, 0x0b, 0x01, 0x01, 0x00,
+    0x07, 0x05, 0x0f, 0x0d, 0x05, 0x05, 0x0e, 0x0c, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x04, 0x00, 0x00,
+    0x07, 0x0f, 0x02, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x02, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01, 0x00,
+    0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00,
+    0x00, 0x03, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x0f, 0x03, 0x01,
+    0x02, 0x05, 0x09, 0x0d, 0x0f, 0x0c, 0x04, 0x01, 0x01, 0x07, 0x0c, 0x0e, 0x07, 0x05, 0x0a, 0x0f,
+    0x04, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x03, 0x02, 0x0c, 0x0c, 0x02, 0x00, 0x02, 0x06, 0x0f,
+    0x04, 0x02, 0x08, 0x0e, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x03, 0x02, 0x0c, 0x0c, 0x01, 0x01,
+    0x07, 0x0c, 0x0e, 0x06, 0x05, 0x0a, 0x0f, 0x04, 0x01, 0x02, 0x05, 0x09, 0x0d, 0x0f, 0x0c, 0x04,
+    0x01, 0x02, 0x05, 0x08, 0x0d, 0x0f, 0x0c, 0x04, 0x01, 0x01, 0x07, 0x0a, 0x0f, 0x07, 0x05, 0x0a,
+    0x0f, 0x05, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x05, 0x03, 0x02, 0x0b, 0x0d, 0x02, 0x00, 0x03, 0x05,
+    0x0f, 0x01, 0x03, 0x02, 0x07, 0x0f, 0x02, 0x00, 0x03, 0x05, 0x0f, 0x05, 0x03, 0x02, 0x0b, 0x0d,
+    0x01, 0x00, 0x08, 0x05, 0x0f, 0x0e, 0x07, 0x05, 0x0a, 0x0f, 0x06, 0x01, 0x00, 0x07, 0x05, 0x0f,
+    0x04, 0x0c, 0x0f, 0x0d, 0x06, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f,
+    0x01, 0x01, 0x00, 0x02, 0x03, 0x0e, 0x01, 0x02, 0x05, 0x08, 0x0d, 0x0f, 0x0c, 0x03, 0x01, 0x01,
+    0x07, 0x0c, 0x0e, 0x07, 0x05, 0x0a, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x04, 0x03, 0x02,
+    0x0c, 0x0b, 0x02, 0x00, 0x02, 0x06, 0x0f, 0x04, 0x02, 0x08, 0x0e, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x04, 0x03, 0x02, 0x0c, 0x0f, 0x01, 0x01, 0x07, 0x0c, 0x0e, 0x07, 0x05, 0x0a, 0x0f, 0x0f, 0x01,
+    0x01, 0x07, 0x01, 0x0a, 0x0e, 0x0e, 0x09, 0x08, 0x0f, 0x01, 0x06, 0x02, 0x08, 0x0f, 0x01, 0x06,
+    0x02, 0x08, 0x0f, 0x01, 0x06, 0x02, 0x05, 0x0c, 0x01, 0x01, 0x04, 0x02, 0x0b, 0x0e, 0x0d, 0x01,
+    0x01, 0x04, 0x0e, 0x0d, 0x05, 0x02, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x05,
+    0x0f, 0x02, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x00,
+    0x03, 0x05, 0x0f, 0x01, 0x01, 0x01, 0x04, 0x0a, 0x0f, 0x0e, 0x0a, 0x01, 0x00, 0x06, 0x06, 0x0f,
+    0x06, 0x06, 0x0a, 0x01, 0x01, 0x00, 0x04, 0x05, 0x0f, 0x07, 0x01, 0x01, 0x01, 0x04, 0x06, 0x0d,
+    0x0f, 0x09, 0x01, 0x03, 0x03, 0x04, 0x0f, 0x07, 0x01, 0x00, 0x06, 0x05, 0x09, 0x05, 0x07, 0x0f,
+    0x07, 0x01, 0x00, 0x05, 0x03, 0x0c, 0x0f, 0x0e, 0x09, 0x01, 0x01, 0x02, 0x02, 0x0a, 0x01, 0x01,
+    0x03, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x05, 0x09, 0x0f, 0x0f, 0x0f, 0x05, 0x01, 0x00, 0x04, 0x01,
+    0x08, 0x0f, 0x05, 0x01, 0x01, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x01, 0x03, 0x05, 0x0f, 0x01, 0x01,
+    0x01, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x01, 0x03, 0x05, 0x0f, 0x01, 0x01, 0x01, 0x03, 0x05, 0x0f,
+    0x01, 0x02, 0x00, 0x02, 0x03, 0x0e, 0x03, 0x03, 0x02, 0x0e, 0x01, 0x01, 0x00, 0x08, 0x05, 0x0f,
+    0x01, 0x00, 0x00, 0x04, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x01, 0x00, 0x00, 0x04, 0x0f,
+    0x03, 0x01, 0x00, 0x08, 0x05, 0x0f, 0x02, 0x00, 0x00, 0x04, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x04,
+    0x0f, 0x05, 0x00, 0x00, 0x07, 0x0f, 0x01, 0x01, 0x01, 0x06, 0x0d, 0x0d, 0x05, 0x05, 0x0e, 0x0b,
+    0x01, 0x01, 0x06, 0x02, 0x0b, 0x0e, 0x0e, 0x09, 0x01, 0x02, 0x00, 0x02, 0x0a, 0x09, 0x03, 0x02,
+    0x04, 0x0e, 0x01, 0x00, 0x07, 0x07, 0x0f, 0x02, 0x00, 0x00, 0x0c, 0x0d, 0x01, 0x01, 0x06, 0x0e,
+    0x09, 0x00, 0x03, 0x0f, 0x05, 0x01, 0x01, 0x05, 0x08, 0x0f, 0x01, 0x0b, 0x0d, 0x01, 0x01, 0x05,
+    0x01, 0x0f, 0x0b, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x08, 0x0f, 0x0e, 0x01, 0x02, 0x03, 0x01, 0x0e,
+    0x06, 0x02, 0x00, 0x02, 0x08, 0x09, 0x03, 0x07, 0x0b, 0x07, 0x00, 0x00, 0x01, 0x0d, 0x04, 0x01,
+    0x00, 0x0c, 0x06, 0x0f, 0x02, 0x00, 0x04, 0x0f, 0x0f, 0x00, 0x00, 0x07, 0x0f, 0x02, 0x01, 0x01,
+    0x0a, 0x0f, 0x08, 0x00, 0x0a, 0x0d, 0x0f, 0x05, 0x00, 0x0d, 0x0b, 0x01, 0x01, 0x0a, 0x09, 0x0e,
+    0x01, 0x0f, 0x06, 0x0b, 0x0c, 0x03, 0x0f, 0x04, 0x01, 0x01, 0x09, 0x02, 0x0f, 0x0c, 0x0f, 0x00,
+    0x04, 0x0f, 0x0c, 0x0d, 0x01, 0x02, 0x08, 0x0b, 0x0f, 0x09, 0x00, 0x00, 0x0e, 0x0f, 0x06, 0x01,
+    0x02, 0x07, 0x04, 0x0e, 0x02, 0x00, 0x00, 0x06, 0x0e, 0x02, 0x00, 0x02, 0x08, 0x0b, 0x03, 0x02,
+    0x0a, 0x09, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x0b, 0x00, 0x09, 0x0f, 0x04, 0x01, 0x01, 0x05, 0x05,
+    0x0f, 0x0d, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x0b, 0x01, 0x01, 0x05, 0x05, 0x0f, 0x0d,
+    0x0f, 0x06, 0x01, 0x00, 0x07, 0x03, 0x0f, 0x0b, 0x00, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x02, 0x08,
+    0x0b, 0x03, 0x02, 0x0a, 0x09, 0x02, 0x00, 0x02, 0x0a, 0x08, 0x03, 0x02, 0x03, 0x0e, 0x01, 0x00,
+    0x07, 0x08, 0x0f, 0x02, 0x00, 0x00, 0x0b, 0x0d, 0x01, 0x00, 0x07, 0x01, 0x0f, 0x09, 0x00, 0x02,
+    0x0f, 0x06, 0x01, 0x01, 0x05, 0x09, 0x0f, 0x01, 0x0a, 0x0e, 0x01, 0x01, 0x05, 0x01, 0x0f, 0x09,
+    0x0f, 0x07, 0x01, 0x02, 0x04, 0x0a, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x03, 0x0f, 0x08, 0x01,
+    0x02, 0x03, 0x06, 0x0f, 0x01, 0x01, 0x00, 0x04, 0x01, 0x05, 0x0e, 0x09, 0x01, 0x00, 0x03, 0x09,
+    0x0f, 0x0a, 0x03, 0x00, 0x01, 0x07, 0x00, 0x85, 0x00, 0x01, 0x06, 0x01, 0x00, 0x07, 0x01, 0x03,
+    0x03, 0x04, 0x0e, 0x0f, 0x02, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x02, 0x03, 0x07, 0x0f,
+    0x07, 0x01, 0x01, 0x03, 0x04, 0x0f, 0x0a, 0x01, 0x00, 0x07, 0x02, 0x0f, 0x0e, 0x04, 0x03, 0x03,
+    0x01, 0x03, 0x00, 0x01, 0x07, 0x00, 0x85, 0x00, 0x01, 0x08, 0x01, 0x01, 0x04, 0x05, 0x0d, 0x0f,
+    0x03, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0d, 0x07, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x06, 0x01, 0x00,
+    0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05,
+    0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x03,
+    0x0f, 0x05, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x0a, 0x02, 0x01, 0x01, 0x04, 0x0a, 0x0f, 0x0f, 0x04,
+    0x01, 0x02, 0x02, 0x02, 0x04, 0x01, 0x00, 0x02, 0x02, 0x0d, 0x01, 0x00, 0x02, 0x03, 0x0f, 0x01,
+    0x00, 0x02, 0x03, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x0f, 0x01, 0x00,
+    0x02, 0x03, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x0f, 0x01, 0x00, 0x02,
+    0x03, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x0f, 0x01, 0x00, 0x02, 0x01,
+    0x0a, 0x01, 0x00, 0x04, 0x06, 0x0f, 0x0d, 0x04, 0x01, 0x00, 0x04, 0x01, 0x07, 0x0e, 0x0e, 0x01,
+    0x02, 0x02, 0x08, 0x0f, 0x01, 0x02, 0x02, 0x07, 0x0f, 0x01, 0x02, 0x02, 0x07, 0x0f, 0x01, 0x02,
+    0x02, 0x07, 0x0f, 0x01, 0x02, 0x02, 0x07, 0x0f, 0x01, 0x02, 0x02, 0x07, 0x0f, 0x01, 0x02, 0x02,
+    0x07, 0x0f, 0x01, 0x01, 0x03, 0x02, 0x0c, 0x0f, 0x01, 0x00, 0x04, 0x06, 0x0f, 0x0f, 0x07, 0x01,
+    0x01, 0x02, 0x04, 0x02, 0x01, 0x01, 0x07, 0x09, 0x0e, 0x0d, 0x07, 0x01, 0x03, 0x0d, 0x01, 0x00,
+    0x08, 0x05, 0x0c, 0x01, 0x04, 0x0c, 0x0f, 0x0f, 0x06, 0x01, 0x05, 0x01, 0x01,
+};
+
+static const uint32_t lts14_atlas_index[] = {
+    0, 0, 53, 85, 164, 265, 365, 453,
+    473, 539, 607, 639, 681, 699, 716, 728,
+    793, 879, 928, 998, 1070, 1139, 1214, 1294,
+    1354, 1438, 1515, 1542, 1575, 1618, 1656, 1701,
+    1758, 1868, 1949, 2044, 2124, 2221, 2297, 2366,
+    2470, 2561, 2615, 2675, 2764, 2825, 2942, 3044,
+    3142, 3225, 3341, 3436, 3515, 3570, 3660, 3738,
+    3860, 3941, 4004, 4073, 4151, 4217, 4295, 4343,
+    4363, 4379, 4448, 4534, 4585, 4667, 4729, 4785,
+    4878, 4970, 5025, 5091, 5171, 5230, 5332, 5407,
+    5472, 5558, 5640, 5684, 5737, 5793, 5865, 5921,
+    6009, 6069, 6146, 6202, 6277, 6337, 6404,
+};
+
+static const glyph_atlas_t lts14_atlas = {
+    .index = lts14_atlas_index,
+    .data = lts14_atlas_data,
+};
+
+static const uint8_t lts16_atlas_data[] = {
+    0x01, 0x00, 0x03, 0x02, 0x0e, 0x06, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x05,
+    0x0f, 0x09, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x08, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x07, 0x01, 0x00,
+    0x03, 0x02, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x05, 0x01, 0x01, 0x02, 0x0f, 0x03, 0x00,
+    0x01, 0x00, 0x03, 0x03, 0x0e, 0x06, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x06, 0x01, 0x00, 0x05, 0x02,
+    0x0e, 0x03, 0x07, 0x0c, 0x01, 0x00, 0x05, 0x04, 0x0f, 0x05, 0x0a, 0x0e, 0x01, 0x00, 0x05, 0x04,
+    0x0f, 0x05, 0x0a, 0x0e, 0x01, 0x00, 0x05, 0x02, 0x0b, 0x03, 0x07, 0x0a, 0x01, 0x03, 0x05, 0x0d,
+    0x05, 0x00, 0x04, 0x0e, 0x01, 0x02, 0x06, 0x01, 0x0f, 0x06, 0x00, 0x09, 0x0e, 0x01, 0x02, 0x06,
+    0x04, 0x0f, 0x03, 0x00, 0x0c, 0x0b, 0x03, 0x01, 0x01, 0x0e, 0x00, 0x86, 0x00, 0x01, 0x0e, 0x01,
+    0x01, 0x08, 0x05, 0x0d, 0x0e, 0x06, 0x07, 0x0f, 0x09, 0x05, 0x01, 0x02, 0x06, 0x0c, 0x0b, 0x00,
+    0x03, 0x0f, 0x04, 0x01, 0x01, 0x07, 0x01, 0x0e, 0x0a, 0x01, 0x06, 0x0f, 0x03, 0x03, 0x00, 0x01,
+    0x09, 0x00, 0x87, 0x00, 0x01, 0x07, 0x01, 0x00, 0x09, 0x01, 0x07, 0x0f, 0x07, 0x04, 0x0c, 0x0d,
+    0x04, 0x01, 0x01, 0x01, 0x06, 0x07, 0x0f, 0x00, 0x00, 0x0e, 0x09, 0x01, 0x01, 0x06, 0x07, 0x0b,
+    0x00, 0x00, 0x0e, 0x05, 0x00, 0x01, 0x04, 0x02, 0x02, 0x09, 0x01, 0x04, 0x02, 0x03, 0x09, 0x01,
+    0x02, 0x06, 0x07, 0x0d, 0x0f, 0x0f, 0x0b, 0x04, 0x01, 0x01, 0x08, 0x0b, 0x0f, 0x0d, 0x0c, 0x0d,
+    0x0f, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x0b, 0x00, 0x08, 0x05, 0x01, 0x06, 0x01, 0x00,
+    0x06, 0x02, 0x0f, 0x0a, 0x00, 0x0a, 0x03, 0x01, 0x01, 0x05, 0x0c, 0x0f, 0x0c, 0x0d, 0x03, 0x01,
+    0x01, 0x07, 0x01, 0x07, 0x0d, 0x0f, 0x0f, 0x0c, 0x05, 0x01, 0x04, 0x05, 0x0e, 0x08, 0x0e, 0x0f,
+    0x05, 0x01, 0x04, 0x05, 0x0d, 0x00, 0x02, 0x0f, 0x0a, 0x01, 0x00, 0x09, 0x05, 0x0b, 0x04, 0x02,
+    0x0b, 0x00, 0x05, 0x0f, 0x09, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x0f, 0x0e, 0x0d, 0x0c, 0x0f, 0x0f,
+    0x02, 0x01, 0x01, 0x07, 0x01, 0x09, 0x0e, 0x0f, 0x0e, 0x0a, 0x02, 0x01, 0x03, 0x02, 0x06, 0x06,
+    0x01, 0x03, 0x02, 0x02, 0x01, 0x02, 0x01, 0x04, 0x07, 0x0e, 0x0e, 0x08, 0x04, 0x02, 0x09, 0x0a,
+    0x01, 0x00, 0x0b, 0x04, 0x0f, 0x06, 0x05, 0x0e, 0x06, 0x00, 0x00, 0x05, 0x0f, 0x07, 0x01, 0x00,
+    0x0a, 0x07, 0x0b, 0x00, 0x00, 0x09, 0x09, 0x00, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x0a, 0x04, 0x0e,
+    0x02, 0x01, 0x0d, 0x07, 0x00, 0x0c, 0x0e, 0x01, 0x01, 0x01, 0x08, 0x09, 0x0f, 0x0f, 0x0a, 0x00,
+    0x09, 0x0f, 0x03, 0x01, 0x05, 0x03, 0x04, 0x0f, 0x07, 0x01, 0x04, 0x08, 0x01, 0x0e, 0x0b, 0x00,
+    0x06, 0x0d, 0x0d, 0x08, 0x01, 0x04, 0x09, 0x0c, 0x0e, 0x01, 0x03, 0x0f, 0x05, 0x04, 0x0e, 0x06,
+    0x01, 0x03, 0x0a, 0x08, 0x0f, 0x04, 0x00, 0x07, 0x0b, 0x00, 0x00, 0x09, 0x0a, 0x01, 0x02, 0x0b,
+    0x04, 0x0f, 0x08, 0x00, 0x00, 0x04, 0x0f, 0x06, 0x05, 0x0e, 0x07, 0x02, 0x02, 0x02, 0x08, 0x0b,
+    0x04, 0x04, 0x07, 0x0e, 0x0e, 0x09, 0x01, 0x02, 0x06, 0x08, 0x0d, 0x0f, 0x0d, 0x09, 0x01, 0x01,
+    0x01, 0x07, 0x0a, 0x0f, 0x0c, 0x09, 0x0c, 0x0f, 0x0d, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0d, 0x03,
+    0x02, 0x03, 0x07, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x01, 0x08, 0x0b, 0x0f, 0x07, 0x03,
+    0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x02, 0x01, 0x0d, 0x00, 0x86, 0x00, 0x01, 0x07, 0x01, 0x00,
+    0x09, 0x01, 0x0d, 0x0f, 0x09, 0x06, 0x05, 0x08, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x07, 0x0f, 0x06,
+    0x03, 0x03, 0x04, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x07, 0x03, 0x03, 0x04, 0x0f, 0x07,
+    0x01, 0x00, 0x09, 0x01, 0x0e, 0x0f, 0x0b, 0x09, 0x0b, 0x0f, 0x0f, 0x04, 0x01, 0x01, 0x07, 0x01,
+    0x09, 0x0d, 0x0f, 0x0d, 0x0a, 0x03, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x03, 0x01, 0x00, 0x03, 0x04,
+    0x0f, 0x05, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x02, 0x0b, 0x03, 0x01, 0x02,
+    0x02, 0x05, 0x0e, 0x01, 0x01, 0x03, 0x01, 0x0e, 0x0e, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x06, 0x01,
+    0x01, 0x02, 0x0e, 0x0e, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x00, 0x03, 0x06, 0x0f, 0x05,
+    0x01, 0x00, 0x03, 0x07, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x07, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x06,
+    0x0f, 0x05, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x09, 0x01, 0x01, 0x02, 0x0e, 0x0e, 0x01, 0x01, 0x03,
+    0x08, 0x0f, 0x06, 0x01, 0x01, 0x03, 0x01, 0x0e, 0x0e, 0x01, 0x02, 0x02, 0x05, 0x0e, 0x01, 0x01,
+    0x02, 0x0a, 0x0b, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x05, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x0d, 0x01,
+    0x02, 0x03, 0x09, 0x0f, 0x04, 0x01, 0x02, 0x03, 0x03, 0x0f, 0x08, 0x01, 0x03, 0x02, 0x0f, 0x0b,
+    0x01, 0x03, 0x02, 0x0e, 0x0d, 0x01, 0x03, 0x02, 0x0e, 0x0d, 0x01, 0x03, 0x02, 0x0f, 0x0b, 0x01,
+    0x02, 0x03, 0x03, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x01, 0x0f,
+    0x0d, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x05, 0x01, 0x01, 0x02, 0x0a, 0x0b, 0x01, 0x02, 0x02, 0x0a,
+    0x05, 0x01, 0x00, 0x06, 0x05, 0x0d, 0x0d, 0x0c, 0x0e, 0x01, 0x01, 0x01, 0x04, 0x0b, 0x0f, 0x0f,
+    0x07, 0x01, 0x00, 0x06, 0x06, 0x0e, 0x0e, 0x0c, 0x0f, 0x01, 0x01, 0x02, 0x02, 0x0a, 0x05, 0x00,
+    0x01, 0x03, 0x02, 0x08, 0x09, 0x01, 0x03, 0x02, 0x0a, 0x0c, 0x01, 0x01, 0x06, 0x01, 0x01, 0x0b,
+    0x0c, 0x01, 0x01, 0x03, 0x00, 0x01, 0x07, 0x00, 0x86, 0x00, 0x01, 0x09, 0x01, 0x00, 0x08, 0x01,
+    0x04, 0x04, 0x0c, 0x0d, 0x04, 0x04, 0x01, 0x01, 0x03, 0x02, 0x0a, 0x0c, 0x01, 0x03, 0x02, 0x08,
+    0x0a, 0x01, 0x00, 0x03, 0x01, 0x0d, 0x08, 0x01, 0x00, 0x03, 0x01, 0x0e, 0x0c, 0x01, 0x00, 0x03,
+    0x01, 0x0c, 0x05, 0x01, 0x00, 0x02, 0x04, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x00, 0x01, 0x07, 0x00, 0x85, 0x01, 0x00, 0x06, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x01,
+    0x00, 0x03, 0x01, 0x0e, 0x08, 0x01, 0x00, 0x03, 0x01, 0x0d, 0x08, 0x01, 0x04, 0x03, 0x01, 0x0e,
+    0x05, 0x01, 0x04, 0x03, 0x07, 0x0f, 0x05, 0x01, 0x04, 0x02, 0x0d, 0x0e, 0x01, 0x03, 0x03, 0x03,
+    0x0f, 0x08, 0x01, 0x03, 0x03, 0x09, 0x0f, 0x02, 0x01, 0x03, 0x02, 0x0e, 0x0c, 0x01, 0x02, 0x03,
+    0x05, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x01, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x0a, 0x01,
+    0x01, 0x03, 0x07, 0x0f, 0x04, 0x01, 0x01, 0x02, 0x0d, 0x0e, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x08,
+    0x01, 0x00, 0x03, 0x09, 0x0f, 0x02, 0x01, 0x00, 0x02, 0x0a, 0x0b, 0x01, 0x03, 0x05, 0x08, 0x0c,
+    0x0f, 0x0c, 0x06, 0x01, 0x02, 0x07, 0x0c, 0x0f, 0x0d, 0x0a, 0x0e, 0x0f, 0x09, 0x02, 0x01, 0x03,
+    0x07, 0x0f, 0x09, 0x03, 0x03, 0x0b, 0x0f, 0x04, 0x02, 0x01, 0x02, 0x0e, 0x0e, 0x04, 0x03, 0x02,
+    0x0f, 0x0b, 0x02, 0x01, 0x02, 0x0f, 0x0b, 0x05, 0x02, 0x0e, 0x0e, 0x02, 0x00, 0x03, 0x02, 0x0f,
+    0x09, 0x05, 0x02, 0x0c, 0x0f, 0x02, 0x01, 0x02, 0x0f, 0x0b, 0x05, 0x02, 0x0e, 0x0d, 0x02, 0x01,
+    0x02, 0x0e, 0x0e, 0x04, 0x03, 0x02, 0x0f, 0x0b, 0x02, 0x01, 0x03, 0x07, 0x0f, 0x09, 0x03, 0x03,
+    0x0b, 0x0f, 0x04, 0x01, 0x02, 0x07, 0x0c, 0x0f, 0x0d, 0x0a, 0x0e, 0x0f, 0x09, 0x01, 0x03, 0x05,
+    0x08, 0x0c, 0x0f, 0x0c, 0x06, 0x01, 0x00, 0x04, 0x0a, 0x0f, 0x0f, 0x0d, 0x01, 0x00, 0x04, 0x05,
+    0x09, 0x0e, 0x0f, 0x01, 0x02, 0x02, 0x0b, 0x0f, 0x01, 0x02, 0x02, 0x0b, 0x0f, 0x01, 0x02, 0x02,
+    0x0b, 0x0f, 0x01, 0x02, 0x02, 0x0b, 0x0f, 0x01, 0x02, 0x02, 0x0b, 0x0f, 0x01, 0x02, 0x02, 0x0b,
+    0x0f, 0x01, 0x02, 0x02, 0x0b, 0x0f, 0x01, 0x02, 0x02, 0x0b, 0x0f, 0x01, 0x02, 0x02, 0x0b, 0x0f,
+    0x01, 0x01, 0x06, 0x01, 0x09, 0x0d, 0x0f, 0x0c, 0x06, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0f, 0x0b,
+    0x0a, 0x0e, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x01, 0x0a, 0x03, 0x00, 0x00, 0x01, 0x0f, 0x0d, 0x01,
+    0x06, 0x02, 0x0e, 0x0d, 0x01, 0x05, 0x03, 0x05, 0x0f, 0x09, 0x01, 0x04, 0x04, 0x04, 0x0f, 0x0e,
+    0x01, 0x01, 0x03, 0x04, 0x04, 0x0f, 0x0e, 0x02, 0x01, 0x02, 0x04, 0x04, 0x0f, 0x0e, 0x02, 0x01,
+    0x01, 0x04, 0x04, 0x0f, 0x0e, 0x02, 0x01, 0x00, 0x08, 0x03, 0x0f, 0x0f, 0x0b, 0x09, 0x09, 0x09,
+    0x08, 0x03, 0x00, 0x01, 0x05, 0x00, 0x87, 0x00, 0x01, 0x02, 0x01, 0x01, 0x06, 0x02, 0x0a, 0x0d,
+    0x0f, 0x0c, 0x05, 0x01, 0x01, 0x07, 0x0f, 0x0f, 0x0b, 0x0a, 0x0f, 0x0f, 0x06, 0x01, 0x01, 0x07,
+    0x08, 0x03, 0x00, 0x00, 0x01, 0x0f, 0x0d, 0x01, 0x06, 0x02, 0x0e, 0x0d, 0x01, 0x03, 0x05, 0x01,
+    0x04, 0x0a, 0x0f, 0x07, 0x01, 0x02, 0x05, 0x01, 0x0f, 0x0f, 0x0f, 0x0b, 0x01, 0x03, 0x05, 0x04,
+    0x06, 0x0b, 0x0f, 0x08, 0x01, 0x06, 0x02, 0x0b, 0x0f, 0x02, 0x00, 0x03, 0x01, 0x08, 0x02, 0x03,
+    0x02, 0x0d, 0x0f, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x0f, 0x0b, 0x0a, 0x0e, 0x0f, 0x09, 0x01, 0x01,
+    0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0d, 0x07, 0x01, 0x04, 0x02, 0x08, 0x0c, 0x01, 0x03, 0x03, 0x03,
+    0x0f, 0x0b, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x02, 0x03, 0x06, 0x0f, 0x09, 0x01, 0x01,
+    0x07, 0x01, 0x0e, 0x0e, 0x01, 0x00, 0x03, 0x0a, 0x01, 0x01, 0x08, 0x09, 0x0f, 0x06, 0x00, 0x00,
+    0x07, 0x0f, 0x04, 0x01, 0x00, 0x09, 0x02, 0x0f, 0x0f, 0x09, 0x09, 0x09, 0x0c, 0x0f, 0x04, 0x03,
+    0x00, 0x01, 0x04, 0x00, 0x87, 0x00, 0x01, 0x04, 0x01, 0x06, 0x03, 0x07, 0x0f, 0x04, 0x01, 0x06,
+    0x03, 0x07, 0x0f, 0x04, 0x01, 0x06, 0x03, 0x07, 0x0f, 0x03, 0x03, 0x01, 0x01, 0x0a, 0x00, 0x85,
+    0x00, 0x01, 0x07, 0x01, 0x01, 0x07, 0x0d, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x03, 0x01, 0x01, 0x02,
+    0x0d, 0x0e, 0x01, 0x01, 0x04, 0x0d, 0x0e, 0x02, 0x01, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x84, 0x00,
+    0x02, 0x09, 0x01, 0x01, 0x01, 0x07, 0x02, 0x05, 0x05, 0x06, 0x0a, 0x0f, 0x0b, 0x01, 0x06, 0x03,
+    0x0a, 0x0f, 0x03, 0x01, 0x06, 0x03, 0x07, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0a, 0x03, 0x03,
+    0x03, 0x0c, 0x0f, 0x02, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x0f, 0x0b, 0x0a, 0x0d, 0x0f, 0x09, 0x01,
+    0x01, 0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0c, 0x06, 0x01, 0x04, 0x02, 0x08, 0x0d, 0x01, 0x03, 0x03,
+    0x04, 0x0f, 0x0c, 0x01, 0x02, 0x04, 0x01, 0x0e, 0x0f, 0x02, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x06,
+    0x03, 0x01, 0x01, 0x05, 0x00, 0x84, 0x00, 0x02, 0x0d, 0x04, 0x01, 0x01, 0x08, 0x0e, 0x0f, 0x09,
+    0x05, 0x07, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x03, 0x03, 0x05, 0x0f, 0x08,
+    0x02, 0x00, 0x03, 0x04, 0x0f, 0x07, 0x03, 0x03, 0x02, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x01, 0x0f,
+    0x0b, 0x03, 0x03, 0x06, 0x0f, 0x07, 0x01, 0x01, 0x07, 0x08, 0x0f, 0x0c, 0x08, 0x0a, 0x0f, 0x0d,
+    0x01, 0x02, 0x06, 0x06, 0x0c, 0x0f, 0x0d, 0x09, 0x01, 0x03, 0x00, 0x01, 0x07, 0x00, 0x87, 0x00,
+    0x01, 0x05, 0x01, 0x00, 0x09, 0x03, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x0f, 0x03, 0x01, 0x05,
+    0x03, 0x04, 0x0f, 0x0a, 0x01, 0x05, 0x03, 0x0d, 0x0f, 0x02, 0x01, 0x04, 0x03, 0x06, 0x0f, 0x08,
+    0x01, 0x03, 0x04, 0x01, 0x0e, 0x0e, 0x01, 0x01, 0x03, 0x03, 0x08, 0x0f, 0x06, 0x01, 0x02, 0x03,
+    0x02, 0x0f, 0x0d, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x03, 0x0f, 0x0b, 0x01,
+    0x01, 0x03, 0x04, 0x0e, 0x02, 0x01, 0x02, 0x05, 0x08, 0x0d, 0x0f, 0x0c, 0x04, 0x01, 0x01, 0x07,
+    0x0b, 0x0f, 0x0d, 0x0a, 0x0f, 0x0f, 0x04, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0d, 0x00, 0x00, 0x03,
+    0x0f, 0x0a, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x09, 0x00, 0x00, 0x01, 0x0f, 0x0b, 0x01, 0x01, 0x07,
+    0x0c, 0x0f, 0x06, 0x03, 0x0b, 0x0f, 0x05, 0x03, 0x01, 0x01, 0x01, 0x00, 0x84, 0x00, 0x01, 0x0a,
+    0x01, 0x01, 0x07, 0x0d, 0x0e, 0x09, 0x06, 0x0b, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x05, 0x0f, 0x05,
+    0x03, 0x02, 0x0b, 0x0e, 0x02, 0x00, 0x03, 0x07, 0x0f, 0x07, 0x03, 0x02, 0x0d, 0x0f, 0x01, 0x00,
+    0x08, 0x01, 0x0e, 0x0f, 0x0c, 0x0a, 0x0e, 0x0f, 0x09, 0x01, 0x01, 0x06, 0x02, 0x0a, 0x0e, 0x0f,
+    0x0d, 0x07, 0x01, 0x02, 0x06, 0x06, 0x0c, 0x0f, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x07, 0x08, 0x0f,
+    0x0c, 0x08, 0x0a, 0x0f, 0x0d, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x03, 0x07, 0x0f, 0x06,
+    0x02, 0x00, 0x03, 0x04, 0x0f, 0x07, 0x03, 0x03, 0x02, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x03, 0x0f,
+    0x09, 0x03, 0x03, 0x04, 0x0f, 0x08, 0x01, 0x01, 0x08, 0x0d, 0x0f, 0x07, 0x02, 0x04, 0x0d, 0x0f,
+    0x03, 0x03, 0x01, 0x02, 0x02, 0x0d, 0x00, 0x84, 0x00, 0x01, 0x0a, 0x01, 0x03, 0x05, 0x03, 0x05,
+    0x0e, 0x0e, 0x01, 0x01, 0x04, 0x03, 0x0b, 0x0f, 0x04, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x09, 0x01,
+    0x03, 0x02, 0x08, 0x0c, 0x00, 0x01, 0x00, 0x03, 0x01, 0x0e, 0x08, 0x01, 0x00, 0x03, 0x01, 0x0d,
+    0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x0e, 0x08, 0x01, 0x00, 0x03, 0x01, 0x0d, 0x08,
+    0x00, 0x01, 0x00, 0x03, 0x01, 0x0e, 0x08, 0x01, 0x00, 0x03, 0x01, 0x0d, 0x08, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0c, 0x01, 0x01, 0x02, 0x0b, 0x09,
+    0x01, 0x00, 0x03, 0x05, 0x0c, 0x01, 0x00, 0x01, 0x05, 0x02, 0x09, 0x08, 0x01, 0x03, 0x04, 0x04,
+    0x0e, 0x0f, 0x05, 0x01, 0x01, 0x05, 0x01, 0x09, 0x0f, 0x0b, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0e,
+    0x0f, 0x06, 0x01, 0x00, 0x04, 0x03, 0x0f, 0x0e, 0x04, 0x01, 0x01, 0x05, 0x02, 0x0c, 0x0f, 0x09,
+    0x01, 0x01, 0x03, 0x04, 0x06, 0x0f, 0x0e, 0x04, 0x01, 0x04, 0x03, 0x01, 0x0b, 0x0a, 0x03, 0x00,
+    0x01, 0x06, 0x00, 0x86, 0x00, 0x01, 0x08, 0x01, 0x00, 0x08, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x02, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x07, 0x00,
+    0x86, 0x00, 0x01, 0x09, 0x01, 0x00, 0x08, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01,
+    0x00, 0x03, 0x04, 0x0b, 0x03, 0x01, 0x00, 0x04, 0x02, 0x0d, 0x0f, 0x08, 0x01, 0x02, 0x04, 0x07,
+    0x0f, 0x0d, 0x03, 0x01, 0x03, 0x04, 0x02, 0x0c, 0x0f, 0x07, 0x01, 0x03, 0x04, 0x01, 0x0b, 0x0f,
+    0x09, 0x01, 0x02, 0x04, 0x05, 0x0e, 0x0e, 0x05, 0x01, 0x00, 0x05, 0x01, 0x0b, 0x0f, 0x0a, 0x01,
+    0x01, 0x00, 0x03, 0x04, 0x0e, 0x05, 0x01, 0x01, 0x06, 0x04, 0x0c, 0x0e, 0x0e, 0x0b, 0x03, 0x01,
+    0x00, 0x08, 0x07, 0x0f, 0x0e, 0x0a, 0x0b, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x02, 0x04, 0x06, 0x03,
+    0x03, 0x06, 0x0f, 0x06, 0x01, 0x05, 0x03, 0x0c, 0x0f, 0x02, 0x01, 0x03, 0x04, 0x02, 0x0d, 0x0f,
+    0x06, 0x01, 0x03, 0x03, 0x0a, 0x0e, 0x02, 0x01, 0x03, 0x02, 0x0e, 0x08, 0x01, 0x03, 0x02, 0x0b,
+    0x04, 0x00, 0x01, 0x02, 0x03, 0x01, 0x0e, 0x08, 0x01, 0x02, 0x03, 0x01, 0x0d, 0x08, 0x01, 0x03,
+    0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0d, 0x0a, 0x04, 0x01, 0x02, 0x09, 0x08, 0x0f, 0x08, 0x04, 0x02,
+    0x04, 0x08, 0x0f, 0x0a, 0x02, 0x01, 0x03, 0x05, 0x0f, 0x02, 0x05, 0x03, 0x01, 0x0e, 0x07, 0x01,
+    0x01, 0x0b, 0x0e, 0x06, 0x00, 0x09, 0x0e, 0x0e, 0x07, 0x0e, 0x01, 0x04, 0x0e, 0x01, 0x00, 0x0d,
+    0x01, 0x0f, 0x01, 0x07, 0x0d, 0x04, 0x02, 0x09, 0x0f, 0x02, 0x00, 0x0f, 0x01, 0x01, 0x00, 0x0d,
+    0x03, 0x0e, 0x00, 0x0a, 0x07, 0x00, 0x00, 0x01, 0x0f, 0x02, 0x01, 0x0f, 0x01, 0x01, 0x00, 0x0c,
+    0x01, 0x0f, 0x01, 0x07, 0x0d, 0x03, 0x01, 0x09, 0x0f, 0x03, 0x09, 0x0b, 0x01, 0x01, 0x0b, 0x0e,
+    0x06, 0x00, 0x09, 0x0e, 0x0e, 0x08, 0x0e, 0x0f, 0x0a, 0x01, 0x01, 0x01, 0x03, 0x05, 0x0f, 0x02,
+    0x01, 0x02, 0x08, 0x08, 0x0f, 0x08, 0x04, 0x02, 0x05, 0x09, 0x07, 0x01, 0x03, 0x07, 0x03, 0x0a,
+    0x0d, 0x0f, 0x0e, 0x0a, 0x02, 0x01, 0x05, 0x02, 0x0c, 0x0b, 0x01, 0x04, 0x04, 0x07, 0x0f, 0x0f,
+    0x05, 0x01, 0x04, 0x04, 0x0d, 0x0e, 0x0f, 0x0c, 0x01, 0x03, 0x06, 0x05, 0x0f, 0x08, 0x09, 0x0f,
+    0x03, 0x01, 0x03, 0x06, 0x0c, 0x0f, 0x01, 0x02, 0x0f, 0x0a, 0x01, 0x02, 0x08, 0x03, 0x0f, 0x0a,
+    0x00, 0x00, 0x0c, 0x0f, 0x02, 0x01, 0x02, 0x08, 0x0a, 0x0f, 0x03, 0x00, 0x00, 0x05, 0x0f, 0x09,
+    0x03, 0x01, 0x01, 0x02, 0x00, 0x88, 0x00, 0x01, 0x01, 0x01, 0x01, 0x0a, 0x08, 0x0f, 0x0a, 0x08,
+    0x08, 0x08, 0x08, 0x0b, 0x0f, 0x07, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x01, 0x0f, 0x0e,
+    0x02, 0x00, 0x03, 0x06, 0x0f, 0x08, 0x06, 0x03, 0x0a, 0x0f, 0x04, 0x03, 0x01, 0x01, 0x0d, 0x00,
+    0x84, 0x00, 0x02, 0x0c, 0x05, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0d, 0x09, 0x09, 0x0a, 0x0f, 0x0f,
+    0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x03, 0x03, 0x03, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x04, 0x02, 0x0f, 0x0c, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0b, 0x01, 0x01, 0x02, 0x09,
+    0x0f, 0x06, 0x03, 0x00, 0x01, 0x01, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x00, 0x0a, 0x01,
+    0x0f, 0x0c, 0x04, 0x04, 0x04, 0x08, 0x0e, 0x0d, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x04,
+    0x03, 0x06, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x04, 0x03, 0x08, 0x0f, 0x06, 0x01,
+    0x00, 0x0a, 0x01, 0x0f, 0x0d, 0x09, 0x09, 0x09, 0x0d, 0x0f, 0x0e, 0x01, 0x03, 0x00, 0x01, 0x01,
+    0x00, 0x85, 0x00, 0x03, 0x0e, 0x0a, 0x02, 0x01, 0x03, 0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0d, 0x09,
+    0x02, 0x01, 0x02, 0x09, 0x09, 0x0f, 0x0f, 0x0b, 0x09, 0x0c, 0x0f, 0x0f, 0x04, 0x02, 0x01, 0x04,
+    0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x03, 0x0b, 0x06, 0x01, 0x01, 0x03, 0x0e, 0x0e, 0x01, 0x01,
+    0x00, 0x03, 0x02, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x07, 0x01, 0x00, 0x03, 0x02, 0x0f,
+    0x0a, 0x01, 0x01, 0x03, 0x0e, 0x0e, 0x01, 0x02, 0x01, 0x04, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03,
+    0x03, 0x0b, 0x06, 0x01, 0x02, 0x09, 0x09, 0x0f, 0x0f, 0x0b, 0x09, 0x0c, 0x0f, 0x0f, 0x04, 0x01,
+    0x03, 0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0d, 0x09, 0x02, 0x01, 0x01, 0x07, 0x0e, 0x0f, 0x0f, 0x0f,
+    0x0e, 0x0b, 0x05, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0d, 0x09, 0x09, 0x0b, 0x0e, 0x0f, 0x0b, 0x02,
+    0x00, 0x03, 0x01, 0x0f, 0x0a, 0x04, 0x03, 0x0a, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a,
+    0x05, 0x03, 0x0c, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x06, 0x0f, 0x05,
+    0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x04, 0x0f, 0x08, 0x02, 0x00, 0x03, 0x01, 0x0f,
+    0x0a, 0x05, 0x03, 0x06, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x0c, 0x0f,
+    0x02, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x04, 0x03, 0x0a, 0x0f, 0x09, 0x01, 0x00, 0x09, 0x01,
+    0x0f, 0x0d, 0x09, 0x09, 0x0b, 0x0e, 0x0f, 0x0b, 0x01, 0x01, 0x07, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x0b, 0x05, 0x03, 0x01, 0x01, 0x0e, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x00, 0x09, 0x01, 0x0f,
+    0x0d, 0x09, 0x09, 0x09, 0x09, 0x09, 0x02, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03,
+    0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x03, 0x00, 0x01, 0x01, 0x00, 0x86, 0x00,
+    0x01, 0x0e, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0d, 0x08, 0x08, 0x08, 0x08, 0x06, 0x01, 0x00, 0x03,
+    0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0d, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x02, 0x03, 0x01, 0x01, 0x0e, 0x00, 0x86, 0x00, 0x01, 0x04, 0x03, 0x01,
+    0x01, 0x0e, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0d, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x02, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0a, 0x03, 0x00, 0x01, 0x01, 0x00, 0x86, 0x00, 0x01, 0x0e, 0x01, 0x00,
+    0x08, 0x01, 0x0f, 0x0d, 0x08, 0x08, 0x08, 0x08, 0x06, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f,
+    0x09, 0x01, 0x03, 0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0d, 0x09, 0x02, 0x01, 0x02, 0x09, 0x09, 0x0f,
+    0x0f, 0x0b, 0x09, 0x0c, 0x0f, 0x0f, 0x04, 0x02, 0x01, 0x04, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03,
+    0x03, 0x0b, 0x06, 0x01, 0x01, 0x03, 0x0e, 0x0e, 0x01, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0a, 0x04,
+    0x00, 0x03, 0x04, 0x0f, 0x07, 0x03, 0x01, 0x0a, 0x00, 0x84, 0x00, 0x01, 0x08, 0x02, 0x00, 0x03,
+    0x02, 0x0f, 0x0a, 0x03, 0x06, 0x05, 0x09, 0x09, 0x0a, 0x0f, 0x09, 0x02, 0x01, 0x03, 0x0e, 0x0e,
+    0x01, 0x05, 0x03, 0x07, 0x0f, 0x06, 0x02, 0x01, 0x04, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x04,
+    0x0f, 0x0e, 0x01, 0x02, 0x09, 0x09, 0x0f, 0x0f, 0x0b, 0x09, 0x0c, 0x0f, 0x0e, 0x03, 0x01, 0x03,
+    0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0c, 0x09, 0x01, 0x02, 0x01, 0x02, 0x0d, 0x06, 0x05, 0x02, 0x07,
+    0x0d, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x0b,
+    0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x01, 0x03, 0x00, 0x01,
+    0x01, 0x00, 0x89, 0x00, 0x01, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0d, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x0d, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x01, 0x02,
+    0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a,
+    0x05, 0x03, 0x0b, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x05, 0x02, 0x0a, 0x0f, 0x01,
+    0x01, 0x02, 0x0d, 0x07, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00,
+    0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x09,
+    0x01, 0x05, 0x03, 0x03, 0x0e, 0x03, 0x01, 0x05, 0x03, 0x05, 0x0f, 0x06, 0x01, 0x05, 0x03, 0x05,
+    0x0f, 0x06, 0x01, 0x05, 0x03, 0x05, 0x0f, 0x06, 0x01, 0x05, 0x03, 0x05, 0x0f, 0x06, 0x01, 0x05,
+    0x03, 0x05, 0x0f, 0x06, 0x01, 0x05, 0x03, 0x05, 0x0f, 0x06, 0x01, 0x05, 0x03, 0x07, 0x0f, 0x05,
+    0x02, 0x00, 0x02, 0x03, 0x06, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x00, 0x07, 0x07, 0x0f, 0x0e,
+    0x0a, 0x0c, 0x0f, 0x0b, 0x01, 0x01, 0x06, 0x06, 0x0c, 0x0f, 0x0e, 0x09, 0x01, 0x02, 0x01, 0x02,
+    0x0d, 0x07, 0x03, 0x03, 0x02, 0x0d, 0x07, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0a, 0x00, 0x00, 0x02,
+    0x0e, 0x0f, 0x03, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0a, 0x00, 0x02, 0x0e, 0x0f, 0x03, 0x01, 0x00,
+    0x07, 0x01, 0x0f, 0x0a, 0x03, 0x0e, 0x0e, 0x03, 0x01, 0x00, 0x06, 0x01, 0x0f, 0x0d, 0x0e, 0x0f,
+    0x06, 0x01, 0x00, 0x07, 0x01, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x01, 0x01, 0x00, 0x07, 0x01, 0x0f,
+    0x0e, 0x02, 0x06, 0x0f, 0x0b, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0a, 0x00, 0x00, 0x0a, 0x0f, 0x06,
+    0x01, 0x00, 0x09, 0x01, 0x0f, 0x0a, 0x00, 0x00, 0x01, 0x0e, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x03, 0x03, 0x03, 0x0f, 0x0d, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x04, 0x02, 0x07,
+    0x0d, 0x01, 0x01, 0x02, 0x0d, 0x07, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00,
+    0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0d, 0x09, 0x09, 0x09, 0x09,
+    0x09, 0x02, 0x03, 0x01, 0x01, 0x0e, 0x00, 0x86, 0x00, 0x01, 0x04, 0x02, 0x01, 0x03, 0x07, 0x0e,
+    0x03, 0x05, 0x03, 0x05, 0x0e, 0x04, 0x02, 0x01, 0x03, 0x0b, 0x0f, 0x0a, 0x05, 0x03, 0x0d, 0x0f,
+    0x09, 0x02, 0x01, 0x04, 0x0d, 0x0f, 0x0f, 0x01, 0x03, 0x04, 0x03, 0x0f, 0x0f, 0x0a, 0x02, 0x01,
+    0x04, 0x0e, 0x0e, 0x0f, 0x07, 0x03, 0x04, 0x0a, 0x0f, 0x0f, 0x0c, 0x02, 0x01, 0x04, 0x0f, 0x0b,
+    0x0c, 0x0d, 0x03, 0x04, 0x0f, 0x0a, 0x0d, 0x0d, 0x01, 0x00, 0x0c, 0x01, 0x0f, 0x09, 0x06, 0x0f,
+    0x04, 0x00, 0x06, 0x0f, 0x03, 0x0c, 0x0e, 0x01, 0x00, 0x0c, 0x02, 0x0f, 0x08, 0x00, 0x0f, 0x0a,
+    0x00, 0x0c, 0x0d, 0x00, 0x0b, 0x0f, 0x01, 0x00, 0x0d, 0x04, 0x0f, 0x07, 0x00, 0x09, 0x0f, 0x04,
+    0x0f, 0x07, 0x00, 0x0a, 0x0f, 0x01, 0x01, 0x00, 0x0d, 0x05, 0x0f, 0x06, 0x00, 0x03, 0x0f, 0x0e,
+    0x0f, 0x01, 0x00, 0x08, 0x0f, 0x03, 0x01, 0x00, 0x0d, 0x07, 0x0f, 0x04, 0x00, 0x00, 0x0d, 0x0f,
+    0x0a, 0x00, 0x00, 0x07, 0x0f, 0x04, 0x01, 0x00, 0x0d, 0x08, 0x0f, 0x03, 0x00, 0x00, 0x06, 0x0f,
+    0x04, 0x00, 0x00, 0x05, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0d, 0x09, 0x05, 0x03, 0x05, 0x0e, 0x01,
+    0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x07, 0x04, 0x03, 0x08, 0x0f, 0x03, 0x02, 0x00, 0x05, 0x01,
+    0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x08, 0x0f, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0c, 0x0e,
+    0x0e, 0x01, 0x00, 0x00, 0x08, 0x0f, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0a, 0x04, 0x0f, 0x0c,
+    0x00, 0x00, 0x08, 0x0f, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0a, 0x00, 0x08, 0x0f, 0x08, 0x00,
+    0x08, 0x0f, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0a, 0x00, 0x00, 0x0c, 0x0f, 0x04, 0x08, 0x0f,
+    0x03, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0a, 0x00, 0x00, 0x01, 0x0e, 0x0e, 0x0b, 0x0f, 0x03, 0x02,
+    0x00, 0x03, 0x01, 0x0f, 0x0a, 0x03, 0x05, 0x03, 0x0f, 0x0f, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x04, 0x04, 0x07, 0x0f, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x05, 0x03,
+    0x0a, 0x0f, 0x02, 0x01, 0x03, 0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0c, 0x09, 0x02, 0x01, 0x02, 0x09,
+    0x09, 0x0f, 0x0f, 0x0b, 0x0a, 0x0c, 0x0f, 0x0f, 0x06, 0x02, 0x01, 0x04, 0x06, 0x0f, 0x0c, 0x01,
+    0x03, 0x04, 0x03, 0x0d, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x0e, 0x0e, 0x01, 0x05, 0x03, 0x03, 0x0f,
+    0x0b, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0a, 0x07, 0x02, 0x0c, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x07, 0x07, 0x03, 0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0a, 0x07, 0x02, 0x0d, 0x0f,
+    0x02, 0x01, 0x03, 0x0e, 0x0e, 0x01, 0x05, 0x03, 0x03, 0x0f, 0x0b, 0x02, 0x01, 0x04, 0x06, 0x0f,
+    0x0c, 0x01, 0x03, 0x04, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x02, 0x09, 0x09, 0x0f, 0x0f, 0x0b, 0x09,
+    0x0c, 0x0f, 0x0f, 0x06, 0x01, 0x03, 0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0c, 0x09, 0x02, 0x03, 0x01,
+    0x01, 0x0d, 0x00, 0x84, 0x00, 0x02, 0x0c, 0x05, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0d, 0x09, 0x09,
+    0x0a, 0x0e, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x03, 0x03, 0x01, 0x0e, 0x0f, 0x02,
+    0x00, 0x03, 0x01, 0x0f, 0x0a, 0x04, 0x03, 0x08, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a,
+    0x04, 0x03, 0x0a, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x03, 0x03, 0x06, 0x0f, 0x0d,
+    0x03, 0x00, 0x01, 0x01, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x03, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0d,
+    0x09, 0x09, 0x09, 0x06, 0x01, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f,
+    0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x01, 0x03, 0x07, 0x03, 0x0a, 0x0d, 0x0f, 0x0c, 0x09,
+    0x02, 0x01, 0x02, 0x09, 0x08, 0x0f, 0x0f, 0x0b, 0x0a, 0x0c, 0x0f, 0x0f, 0x06, 0x02, 0x01, 0x04,
+    0x05, 0x0f, 0x0c, 0x01, 0x03, 0x04, 0x03, 0x0d, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x0e, 0x0e, 0x01,
+    0x05, 0x03, 0x03, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0a, 0x07, 0x02, 0x0d, 0x0f, 0x02,
+    0x00, 0x03, 0x04, 0x0f, 0x07, 0x07, 0x03, 0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0a,
+    0x07, 0x02, 0x0c, 0x0f, 0x02, 0x01, 0x03, 0x0f, 0x0e, 0x01, 0x05, 0x03, 0x02, 0x0f, 0x0c, 0x02,
+    0x01, 0x04, 0x07, 0x0f, 0x0b, 0x01, 0x03, 0x04, 0x02, 0x0d, 0x0f, 0x04, 0x01, 0x02, 0x09, 0x0a,
+    0x0f, 0x0e, 0x0a, 0x08, 0x0b, 0x0f, 0x0f, 0x07, 0x01, 0x03, 0x07, 0x05, 0x0b, 0x0e, 0x0f, 0x0f,
+    0x0a, 0x03, 0x01, 0x06, 0x04, 0x09, 0x0f, 0x08, 0x02, 0x01, 0x07, 0x04, 0x0b, 0x0f, 0x0f, 0x0b,
+    0x01, 0x08, 0x03, 0x02, 0x04, 0x02, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x84, 0x00, 0x02, 0x0d, 0x07,
+    0x01, 0x00, 0x09, 0x01, 0x0f, 0x0d, 0x09, 0x09, 0x0a, 0x0d, 0x0f, 0x08, 0x02, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x04, 0x02, 0x0e, 0x0f, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x04, 0x03, 0x0a, 0x0f,
+    0x02, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x04, 0x02, 0x0e, 0x0f, 0x01, 0x00, 0x09, 0x01, 0x0f,
+    0x0d, 0x09, 0x09, 0x0a, 0x0d, 0x0f, 0x09, 0x03, 0x00, 0x01, 0x01, 0x00, 0x86, 0x00, 0x01, 0x09,
+    0x01, 0x00, 0x08, 0x01, 0x0f, 0x0a, 0x00, 0x00, 0x06, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x01, 0x0f,
+    0x0a, 0x03, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x03, 0x03, 0x03, 0x0f,
+    0x0d, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x04, 0x02, 0x07, 0x0d, 0x01, 0x02, 0x06, 0x07, 0x0d,
+    0x0f, 0x0e, 0x0b, 0x04, 0x01, 0x01, 0x08, 0x0a, 0x0f, 0x0d, 0x09, 0x0a, 0x0f, 0x0f, 0x03, 0x02,
+    0x00, 0x03, 0x01, 0x0f, 0x0c, 0x04, 0x02, 0x06, 0x01, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0b, 0x01,
+    0x01, 0x05, 0x0c, 0x0f, 0x0c, 0x07, 0x02, 0x01, 0x02, 0x06, 0x07, 0x0d, 0x0f, 0x0f, 0x0c, 0x05,
+    0x01, 0x04, 0x05, 0x03, 0x07, 0x0d, 0x0f, 0x06, 0x01, 0x06, 0x03, 0x01, 0x0f, 0x0b, 0x02, 0x00,
+    0x03, 0x04, 0x0b, 0x04, 0x03, 0x03, 0x03, 0x0f, 0x0a, 0x01, 0x00, 0x09, 0x02, 0x0f, 0x0f, 0x0c,
+    0x0a, 0x0b, 0x0f, 0x0f, 0x03, 0x01, 0x01, 0x07, 0x01, 0x08, 0x0c, 0x0f, 0x0e, 0x0b, 0x03, 0x03,
+    0x00, 0x01, 0x07, 0x00, 0x87, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x09, 0x03, 0x09, 0x09, 0x0a, 0x0f,
+    0x0d, 0x09, 0x09, 0x08, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x09,
+    0x01, 0x03, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x03, 0x03, 0x02,
+    0x0f, 0x09, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x03,
+    0x03, 0x02, 0x0f, 0x09, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x09, 0x02, 0x01, 0x02, 0x0d, 0x07, 0x05,
+    0x02, 0x09, 0x0b, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x02, 0x0d, 0x0f, 0x02, 0x00, 0x03,
+    0x01, 0x0f, 0x0a, 0x05, 0x02, 0x0d, 0x0f, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x02, 0x0d,
+    0x0f, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x02, 0x0d, 0x0f, 0x02, 0x00, 0x03, 0x01, 0x0f,
+    0x0a, 0x05, 0x02, 0x0d, 0x0f, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x05, 0x02, 0x0d, 0x0e, 0x02,
+    0x01, 0x02, 0x0f, 0x0d, 0x05, 0x02, 0x0f, 0x0c, 0x02, 0x01, 0x03, 0x0b, 0x0f, 0x05, 0x03, 0x03,
+    0x08, 0x0f, 0x08, 0x01, 0x01, 0x08, 0x02, 0x0e, 0x0f, 0x0b, 0x09, 0x0c, 0x0f, 0x0d, 0x01, 0x02,
+    0x06, 0x01, 0x09, 0x0d, 0x0f, 0x0d, 0x08, 0x02, 0x00, 0x03, 0x05, 0x0e, 0x02, 0x06, 0x02, 0x0c,
+    0x09, 0x02, 0x00, 0x03, 0x05, 0x0f, 0x09, 0x05, 0x03, 0x04, 0x0f, 0x09, 0x02, 0x01, 0x03, 0x0d,
+    0x0f, 0x01, 0x04, 0x03, 0x0b, 0x0f, 0x02, 0x02, 0x01, 0x03, 0x06, 0x0f, 0x07, 0x03, 0x03, 0x02,
+    0x0f, 0x0b, 0x02, 0x02, 0x02, 0x0f, 0x0d, 0x03, 0x03, 0x09, 0x0f, 0x04, 0x01, 0x02, 0x07, 0x08,
+    0x0f, 0x05, 0x00, 0x01, 0x0f, 0x0d, 0x01, 0x02, 0x07, 0x01, 0x0f, 0x0b, 0x00, 0x07, 0x0f, 0x05,
+    0x01, 0x03, 0x05, 0x0a, 0x0f, 0x03, 0x0e, 0x0e, 0x01, 0x03, 0x05, 0x03, 0x0f, 0x0d, 0x0f, 0x07,
+    0x01, 0x04, 0x04, 0x0c, 0x0f, 0x0f, 0x01, 0x01, 0x04, 0x03, 0x03, 0x0e, 0x07, 0x03, 0x00, 0x02,
+    0x08, 0x0d, 0x04, 0x03, 0x09, 0x0f, 0x03, 0x03, 0x03, 0x04, 0x0e, 0x02, 0x03, 0x00, 0x03, 0x09,
+    0x0f, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x09, 0x03, 0x03, 0x09, 0x0f, 0x03, 0x02, 0x00, 0x09, 0x05,
+    0x0f, 0x07, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x0d, 0x03, 0x02, 0x0e, 0x0e, 0x01, 0x00, 0x0e, 0x01,
+    0x0f, 0x0c, 0x00, 0x00, 0x08, 0x0f, 0x0d, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0x09, 0x01, 0x01, 0x0d,
+    0x0c, 0x0f, 0x00, 0x00, 0x0c, 0x0f, 0x06, 0x0f, 0x06, 0x00, 0x06, 0x0f, 0x05, 0x01, 0x01, 0x0d,
+    0x07, 0x0f, 0x04, 0x01, 0x0f, 0x0b, 0x01, 0x0f, 0x0a, 0x00, 0x0b, 0x0f, 0x01, 0x01, 0x01, 0x0c,
+    0x03, 0x0f, 0x09, 0x05, 0x0f, 0x06, 0x00, 0x0d, 0x0e, 0x00, 0x0f, 0x0c, 0x01, 0x02, 0x0b, 0x0e,
+    0x0d, 0x09, 0x0f, 0x02, 0x00, 0x08, 0x0f, 0x07, 0x0f, 0x07, 0x01, 0x02, 0x0b, 0x0a, 0x0f, 0x0e,
+    0x0d, 0x00, 0x00, 0x04, 0x0f, 0x0e, 0x0f, 0x03, 0x02, 0x02, 0x04, 0x05, 0x0f, 0x0f, 0x09, 0x03,
+    0x03, 0x0f, 0x0f, 0x0e, 0x02, 0x02, 0x04, 0x01, 0x0e, 0x0f, 0x03, 0x03, 0x03, 0x09, 0x0f, 0x09,
+    0x02, 0x00, 0x03, 0x02, 0x0e, 0x05, 0x04, 0x02, 0x0a, 0x0b, 0x01, 0x00, 0x09, 0x01, 0x0e, 0x0f,
+    0x02, 0x00, 0x00, 0x07, 0x0f, 0x0a, 0x01, 0x01, 0x08, 0x05, 0x0f, 0x0c, 0x00, 0x03, 0x0f, 0x0e,
+    0x01, 0x01, 0x02, 0x06, 0x09, 0x0f, 0x09, 0x0d, 0x0f, 0x04, 0x01, 0x03, 0x04, 0x0d, 0x0f, 0x0f,
+    0x08, 0x01, 0x03, 0x04, 0x07, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x05, 0x02, 0x0f, 0x0f, 0x0f, 0x0b,
+    0x01, 0x02, 0x06, 0x0c, 0x0f, 0x05, 0x0b, 0x0f, 0x06, 0x01, 0x01, 0x08, 0x08, 0x0f, 0x0a, 0x00,
+    0x01, 0x0e, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0d, 0x03, 0x03, 0x04, 0x0f, 0x0d, 0x02,
+    0x00, 0x03, 0x05, 0x0e, 0x03, 0x04, 0x02, 0x07, 0x0d, 0x02, 0x00, 0x03, 0x06, 0x0d, 0x02, 0x04,
+    0x03, 0x06, 0x0e, 0x01, 0x02, 0x00, 0x03, 0x05, 0x0f, 0x0c, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x01,
+    0x01, 0x08, 0x0a, 0x0f, 0x08, 0x00, 0x00, 0x0d, 0x0f, 0x04, 0x01, 0x02, 0x06, 0x0d, 0x0f, 0x04,
+    0x09, 0x0f, 0x08, 0x01, 0x02, 0x05, 0x03, 0x0f, 0x0f, 0x0f, 0x0d, 0x01, 0x03, 0x04, 0x07, 0x0f,
+    0x0f, 0x02, 0x01, 0x03, 0x03, 0x01, 0x0f, 0x0b, 0x01, 0x04, 0x02, 0x0f, 0x0b, 0x01, 0x04, 0x02,
+    0x0f, 0x0b, 0x01, 0x04, 0x02, 0x0f, 0x0b, 0x01, 0x04, 0x02, 0x0f, 0x0a, 0x03, 0x01, 0x01, 0x0e,
+    0x00, 0x86, 0x00, 0x01, 0x06, 0x01, 0x01, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0a, 0x0f, 0x0f, 0x04,
+    0x01, 0x05, 0x03, 0x09, 0x0f, 0x0a, 0x01, 0x04, 0x04, 0x04, 0x0f, 0x0e, 0x01, 0x01, 0x04, 0x03,
+    0x0d, 0x0f, 0x05, 0x01, 0x03, 0x03, 0x09, 0x0f, 0x0b, 0x01, 0x02, 0x04, 0x03, 0x0f, 0x0e, 0x01,
+    0x01, 0x02, 0x03, 0x0d, 0x0f, 0x06, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x0b, 0x01, 0x00, 0x09, 0x02,
+    0x0f, 0x0f, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x05, 0x03, 0x00, 0x01, 0x04, 0x00, 0x87, 0x00, 0x01,
+    0x0a, 0x01, 0x01, 0x04, 0x0e, 0x0f, 0x0f, 0x0d, 0x01, 0x00, 0x05, 0x01, 0x0f, 0x0d, 0x09, 0x07,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00,
+    0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x05, 0x01,
+    0x0f, 0x0f, 0x0f, 0x0d, 0x01, 0x01, 0x04, 0x08, 0x09, 0x09, 0x07, 0x01, 0x00, 0x02, 0x09, 0x0b,
+    0x01, 0x00, 0x03, 0x09, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x08, 0x01, 0x01, 0x02, 0x0d,
+    0x0e, 0x01, 0x01, 0x03, 0x07, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03,
+    0x0b, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x05, 0x0f, 0x06, 0x01, 0x03, 0x02, 0x0e, 0x0c, 0x01, 0x03,
+    0x03, 0x09, 0x0f, 0x02, 0x01, 0x03, 0x03, 0x03, 0x0f, 0x08, 0x01, 0x04, 0x02, 0x0d, 0x0e, 0x01,
+    0x04, 0x03, 0x07, 0x0f, 0x05, 0x01, 0x04, 0x03, 0x01, 0x0e, 0x05, 0x01, 0x00, 0x05, 0x04, 0x0f,
+    0x0f, 0x0f, 0x08, 0x01, 0x00, 0x05, 0x02, 0x09, 0x0a, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f,
+    0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03,
+    0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01,
+    0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f,
+    0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x0f, 0x0a, 0x01,
+    0x00, 0x05, 0x02, 0x09, 0x09, 0x09, 0x04, 0x01, 0x03, 0x03, 0x02, 0x0d, 0x06, 0x01, 0x03, 0x04,
+    0x0c, 0x0f, 0x0f, 0x02, 0x01, 0x02, 0x05, 0x08, 0x0f, 0x04, 0x0d, 0x0d, 0x01, 0x01, 0x07, 0x04,
+    0x0f, 0x07, 0x00, 0x03, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x01, 0x0e, 0x0c, 0x03, 0x03, 0x07, 0x0f,
+    0x04, 0x02, 0x00, 0x03, 0x04, 0x0d, 0x01, 0x04, 0x02, 0x0a, 0x09, 0x01, 0x01, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x0b, 0x00, 0x87, 0x00, 0x01, 0x01, 0x01, 0x00,
+    0x08, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x01, 0x00, 0x02, 0x03, 0x04, 0x01, 0x00,
+    0x04, 0x07, 0x0f, 0x0a, 0x01, 0x01, 0x01, 0x03, 0x04, 0x0d, 0x06, 0x01, 0x02, 0x07, 0x06, 0x0c,
+    0x0f, 0x0c, 0x05, 0x06, 0x0d, 0x01, 0x01, 0x09, 0x08, 0x0f, 0x0d, 0x08, 0x09, 0x0e, 0x0e, 0x0f,
+    0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x03,
+    0x04, 0x0f, 0x05, 0x04, 0x03, 0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x04, 0x03,
+    0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01,
+    0x01, 0x09, 0x08, 0x0f, 0x0d, 0x08, 0x09, 0x0e, 0x0e, 0x0f, 0x01, 0x01, 0x02, 0x08, 0x06, 0x0c,
+    0x0f, 0x0c, 0x06, 0x08, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x03, 0x01, 0x00, 0x03, 0x04,
+    0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x06, 0x07, 0x0d,
+    0x0f, 0x0c, 0x04, 0x01, 0x00, 0x09, 0x04, 0x0f, 0x0e, 0x0d, 0x08, 0x09, 0x0e, 0x0f, 0x04, 0x02,
+    0x00, 0x03, 0x04, 0x0f, 0x0d, 0x03, 0x03, 0x01, 0x0e, 0x0d, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x07,
+    0x04, 0x03, 0x09, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x07, 0x04, 0x03, 0x09, 0x0f, 0x01,
+    0x02, 0x01, 0x02, 0x0e, 0x0d, 0x03, 0x03, 0x01, 0x0e, 0x0d, 0x01, 0x01, 0x08, 0x05, 0x0f, 0x0d,
+    0x08, 0x09, 0x0e, 0x0f, 0x03, 0x01, 0x02, 0x06, 0x04, 0x0b, 0x0e, 0x0e, 0x0b, 0x03, 0x01, 0x02,
+    0x06, 0x04, 0x0c, 0x0e, 0x0f, 0x0b, 0x03, 0x01, 0x01, 0x07, 0x06, 0x0f, 0x0d, 0x08, 0x09, 0x0d,
+    0x08, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x01, 0x01, 0x07, 0x06, 0x0f, 0x0d, 0x08,
+    0x09, 0x0d, 0x08, 0x01, 0x02, 0x06, 0x04, 0x0c, 0x0f, 0x0f, 0x0b, 0x02, 0x01, 0x07, 0x02, 0x06,
+    0x0d, 0x01, 0x07, 0x03, 0x09, 0x0f, 0x01, 0x01, 0x07, 0x03, 0x09, 0x0f, 0x01, 0x01, 0x02, 0x08,
+    0x06, 0x0c, 0x0f, 0x0c, 0x06, 0x09, 0x0f, 0x01, 0x01, 0x01, 0x09, 0x08, 0x0f, 0x0d, 0x08, 0x09,
+    0x0e, 0x0e, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x04, 0x02, 0x0f, 0x0f, 0x01,
+    0x02, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x04, 0x03, 0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x05, 0x04, 0x02, 0x0a, 0x0f, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x03, 0x02, 0x0f, 0x0c,
+    0x01, 0x01, 0x08, 0x06, 0x0f, 0x0d, 0x08, 0x09, 0x0e, 0x0f, 0x03, 0x01, 0x02, 0x06, 0x04, 0x0c,
+    0x0e, 0x0e, 0x0a, 0x02, 0x01, 0x02, 0x06, 0x05, 0x0c, 0x0f, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x07,
+    0x07, 0x0f, 0x0c, 0x08, 0x0b, 0x0f, 0x0d, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0b, 0x03, 0x03, 0x04,
+    0x0f, 0x06, 0x03, 0x00, 0x01, 0x04, 0x00, 0x87, 0x00, 0x01, 0x08, 0x01, 0x00, 0x08, 0x04, 0x0f,
+    0x0a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x07,
+    0x06, 0x0f, 0x0d, 0x08, 0x08, 0x0d, 0x0e, 0x01, 0x02, 0x06, 0x04, 0x0c, 0x0f, 0x0e, 0x0c, 0x04,
+    0x01, 0x02, 0x05, 0x02, 0x0c, 0x0f, 0x0f, 0x03, 0x01, 0x02, 0x04, 0x0e, 0x0f, 0x08, 0x06, 0x01,
+    0x01, 0x03, 0x02, 0x0f, 0x09, 0x03, 0x00, 0x01, 0x08, 0x00, 0x84, 0x00, 0x01, 0x0e, 0x01, 0x00,
+    0x06, 0x02, 0x08, 0x0f, 0x0b, 0x06, 0x05, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x07, 0x01, 0x01, 0x03,
+    0x02, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x07, 0x01,
+    0x01, 0x03, 0x02, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x02, 0x0f, 0x07, 0x01, 0x02, 0x07, 0x06, 0x0c,
+    0x0f, 0x0c, 0x05, 0x06, 0x0d, 0x01, 0x01, 0x09, 0x08, 0x0f, 0x0d, 0x08, 0x09, 0x0e, 0x0e, 0x0f,
+    0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x03,
+    0x04, 0x0f, 0x05, 0x04, 0x03, 0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x04, 0x03,
+    0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01,
+    0x01, 0x09, 0x08, 0x0f, 0x0d, 0x08, 0x09, 0x0e, 0x0e, 0x0f, 0x01, 0x01, 0x02, 0x07, 0x06, 0x0c,
+    0x0f, 0x0c, 0x06, 0x0a, 0x0f, 0x01, 0x07, 0x02, 0x0e, 0x0d, 0x01, 0x01, 0x08, 0x07, 0x0f, 0x0c,
+    0x08, 0x08, 0x0d, 0x0f, 0x05, 0x01, 0x01, 0x07, 0x01, 0x08, 0x0d, 0x0f, 0x0e, 0x0c, 0x04, 0x01,
+    0x00, 0x03, 0x02, 0x0e, 0x04, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f,
+    0x06, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x09, 0x0b, 0x0e, 0x0e, 0x08, 0x01, 0x00, 0x08, 0x04, 0x0f,
+    0x0f, 0x0b, 0x07, 0x0b, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x0b, 0x03, 0x03, 0x0b, 0x0f,
+    0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x07, 0x03, 0x03, 0x07, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x04,
+    0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x03, 0x03, 0x06,
+    0x0f, 0x04, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f, 0x04, 0x02, 0x00, 0x03,
+    0x03, 0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0d, 0x08, 0x01, 0x00,
+    0x03, 0x01, 0x0e, 0x08, 0x00, 0x01, 0x01, 0x02, 0x0d, 0x06, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x09,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x01, 0x00, 0x03, 0x01,
+    0x0f, 0x09, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x09, 0x01, 0x00,
+    0x03, 0x01, 0x0f, 0x09, 0x01, 0x02, 0x02, 0x0c, 0x0a, 0x01, 0x02, 0x02, 0x0d, 0x0b, 0x00, 0x01,
+    0x02, 0x02, 0x0b, 0x09, 0x01, 0x02, 0x02, 0x0e, 0x0c, 0x01, 0x02, 0x02, 0x0e, 0x0c, 0x01, 0x02,
+    0x02, 0x0e, 0x0c, 0x01, 0x02, 0x02, 0x0e, 0x0c, 0x01, 0x02, 0x02, 0x0e, 0x0c, 0x01, 0x02, 0x02,
+    0x0e, 0x0c, 0x01, 0x02, 0x02, 0x0e, 0x0c, 0x01, 0x02, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x04, 0x04,
+    0x0a, 0x0f, 0x07, 0x01, 0x00, 0x03, 0x0c, 0x0e, 0x09, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x04, 0x01,
+    0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x07, 0x04, 0x0f,
+    0x06, 0x00, 0x00, 0x09, 0x0c, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x06, 0x00, 0x0a, 0x0f, 0x06, 0x01,
+    0x00, 0x06, 0x04, 0x0f, 0x07, 0x0b, 0x0f, 0x06, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x01, 0x01, 0x00, 0x06, 0x04, 0x0f, 0x0f, 0x07, 0x0f, 0x0c, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x07,
+    0x00, 0x06, 0x0f, 0x09, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x06, 0x00, 0x00, 0x0a, 0x0f, 0x05, 0x02,
+    0x00, 0x03, 0x03, 0x0f, 0x06, 0x03, 0x02, 0x0c, 0x08, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x04, 0x01,
+    0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f,
+    0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01,
+    0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x06, 0x01, 0x00, 0x0c, 0x02, 0x0e,
+    0x07, 0x0c, 0x0f, 0x0b, 0x03, 0x01, 0x0b, 0x0e, 0x0d, 0x05, 0x01, 0x00, 0x0d, 0x04, 0x0f, 0x0f,
+    0x09, 0x08, 0x0e, 0x0f, 0x0e, 0x0a, 0x07, 0x0d, 0x0f, 0x03, 0x01, 0x00, 0x0d, 0x04, 0x0f, 0x0b,
+    0x00, 0x00, 0x06, 0x0f, 0x0d, 0x00, 0x00, 0x04, 0x0f, 0x09, 0x02, 0x00, 0x08, 0x04, 0x0f, 0x07,
+    0x00, 0x00, 0x02, 0x0f, 0x09, 0x03, 0x02, 0x0f, 0x0b, 0x02, 0x00, 0x08, 0x04, 0x0f, 0x06, 0x00,
+    0x00, 0x01, 0x0f, 0x08, 0x03, 0x02, 0x0f, 0x0b, 0x02, 0x00, 0x08, 0x04, 0x0f, 0x06, 0x00, 0x00,
+    0x01, 0x0f, 0x08, 0x03, 0x02, 0x0f, 0x0b, 0x02, 0x00, 0x08, 0x04, 0x0f, 0x06, 0x00, 0x00, 0x01,
+    0x0f, 0x08, 0x03, 0x02, 0x0f, 0x0b, 0x02, 0x00, 0x08, 0x03, 0x0f, 0x06, 0x00, 0x00, 0x01, 0x0f,
+    0x08, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x07, 0x02, 0x0e, 0x06, 0x0b, 0x0e, 0x0e, 0x08, 0x01,
+    0x00, 0x08, 0x04, 0x0f, 0x0f, 0x0b, 0x07, 0x0b, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x0b,
+    0x03, 0x03, 0x0b, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x07, 0x03, 0x03, 0x07, 0x0f, 0x03,
+    0x02, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x06, 0x03, 0x03, 0x06, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f,
+    0x04, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f, 0x03, 0x01, 0x02, 0x06, 0x04,
+    0x0c, 0x0e, 0x0e, 0x0a, 0x02, 0x01, 0x01, 0x08, 0x06, 0x0f, 0x0d, 0x08, 0x09, 0x0f, 0x0f, 0x03,
+    0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x03, 0x02, 0x0f, 0x0c, 0x02, 0x00, 0x03, 0x04, 0x0f,
+    0x05, 0x04, 0x02, 0x0a, 0x0f, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x04, 0x02, 0x0a, 0x0f, 0x02,
+    0x00, 0x03, 0x01, 0x0f, 0x0c, 0x03, 0x03, 0x02, 0x0f, 0x0c, 0x01, 0x01, 0x08, 0x06, 0x0f, 0x0d,
+    0x08, 0x09, 0x0e, 0x0f, 0x03, 0x01, 0x02, 0x06, 0x04, 0x0c, 0x0e, 0x0e, 0x0a, 0x02, 0x01, 0x02,
+    0x06, 0x03, 0x0b, 0x0e, 0x0e, 0x0b, 0x02, 0x01, 0x01, 0x08, 0x05, 0x0f, 0x0d, 0x08, 0x09, 0x0e,
+    0x0f, 0x03, 0x02, 0x01, 0x02, 0x0e, 0x0d, 0x03, 0x03, 0x01, 0x0e, 0x0d, 0x02, 0x00, 0x03, 0x02,
+    0x0f, 0x07, 0x04, 0x03, 0x09, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x07, 0x04, 0x03, 0x09,
+    0x0f, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x0d, 0x03, 0x03, 0x01, 0x0e, 0x0d, 0x01, 0x00, 0x09,
+    0x04, 0x0f, 0x0e, 0x0d, 0x08, 0x09, 0x0e, 0x0f, 0x05, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x06, 0x08,
+    0x0d, 0x0f, 0x0c, 0x04, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06,
+    0x01, 0x00, 0x03, 0x02, 0x0e, 0x03, 0x01, 0x02, 0x06, 0x04, 0x0c, 0x0e, 0x0e, 0x0a, 0x02, 0x01,
+    0x01, 0x08, 0x06, 0x0f, 0x0d, 0x08, 0x09, 0x0e, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c,
+    0x03, 0x03, 0x02, 0x0f, 0x0c, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x05, 0x04, 0x02, 0x0a, 0x0f, 0x02,
+    0x00, 0x03, 0x04, 0x0f, 0x05, 0x04, 0x03, 0x0a, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0c,
+    0x03, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x09, 0x08, 0x0f, 0x0d, 0x08, 0x09, 0x0e, 0x0e,
+    0x0f, 0x01, 0x01, 0x02, 0x08, 0x06, 0x0c, 0x0f, 0x0c, 0x06, 0x09, 0x0f, 0x01, 0x01, 0x07, 0x03,
+    0x09, 0x0f, 0x01, 0x01, 0x07, 0x03, 0x09, 0x0f, 0x01, 0x01, 0x07, 0x02, 0x06, 0x0d, 0x01, 0x02,
+    0x04, 0x07, 0x0d, 0x0f, 0x08, 0x01, 0x01, 0x05, 0x0a, 0x0f, 0x0a, 0x07, 0x02, 0x01, 0x00, 0x03,
+    0x01, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x07, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01,
+    0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x01, 0x00, 0x03, 0x03, 0x0f,
+    0x06, 0x01, 0x01, 0x05, 0x07, 0x0e, 0x0f, 0x0c, 0x06, 0x01, 0x00, 0x06, 0x03, 0x0f, 0x0c, 0x08,
+    0x0b, 0x0c, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x06, 0x01, 0x01, 0x04, 0x0c, 0x0f, 0x0d, 0x07, 0x01,
+    0x02, 0x05, 0x04, 0x0a, 0x0f, 0x0d, 0x01, 0x01, 0x04, 0x03, 0x06, 0x0f, 0x05, 0x01, 0x00, 0x07,
+    0x06, 0x0d, 0x0a, 0x08, 0x0d, 0x0f, 0x02, 0x01, 0x00, 0x06, 0x02, 0x0b, 0x0e, 0x0f, 0x0d, 0x05,
+    0x01, 0x02, 0x02, 0x0d, 0x05, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x08, 0x01, 0x00, 0x05, 0x08, 0x0f,
+    0x0f, 0x0f, 0x0e, 0x01, 0x00, 0x05, 0x02, 0x07, 0x0f, 0x0b, 0x05, 0x01, 0x01, 0x03, 0x01, 0x0f,
+    0x08, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x08, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x08, 0x01, 0x01, 0x03,
+    0x01, 0x0f, 0x08, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x08, 0x01, 0x01, 0x03, 0x01, 0x0f, 0x08, 0x02,
+    0x00, 0x03, 0x02, 0x0e, 0x04, 0x03, 0x03, 0x04, 0x0e, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x06,
+    0x03, 0x03, 0x06, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f, 0x03,
+    0x02, 0x00, 0x03, 0x04, 0x0f, 0x06, 0x03, 0x03, 0x06, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x03, 0x0f,
+    0x07, 0x03, 0x03, 0x07, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0b, 0x03, 0x02, 0x0b, 0x0f,
+    0x01, 0x01, 0x07, 0x09, 0x0f, 0x0b, 0x07, 0x0b, 0x0f, 0x09, 0x01, 0x02, 0x05, 0x07, 0x0d, 0x0f,
+    0x0d, 0x07, 0x02, 0x00, 0x02, 0x09, 0x0b, 0x04, 0x02, 0x05, 0x0e, 0x02, 0x00, 0x03, 0x08, 0x0f,
+    0x05, 0x03, 0x02, 0x0e, 0x0e, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0c, 0x00, 0x00, 0x06, 0x0f, 0x06,
+    0x01, 0x01, 0x06, 0x08, 0x0f, 0x04, 0x00, 0x0d, 0x0e, 0x01, 0x01, 0x06, 0x01, 0x0f, 0x0b, 0x05,
+    0x0f, 0x07, 0x01, 0x02, 0x04, 0x09, 0x0f, 0x0e, 0x0e, 0x01, 0x02, 0x04, 0x01, 0x0f, 0x0f, 0x08,
+    0x01, 0x03, 0x03, 0x09, 0x0e, 0x01, 0x03, 0x00, 0x02, 0x07, 0x0d, 0x03, 0x03, 0x01, 0x0e, 0x06,
+    0x03, 0x02, 0x08, 0x0d, 0x02, 0x00, 0x08, 0x07, 0x0f, 0x05, 0x00, 0x00, 0x08, 0x0f, 0x0d, 0x03,
+    0x02, 0x0f, 0x0c, 0x01, 0x00, 0x0d, 0x01, 0x0f, 0x0b, 0x00, 0x00, 0x0e, 0x0f, 0x0f, 0x04, 0x00,
+    0x06, 0x0f, 0x06, 0x01, 0x01, 0x0b, 0x09, 0x0f, 0x02, 0x04, 0x0f, 0x06, 0x0f, 0x0a, 0x00, 0x0c,
+    0x0e, 0x01, 0x01, 0x0b, 0x02, 0x0f, 0x08, 0x0b, 0x0e, 0x00, 0x09, 0x0f, 0x04, 0x0f, 0x08, 0x01,
+    0x02, 0x0a, 0x0c, 0x0e, 0x0f, 0x08, 0x00, 0x03, 0x0f, 0x0e, 0x0f, 0x01, 0x01, 0x02, 0x09, 0x05,
+    0x0f, 0x0f, 0x02, 0x00, 0x00, 0x0c, 0x0f, 0x0a, 0x02, 0x03, 0x02, 0x0d, 0x0b, 0x03, 0x03, 0x05,
+    0x0f, 0x03, 0x01, 0x00, 0x08, 0x07, 0x0d, 0x01, 0x00, 0x00, 0x01, 0x0c, 0x08, 0x01, 0x00, 0x08,
+    0x04, 0x0f, 0x0d, 0x01, 0x00, 0x0c, 0x0f, 0x05, 0x01, 0x01, 0x06, 0x06, 0x0f, 0x0c, 0x0b, 0x0f,
+    0x07, 0x01, 0x02, 0x04, 0x07, 0x0f, 0x0f, 0x09, 0x01, 0x02, 0x04, 0x07, 0x0f, 0x0f, 0x09, 0x01,
+    0x01, 0x06, 0x06, 0x0f, 0x0c, 0x0a, 0x0f, 0x07, 0x01, 0x00, 0x08, 0x04, 0x0f, 0x0d, 0x00, 0x00,
+    0x0c, 0x0f, 0x05, 0x01, 0x00, 0x08, 0x07, 0x0d, 0x01, 0x00, 0x00, 0x01, 0x0c, 0x08, 0x02, 0x00,
+    0x02, 0x09, 0x0b, 0x04, 0x02, 0x05, 0x0e, 0x02, 0x00, 0x03, 0x08, 0x0f, 0x05, 0x03, 0x02, 0x0e,
+    0x0e, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0d, 0x00, 0x00, 0x06, 0x0f, 0x06, 0x01, 0x01, 0x06, 0x08,
+    0x0f, 0x04, 0x00, 0x0d, 0x0e, 0x01, 0x01, 0x06, 0x01, 0x0f, 0x0c, 0x05, 0x0f, 0x07, 0x01, 0x02,
+    0x04, 0x08, 0x0f, 0x0e, 0x0f, 0x01, 0x02, 0x04, 0x01, 0x0f, 0x0f, 0x08, 0x01, 0x03, 0x03, 0x0c,
+    0x0f, 0x01, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x00, 0x05, 0x02, 0x07, 0x0d, 0x0e, 0x01,
+    0x01, 0x00, 0x04, 0x08, 0x0f, 0x0c, 0x03, 0x03, 0x00, 0x01, 0x06, 0x00, 0x86, 0x00, 0x01, 0x06,
+    0x01, 0x00, 0x08, 0x01, 0x06, 0x06, 0x06, 0x08, 0x0f, 0x0f, 0x02, 0x01, 0x04, 0x03, 0x0d, 0x0f,
+    0x05, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x08, 0x0f, 0x0a, 0x01, 0x01, 0x03,
+    0x05, 0x0f, 0x0c, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x0f, 0x08, 0x06, 0x06, 0x06, 0x01, 0x03, 0x00,
+    0x01, 0x06, 0x00, 0x86, 0x00, 0x01, 0x07, 0x01, 0x01, 0x04, 0x02, 0x0b, 0x0f, 0x0d, 0x01, 0x01,
+    0x04, 0x0c, 0x0f, 0x0c, 0x07, 0x01, 0x01, 0x02, 0x0f, 0x0d, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01,
+    0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00,
+    0x03, 0x01, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x01, 0x03, 0x0f, 0x0e, 0x02,
+    0x01, 0x01, 0x04, 0x09, 0x0f, 0x0f, 0x0d, 0x01, 0x02, 0x03, 0x05, 0x08, 0x07, 0x01, 0x01, 0x02,
+    0x0e, 0x02, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x00,
+    0x03, 0x01, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01,
+    0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x00,
+    0x03, 0x01, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x03, 0x01, 0x01, 0x01, 0x05, 0x01, 0x00,
+    0x04, 0x04, 0x0f, 0x0e, 0x07, 0x01, 0x00, 0x05, 0x02, 0x09, 0x0e, 0x0f, 0x05, 0x01, 0x02, 0x03,
+    0x04, 0x0f, 0x09, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01,
+    0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f,
+    0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x01, 0x0f, 0x0a, 0x01, 0x02, 0x03,
+    0x02, 0x0f, 0x0a, 0x01, 0x02, 0x03, 0x08, 0x0f, 0x08, 0x01, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x0f,
+    0x02, 0x01, 0x00, 0x04, 0x02, 0x09, 0x07, 0x02, 0x00, 0x01, 0x01, 0x09, 0x08, 0x0e, 0x0f, 0x0c,
+    0x06, 0x02, 0x05, 0x0f, 0x01, 0x01, 0x00, 0x09, 0x04, 0x0f, 0x02, 0x01, 0x07, 0x0e, 0x0f, 0x0f,
+    0x09, 0x02, 0x01, 0x01, 0x02, 0x04, 0x02, 0x02, 0x01,
+};
+
+static const uint32_t lts16_atlas_index[] = {
+    0, 0, 60, 92, 196, 325, 454, 566,
+    590, 670, 748, 784, 833, 856, 878, 891,
+    971, 1077, 1136, 1226, 1319, 1402, 1496, 1593,
+    1669, 1778, 1876, 1904, 1943, 1998, 2047, 2102,
+    2174, 2309, 2411, 2535, 2633, 2754, 2846, 2929,
+    3048, 3167, 3232, 3309, 3425, 3499, 3654, 3795,
+    3918, 4023, 4166, 4283, 4383, 4458, 4567, 4669,
+    4832, 4937, 5020, 5105, 5195, 5275, 5367, 5419,
+    5449, 5467, 5558, 5662, 5724, 5828, 5904, 5979,
+    6095, 6200, 6260, 6329, 6425, 6491, 6613, 6700,
+    6782, 6886, 6990, 7041, 7104, 7167, 7250, 7318,
+    7426, 7502, 7591, 7655, 7741, 7822, 7912,
+};
+
+static const glyph_atlas_t lts16_atlas = {
+    .index = lts16_atlas_index,
+    .data = lts16_atlas_data,
+};
+
+static const uint8_t lts18_atlas_data[] = {
+    0x01, 0x01, 0x02, 0x0d, 0x09, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x04, 0x0f,
+    0x0e, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x0e, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0d, 0x01, 0x00, 0x03,
+    0x01, 0x0f, 0x0c, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0b, 0x01, 0x01, 0x02, 0x0f, 0x0b, 0x01, 0x01,
+    0x02, 0x0f, 0x0a, 0x01, 0x01, 0x02, 0x0d, 0x08, 0x01, 0x01, 0x02, 0x06, 0x03, 0x01, 0x00, 0x03,
+    0x03, 0x0f, 0x0e, 0x01, 0x00, 0x03, 0x01, 0x0d, 0x09, 0x01, 0x01, 0x05, 0x0d, 0x06, 0x01, 0x0e,
+    0x05, 0x01, 0x00, 0x06, 0x02, 0x0f, 0x0a, 0x03, 0x0f, 0x08, 0x01, 0x00, 0x06, 0x02, 0x0f, 0x0a,
+    0x03, 0x0f, 0x08, 0x01, 0x00, 0x06, 0x02, 0x0f, 0x0a, 0x03, 0x0f, 0x08, 0x01, 0x00, 0x06, 0x01,
+    0x0a, 0x06, 0x02, 0x0a, 0x05, 0x01, 0x03, 0x06, 0x07, 0x0e, 0x00, 0x00, 0x07, 0x0e, 0x01, 0x03,
+    0x06, 0x0c, 0x0e, 0x00, 0x00, 0x0c, 0x0e, 0x01, 0x03, 0x06, 0x0f, 0x0b, 0x00, 0x00, 0x0f, 0x0b,
+    0x03, 0x01, 0x01, 0x0d, 0x00, 0x87, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x01, 0x0a, 0x09, 0x0d, 0x0f,
+    0x0d, 0x0c, 0x0d, 0x0f, 0x0d, 0x0b, 0x01, 0x01, 0x02, 0x07, 0x07, 0x0f, 0x03, 0x00, 0x07, 0x0f,
+    0x03, 0x01, 0x02, 0x07, 0x09, 0x0f, 0x01, 0x00, 0x09, 0x0f, 0x01, 0x01, 0x00, 0x0a, 0x04, 0x0c,
+    0x0e, 0x0f, 0x0c, 0x0c, 0x0e, 0x0f, 0x0c, 0x05, 0x03, 0x00, 0x01, 0x07, 0x00, 0x88, 0x00, 0x01,
+    0x07, 0x01, 0x01, 0x07, 0x01, 0x0f, 0x09, 0x00, 0x01, 0x0f, 0x09, 0x01, 0x01, 0x07, 0x03, 0x0f,
+    0x07, 0x00, 0x03, 0x0f, 0x07, 0x01, 0x01, 0x07, 0x06, 0x0f, 0x04, 0x00, 0x06, 0x0f, 0x04, 0x01,
+    0x01, 0x07, 0x04, 0x0e, 0x01, 0x00, 0x04, 0x0e, 0x01, 0x00, 0x01, 0x05, 0x02, 0x07, 0x04, 0x01,
+    0x05, 0x02, 0x09, 0x05, 0x01, 0x05, 0x02, 0x0a, 0x04, 0x01, 0x02, 0x07, 0x04, 0x0b, 0x0e, 0x0f,
+    0x0d, 0x09, 0x01, 0x03, 0x01, 0x01, 0x06, 0x00, 0x87, 0x00, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0e,
+    0x0f, 0x08, 0x01, 0x0e, 0x03, 0x09, 0x0f, 0x03, 0x01, 0x00, 0x06, 0x02, 0x0f, 0x0e, 0x00, 0x00,
+    0x0e, 0x01, 0x01, 0x05, 0x0f, 0x0f, 0x03, 0x01, 0x0d, 0x01, 0x01, 0x06, 0x08, 0x0f, 0x0f, 0x0d,
+    0x0d, 0x02, 0x01, 0x02, 0x07, 0x06, 0x0e, 0x0f, 0x0f, 0x0f, 0x0d, 0x04, 0x01, 0x04, 0x06, 0x07,
+    0x0c, 0x0c, 0x0f, 0x0f, 0x04, 0x01, 0x04, 0x06, 0x08, 0x07, 0x00, 0x06, 0x0f, 0x0a, 0x01, 0x00,
+    0x0a, 0x01, 0x05, 0x00, 0x00, 0x09, 0x05, 0x00, 0x04, 0x0f, 0x0c, 0x01, 0x00, 0x0a, 0x06, 0x0f,
+    0x0e, 0x07, 0x0b, 0x05, 0x04, 0x0d, 0x0f, 0x08, 0x03, 0x01, 0x01, 0x0c, 0x00, 0x86, 0x00, 0x01,
+    0x0d, 0x01, 0x02, 0x06, 0x06, 0x0b, 0x0f, 0x0f, 0x0c, 0x08, 0x01, 0x04, 0x01, 0x0f, 0x01, 0x04,
+    0x01, 0x0c, 0x00, 0x02, 0x01, 0x05, 0x05, 0x0d, 0x0f, 0x0c, 0x04, 0x04, 0x03, 0x05, 0x0e, 0x01,
+    0x01, 0x00, 0x0c, 0x02, 0x0f, 0x0c, 0x08, 0x0c, 0x0f, 0x01, 0x00, 0x00, 0x02, 0x0f, 0x0e, 0x01,
+    0x00, 0x0c, 0x06, 0x0f, 0x00, 0x00, 0x01, 0x0f, 0x05, 0x00, 0x00, 0x0c, 0x0f, 0x03, 0x01, 0x00,
+    0x0b, 0x03, 0x0f, 0x06, 0x01, 0x07, 0x0f, 0x02, 0x00, 0x07, 0x0f, 0x08, 0x01, 0x01, 0x09, 0x08,
+    0x0f, 0x0f, 0x0f, 0x07, 0x00, 0x03, 0x0f, 0x0c, 0x02, 0x02, 0x02, 0x01, 0x03, 0x03, 0x03, 0x0d,
+    0x0f, 0x02, 0x01, 0x06, 0x03, 0x09, 0x0f, 0x06, 0x01, 0x05, 0x09, 0x04, 0x0f, 0x0b, 0x00, 0x05,
+    0x0d, 0x0f, 0x0c, 0x02, 0x01, 0x04, 0x0a, 0x01, 0x0e, 0x0e, 0x01, 0x02, 0x0f, 0x09, 0x05, 0x0c,
+    0x0d, 0x01, 0x04, 0x0b, 0x0b, 0x0f, 0x05, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x02, 0x0f, 0x03, 0x01,
+    0x03, 0x0c, 0x06, 0x0f, 0x0a, 0x00, 0x00, 0x07, 0x0e, 0x00, 0x00, 0x03, 0x0f, 0x02, 0x02, 0x02,
+    0x03, 0x02, 0x0f, 0x0e, 0x03, 0x06, 0x02, 0x0f, 0x0c, 0x08, 0x0e, 0x0d, 0x02, 0x02, 0x03, 0x03,
+    0x0e, 0x03, 0x04, 0x05, 0x04, 0x0d, 0x0f, 0x0b, 0x02, 0x01, 0x02, 0x06, 0x04, 0x0b, 0x0e, 0x0f,
+    0x0c, 0x07, 0x03, 0x01, 0x01, 0x07, 0x00, 0x86, 0x00, 0x01, 0x0c, 0x01, 0x01, 0x08, 0x0f, 0x0f,
+    0x06, 0x00, 0x00, 0x03, 0x0a, 0x0c, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x04, 0x0b, 0x0f,
+    0x08, 0x03, 0x03, 0x01, 0x02, 0x01, 0x0c, 0x00, 0x87, 0x00, 0x01, 0x08, 0x01, 0x01, 0x0a, 0x04,
+    0x0e, 0x0f, 0x0f, 0x0d, 0x0d, 0x0e, 0x0f, 0x0e, 0x06, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x05,
+    0x03, 0x03, 0x06, 0x0f, 0x08, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x0a, 0x04, 0x03, 0x06, 0x0f, 0x08,
+    0x02, 0x00, 0x03, 0x06, 0x0f, 0x0a, 0x04, 0x03, 0x06, 0x0f, 0x08, 0x01, 0x00, 0x0a, 0x02, 0x0f,
+    0x0f, 0x06, 0x01, 0x00, 0x03, 0x0c, 0x0f, 0x08, 0x03, 0x01, 0x01, 0x08, 0x00, 0x86, 0x00, 0x02,
+    0x0d, 0x02, 0x01, 0x02, 0x06, 0x05, 0x0b, 0x0e, 0x0e, 0x0c, 0x08, 0x01, 0x01, 0x02, 0x0d, 0x06,
+    0x01, 0x00, 0x03, 0x02, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x02,
+    0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0a, 0x06, 0x01, 0x02, 0x03, 0x01, 0x0d, 0x07, 0x01, 0x02,
+    0x03, 0x09, 0x0f, 0x08, 0x01, 0x01, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x03, 0x08, 0x0f,
+    0x09, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x02, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x01, 0x00, 0x03,
+    0x04, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x06, 0x0f, 0x09, 0x01, 0x00, 0x03, 0x06, 0x0f, 0x08, 0x01,
+    0x00, 0x03, 0x06, 0x0f, 0x09, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f,
+    0x0e, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x02, 0x01, 0x01, 0x03, 0x07, 0x0f, 0x09, 0x01, 0x01, 0x04,
+    0x01, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x01, 0x0d, 0x07,
+    0x01, 0x01, 0x02, 0x08, 0x0c, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x03, 0x0f,
+    0x0e, 0x01, 0x02, 0x03, 0x0c, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x04, 0x0f, 0x0c, 0x01, 0x03, 0x02,
+    0x0f, 0x0f, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0b, 0x0f, 0x04, 0x01, 0x03,
+    0x03, 0x0a, 0x0f, 0x05, 0x01, 0x03, 0x03, 0x0b, 0x0f, 0x04, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03,
+    0x01, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x04, 0x0f, 0x0c, 0x01, 0x02, 0x03, 0x0b, 0x0f,
+    0x06, 0x01, 0x01, 0x03, 0x03, 0x0f, 0x0e, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x07, 0x01, 0x01, 0x02,
+    0x08, 0x0c, 0x01, 0x02, 0x02, 0x05, 0x0b, 0x01, 0x00, 0x06, 0x04, 0x0b, 0x09, 0x0e, 0x08, 0x09,
+    0x01, 0x00, 0x06, 0x02, 0x0c, 0x0f, 0x0f, 0x0f, 0x06, 0x01, 0x00, 0x06, 0x01, 0x0b, 0x0f, 0x0f,
+    0x0e, 0x04, 0x01, 0x00, 0x06, 0x04, 0x0d, 0x0a, 0x0e, 0x0a, 0x0b, 0x01, 0x02, 0x02, 0x06, 0x0d,
+    0x01, 0x03, 0x01, 0x02, 0x01, 0x04, 0x02, 0x0a, 0x01, 0x01, 0x03, 0x03, 0x04, 0x0f, 0x05, 0x01,
+    0x03, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x03, 0x03, 0x04, 0x0f, 0x05, 0x03, 0x00, 0x01, 0x05, 0x00,
+    0x87, 0x00, 0x01, 0x07, 0x01, 0x00, 0x09, 0x03, 0x0c, 0x0c, 0x0d, 0x0f, 0x0d, 0x0c, 0x0c, 0x04,
+    0x01, 0x03, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x03, 0x03, 0x04, 0x0f, 0x05, 0x01, 0x03, 0x03, 0x02,
+    0x0e, 0x03, 0x01, 0x01, 0x02, 0x0b, 0x0c, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x01,
+    0x02, 0x08, 0x0e, 0x01, 0x00, 0x03, 0x02, 0x0d, 0x06, 0x01, 0x00, 0x02, 0x03, 0x04, 0x01, 0x00,
+    0x07, 0x03, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x07, 0x03, 0x00, 0x01, 0x05, 0x00, 0x85, 0x00, 0x01,
+    0x0a, 0x01, 0x01, 0x02, 0x04, 0x04, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x02,
+    0x0b, 0x0c, 0x01, 0x05, 0x03, 0x05, 0x0e, 0x02, 0x01, 0x05, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x0f, 0x0d, 0x01, 0x04, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x04, 0x03, 0x0d, 0x0f, 0x02,
+    0x01, 0x03, 0x03, 0x02, 0x0f, 0x0d, 0x01, 0x03, 0x03, 0x08, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0d,
+    0x0f, 0x02, 0x01, 0x02, 0x03, 0x03, 0x0f, 0x0c, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x06, 0x01, 0x02,
+    0x03, 0x0e, 0x0f, 0x01, 0x01, 0x01, 0x03, 0x04, 0x0f, 0x0b, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x05,
+    0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x0a, 0x0f,
+    0x05, 0x01, 0x00, 0x02, 0x08, 0x0d, 0x01, 0x03, 0x06, 0x02, 0x0a, 0x0d, 0x0e, 0x0a, 0x04, 0x03,
+    0x02, 0x01, 0x04, 0x00, 0x86, 0x00, 0x01, 0x06, 0x01, 0x01, 0x0a, 0x01, 0x0e, 0x0f, 0x09, 0x02,
+    0x01, 0x07, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x03, 0x08, 0x0f, 0x0b, 0x04, 0x03, 0x08, 0x0f, 0x0b,
+    0x02, 0x01, 0x03, 0x0c, 0x0f, 0x03, 0x04, 0x03, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x06, 0x03, 0x0d, 0x0f, 0x02, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x06, 0x03, 0x0c, 0x0f, 0x03, 0x02,
+    0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0d, 0x0f, 0x02, 0x02, 0x01, 0x03, 0x0c, 0x0f, 0x03, 0x04,
+    0x03, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x03, 0x08, 0x0f, 0x0a, 0x04, 0x03, 0x08, 0x0f, 0x0b, 0x01,
+    0x01, 0x0a, 0x01, 0x0f, 0x0f, 0x09, 0x01, 0x01, 0x07, 0x0f, 0x0f, 0x03, 0x03, 0x02, 0x01, 0x04,
+    0x00, 0x86, 0x00, 0x01, 0x07, 0x01, 0x03, 0x06, 0x02, 0x0a, 0x0d, 0x0e, 0x0a, 0x04, 0x01, 0x00,
+    0x05, 0x08, 0x0f, 0x0f, 0x0f, 0x04, 0x01, 0x00, 0x05, 0x08, 0x0f, 0x0f, 0x0f, 0x08, 0x01, 0x02,
+    0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x08,
+    0x01, 0x02, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x07,
+    0x0f, 0x08, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x02,
+    0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x02, 0x03, 0x06, 0x0f, 0x07,
+    0x01, 0x02, 0x06, 0x06, 0x0c, 0x0e, 0x0e, 0x0b, 0x02, 0x03, 0x01, 0x01, 0x0b, 0x00, 0x86, 0x00,
+    0x01, 0x03, 0x01, 0x00, 0x09, 0x02, 0x0f, 0x0d, 0x04, 0x00, 0x02, 0x0a, 0x0f, 0x0b, 0x02, 0x01,
+    0x01, 0x03, 0x04, 0x03, 0x01, 0x0f, 0x0e, 0x01, 0x06, 0x03, 0x03, 0x0f, 0x0d, 0x01, 0x06, 0x03,
+    0x0b, 0x0f, 0x07, 0x01, 0x05, 0x03, 0x08, 0x0f, 0x0c, 0x01, 0x04, 0x04, 0x08, 0x0f, 0x0d, 0x01,
+    0x01, 0x03, 0x04, 0x08, 0x0f, 0x0d, 0x01, 0x01, 0x02, 0x04, 0x07, 0x0f, 0x0d, 0x01, 0x01, 0x01,
+    0x04, 0x07, 0x0f, 0x0d, 0x01, 0x03, 0x00, 0x01, 0x04, 0x00, 0x87, 0x00, 0x02, 0x0e, 0x02, 0x03,
+    0x00, 0x01, 0x04, 0x00, 0x87, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x02, 0x06, 0x07, 0x0c, 0x0f, 0x0e,
+    0x0b, 0x03, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x01, 0x08, 0x0c, 0x0a,
+    0x03, 0x00, 0x02, 0x09, 0x0f, 0x0c, 0x01, 0x06, 0x03, 0x01, 0x0f, 0x0d, 0x01, 0x05, 0x04, 0x03,
+    0x0a, 0x0f, 0x08, 0x01, 0x03, 0x05, 0x09, 0x0f, 0x0f, 0x0f, 0x0a, 0x01, 0x03, 0x06, 0x07, 0x0d,
+    0x0f, 0x0f, 0x0c, 0x01, 0x01, 0x06, 0x03, 0x07, 0x0f, 0x0c, 0x01, 0x07, 0x03, 0x0e, 0x0f, 0x01,
+    0x02, 0x01, 0x01, 0x04, 0x05, 0x02, 0x0e, 0x0f, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x0e, 0x05, 0x00,
+    0x01, 0x09, 0x0f, 0x0d, 0x03, 0x01, 0x01, 0x0c, 0x00, 0x86, 0x00, 0x01, 0x03, 0x01, 0x02, 0x06,
+    0x06, 0x0c, 0x0e, 0x0e, 0x0b, 0x02, 0x01, 0x04, 0x03, 0x01, 0x0d, 0x08, 0x01, 0x04, 0x03, 0x0a,
+    0x0f, 0x08, 0x01, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x05, 0x01, 0x02,
+    0x07, 0x06, 0x0f, 0x0b, 0x00, 0x00, 0x01, 0x05, 0x01, 0x02, 0x08, 0x0e, 0x0f, 0x02, 0x00, 0x00,
+    0x0a, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x08, 0x0f, 0x08, 0x03, 0x03, 0x0a, 0x0f, 0x04, 0x03, 0x00,
+    0x01, 0x01, 0x00, 0x88, 0x00, 0x01, 0x04, 0x03, 0x00, 0x01, 0x03, 0x00, 0x88, 0x00, 0x01, 0x04,
+    0x01, 0x07, 0x03, 0x0b, 0x0f, 0x04, 0x01, 0x07, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x07, 0x03, 0x0a,
+    0x0f, 0x04, 0x01, 0x07, 0x03, 0x0a, 0x0f, 0x04, 0x03, 0x01, 0x01, 0x07, 0x00, 0x86, 0x00, 0x01,
+    0x05, 0x03, 0x01, 0x01, 0x0b, 0x00, 0x86, 0x00, 0x01, 0x05, 0x01, 0x01, 0x03, 0x0b, 0x0f, 0x04,
+    0x01, 0x01, 0x03, 0x0b, 0x0f, 0x04, 0x01, 0x01, 0x07, 0x0b, 0x0f, 0x0f, 0x0f, 0x0d, 0x0a, 0x02,
+    0x01, 0x01, 0x08, 0x07, 0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0x05, 0x01, 0x06, 0x03, 0x07, 0x0f,
+    0x0e, 0x01, 0x07, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x07, 0x03, 0x09, 0x0f, 0x05, 0x02, 0x01, 0x01,
+    0x05, 0x05, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x00, 0x09, 0x03, 0x0f, 0x0e, 0x05, 0x00, 0x01, 0x09,
+    0x0f, 0x0d, 0x03, 0x01, 0x01, 0x0b, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x02, 0x06, 0x06, 0x0c,
+    0x0e, 0x0e, 0x0a, 0x02, 0x01, 0x04, 0x03, 0x01, 0x0c, 0x09, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x08,
+    0x01, 0x03, 0x03, 0x04, 0x0f, 0x0c, 0x01, 0x02, 0x04, 0x01, 0x0e, 0x0f, 0x02, 0x01, 0x02, 0x06,
+    0x09, 0x0f, 0x0e, 0x0e, 0x0d, 0x08, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f,
+    0x0c, 0x01, 0x01, 0x09, 0x0c, 0x0f, 0x08, 0x00, 0x00, 0x03, 0x0e, 0x0f, 0x05, 0x02, 0x00, 0x03,
+    0x01, 0x0f, 0x0e, 0x04, 0x03, 0x06, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0b, 0x04, 0x03,
+    0x03, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x04, 0x03, 0x06, 0x0f, 0x09, 0x01, 0x01,
+    0x09, 0x0d, 0x0f, 0x09, 0x00, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x01, 0x08, 0x03, 0x0f, 0x0f,
+    0x0f, 0x0e, 0x0f, 0x0f, 0x09, 0x01, 0x02, 0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0c, 0x06, 0x03, 0x00,
+    0x01, 0x05, 0x00, 0x88, 0x00, 0x01, 0x05, 0x03, 0x00, 0x01, 0x05, 0x00, 0x88, 0x00, 0x01, 0x05,
+    0x01, 0x06, 0x03, 0x04, 0x0f, 0x0d, 0x01, 0x06, 0x03, 0x0c, 0x0f, 0x05, 0x01, 0x05, 0x03, 0x05,
+    0x0f, 0x0c, 0x01, 0x05, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x04, 0x03, 0x07, 0x0f, 0x0b, 0x01, 0x03,
+    0x04, 0x01, 0x0e, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x08, 0x0f, 0x0a, 0x01, 0x02, 0x04, 0x01, 0x0f,
+    0x0f, 0x02, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x09, 0x01, 0x01, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01,
+    0x01, 0x03, 0x01, 0x0e, 0x07, 0x01, 0x02, 0x06, 0x05, 0x0c, 0x0f, 0x0e, 0x0a, 0x02, 0x03, 0x01,
+    0x01, 0x07, 0x00, 0x86, 0x00, 0x01, 0x02, 0x01, 0x01, 0x08, 0x0f, 0x0f, 0x06, 0x01, 0x02, 0x0a,
+    0x0f, 0x09, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x03, 0x03, 0x03, 0x0f, 0x0b, 0x01, 0x01, 0x08,
+    0x0c, 0x0f, 0x07, 0x01, 0x03, 0x0b, 0x0f, 0x07, 0x03, 0x01, 0x02, 0x01, 0x0d, 0x00, 0x84, 0x00,
+    0x01, 0x09, 0x01, 0x01, 0x08, 0x03, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x0c, 0x01, 0x01, 0x00, 0x09,
+    0x01, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x08, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x09, 0x04,
+    0x03, 0x0e, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x09, 0x04, 0x03, 0x0e, 0x0f, 0x01, 0x01,
+    0x00, 0x09, 0x03, 0x0f, 0x0f, 0x05, 0x00, 0x01, 0x09, 0x0f, 0x0d, 0x03, 0x01, 0x01, 0x09, 0x00,
+    0x86, 0x00, 0x01, 0x04, 0x01, 0x02, 0x06, 0x06, 0x0c, 0x0f, 0x0e, 0x0b, 0x03, 0x01, 0x02, 0x06,
+    0x01, 0x0a, 0x0d, 0x0f, 0x0c, 0x06, 0x01, 0x01, 0x08, 0x03, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f,
+    0x0a, 0x01, 0x01, 0x09, 0x0d, 0x0f, 0x09, 0x00, 0x00, 0x03, 0x0e, 0x0f, 0x05, 0x02, 0x00, 0x03,
+    0x01, 0x0f, 0x0e, 0x04, 0x03, 0x06, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0b, 0x04, 0x03,
+    0x03, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x04, 0x03, 0x07, 0x0f, 0x09, 0x01, 0x01,
+    0x09, 0x0c, 0x0f, 0x0b, 0x02, 0x00, 0x05, 0x0f, 0x0f, 0x04, 0x03, 0x01, 0x02, 0x03, 0x0e, 0x00,
+    0x85, 0x00, 0x01, 0x0c, 0x01, 0x02, 0x07, 0x01, 0x09, 0x0c, 0x0b, 0x0f, 0x0f, 0x02, 0x01, 0x05,
+    0x03, 0x0b, 0x0f, 0x07, 0x01, 0x04, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x04, 0x01, 0x0f, 0x0f,
+    0x02, 0x01, 0x03, 0x03, 0x02, 0x0e, 0x06, 0x01, 0x01, 0x02, 0x04, 0x04, 0x01, 0x00, 0x04, 0x01,
+    0x0f, 0x0f, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x04,
+    0x04, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x0c, 0x01, 0x01, 0x02,
+    0x04, 0x04, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x0b, 0x0c, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x01,
+    0x02, 0x08, 0x0e, 0x01, 0x00, 0x03, 0x02, 0x0d, 0x06, 0x01, 0x00, 0x02, 0x03, 0x04, 0x01, 0x05,
+    0x03, 0x01, 0x0a, 0x05, 0x01, 0x04, 0x04, 0x04, 0x0e, 0x0f, 0x07, 0x01, 0x03, 0x04, 0x08, 0x0f,
+    0x0f, 0x06, 0x01, 0x01, 0x05, 0x02, 0x0c, 0x0f, 0x0d, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x0f,
+    0x09, 0x01, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x06, 0x01, 0x01, 0x05, 0x03, 0x0e, 0x0f, 0x0a, 0x01,
+    0x01, 0x02, 0x05, 0x01, 0x0b, 0x0f, 0x0e, 0x03, 0x01, 0x04, 0x04, 0x06, 0x0f, 0x0f, 0x05, 0x01,
+    0x05, 0x03, 0x03, 0x0d, 0x07, 0x03, 0x00, 0x01, 0x05, 0x00, 0x87, 0x00, 0x01, 0x07, 0x01, 0x00,
+    0x09, 0x03, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x00, 0x00, 0x03, 0x00, 0x01, 0x05,
+    0x00, 0x87, 0x00, 0x01, 0x07, 0x01, 0x00, 0x09, 0x03, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x04, 0x01, 0x00, 0x03, 0x02, 0x0b, 0x03, 0x01, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x07, 0x01, 0x01,
+    0x05, 0x03, 0x0d, 0x0f, 0x0b, 0x01, 0x01, 0x03, 0x04, 0x0a, 0x0f, 0x0e, 0x04, 0x01, 0x04, 0x04,
+    0x05, 0x0f, 0x0f, 0x06, 0x01, 0x04, 0x04, 0x03, 0x0e, 0x0f, 0x07, 0x01, 0x03, 0x04, 0x07, 0x0f,
+    0x0f, 0x07, 0x01, 0x01, 0x05, 0x01, 0x0b, 0x0f, 0x0d, 0x03, 0x01, 0x00, 0x04, 0x02, 0x0e, 0x0f,
+    0x0a, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x06, 0x01, 0x01, 0x07, 0x02, 0x0a, 0x0d, 0x0f, 0x0e, 0x09,
+    0x01, 0x03, 0x00, 0x01, 0x05, 0x00, 0x86, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x09, 0x05, 0x0b, 0x06,
+    0x01, 0x00, 0x02, 0x0d, 0x0f, 0x04, 0x01, 0x05, 0x04, 0x02, 0x0e, 0x0f, 0x03, 0x01, 0x04, 0x04,
+    0x05, 0x0f, 0x0f, 0x06, 0x01, 0x03, 0x04, 0x02, 0x0f, 0x0e, 0x03, 0x01, 0x03, 0x03, 0x07, 0x0f,
+    0x03, 0x01, 0x03, 0x02, 0x08, 0x0f, 0x01, 0x03, 0x02, 0x06, 0x0d, 0x00, 0x01, 0x03, 0x02, 0x02,
+    0x06, 0x01, 0x03, 0x03, 0x0d, 0x0f, 0x05, 0x01, 0x03, 0x03, 0x08, 0x0d, 0x02, 0x01, 0x04, 0x07,
+    0x06, 0x0a, 0x0d, 0x0f, 0x0c, 0x0a, 0x03, 0x01, 0x02, 0x0a, 0x02, 0x0c, 0x0f, 0x0b, 0x08, 0x07,
+    0x09, 0x0c, 0x0f, 0x0a, 0x02, 0x02, 0x03, 0x0c, 0x0d, 0x03, 0x05, 0x03, 0x04, 0x0e, 0x0a, 0x01,
+    0x01, 0x0d, 0x07, 0x0f, 0x02, 0x02, 0x0b, 0x0f, 0x0d, 0x04, 0x0d, 0x03, 0x04, 0x0f, 0x04, 0x01,
+    0x01, 0x0d, 0x0d, 0x08, 0x00, 0x0d, 0x0d, 0x06, 0x05, 0x0d, 0x0f, 0x04, 0x00, 0x0d, 0x08, 0x01,
+    0x01, 0x0d, 0x0f, 0x04, 0x03, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x0f, 0x04, 0x00, 0x0a, 0x0a, 0x01,
+    0x00, 0x0e, 0x02, 0x0f, 0x02, 0x04, 0x0f, 0x01, 0x00, 0x00, 0x01, 0x0f, 0x04, 0x00, 0x0c, 0x08,
+    0x01, 0x01, 0x0d, 0x0f, 0x04, 0x00, 0x0e, 0x0a, 0x01, 0x01, 0x0a, 0x0f, 0x05, 0x06, 0x0f, 0x03,
+    0x01, 0x01, 0x0c, 0x0d, 0x08, 0x00, 0x04, 0x0e, 0x0f, 0x0f, 0x09, 0x0f, 0x0f, 0x0f, 0x06, 0x01,
+    0x01, 0x0a, 0x07, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x0d,
+    0x0d, 0x03, 0x05, 0x01, 0x01, 0x01, 0x02, 0x09, 0x02, 0x0c, 0x0f, 0x0b, 0x08, 0x06, 0x09, 0x0e,
+    0x0d, 0x01, 0x04, 0x07, 0x06, 0x0a, 0x0d, 0x0f, 0x0d, 0x09, 0x02, 0x01, 0x05, 0x03, 0x03, 0x0e,
+    0x08, 0x01, 0x05, 0x04, 0x0b, 0x0f, 0x0f, 0x02, 0x01, 0x04, 0x05, 0x02, 0x0f, 0x0f, 0x0f, 0x08,
+    0x01, 0x04, 0x05, 0x09, 0x0f, 0x08, 0x0f, 0x0f, 0x01, 0x03, 0x07, 0x01, 0x0f, 0x0f, 0x01, 0x09,
+    0x0f, 0x06, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x09, 0x00, 0x03, 0x0f, 0x0d, 0x01, 0x03, 0x08, 0x0d,
+    0x0f, 0x03, 0x00, 0x00, 0x0c, 0x0f, 0x04, 0x02, 0x02, 0x03, 0x04, 0x0f, 0x0c, 0x03, 0x03, 0x05,
+    0x0f, 0x0b, 0x01, 0x02, 0x0a, 0x0b, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x02, 0x03,
+    0x01, 0x01, 0x02, 0x00, 0x89, 0x00, 0x01, 0x08, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x09, 0x05, 0x03,
+    0x03, 0x0f, 0x0e, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x03, 0x06, 0x03, 0x0d, 0x0f, 0x06, 0x02, 0x00,
+    0x03, 0x05, 0x0f, 0x0d, 0x07, 0x03, 0x06, 0x0f, 0x0b, 0x03, 0x01, 0x01, 0x0b, 0x00, 0x84, 0x00,
+    0x03, 0x0e, 0x0b, 0x03, 0x02, 0x01, 0x88, 0x00, 0x01, 0x04, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03,
+    0x04, 0x01, 0x0a, 0x0f, 0x0c, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x04, 0x03, 0x01, 0x0f, 0x0e, 0x02,
+    0x01, 0x02, 0x0f, 0x0f, 0x04, 0x03, 0x06, 0x0f, 0x0b, 0x01, 0x01, 0x09, 0x0f, 0x0f, 0x0b, 0x0b,
+    0x0c, 0x0d, 0x0f, 0x0e, 0x01, 0x02, 0x01, 0x88, 0x00, 0x01, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x04, 0x04, 0x03, 0x0d, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x06, 0x0f, 0x07,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x06, 0x0f, 0x0a, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x04,
+    0x04, 0x03, 0x0e, 0x0f, 0x06, 0x02, 0x01, 0x88, 0x00, 0x01, 0x0d, 0x02, 0x01, 0x86, 0x00, 0x02,
+    0x0d, 0x09, 0x01, 0x04, 0x07, 0x06, 0x0a, 0x0d, 0x0f, 0x0c, 0x08, 0x01, 0x03, 0x02, 0x02, 0x02,
+    0x0c, 0x00, 0x87, 0x00, 0x01, 0x05, 0x01, 0x02, 0x0a, 0x0d, 0x0f, 0x0d, 0x05, 0x01, 0x00, 0x03,
+    0x0a, 0x0f, 0x0e, 0x02, 0x01, 0x03, 0x08, 0x0f, 0x0d, 0x06, 0x02, 0x02, 0x04, 0x01, 0x01, 0x03,
+    0x0e, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x0c, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0e, 0x01, 0x01, 0x03, 0x0e, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x08, 0x0f,
+    0x0c, 0x06, 0x02, 0x02, 0x04, 0x01, 0x02, 0x0a, 0x0d, 0x0f, 0x0d, 0x05, 0x01, 0x00, 0x03, 0x0a,
+    0x0f, 0x0e, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x87, 0x00, 0x01, 0x05, 0x01, 0x04, 0x07, 0x06,
+    0x0b, 0x0d, 0x0f, 0x0c, 0x09, 0x01, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x84, 0x00, 0x03, 0x0c, 0x09,
+    0x03, 0x02, 0x01, 0x88, 0x00, 0x01, 0x08, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03, 0x05, 0x03, 0x08,
+    0x0f, 0x0f, 0x08, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x04, 0x04, 0x0f, 0x0f, 0x02, 0x02, 0x01,
+    0x02, 0x0f, 0x0f, 0x06, 0x03, 0x09, 0x0f, 0x08, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x04,
+    0x0f, 0x0b, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x02, 0x0f, 0x0d, 0x02, 0x01, 0x02, 0x0f,
+    0x0f, 0x06, 0x03, 0x04, 0x0f, 0x0b, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x09, 0x0f, 0x08,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x04, 0x04, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x03, 0x05, 0x03, 0x08, 0x0f, 0x0f, 0x08, 0x02, 0x01, 0x88, 0x00, 0x01, 0x08, 0x03, 0x01, 0x01,
+    0x0d, 0x00, 0x84, 0x00, 0x03, 0x0d, 0x09, 0x03, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x87, 0x00, 0x01,
+    0x04, 0x02, 0x01, 0x88, 0x00, 0x01, 0x05, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f,
+    0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x08, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x0b, 0x02, 0x01, 0x87, 0x00, 0x01, 0x0d, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f,
+    0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x02, 0x01, 0x88, 0x00, 0x01,
+    0x05, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x87, 0x00, 0x01, 0x04, 0x03, 0x01, 0x01, 0x0d, 0x00, 0x87,
+    0x00, 0x01, 0x04, 0x02, 0x01, 0x88, 0x00, 0x01, 0x05, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01,
+    0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x08, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x0b, 0x02, 0x01, 0x87, 0x00, 0x01, 0x0d, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01,
+    0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02,
+    0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01, 0x04, 0x07, 0x06, 0x0a, 0x0d, 0x0f, 0x0c, 0x09,
+    0x02, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x87, 0x00, 0x01, 0x07, 0x01, 0x02, 0x0a, 0x0d, 0x0f,
+    0x0d, 0x05, 0x01, 0x00, 0x02, 0x07, 0x0e, 0x0d, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x0d, 0x01, 0x01,
+    0x03, 0x0e, 0x0f, 0x03, 0x04, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x04, 0x01, 0x0c, 0x00, 0x84, 0x00,
+    0x01, 0x0e, 0x04, 0x00, 0x03, 0x03, 0x0f, 0x0c, 0x04, 0x01, 0x0c, 0x00, 0x85, 0x00, 0x01, 0x02,
+    0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x07, 0x03, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x03, 0x0e, 0x0f,
+    0x03, 0x06, 0x03, 0x04, 0x0f, 0x0d, 0x02, 0x01, 0x03, 0x08, 0x0f, 0x0c, 0x06, 0x03, 0x0d, 0x0f,
+    0x06, 0x01, 0x02, 0x0a, 0x0d, 0x0f, 0x0d, 0x05, 0x01, 0x00, 0x04, 0x0d, 0x0f, 0x0d, 0x03, 0x02,
+    0x02, 0x02, 0x0c, 0x00, 0x86, 0x00, 0x02, 0x0c, 0x02, 0x01, 0x04, 0x06, 0x06, 0x0b, 0x0d, 0x0f,
+    0x0d, 0x08, 0x02, 0x01, 0x02, 0x0b, 0x0b, 0x06, 0x03, 0x06, 0x0e, 0x02, 0x02, 0x01, 0x02, 0x0f,
+    0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x05,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06,
+    0x03, 0x0a, 0x0f, 0x05, 0x01, 0x01, 0x0b, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f,
+    0x0f, 0x05, 0x02, 0x01, 0x8a, 0x00, 0x01, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0a,
+    0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f,
+    0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x05,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x06,
+    0x03, 0x09, 0x0f, 0x04, 0x01, 0x01, 0x02, 0x0b, 0x0a, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01,
+    0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02,
+    0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f,
+    0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f,
+    0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x06, 0x03, 0x06, 0x0e, 0x02, 0x01, 0x06, 0x03, 0x0a, 0x0f,
+    0x05, 0x01, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x01, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x01, 0x06, 0x03,
+    0x0a, 0x0f, 0x05, 0x01, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x01, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x01,
+    0x06, 0x03, 0x0a, 0x0f, 0x05, 0x01, 0x06, 0x03, 0x0a, 0x0f, 0x05, 0x01, 0x06, 0x03, 0x0d, 0x0f,
+    0x03, 0x01, 0x00, 0x08, 0x06, 0x0f, 0x08, 0x01, 0x00, 0x07, 0x0f, 0x0e, 0x03, 0x00, 0x01, 0x03,
+    0x00, 0x86, 0x00, 0x01, 0x06, 0x01, 0x01, 0x06, 0x02, 0x0a, 0x0d, 0x0f, 0x0c, 0x05, 0x02, 0x01,
+    0x02, 0x0b, 0x0a, 0x04, 0x03, 0x02, 0x0d, 0x07, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03, 0x04, 0x02,
+    0x0e, 0x0f, 0x06, 0x01, 0x01, 0x08, 0x0f, 0x0f, 0x00, 0x00, 0x02, 0x0e, 0x0f, 0x08, 0x01, 0x01,
+    0x07, 0x0f, 0x0f, 0x00, 0x01, 0x0d, 0x0f, 0x08, 0x01, 0x01, 0x06, 0x0f, 0x0f, 0x01, 0x0d, 0x0f,
+    0x08, 0x01, 0x01, 0x06, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x06, 0x0f, 0x0f, 0x0f,
+    0x0e, 0x0f, 0x0b, 0x01, 0x01, 0x07, 0x0f, 0x0f, 0x09, 0x01, 0x0e, 0x0f, 0x06, 0x01, 0x01, 0x08,
+    0x0f, 0x0f, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03, 0x03, 0x08,
+    0x0f, 0x0c, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x04, 0x03, 0x0d, 0x0f, 0x07, 0x02, 0x01, 0x02, 0x0f,
+    0x0f, 0x04, 0x04, 0x03, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x06, 0x0e,
+    0x01, 0x01, 0x01, 0x02, 0x0b, 0x0b, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f,
+    0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01,
+    0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01,
+    0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x02, 0x01, 0x88, 0x00, 0x01, 0x05, 0x03, 0x01,
+    0x01, 0x0d, 0x00, 0x87, 0x00, 0x01, 0x04, 0x02, 0x01, 0x03, 0x03, 0x0e, 0x07, 0x06, 0x03, 0x02,
+    0x0d, 0x0a, 0x02, 0x01, 0x04, 0x08, 0x0f, 0x0f, 0x01, 0x05, 0x03, 0x09, 0x0f, 0x0f, 0x02, 0x01,
+    0x04, 0x0a, 0x0f, 0x0f, 0x06, 0x05, 0x04, 0x0e, 0x0f, 0x0f, 0x01, 0x02, 0x01, 0x04, 0x0b, 0x0f,
+    0x0f, 0x0c, 0x04, 0x05, 0x05, 0x0f, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x05, 0x0c, 0x0f, 0x0c, 0x0f,
+    0x02, 0x03, 0x05, 0x0b, 0x0f, 0x0c, 0x0f, 0x03, 0x01, 0x01, 0x0d, 0x0e, 0x0f, 0x05, 0x0f, 0x08,
+    0x00, 0x00, 0x01, 0x0f, 0x0c, 0x09, 0x0f, 0x05, 0x01, 0x01, 0x0d, 0x0f, 0x0f, 0x00, 0x0e, 0x0e,
+    0x00, 0x00, 0x07, 0x0f, 0x06, 0x08, 0x0f, 0x06, 0x01, 0x00, 0x0e, 0x01, 0x0f, 0x0d, 0x00, 0x09,
+    0x0f, 0x04, 0x00, 0x0d, 0x0f, 0x00, 0x07, 0x0f, 0x08, 0x01, 0x00, 0x0e, 0x02, 0x0f, 0x0c, 0x00,
+    0x03, 0x0f, 0x0a, 0x03, 0x0f, 0x0a, 0x00, 0x05, 0x0f, 0x09, 0x01, 0x00, 0x0e, 0x03, 0x0f, 0x0b,
+    0x00, 0x00, 0x0d, 0x0f, 0x0a, 0x0f, 0x04, 0x00, 0x04, 0x0f, 0x0a, 0x01, 0x00, 0x0e, 0x05, 0x0f,
+    0x0a, 0x00, 0x00, 0x07, 0x0f, 0x0f, 0x0e, 0x00, 0x00, 0x03, 0x0f, 0x0c, 0x01, 0x00, 0x0e, 0x06,
+    0x0f, 0x09, 0x00, 0x00, 0x01, 0x0f, 0x0f, 0x08, 0x00, 0x00, 0x02, 0x0f, 0x0d, 0x03, 0x00, 0x03,
+    0x07, 0x0f, 0x07, 0x03, 0x03, 0x09, 0x0e, 0x02, 0x03, 0x02, 0x0f, 0x0e, 0x02, 0x01, 0x03, 0x0b,
+    0x0c, 0x01, 0x05, 0x03, 0x04, 0x0e, 0x03, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x0b, 0x05, 0x03, 0x08,
+    0x0f, 0x07, 0x02, 0x01, 0x04, 0x0f, 0x0f, 0x0f, 0x06, 0x04, 0x03, 0x08, 0x0f, 0x07, 0x03, 0x01,
+    0x84, 0x00, 0x01, 0x03, 0x03, 0x03, 0x08, 0x0f, 0x07, 0x02, 0x01, 0x05, 0x0f, 0x0f, 0x06, 0x0f,
+    0x0d, 0x03, 0x03, 0x08, 0x0f, 0x07, 0x01, 0x01, 0x0b, 0x0f, 0x0f, 0x00, 0x0b, 0x0f, 0x09, 0x00,
+    0x00, 0x08, 0x0f, 0x07, 0x01, 0x01, 0x0b, 0x0f, 0x0f, 0x00, 0x01, 0x0e, 0x0f, 0x05, 0x00, 0x08,
+    0x0f, 0x07, 0x01, 0x01, 0x0b, 0x0f, 0x0f, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x02, 0x08, 0x0f, 0x07,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03, 0x06, 0x08, 0x0f, 0x0c, 0x08, 0x0f, 0x07, 0x02, 0x01, 0x02,
+    0x0f, 0x0f, 0x04, 0x05, 0x0c, 0x0f, 0x0e, 0x0f, 0x07, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x04, 0x05,
+    0x02, 0x0f, 0x0f, 0x0f, 0x07, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x04, 0x05, 0x0f, 0x0f, 0x07,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x08, 0x0f, 0x07, 0x01, 0x04, 0x07, 0x06, 0x0a, 0x0d,
+    0x0e, 0x0c, 0x09, 0x01, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x87, 0x00, 0x01, 0x06, 0x01, 0x02,
+    0x0b, 0x0d, 0x0f, 0x0d, 0x05, 0x01, 0x00, 0x03, 0x0a, 0x0f, 0x0f, 0x04, 0x02, 0x01, 0x03, 0x08,
+    0x0f, 0x0d, 0x06, 0x03, 0x07, 0x0f, 0x0e, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x03, 0x07, 0x03, 0x0c,
+    0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x08, 0x03, 0x08, 0x0f, 0x07, 0x02, 0x00, 0x03,
+    0x03, 0x0f, 0x0c, 0x08, 0x03, 0x06, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x08, 0x03,
+    0x08, 0x0f, 0x07, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x03, 0x07, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x01,
+    0x03, 0x08, 0x0f, 0x0c, 0x06, 0x03, 0x07, 0x0f, 0x0e, 0x01, 0x02, 0x0b, 0x0d, 0x0f, 0x0d, 0x05,
+    0x01, 0x00, 0x03, 0x0a, 0x0f, 0x0f, 0x04, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x87, 0x00, 0x01,
+    0x06, 0x01, 0x04, 0x07, 0x06, 0x0b, 0x0d, 0x0f, 0x0c, 0x09, 0x01, 0x03, 0x01, 0x01, 0x0b, 0x00,
+    0x84, 0x00, 0x03, 0x0e, 0x0b, 0x03, 0x02, 0x01, 0x88, 0x00, 0x01, 0x05, 0x02, 0x01, 0x02, 0x0f,
+    0x0f, 0x03, 0x04, 0x02, 0x09, 0x0f, 0x0e, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f,
+    0x04, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x09, 0x0f, 0x06, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03, 0x04, 0x01, 0x09, 0x0f, 0x0e,
+    0x02, 0x01, 0x88, 0x00, 0x01, 0x05, 0x02, 0x01, 0x85, 0x00, 0x03, 0x0e, 0x0b, 0x03, 0x01, 0x01,
+    0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02,
+    0x0f, 0x0f, 0x01, 0x04, 0x07, 0x06, 0x0a, 0x0d, 0x0e, 0x0c, 0x09, 0x01, 0x03, 0x02, 0x02, 0x02,
+    0x0c, 0x00, 0x87, 0x00, 0x01, 0x06, 0x01, 0x02, 0x0b, 0x0d, 0x0f, 0x0e, 0x05, 0x01, 0x00, 0x03,
+    0x0a, 0x0f, 0x0f, 0x04, 0x02, 0x01, 0x03, 0x08, 0x0f, 0x0d, 0x06, 0x03, 0x07, 0x0f, 0x0e, 0x02,
+    0x01, 0x03, 0x0e, 0x0f, 0x03, 0x07, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e,
+    0x08, 0x03, 0x08, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0c, 0x08, 0x03, 0x06, 0x0f, 0x09,
+    0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x08, 0x03, 0x08, 0x0f, 0x08, 0x02, 0x01, 0x03, 0x0e, 0x0f,
+    0x03, 0x07, 0x03, 0x0c, 0x0f, 0x05, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x0c, 0x06, 0x03, 0x06, 0x0f,
+    0x0e, 0x01, 0x01, 0x0c, 0x01, 0x0e, 0x0f, 0x0d, 0x04, 0x00, 0x00, 0x02, 0x09, 0x0f, 0x0f, 0x06,
+    0x03, 0x02, 0x02, 0x03, 0x0d, 0x00, 0x87, 0x00, 0x01, 0x07, 0x01, 0x04, 0x07, 0x08, 0x0b, 0x0e,
+    0x0f, 0x0f, 0x09, 0x03, 0x01, 0x07, 0x04, 0x0d, 0x0f, 0x07, 0x01, 0x01, 0x07, 0x06, 0x04, 0x0f,
+    0x0f, 0x0f, 0x0e, 0x01, 0x01, 0x08, 0x04, 0x02, 0x08, 0x0b, 0x0a, 0x03, 0x01, 0x01, 0x0b, 0x00,
+    0x85, 0x00, 0x02, 0x0c, 0x05, 0x02, 0x01, 0x88, 0x00, 0x01, 0x07, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x03, 0x04, 0x01, 0x06, 0x0f, 0x0f, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x0b, 0x0f, 0x03,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03,
+    0x04, 0x01, 0x06, 0x0f, 0x0f, 0x02, 0x01, 0x88, 0x00, 0x01, 0x07, 0x02, 0x01, 0x87, 0x00, 0x01,
+    0x06, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x03, 0x03, 0x0c, 0x0f, 0x08, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x03, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x04, 0x03, 0x0a, 0x0f, 0x0a,
+    0x02, 0x01, 0x02, 0x0f, 0x0f, 0x04, 0x04, 0x02, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x05, 0x03, 0x07, 0x0e, 0x01, 0x01, 0x02, 0x07, 0x03, 0x0b, 0x0d, 0x0f, 0x0d, 0x09, 0x01, 0x03,
+    0x01, 0x01, 0x05, 0x00, 0x87, 0x00, 0x01, 0x02, 0x01, 0x01, 0x09, 0x0e, 0x0f, 0x09, 0x01, 0x00,
+    0x02, 0x09, 0x0e, 0x04, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x03, 0x0e, 0x0f, 0x04,
+    0x01, 0x01, 0x06, 0x07, 0x0f, 0x0f, 0x0b, 0x06, 0x01, 0x01, 0x02, 0x07, 0x05, 0x0c, 0x0f, 0x0f,
+    0x0f, 0x0b, 0x03, 0x01, 0x04, 0x06, 0x01, 0x06, 0x0a, 0x0f, 0x0f, 0x05, 0x01, 0x07, 0x03, 0x05,
+    0x0f, 0x0c, 0x02, 0x01, 0x01, 0x05, 0x05, 0x03, 0x02, 0x0f, 0x0d, 0x01, 0x00, 0x0a, 0x04, 0x0f,
+    0x0e, 0x06, 0x01, 0x00, 0x03, 0x0c, 0x0f, 0x0a, 0x03, 0x01, 0x01, 0x0b, 0x00, 0x86, 0x00, 0x02,
+    0x0e, 0x01, 0x01, 0x02, 0x07, 0x04, 0x0a, 0x0d, 0x0f, 0x0d, 0x09, 0x01, 0x03, 0x00, 0x01, 0x06,
+    0x00, 0x88, 0x00, 0x02, 0x0e, 0x01, 0x03, 0x00, 0x01, 0x06, 0x00, 0x88, 0x00, 0x02, 0x0e, 0x01,
+    0x01, 0x04, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x04, 0x03, 0x0a,
+    0x0f, 0x04, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x04,
+    0x03, 0x0a, 0x0f, 0x04, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x04,
+    0x01, 0x04, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x04, 0x03, 0x0a,
+    0x0f, 0x04, 0x02, 0x01, 0x02, 0x0b, 0x0b, 0x06, 0x02, 0x08, 0x0d, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x06, 0x03, 0x0c, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0c, 0x0f, 0x03, 0x02,
+    0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0c, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03,
+    0x0c, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0c, 0x0f, 0x03, 0x02, 0x01, 0x02,
+    0x0f, 0x0f, 0x06, 0x03, 0x0c, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0c, 0x0f,
+    0x03, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x01, 0x05, 0x03, 0x0e, 0x0f, 0x01, 0x02, 0x01, 0x03, 0x0b,
+    0x0f, 0x07, 0x04, 0x03, 0x04, 0x0f, 0x0e, 0x01, 0x01, 0x0a, 0x04, 0x0f, 0x0f, 0x06, 0x00, 0x00,
+    0x04, 0x0e, 0x0f, 0x07, 0x03, 0x02, 0x01, 0x09, 0x00, 0x86, 0x00, 0x01, 0x0c, 0x01, 0x03, 0x06,
+    0x04, 0x0b, 0x0e, 0x0e, 0x0c, 0x06, 0x02, 0x00, 0x03, 0x03, 0x0e, 0x05, 0x07, 0x02, 0x09, 0x0d,
+    0x02, 0x00, 0x03, 0x05, 0x0f, 0x0d, 0x06, 0x03, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x03, 0x0e, 0x0f,
+    0x03, 0x05, 0x03, 0x08, 0x0f, 0x0a, 0x02, 0x01, 0x03, 0x08, 0x0f, 0x0a, 0x05, 0x03, 0x0e, 0x0f,
+    0x03, 0x02, 0x01, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x03, 0x03, 0x05, 0x0f, 0x0c, 0x02, 0x02, 0x03,
+    0x0a, 0x0f, 0x07, 0x03, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x02, 0x08, 0x03, 0x0f, 0x0d, 0x00, 0x00,
+    0x02, 0x0f, 0x0e, 0x01, 0x03, 0x07, 0x0d, 0x0f, 0x04, 0x00, 0x09, 0x0f, 0x08, 0x01, 0x03, 0x07,
+    0x06, 0x0f, 0x0b, 0x00, 0x0e, 0x0f, 0x01, 0x01, 0x04, 0x05, 0x0e, 0x0f, 0x08, 0x0f, 0x0a, 0x01,
+    0x04, 0x05, 0x08, 0x0f, 0x0f, 0x0f, 0x03, 0x01, 0x04, 0x04, 0x02, 0x0f, 0x0f, 0x0c, 0x01, 0x05,
+    0x03, 0x08, 0x0e, 0x04, 0x03, 0x00, 0x03, 0x06, 0x0e, 0x01, 0x04, 0x03, 0x0c, 0x0e, 0x03, 0x04,
+    0x02, 0x09, 0x0d, 0x03, 0x00, 0x03, 0x09, 0x0f, 0x06, 0x03, 0x04, 0x02, 0x0f, 0x0f, 0x09, 0x04,
+    0x02, 0x0f, 0x0f, 0x03, 0x00, 0x03, 0x05, 0x0f, 0x0a, 0x03, 0x04, 0x06, 0x0f, 0x0f, 0x0d, 0x03,
+    0x03, 0x04, 0x0f, 0x0c, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x03, 0x0a, 0x0a, 0x0f, 0x0f, 0x0f,
+    0x01, 0x00, 0x00, 0x08, 0x0f, 0x08, 0x01, 0x01, 0x0f, 0x0d, 0x0f, 0x03, 0x00, 0x00, 0x0e, 0x0f,
+    0x0b, 0x0f, 0x05, 0x00, 0x00, 0x0c, 0x0f, 0x03, 0x01, 0x01, 0x0e, 0x08, 0x0f, 0x07, 0x00, 0x03,
+    0x0f, 0x0c, 0x05, 0x0f, 0x09, 0x00, 0x00, 0x0f, 0x0f, 0x01, 0x01, 0x0e, 0x04, 0x0f, 0x0b, 0x00,
+    0x07, 0x0f, 0x08, 0x01, 0x0f, 0x0e, 0x00, 0x04, 0x0f, 0x0b, 0x01, 0x02, 0x0d, 0x0f, 0x0f, 0x00,
+    0x0b, 0x0f, 0x04, 0x00, 0x0d, 0x0f, 0x02, 0x08, 0x0f, 0x06, 0x01, 0x02, 0x0d, 0x0b, 0x0f, 0x04,
+    0x0f, 0x0f, 0x00, 0x00, 0x09, 0x0f, 0x06, 0x0c, 0x0f, 0x02, 0x01, 0x02, 0x0c, 0x07, 0x0f, 0x0b,
+    0x0f, 0x0b, 0x00, 0x00, 0x05, 0x0f, 0x0b, 0x0f, 0x0e, 0x01, 0x02, 0x0c, 0x03, 0x0f, 0x0f, 0x0f,
+    0x07, 0x00, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x09, 0x02, 0x03, 0x04, 0x0e, 0x0f, 0x0f, 0x03, 0x03,
+    0x04, 0x0c, 0x0f, 0x0f, 0x05, 0x02, 0x03, 0x03, 0x09, 0x0f, 0x0e, 0x04, 0x04, 0x07, 0x0f, 0x0f,
+    0x01, 0x02, 0x00, 0x03, 0x01, 0x0d, 0x08, 0x05, 0x02, 0x0a, 0x0c, 0x02, 0x00, 0x04, 0x01, 0x0f,
+    0x0f, 0x05, 0x03, 0x03, 0x07, 0x0f, 0x0e, 0x01, 0x01, 0x09, 0x06, 0x0f, 0x0e, 0x01, 0x00, 0x02,
+    0x0f, 0x0f, 0x04, 0x01, 0x02, 0x07, 0x0b, 0x0f, 0x0a, 0x00, 0x0d, 0x0f, 0x09, 0x01, 0x02, 0x06,
+    0x01, 0x0f, 0x0f, 0x0c, 0x0f, 0x0d, 0x01, 0x03, 0x05, 0x05, 0x0f, 0x0f, 0x0f, 0x03, 0x01, 0x04,
+    0x03, 0x0e, 0x0f, 0x0d, 0x01, 0x03, 0x05, 0x09, 0x0f, 0x0f, 0x0f, 0x06, 0x01, 0x02, 0x07, 0x04,
+    0x0f, 0x0f, 0x07, 0x0f, 0x0f, 0x02, 0x01, 0x01, 0x08, 0x01, 0x0e, 0x0f, 0x07, 0x00, 0x09, 0x0f,
+    0x0c, 0x02, 0x01, 0x03, 0x0a, 0x0f, 0x0c, 0x03, 0x03, 0x0d, 0x0f, 0x07, 0x02, 0x00, 0x04, 0x04,
+    0x0f, 0x0f, 0x02, 0x03, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x03, 0x0e, 0x05, 0x05,
+    0x03, 0x07, 0x0e, 0x01, 0x02, 0x00, 0x03, 0x04, 0x0e, 0x04, 0x05, 0x03, 0x06, 0x0e, 0x02, 0x02,
+    0x00, 0x04, 0x05, 0x0f, 0x0e, 0x01, 0x03, 0x04, 0x02, 0x0f, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x0c,
+    0x0f, 0x0a, 0x03, 0x03, 0x0c, 0x0f, 0x09, 0x01, 0x01, 0x08, 0x02, 0x0f, 0x0f, 0x05, 0x00, 0x07,
+    0x0f, 0x0e, 0x01, 0x02, 0x07, 0x06, 0x0f, 0x0f, 0x04, 0x0f, 0x0f, 0x04, 0x01, 0x03, 0x05, 0x0b,
+    0x0f, 0x0f, 0x0f, 0x09, 0x01, 0x03, 0x04, 0x01, 0x0e, 0x0f, 0x0d, 0x01, 0x04, 0x03, 0x09, 0x0f,
+    0x06, 0x01, 0x04, 0x03, 0x09, 0x0f, 0x06, 0x01, 0x04, 0x03, 0x09, 0x0f, 0x06, 0x01, 0x04, 0x03,
+    0x09, 0x0f, 0x06, 0x01, 0x04, 0x03, 0x09, 0x0f, 0x06, 0x01, 0x04, 0x03, 0x08, 0x0f, 0x06, 0x03,
+    0x01, 0x01, 0x0c, 0x00, 0x87, 0x00, 0x01, 0x07, 0x03, 0x01, 0x01, 0x0c, 0x00, 0x87, 0x00, 0x01,
+    0x06, 0x01, 0x06, 0x03, 0x09, 0x0f, 0x0d, 0x01, 0x05, 0x04, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x05,
+    0x03, 0x0c, 0x0f, 0x0a, 0x01, 0x04, 0x04, 0x07, 0x0f, 0x0e, 0x01, 0x01, 0x03, 0x04, 0x02, 0x0f,
+    0x0f, 0x05, 0x01, 0x03, 0x03, 0x0b, 0x0f, 0x0b, 0x01, 0x02, 0x04, 0x05, 0x0f, 0x0f, 0x02, 0x01,
+    0x01, 0x04, 0x01, 0x0e, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x0d, 0x03, 0x00, 0x01, 0x02,
+    0x00, 0x88, 0x00, 0x01, 0x0b, 0x03, 0x00, 0x01, 0x03, 0x00, 0x88, 0x00, 0x01, 0x0a, 0x01, 0x01,
+    0x05, 0x0d, 0x0f, 0x0f, 0x0f, 0x06, 0x02, 0x01, 0x84, 0x00, 0x01, 0x06, 0x01, 0x01, 0x02, 0x0f,
+    0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f,
+    0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01,
+    0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01,
+    0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x02, 0x01, 0x84,
+    0x00, 0x01, 0x06, 0x01, 0x01, 0x05, 0x0c, 0x0f, 0x0f, 0x0f, 0x06, 0x01, 0x00, 0x02, 0x08, 0x0d,
+    0x01, 0x00, 0x03, 0x0a, 0x0f, 0x05, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x0a, 0x01, 0x01, 0x02, 0x0f,
+    0x0f, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x05, 0x01, 0x01, 0x03, 0x04, 0x0f, 0x0b, 0x01, 0x02, 0x03,
+    0x0e, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x03, 0x0f, 0x0c, 0x01,
+    0x03, 0x03, 0x0d, 0x0f, 0x02, 0x01, 0x03, 0x03, 0x08, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x02, 0x0f,
+    0x0d, 0x01, 0x04, 0x03, 0x0d, 0x0f, 0x02, 0x01, 0x04, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x04, 0x03,
+    0x01, 0x0f, 0x0d, 0x01, 0x05, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x05, 0x03, 0x05, 0x0e, 0x02, 0x01,
+    0x00, 0x06, 0x03, 0x0f, 0x0f, 0x0f, 0x0e, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x84, 0x00, 0x01,
+    0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03,
+    0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01,
+    0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f,
+    0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03,
+    0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x03,
+    0x00, 0x01, 0x03, 0x00, 0x84, 0x00, 0x01, 0x03, 0x01, 0x00, 0x06, 0x03, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x01, 0x01, 0x04, 0x02, 0x01, 0x05, 0x01, 0x04, 0x03, 0x0d, 0x0f, 0x05, 0x01, 0x03, 0x05, 0x08,
+    0x0f, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x06, 0x02, 0x0f, 0x0c, 0x05, 0x0f, 0x0a, 0x01, 0x02, 0x07,
+    0x0c, 0x0f, 0x02, 0x00, 0x0b, 0x0f, 0x04, 0x01, 0x01, 0x08, 0x07, 0x0f, 0x08, 0x00, 0x00, 0x01,
+    0x0f, 0x0e, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0d, 0x04, 0x03, 0x06, 0x0f, 0x08, 0x02, 0x00, 0x03,
+    0x03, 0x0e, 0x03, 0x05, 0x02, 0x0a, 0x0a, 0x01, 0x00, 0x09, 0x07, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x09, 0x03, 0x00, 0x01, 0x0b, 0x00, 0x87, 0x00, 0x01, 0x0d, 0x01, 0x00, 0x02, 0x02,
+    0x04, 0x01, 0x00, 0x03, 0x09, 0x0f, 0x09, 0x01, 0x00, 0x04, 0x01, 0x0c, 0x0f, 0x0b, 0x01, 0x02,
+    0x02, 0x09, 0x0c, 0x01, 0x02, 0x09, 0x01, 0x0a, 0x0d, 0x0e, 0x0a, 0x02, 0x06, 0x0d, 0x01, 0x01,
+    0x01, 0x0a, 0x02, 0x0e, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x0a, 0x0a,
+    0x0f, 0x0a, 0x01, 0x00, 0x01, 0x0b, 0x0f, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x05, 0x03,
+    0x0e, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x03, 0x02, 0x00,
+    0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x05, 0x03,
+    0x0e, 0x0f, 0x03, 0x01, 0x01, 0x0a, 0x0a, 0x0f, 0x0a, 0x00, 0x00, 0x01, 0x0b, 0x0f, 0x0f, 0x03,
+    0x01, 0x01, 0x0a, 0x02, 0x0e, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x0d, 0x0f, 0x03, 0x01, 0x02, 0x09,
+    0x01, 0x0a, 0x0e, 0x0e, 0x0a, 0x02, 0x09, 0x0f, 0x03, 0x01, 0x01, 0x02, 0x0d, 0x06, 0x01, 0x00,
+    0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x01, 0x00, 0x09, 0x02, 0x0f, 0x0b, 0x02, 0x0a, 0x0e, 0x0e, 0x0a, 0x01, 0x01, 0x00, 0x0a, 0x02,
+    0x0f, 0x0d, 0x0e, 0x0f, 0x0e, 0x0f, 0x0f, 0x0e, 0x02, 0x01, 0x00, 0x0a, 0x02, 0x0f, 0x0f, 0x0b,
+    0x01, 0x00, 0x00, 0x0a, 0x0f, 0x0b, 0x02, 0x00, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x0e,
+    0x0f, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x05, 0x03, 0x0a, 0x0f, 0x03, 0x02, 0x00, 0x03,
+    0x01, 0x0f, 0x0b, 0x05, 0x03, 0x0a, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x01, 0x04, 0x02,
+    0x0e, 0x0f, 0x01, 0x01, 0x09, 0x08, 0x0f, 0x0b, 0x01, 0x00, 0x00, 0x0a, 0x0f, 0x0a, 0x01, 0x02,
+    0x08, 0x0c, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x0d, 0x01, 0x01, 0x03, 0x05, 0x07, 0x0c, 0x0f, 0x0d,
+    0x08, 0x01, 0x03, 0x06, 0x08, 0x0c, 0x0f, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x08, 0x01, 0x0d, 0x0f,
+    0x0f, 0x0d, 0x0f, 0x0f, 0x08, 0x02, 0x01, 0x03, 0x0a, 0x0f, 0x0a, 0x03, 0x02, 0x05, 0x02, 0x01,
+    0x01, 0x02, 0x0f, 0x0e, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x01, 0x00, 0x03, 0x03, 0x0f, 0x0a,
+    0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01, 0x01, 0x08, 0x0a, 0x0f, 0x0a, 0x00, 0x00, 0x01, 0x05, 0x02,
+    0x01, 0x01, 0x08, 0x01, 0x0d, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x09, 0x01, 0x03, 0x06, 0x08, 0x0d,
+    0x0f, 0x0e, 0x09, 0x01, 0x01, 0x08, 0x03, 0x06, 0x0d, 0x01, 0x01, 0x08, 0x03, 0x0a, 0x0f, 0x03,
+    0x01, 0x08, 0x03, 0x0a, 0x0f, 0x03, 0x01, 0x08, 0x03, 0x0a, 0x0f, 0x03, 0x01, 0x02, 0x09, 0x01,
+    0x0a, 0x0d, 0x0e, 0x0a, 0x02, 0x0a, 0x0f, 0x03, 0x01, 0x01, 0x0a, 0x02, 0x0e, 0x0f, 0x0f, 0x0e,
+    0x0f, 0x0e, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x0a, 0x0b, 0x0f, 0x0a, 0x01, 0x00, 0x01, 0x0b, 0x0f,
+    0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x05, 0x03, 0x0e, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x03,
+    0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b,
+    0x0f, 0x01, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x05, 0x02, 0x0e, 0x0f, 0x01, 0x01, 0x09, 0x0a, 0x0f,
+    0x0a, 0x00, 0x00, 0x01, 0x0b, 0x0f, 0x08, 0x01, 0x01, 0x08, 0x01, 0x0d, 0x0f, 0x0f, 0x0d, 0x0f,
+    0x0f, 0x0d, 0x01, 0x03, 0x05, 0x08, 0x0d, 0x0f, 0x0c, 0x08, 0x01, 0x02, 0x06, 0x01, 0x09, 0x0d,
+    0x0f, 0x0c, 0x06, 0x01, 0x01, 0x08, 0x01, 0x0e, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x09, 0x01, 0x01,
+    0x09, 0x0a, 0x0f, 0x07, 0x00, 0x00, 0x02, 0x0d, 0x0f, 0x04, 0x01, 0x01, 0x09, 0x0f, 0x0d, 0x01,
+    0x01, 0x01, 0x01, 0x06, 0x0f, 0x08, 0x03, 0x00, 0x01, 0x03, 0x00, 0x88, 0x00, 0x01, 0x09, 0x01,
+    0x00, 0x0a, 0x03, 0x0f, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x03, 0x0f,
+    0x0f, 0x01, 0x01, 0x01, 0x08, 0x0a, 0x0f, 0x0b, 0x01, 0x00, 0x00, 0x06, 0x07, 0x01, 0x01, 0x08,
+    0x01, 0x0d, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x0e, 0x01, 0x03, 0x06, 0x08, 0x0d, 0x0f, 0x0e, 0x0a,
+    0x02, 0x01, 0x03, 0x05, 0x09, 0x0e, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x05, 0x0a, 0x0f, 0x0f, 0x0c,
+    0x0a, 0x01, 0x02, 0x03, 0x0e, 0x0f, 0x01, 0x03, 0x00, 0x01, 0x06, 0x00, 0x85, 0x00, 0x01, 0x0a,
+    0x01, 0x00, 0x07, 0x04, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x07, 0x01, 0x02, 0x02, 0x0f, 0x0e, 0x01,
+    0x02, 0x02, 0x0f, 0x0e, 0x01, 0x02, 0x02, 0x0f, 0x0e, 0x01, 0x02, 0x02, 0x0f, 0x0e, 0x01, 0x02,
+    0x02, 0x0f, 0x0e, 0x01, 0x02, 0x02, 0x0f, 0x0e, 0x01, 0x02, 0x02, 0x0f, 0x0e, 0x01, 0x02, 0x02,
+    0x0e, 0x0e, 0x01, 0x02, 0x09, 0x01, 0x0a, 0x0d, 0x0e, 0x0a, 0x02, 0x06, 0x0d, 0x01, 0x01, 0x01,
+    0x0a, 0x02, 0x0e, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x0a, 0x0a, 0x0f,
+    0x0a, 0x01, 0x00, 0x01, 0x0b, 0x0f, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x05, 0x03, 0x0e,
+    0x0f, 0x03, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x03, 0x02, 0x00, 0x03,
+    0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x05, 0x03, 0x0e,
+    0x0f, 0x03, 0x01, 0x01, 0x0a, 0x0a, 0x0f, 0x0a, 0x00, 0x00, 0x01, 0x0b, 0x0f, 0x0f, 0x03, 0x01,
+    0x01, 0x0a, 0x02, 0x0e, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x0d, 0x0f, 0x03, 0x01, 0x02, 0x09, 0x01,
+    0x0a, 0x0e, 0x0e, 0x0a, 0x02, 0x0b, 0x0f, 0x02, 0x01, 0x08, 0x02, 0x0e, 0x0f, 0x02, 0x01, 0x03,
+    0x01, 0x08, 0x04, 0x03, 0x03, 0x09, 0x0f, 0x0b, 0x01, 0x01, 0x09, 0x04, 0x0f, 0x0f, 0x0f, 0x0d,
+    0x0f, 0x0f, 0x0f, 0x02, 0x01, 0x02, 0x07, 0x04, 0x0a, 0x0d, 0x0f, 0x0d, 0x09, 0x01, 0x01, 0x01,
+    0x02, 0x0d, 0x07, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01,
+    0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x0b, 0x06, 0x0c, 0x0f, 0x0c, 0x05,
+    0x01, 0x00, 0x09, 0x02, 0x0f, 0x0f, 0x0f, 0x0e, 0x0d, 0x0f, 0x0f, 0x05, 0x01, 0x00, 0x09, 0x02,
+    0x0f, 0x0f, 0x07, 0x00, 0x00, 0x05, 0x0f, 0x0e, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x04, 0x03,
+    0x0c, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0c, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00,
+    0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04,
+    0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02,
+    0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x04, 0x03, 0x08, 0x0f, 0x04, 0x01, 0x01, 0x02, 0x0c, 0x0b, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f,
+    0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x0b, 0x0a, 0x01, 0x01, 0x02, 0x0f,
+    0x0e, 0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x0f, 0x0e,
+    0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01,
+    0x01, 0x02, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x0e, 0x0e, 0x01, 0x03, 0x03, 0x09, 0x0d, 0x01, 0x01,
+    0x03, 0x03, 0x0e, 0x0f, 0x03, 0x01, 0x03, 0x02, 0x03, 0x05, 0x00, 0x01, 0x03, 0x02, 0x08, 0x0c,
+    0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x0c,
+    0x0f, 0x01, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01, 0x01, 0x03,
+    0x03, 0x0c, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01,
+    0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x01, 0x01, 0x02, 0x03, 0x01,
+    0x0f, 0x0f, 0x01, 0x01, 0x04, 0x09, 0x0f, 0x0f, 0x09, 0x01, 0x01, 0x03, 0x0d, 0x0e, 0x09, 0x01,
+    0x01, 0x02, 0x0d, 0x07, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x02, 0x0b, 0x09,
+    0x01, 0x00, 0x08, 0x02, 0x0f, 0x0b, 0x00, 0x00, 0x0c, 0x0f, 0x08, 0x01, 0x00, 0x07, 0x02, 0x0f,
+    0x0b, 0x00, 0x0b, 0x0f, 0x0a, 0x01, 0x00, 0x06, 0x02, 0x0f, 0x0c, 0x0a, 0x0f, 0x0a, 0x03, 0x00,
+    0x01, 0x02, 0x00, 0x84, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x07, 0x02, 0x0f, 0x0f, 0x0b, 0x0c, 0x0f,
+    0x06, 0x01, 0x00, 0x08, 0x02, 0x0f, 0x0d, 0x00, 0x02, 0x0f, 0x0f, 0x02, 0x01, 0x00, 0x08, 0x02,
+    0x0f, 0x0b, 0x00, 0x00, 0x06, 0x0f, 0x0c, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x03, 0x0b,
+    0x0f, 0x07, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0b, 0x03, 0x03, 0x01, 0x0d, 0x07, 0x01, 0x01, 0x02,
+    0x0d, 0x07, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00,
+    0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02,
+    0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00,
+    0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x01, 0x01, 0x0c, 0x0d, 0x07, 0x08, 0x0e, 0x0e, 0x09, 0x00, 0x01, 0x09, 0x0e, 0x0d, 0x07, 0x01,
+    0x00, 0x0e, 0x02, 0x0f, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x0b, 0x0c, 0x0f, 0x0d, 0x0f, 0x0f, 0x08,
+    0x01, 0x00, 0x0e, 0x02, 0x0f, 0x0f, 0x05, 0x00, 0x01, 0x0d, 0x0f, 0x0f, 0x02, 0x00, 0x03, 0x0f,
+    0x0f, 0x03, 0x00, 0x03, 0x02, 0x0f, 0x0d, 0x03, 0x03, 0x07, 0x0f, 0x09, 0x03, 0x03, 0x0b, 0x0f,
+    0x03, 0x03, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x03, 0x06, 0x0f, 0x08, 0x03, 0x03, 0x09, 0x0f,
+    0x04, 0x03, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x03, 0x05, 0x0f, 0x08, 0x03, 0x03, 0x09, 0x0f,
+    0x04, 0x03, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x03, 0x05, 0x0f, 0x08, 0x03, 0x03, 0x09, 0x0f,
+    0x04, 0x03, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x03, 0x05, 0x0f, 0x08, 0x03, 0x03, 0x09, 0x0f,
+    0x04, 0x03, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x03, 0x05, 0x0f, 0x08, 0x03, 0x03, 0x09, 0x0f,
+    0x04, 0x03, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x03, 0x03, 0x05, 0x0f, 0x07, 0x03, 0x03, 0x08, 0x0f,
+    0x04, 0x01, 0x01, 0x07, 0x0d, 0x07, 0x06, 0x0c, 0x0f, 0x0c, 0x05, 0x01, 0x00, 0x09, 0x02, 0x0f,
+    0x0f, 0x0f, 0x0e, 0x0d, 0x0f, 0x0f, 0x05, 0x01, 0x00, 0x09, 0x02, 0x0f, 0x0f, 0x07, 0x00, 0x00,
+    0x05, 0x0f, 0x0e, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x04, 0x03, 0x0c, 0x0f, 0x02, 0x02, 0x00,
+    0x03, 0x02, 0x0f, 0x0c, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04,
+    0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02,
+    0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x08, 0x0f, 0x04,
+    0x01, 0x03, 0x05, 0x08, 0x0c, 0x0f, 0x0c, 0x08, 0x01, 0x01, 0x08, 0x01, 0x0d, 0x0f, 0x0f, 0x0e,
+    0x0f, 0x0f, 0x0d, 0x01, 0x01, 0x09, 0x0a, 0x0f, 0x0a, 0x00, 0x00, 0x01, 0x0b, 0x0f, 0x09, 0x02,
+    0x01, 0x02, 0x0f, 0x0e, 0x05, 0x02, 0x0e, 0x0f, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03,
+    0x0b, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x02, 0x02, 0x01,
+    0x02, 0x0f, 0x0e, 0x05, 0x02, 0x0e, 0x0f, 0x01, 0x01, 0x09, 0x0a, 0x0f, 0x0a, 0x00, 0x00, 0x01,
+    0x0b, 0x0f, 0x09, 0x01, 0x01, 0x08, 0x01, 0x0d, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x0d, 0x01, 0x03,
+    0x05, 0x08, 0x0d, 0x0f, 0x0c, 0x08, 0x01, 0x03, 0x05, 0x07, 0x0c, 0x0f, 0x0d, 0x08, 0x01, 0x02,
+    0x08, 0x0c, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x0d, 0x01, 0x01, 0x01, 0x09, 0x08, 0x0f, 0x0b, 0x01,
+    0x00, 0x00, 0x0a, 0x0f, 0x0a, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x01, 0x04, 0x02, 0x0e, 0x0f, 0x02,
+    0x00, 0x03, 0x01, 0x0f, 0x0b, 0x05, 0x03, 0x0a, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x05, 0x03, 0x0a, 0x0f, 0x03, 0x02, 0x00, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x0d, 0x0f,
+    0x01, 0x01, 0x00, 0x0a, 0x02, 0x0f, 0x0f, 0x0b, 0x01, 0x00, 0x00, 0x0a, 0x0f, 0x0b, 0x01, 0x00,
+    0x0a, 0x02, 0x0f, 0x0d, 0x0e, 0x0f, 0x0d, 0x0f, 0x0f, 0x0e, 0x02, 0x01, 0x00, 0x09, 0x02, 0x0f,
+    0x0b, 0x02, 0x0a, 0x0e, 0x0e, 0x0a, 0x01, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03,
+    0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x01, 0x02, 0x0d, 0x06, 0x01, 0x03,
+    0x05, 0x08, 0x0c, 0x0f, 0x0c, 0x08, 0x01, 0x01, 0x08, 0x01, 0x0d, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f,
+    0x0d, 0x01, 0x01, 0x09, 0x0a, 0x0f, 0x0a, 0x01, 0x00, 0x01, 0x0b, 0x0f, 0x08, 0x02, 0x01, 0x02,
+    0x0f, 0x0e, 0x05, 0x02, 0x0e, 0x0f, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f,
+    0x02, 0x02, 0x00, 0x03, 0x03, 0x0f, 0x0a, 0x05, 0x03, 0x0b, 0x0f, 0x03, 0x02, 0x01, 0x02, 0x0f,
+    0x0e, 0x05, 0x03, 0x0e, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x0b, 0x0f, 0x0a, 0x03, 0x04, 0x0a, 0x0f,
+    0x0f, 0x03, 0x01, 0x01, 0x0a, 0x02, 0x0e, 0x0f, 0x0f, 0x0d, 0x0f, 0x0e, 0x0d, 0x0f, 0x03, 0x01,
+    0x02, 0x09, 0x01, 0x0a, 0x0e, 0x0e, 0x0a, 0x02, 0x0a, 0x0f, 0x03, 0x01, 0x08, 0x03, 0x0a, 0x0f,
+    0x03, 0x01, 0x08, 0x03, 0x0a, 0x0f, 0x03, 0x01, 0x08, 0x03, 0x0a, 0x0f, 0x03, 0x01, 0x08, 0x03,
+    0x06, 0x0d, 0x01, 0x01, 0x02, 0x05, 0x03, 0x0b, 0x0e, 0x0f, 0x04, 0x01, 0x01, 0x06, 0x03, 0x0f,
+    0x0f, 0x0e, 0x0b, 0x02, 0x01, 0x01, 0x03, 0x0c, 0x0f, 0x06, 0x01, 0x01, 0x02, 0x0f, 0x0e, 0x01,
+    0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f,
+    0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x01, 0x00, 0x03,
+    0x02, 0x0f, 0x0b, 0x01, 0x01, 0x06, 0x03, 0x0c, 0x0f, 0x0e, 0x0a, 0x02, 0x01, 0x00, 0x07, 0x01,
+    0x0e, 0x0f, 0x0e, 0x0f, 0x0f, 0x0a, 0x01, 0x00, 0x07, 0x04, 0x0f, 0x0a, 0x00, 0x00, 0x04, 0x02,
+    0x01, 0x00, 0x04, 0x02, 0x0f, 0x0d, 0x03, 0x01, 0x01, 0x05, 0x08, 0x0f, 0x0f, 0x0d, 0x04, 0x01,
+    0x02, 0x05, 0x02, 0x0a, 0x0f, 0x0f, 0x09, 0x01, 0x04, 0x03, 0x01, 0x0e, 0x0f, 0x01, 0x00, 0x08,
+    0x01, 0x05, 0x01, 0x00, 0x01, 0x0e, 0x0f, 0x01, 0x01, 0x00, 0x07, 0x06, 0x0f, 0x0f, 0x0d, 0x0f,
+    0x0f, 0x0b, 0x01, 0x01, 0x06, 0x08, 0x0d, 0x0f, 0x0e, 0x09, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04,
+    0x01, 0x02, 0x02, 0x0d, 0x0f, 0x01, 0x02, 0x02, 0x0e, 0x0f, 0x03, 0x00, 0x01, 0x06, 0x00, 0x84,
+    0x00, 0x01, 0x08, 0x01, 0x00, 0x06, 0x04, 0x0c, 0x0f, 0x0f, 0x0c, 0x05, 0x01, 0x02, 0x02, 0x0e,
+    0x0f, 0x01, 0x02, 0x02, 0x0e, 0x0f, 0x01, 0x02, 0x02, 0x0e, 0x0f, 0x01, 0x02, 0x02, 0x0e, 0x0f,
+    0x01, 0x02, 0x02, 0x0e, 0x0f, 0x01, 0x02, 0x02, 0x0e, 0x0f, 0x01, 0x02, 0x02, 0x0e, 0x0f, 0x01,
+    0x02, 0x02, 0x0d, 0x0f, 0x02, 0x01, 0x02, 0x0d, 0x07, 0x04, 0x03, 0x05, 0x0e, 0x01, 0x02, 0x00,
+    0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04,
+    0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02,
+    0x00, 0x03, 0x02, 0x0f, 0x0b, 0x04, 0x03, 0x09, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0b,
+    0x04, 0x03, 0x0a, 0x0f, 0x04, 0x02, 0x01, 0x02, 0x0f, 0x0e, 0x04, 0x03, 0x0c, 0x0f, 0x01, 0x01,
+    0x01, 0x08, 0x0c, 0x0f, 0x07, 0x00, 0x00, 0x05, 0x0f, 0x0d, 0x01, 0x01, 0x08, 0x03, 0x0f, 0x0f,
+    0x0e, 0x0d, 0x0f, 0x0f, 0x04, 0x01, 0x02, 0x06, 0x02, 0x0b, 0x0e, 0x0e, 0x0b, 0x03, 0x02, 0x00,
+    0x03, 0x07, 0x0d, 0x01, 0x04, 0x02, 0x07, 0x0d, 0x02, 0x00, 0x03, 0x09, 0x0f, 0x07, 0x04, 0x02,
+    0x0f, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x03, 0x03, 0x06, 0x0f, 0x0a, 0x01, 0x01, 0x08,
+    0x0b, 0x0f, 0x05, 0x00, 0x00, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x07, 0x04, 0x0f, 0x0b, 0x00, 0x04,
+    0x0f, 0x0c, 0x01, 0x02, 0x06, 0x0d, 0x0f, 0x02, 0x0a, 0x0f, 0x05, 0x01, 0x02, 0x05, 0x06, 0x0f,
+    0x0b, 0x0f, 0x0e, 0x01, 0x03, 0x04, 0x0f, 0x0f, 0x0f, 0x07, 0x01, 0x03, 0x04, 0x09, 0x0f, 0x0f,
+    0x01, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x08, 0x03, 0x00, 0x03, 0x06, 0x0e, 0x02, 0x03, 0x03, 0x04,
+    0x0e, 0x04, 0x03, 0x03, 0x01, 0x0e, 0x06, 0x03, 0x00, 0x03, 0x08, 0x0f, 0x08, 0x03, 0x03, 0x0b,
+    0x0f, 0x0b, 0x03, 0x03, 0x07, 0x0f, 0x08, 0x01, 0x00, 0x0f, 0x02, 0x0f, 0x0d, 0x00, 0x00, 0x01,
+    0x0f, 0x0f, 0x0f, 0x01, 0x00, 0x00, 0x0d, 0x0f, 0x02, 0x01, 0x01, 0x0d, 0x0c, 0x0f, 0x03, 0x00,
+    0x06, 0x0f, 0x0e, 0x0f, 0x07, 0x00, 0x02, 0x0f, 0x0c, 0x01, 0x01, 0x0d, 0x06, 0x0f, 0x09, 0x00,
+    0x0c, 0x0f, 0x03, 0x0f, 0x0c, 0x00, 0x08, 0x0f, 0x06, 0x01, 0x02, 0x0c, 0x0f, 0x0e, 0x02, 0x0f,
+    0x0c, 0x00, 0x0b, 0x0f, 0x02, 0x0e, 0x0f, 0x01, 0x01, 0x02, 0x0b, 0x09, 0x0f, 0x0b, 0x0f, 0x06,
+    0x00, 0x05, 0x0f, 0x0b, 0x0f, 0x0a, 0x02, 0x02, 0x04, 0x03, 0x0f, 0x0f, 0x0f, 0x03, 0x04, 0x0f,
+    0x0f, 0x0f, 0x04, 0x02, 0x03, 0x03, 0x0d, 0x0f, 0x0a, 0x03, 0x03, 0x0a, 0x0f, 0x0e, 0x02, 0x03,
+    0x03, 0x06, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x05, 0x0d, 0x02, 0x03,
+    0x03, 0x02, 0x0d, 0x07, 0x01, 0x00, 0x09, 0x06, 0x0f, 0x0d, 0x01, 0x00, 0x00, 0x0d, 0x0f, 0x07,
+    0x01, 0x01, 0x07, 0x0a, 0x0f, 0x0b, 0x00, 0x0a, 0x0f, 0x0c, 0x01, 0x02, 0x06, 0x0d, 0x0f, 0x0d,
+    0x0f, 0x0e, 0x01, 0x01, 0x02, 0x05, 0x02, 0x0e, 0x0f, 0x0f, 0x03, 0x01, 0x02, 0x05, 0x02, 0x0e,
+    0x0f, 0x0f, 0x03, 0x01, 0x02, 0x06, 0x0d, 0x0f, 0x0c, 0x0f, 0x0e, 0x01, 0x01, 0x01, 0x07, 0x0a,
+    0x0f, 0x0b, 0x00, 0x0a, 0x0f, 0x0c, 0x01, 0x00, 0x09, 0x06, 0x0f, 0x0d, 0x01, 0x00, 0x00, 0x0c,
+    0x0f, 0x07, 0x02, 0x00, 0x03, 0x05, 0x0d, 0x02, 0x03, 0x03, 0x02, 0x0d, 0x07, 0x02, 0x00, 0x03,
+    0x07, 0x0d, 0x01, 0x04, 0x02, 0x07, 0x0d, 0x02, 0x00, 0x03, 0x09, 0x0f, 0x07, 0x04, 0x03, 0x0f,
+    0x0f, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x03, 0x03, 0x06, 0x0f, 0x0a, 0x01, 0x01, 0x08,
+    0x0b, 0x0f, 0x04, 0x00, 0x00, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x07, 0x05, 0x0f, 0x0b, 0x00, 0x03,
+    0x0f, 0x0c, 0x01, 0x02, 0x06, 0x0e, 0x0f, 0x02, 0x0a, 0x0f, 0x06, 0x01, 0x02, 0x05, 0x07, 0x0f,
+    0x0a, 0x0f, 0x0e, 0x01, 0x02, 0x05, 0x01, 0x0f, 0x0f, 0x0f, 0x08, 0x01, 0x03, 0x04, 0x09, 0x0f,
+    0x0f, 0x02, 0x01, 0x03, 0x03, 0x05, 0x0f, 0x0b, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x04, 0x01, 0x02,
+    0x03, 0x03, 0x0f, 0x0d, 0x01, 0x00, 0x05, 0x04, 0x0c, 0x0f, 0x0f, 0x04, 0x01, 0x00, 0x04, 0x07,
+    0x0f, 0x0d, 0x06, 0x03, 0x00, 0x01, 0x05, 0x00, 0x87, 0x00, 0x01, 0x06, 0x01, 0x00, 0x09, 0x03,
+    0x0b, 0x0c, 0x0c, 0x0c, 0x0d, 0x0f, 0x0f, 0x04, 0x01, 0x05, 0x03, 0x0d, 0x0f, 0x09, 0x01, 0x04,
+    0x03, 0x0a, 0x0f, 0x0c, 0x01, 0x03, 0x04, 0x05, 0x0f, 0x0f, 0x02, 0x01, 0x02, 0x04, 0x02, 0x0f,
+    0x0f, 0x05, 0x01, 0x02, 0x03, 0x0d, 0x0f, 0x09, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x0d, 0x01, 0x00,
+    0x09, 0x04, 0x0f, 0x0f, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x03, 0x00, 0x01, 0x06, 0x00, 0x87,
+    0x00, 0x01, 0x06, 0x01, 0x01, 0x04, 0x07, 0x0d, 0x0f, 0x06, 0x01, 0x00, 0x05, 0x07, 0x0f, 0x0f,
+    0x0f, 0x06, 0x01, 0x00, 0x04, 0x0d, 0x0f, 0x08, 0x01, 0x01, 0x00, 0x03, 0x0f, 0x0f, 0x01, 0x01,
+    0x00, 0x02, 0x0f, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0x0f, 0x01, 0x00,
+    0x02, 0x0f, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0x0f, 0x01, 0x00, 0x02,
+    0x0f, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0x0f, 0x01, 0x00, 0x02, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x0f,
+    0x0f, 0x01, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x08, 0x01, 0x00, 0x05, 0x07, 0x0f, 0x0f, 0x0f, 0x06,
+    0x01, 0x01, 0x04, 0x08, 0x0d, 0x0f, 0x06, 0x01, 0x00, 0x02, 0x0c, 0x05, 0x01, 0x00, 0x02, 0x0f,
+    0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08,
+    0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01,
+    0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00,
+    0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02,
+    0x0f, 0x08, 0x01, 0x00, 0x02, 0x0f, 0x08, 0x01, 0x00, 0x02, 0x0a, 0x04, 0x01, 0x00, 0x05, 0x03,
+    0x0f, 0x0e, 0x0a, 0x01, 0x01, 0x00, 0x05, 0x03, 0x0f, 0x0f, 0x0f, 0x0b, 0x01, 0x02, 0x04, 0x05,
+    0x0f, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01,
+    0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f,
+    0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03,
+    0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x0c, 0x0f, 0x03, 0x01,
+    0x03, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x02, 0x04, 0x05, 0x0f, 0x0f, 0x01, 0x01, 0x00, 0x05, 0x03,
+    0x0f, 0x0f, 0x0f, 0x0b, 0x01, 0x00, 0x05, 0x03, 0x0f, 0x0e, 0x0a, 0x01, 0x02, 0x02, 0x03, 0x08,
+    0x0a, 0x06, 0x04, 0x02, 0x09, 0x01, 0x01, 0x01, 0x0a, 0x0b, 0x0f, 0x0f, 0x0f, 0x0d, 0x02, 0x00,
+    0x04, 0x0f, 0x04, 0x01, 0x00, 0x0a, 0x02, 0x0f, 0x08, 0x01, 0x07, 0x0f, 0x0f, 0x0c, 0x0e, 0x0e,
+    0x01, 0x00, 0x0a, 0x02, 0x0d, 0x01, 0x00, 0x00, 0x02, 0x0a, 0x0e, 0x0c, 0x02,
+};
+
+static const uint32_t lts18_atlas_index[] = {
+    0, 0, 73, 117, 249, 403, 569, 699,
+    728, 832, 930, 980, 1042, 1070, 1089, 1106,
+    1206, 1342, 1424, 1529, 1638, 1736, 1844, 1966,
+    2053, 2189, 2311, 2349, 2398, 2469, 2513, 2583,
+    2669, 2843, 2969, 3090, 3206, 3336, 3418, 3495,
+    3634, 3764, 3829, 3918, 4049, 4119, 4316, 4474,
+    4619, 4722, 4891, 5013, 5132, 5218, 5350, 5476,
+    5681, 5812, 5919, 6014, 6107, 6207, 6321, 6391,
+    6412, 6435, 6553, 6689, 6772, 6906, 7009, 7090,
+    7246, 7381, 7449, 7551, 7677, 7760, 7921, 8032,
+    8134, 8270, 8403, 8467, 8555, 8628, 8734, 8823,
+    8969, 9069, 9187, 9267, 9367, 9452, 9564,
+};
+
+static const glyph_atlas_t lts18_atlas = {
+    .index = lts18_atlas_index,
+    .data = lts18_atlas_data,
+};
+
+static const uint8_t lts20_atlas_data[] = {
+    0x01, 0x01, 0x02, 0x0b, 0x0c, 0x01, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x00, 0x04, 0x02,
+    0x0f, 0x0f, 0x04, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x0f, 0x03, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f,
+    0x02, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x02, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x02,
+    0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0e, 0x0f, 0x01, 0x01, 0x02, 0x0d, 0x0f, 0x01, 0x01, 0x02, 0x0a,
+    0x0c, 0x00, 0x01, 0x01, 0x02, 0x08, 0x09, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x0f, 0x04, 0x01, 0x01,
+    0x02, 0x0b, 0x0c, 0x01, 0x01, 0x05, 0x0c, 0x09, 0x00, 0x08, 0x0d, 0x01, 0x00, 0x07, 0x01, 0x0f,
+    0x0e, 0x00, 0x0d, 0x0f, 0x02, 0x01, 0x00, 0x07, 0x01, 0x0f, 0x0e, 0x00, 0x0d, 0x0f, 0x02, 0x01,
+    0x00, 0x07, 0x01, 0x0f, 0x0e, 0x00, 0x0d, 0x0f, 0x02, 0x01, 0x00, 0x07, 0x01, 0x0f, 0x0e, 0x00,
+    0x0d, 0x0f, 0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x07, 0x01, 0x0e,
+    0x06, 0x00, 0x00, 0x08, 0x0d, 0x01, 0x03, 0x07, 0x05, 0x0f, 0x08, 0x00, 0x00, 0x0d, 0x0f, 0x01,
+    0x03, 0x07, 0x07, 0x0f, 0x06, 0x00, 0x00, 0x0f, 0x0d, 0x01, 0x03, 0x07, 0x0a, 0x0f, 0x03, 0x00,
+    0x03, 0x0f, 0x0a, 0x03, 0x01, 0x01, 0x0a, 0x00, 0x89, 0x00, 0x01, 0x03, 0x03, 0x01, 0x01, 0x0a,
+    0x00, 0x88, 0x00, 0x02, 0x0e, 0x03, 0x01, 0x02, 0x08, 0x02, 0x0f, 0x0b, 0x00, 0x00, 0x0b, 0x0f,
+    0x02, 0x01, 0x02, 0x07, 0x04, 0x0f, 0x09, 0x00, 0x00, 0x0d, 0x0f, 0x01, 0x02, 0x07, 0x06, 0x0f,
+    0x07, 0x00, 0x00, 0x0f, 0x0e, 0x03, 0x00, 0x01, 0x06, 0x00, 0x89, 0x00, 0x01, 0x08, 0x03, 0x00,
+    0x02, 0x05, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x07, 0x01, 0x02, 0x07, 0x0d, 0x0f, 0x00, 0x00, 0x06,
+    0x0f, 0x07, 0x01, 0x02, 0x07, 0x0f, 0x0d, 0x00, 0x00, 0x09, 0x0f, 0x04, 0x01, 0x01, 0x08, 0x03,
+    0x0f, 0x0a, 0x00, 0x00, 0x0c, 0x0f, 0x01, 0x01, 0x01, 0x07, 0x02, 0x0e, 0x05, 0x00, 0x00, 0x09,
+    0x0c, 0x01, 0x06, 0x01, 0x05, 0x01, 0x06, 0x02, 0x0f, 0x01, 0x01, 0x06, 0x01, 0x0f, 0x01, 0x02,
+    0x07, 0x01, 0x07, 0x0c, 0x0f, 0x0f, 0x0c, 0x07, 0x03, 0x01, 0x02, 0x01, 0x0e, 0x00, 0x86, 0x00,
+    0x02, 0x0e, 0x01, 0x01, 0x01, 0x0a, 0x0b, 0x0f, 0x0e, 0x07, 0x08, 0x0d, 0x09, 0x0f, 0x0f, 0x05,
+    0x01, 0x01, 0x09, 0x0f, 0x0f, 0x05, 0x00, 0x06, 0x0a, 0x00, 0x00, 0x05, 0x01, 0x01, 0x06, 0x0f,
+    0x0f, 0x03, 0x00, 0x08, 0x08, 0x01, 0x01, 0x06, 0x0d, 0x0f, 0x0c, 0x03, 0x09, 0x07, 0x03, 0x01,
+    0x01, 0x04, 0x00, 0x84, 0x00, 0x02, 0x0a, 0x03, 0x03, 0x02, 0x02, 0x04, 0x0d, 0x00, 0x84, 0x00,
+    0x02, 0x0c, 0x04, 0x01, 0x04, 0x07, 0x02, 0x0e, 0x0d, 0x0f, 0x0f, 0x0f, 0x03, 0x01, 0x05, 0x06,
+    0x0f, 0x01, 0x02, 0x0c, 0x0f, 0x0a, 0x01, 0x05, 0x06, 0x0f, 0x00, 0x00, 0x05, 0x0f, 0x0e, 0x01,
+    0x00, 0x0b, 0x02, 0x0d, 0x07, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x09, 0x0f, 0x0c, 0x01, 0x00, 0x0b,
+    0x05, 0x0f, 0x0f, 0x0c, 0x09, 0x0d, 0x04, 0x09, 0x0f, 0x0f, 0x07, 0x03, 0x01, 0x01, 0x07, 0x00,
+    0x87, 0x00, 0x01, 0x0b, 0x01, 0x02, 0x07, 0x02, 0x08, 0x0e, 0x0f, 0x0e, 0x0b, 0x05, 0x01, 0x04,
+    0x02, 0x08, 0x08, 0x01, 0x04, 0x02, 0x08, 0x06, 0x00, 0x02, 0x01, 0x05, 0x01, 0x0a, 0x0e, 0x0d,
+    0x07, 0x05, 0x03, 0x02, 0x0d, 0x05, 0x02, 0x01, 0x06, 0x0c, 0x0f, 0x0b, 0x0c, 0x0f, 0x07, 0x04,
+    0x03, 0x0c, 0x0f, 0x05, 0x02, 0x00, 0x07, 0x03, 0x0f, 0x07, 0x00, 0x00, 0x0b, 0x0e, 0x03, 0x03,
+    0x07, 0x0f, 0x0b, 0x01, 0x00, 0x0d, 0x05, 0x0f, 0x02, 0x00, 0x00, 0x06, 0x0f, 0x00, 0x00, 0x03,
+    0x0f, 0x0f, 0x01, 0x01, 0x00, 0x0c, 0x04, 0x0f, 0x04, 0x00, 0x00, 0x07, 0x0e, 0x00, 0x00, 0x0d,
+    0x0f, 0x06, 0x01, 0x01, 0x0a, 0x0e, 0x0c, 0x03, 0x04, 0x0e, 0x09, 0x00, 0x08, 0x0f, 0x0b, 0x01,
+    0x01, 0x0a, 0x03, 0x0e, 0x0f, 0x0f, 0x0c, 0x01, 0x03, 0x0f, 0x0e, 0x01, 0x01, 0x03, 0x07, 0x03,
+    0x02, 0x00, 0x00, 0x0d, 0x0f, 0x05, 0x01, 0x06, 0x09, 0x08, 0x0f, 0x0b, 0x00, 0x04, 0x0d, 0x0f,
+    0x0e, 0x06, 0x01, 0x05, 0x0b, 0x03, 0x0f, 0x0e, 0x01, 0x01, 0x0f, 0x0b, 0x05, 0x09, 0x0f, 0x04,
+    0x02, 0x05, 0x06, 0x0d, 0x0f, 0x05, 0x00, 0x07, 0x0f, 0x03, 0x02, 0x0d, 0x0b, 0x02, 0x04, 0x07,
+    0x09, 0x0f, 0x0a, 0x00, 0x00, 0x09, 0x0d, 0x03, 0x02, 0x0a, 0x0d, 0x01, 0x03, 0x0d, 0x04, 0x0f,
+    0x0e, 0x01, 0x00, 0x00, 0x07, 0x0f, 0x02, 0x00, 0x00, 0x0f, 0x0a, 0x02, 0x03, 0x03, 0x0e, 0x0f,
+    0x05, 0x03, 0x07, 0x01, 0x0e, 0x0e, 0x0a, 0x0d, 0x0f, 0x04, 0x02, 0x03, 0x02, 0x0d, 0x08, 0x05,
+    0x05, 0x02, 0x0c, 0x0f, 0x0d, 0x05, 0x01, 0x02, 0x07, 0x01, 0x09, 0x0d, 0x0f, 0x0d, 0x0b, 0x04,
+    0x03, 0x01, 0x02, 0x01, 0x0e, 0x00, 0x86, 0x00, 0x01, 0x09, 0x01, 0x01, 0x09, 0x0b, 0x0f, 0x0e,
+    0x06, 0x03, 0x04, 0x0a, 0x0f, 0x0f, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x05, 0x04, 0x02, 0x02, 0x03,
+    0x01, 0x01, 0x03, 0x0e, 0x0f, 0x05, 0x01, 0x01, 0x04, 0x09, 0x0f, 0x0d, 0x04, 0x03, 0x02, 0x01,
+    0x09, 0x00, 0x88, 0x00, 0x01, 0x0a, 0x03, 0x01, 0x02, 0x01, 0x0b, 0x00, 0x88, 0x00, 0x01, 0x0a,
+    0x01, 0x01, 0x0a, 0x0c, 0x0f, 0x0d, 0x05, 0x01, 0x00, 0x00, 0x09, 0x0f, 0x0a, 0x02, 0x00, 0x04,
+    0x04, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x09, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x0d, 0x05,
+    0x03, 0x09, 0x0f, 0x09, 0x02, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x09, 0x0f, 0x09,
+    0x01, 0x01, 0x0a, 0x0d, 0x0f, 0x0d, 0x05, 0x03, 0x04, 0x09, 0x0f, 0x0f, 0x08, 0x03, 0x01, 0x01,
+    0x03, 0x00, 0x87, 0x00, 0x02, 0x0c, 0x01, 0x01, 0x02, 0x07, 0x01, 0x09, 0x0d, 0x0f, 0x0d, 0x0b,
+    0x06, 0x01, 0x01, 0x02, 0x0c, 0x09, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x01, 0x00, 0x03, 0x01,
+    0x0f, 0x0e, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0e, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x03, 0x03, 0x08, 0x0d, 0x01, 0x01, 0x02, 0x04, 0x03, 0x0f, 0x0f, 0x01,
+    0x01, 0x02, 0x03, 0x0b, 0x0f, 0x09, 0x01, 0x01, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x03,
+    0x08, 0x0f, 0x0b, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x05, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x02,
+    0x01, 0x00, 0x03, 0x04, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x0d, 0x01, 0x00, 0x03, 0x06,
+    0x0f, 0x0c, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x0d, 0x01, 0x00, 0x03, 0x04, 0x0f, 0x0f, 0x01, 0x00,
+    0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x06, 0x01, 0x01, 0x03, 0x08, 0x0f,
+    0x0c, 0x01, 0x01, 0x04, 0x02, 0x0f, 0x0f, 0x03, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x0a, 0x01, 0x02,
+    0x04, 0x03, 0x0f, 0x0f, 0x01, 0x01, 0x03, 0x03, 0x08, 0x0d, 0x01, 0x01, 0x01, 0x03, 0x08, 0x0d,
+    0x01, 0x01, 0x01, 0x03, 0x0a, 0x0f, 0x0a, 0x01, 0x01, 0x04, 0x02, 0x0f, 0x0f, 0x02, 0x01, 0x02,
+    0x03, 0x0a, 0x0f, 0x09, 0x01, 0x02, 0x03, 0x04, 0x0f, 0x0f, 0x01, 0x03, 0x03, 0x0e, 0x0f, 0x04,
+    0x01, 0x03, 0x03, 0x0b, 0x0f, 0x08, 0x01, 0x03, 0x03, 0x08, 0x0f, 0x0b, 0x01, 0x03, 0x03, 0x06,
+    0x0f, 0x0c, 0x01, 0x03, 0x03, 0x05, 0x0f, 0x0d, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03,
+    0x03, 0x08, 0x0f, 0x0b, 0x01, 0x03, 0x03, 0x0b, 0x0f, 0x08, 0x01, 0x03, 0x03, 0x0e, 0x0f, 0x04,
+    0x01, 0x02, 0x03, 0x05, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x0c, 0x0f, 0x09, 0x01, 0x01, 0x04, 0x03,
+    0x0f, 0x0f, 0x02, 0x01, 0x01, 0x03, 0x0a, 0x0f, 0x0a, 0x01, 0x01, 0x03, 0x07, 0x0d, 0x01, 0x01,
+    0x03, 0x02, 0x0d, 0x02, 0x01, 0x01, 0x05, 0x02, 0x02, 0x0f, 0x04, 0x02, 0x01, 0x00, 0x07, 0x04,
+    0x0f, 0x0c, 0x0f, 0x0c, 0x0f, 0x06, 0x01, 0x01, 0x05, 0x07, 0x0f, 0x0f, 0x0f, 0x09, 0x01, 0x00,
+    0x07, 0x01, 0x0c, 0x0f, 0x0f, 0x0f, 0x0d, 0x02, 0x01, 0x00, 0x07, 0x03, 0x0e, 0x08, 0x0f, 0x09,
+    0x0d, 0x05, 0x01, 0x02, 0x03, 0x01, 0x0e, 0x02, 0x01, 0x04, 0x02, 0x05, 0x06, 0x01, 0x04, 0x02,
+    0x0d, 0x0f, 0x01, 0x04, 0x02, 0x0d, 0x0f, 0x01, 0x04, 0x02, 0x0d, 0x0f, 0x01, 0x00, 0x0a, 0x04,
+    0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x05, 0x03, 0x00, 0x01, 0x04, 0x00, 0x88, 0x00,
+    0x01, 0x06, 0x01, 0x04, 0x02, 0x0d, 0x0f, 0x01, 0x04, 0x02, 0x0d, 0x0f, 0x01, 0x04, 0x02, 0x0d,
+    0x0f, 0x01, 0x04, 0x02, 0x09, 0x0b, 0x01, 0x01, 0x03, 0x09, 0x0d, 0x02, 0x01, 0x01, 0x03, 0x0f,
+    0x0f, 0x08, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x05, 0x01, 0x01, 0x02, 0x09, 0x0e, 0x01, 0x00, 0x03,
+    0x06, 0x0c, 0x02, 0x00, 0x03, 0x00, 0x02, 0x04, 0x0e, 0x00, 0x85, 0x00, 0x01, 0x06, 0x03, 0x00,
+    0x01, 0x04, 0x00, 0x86, 0x00, 0x01, 0x06, 0x01, 0x01, 0x03, 0x06, 0x0a, 0x01, 0x01, 0x01, 0x03,
+    0x0f, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x09, 0x0d, 0x02, 0x01, 0x06, 0x02, 0x0a, 0x0d, 0x01, 0x05,
+    0x03, 0x02, 0x0f, 0x0f, 0x01, 0x05, 0x03, 0x07, 0x0f, 0x0b, 0x01, 0x05, 0x03, 0x0d, 0x0f, 0x06,
+    0x01, 0x04, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x08, 0x0f, 0x0a, 0x01, 0x04, 0x03, 0x0d,
+    0x0f, 0x05, 0x01, 0x03, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x03, 0x03, 0x08, 0x0f, 0x0a, 0x01, 0x03,
+    0x03, 0x0e, 0x0f, 0x04, 0x01, 0x02, 0x03, 0x04, 0x0f, 0x0e, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x09,
+    0x01, 0x02, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x01, 0x03, 0x04, 0x0f, 0x0e, 0x01, 0x01, 0x03, 0x0a,
+    0x0f, 0x08, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x03, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x0d, 0x01, 0x00,
+    0x03, 0x0a, 0x0f, 0x08, 0x01, 0x00, 0x03, 0x07, 0x0e, 0x02, 0x01, 0x03, 0x06, 0x06, 0x0d, 0x0f,
+    0x0e, 0x0a, 0x02, 0x03, 0x02, 0x01, 0x0a, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x01, 0x0a, 0x09,
+    0x0f, 0x0f, 0x08, 0x04, 0x05, 0x0c, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x06,
+    0x04, 0x03, 0x0d, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x08, 0x0f, 0x0d, 0x05, 0x04, 0x05, 0x0f, 0x0f,
+    0x01, 0x02, 0x00, 0x03, 0x0b, 0x0f, 0x07, 0x06, 0x03, 0x0f, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x0d,
+    0x0f, 0x05, 0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0f, 0x0f, 0x03, 0x06, 0x03, 0x0b,
+    0x0f, 0x08, 0x02, 0x00, 0x03, 0x0d, 0x0f, 0x05, 0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03,
+    0x0b, 0x0f, 0x07, 0x06, 0x03, 0x0f, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x08, 0x0f, 0x0d, 0x05, 0x04,
+    0x05, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x06, 0x04, 0x03, 0x0d, 0x0f, 0x0a,
+    0x01, 0x01, 0x0a, 0x09, 0x0f, 0x0f, 0x08, 0x04, 0x05, 0x0c, 0x0f, 0x0f, 0x02, 0x03, 0x02, 0x01,
+    0x0a, 0x00, 0x86, 0x00, 0x01, 0x04, 0x01, 0x03, 0x06, 0x06, 0x0d, 0x0f, 0x0e, 0x0a, 0x02, 0x01,
+    0x00, 0x05, 0x07, 0x0f, 0x0f, 0x0f, 0x0b, 0x02, 0x00, 0x01, 0x0a, 0x00, 0x84, 0x01, 0x01, 0x04,
+    0x03, 0x05, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f,
+    0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02,
+    0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02,
+    0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f,
+    0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x06, 0x02,
+    0x0a, 0x0d, 0x0f, 0x0d, 0x08, 0x03, 0x01, 0x01, 0x07, 0x00, 0x86, 0x00, 0x01, 0x0d, 0x01, 0x00,
+    0x0a, 0x01, 0x0f, 0x0f, 0x0c, 0x05, 0x03, 0x06, 0x0f, 0x0f, 0x08, 0x02, 0x01, 0x02, 0x09, 0x06,
+    0x04, 0x03, 0x07, 0x0f, 0x0c, 0x01, 0x07, 0x03, 0x05, 0x0f, 0x0e, 0x01, 0x07, 0x03, 0x09, 0x0f,
+    0x0c, 0x01, 0x06, 0x04, 0x03, 0x0f, 0x0f, 0x05, 0x01, 0x05, 0x04, 0x01, 0x0e, 0x0f, 0x0c, 0x01,
+    0x04, 0x05, 0x01, 0x0d, 0x0f, 0x0d, 0x01, 0x01, 0x04, 0x04, 0x0c, 0x0f, 0x0e, 0x02, 0x01, 0x03,
+    0x04, 0x0c, 0x0f, 0x0e, 0x02, 0x01, 0x02, 0x04, 0x0b, 0x0f, 0x0e, 0x02, 0x01, 0x01, 0x09, 0x0a,
+    0x0f, 0x0f, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x00, 0x01, 0x04, 0x00, 0x89, 0x00, 0x01,
+    0x02, 0x03, 0x00, 0x02, 0x03, 0x0e, 0x00, 0x87, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x02, 0x07, 0x03,
+    0x0a, 0x0d, 0x0f, 0x0d, 0x08, 0x01, 0x03, 0x01, 0x01, 0x08, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x01,
+    0x01, 0x01, 0x09, 0x0e, 0x0f, 0x0a, 0x04, 0x03, 0x06, 0x0e, 0x0f, 0x09, 0x02, 0x01, 0x02, 0x03,
+    0x02, 0x04, 0x03, 0x06, 0x0f, 0x0d, 0x01, 0x07, 0x03, 0x06, 0x0f, 0x0d, 0x01, 0x06, 0x04, 0x04,
+    0x0e, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x04, 0x00, 0x84, 0x00, 0x01, 0x08, 0x03, 0x03, 0x01, 0x04,
+    0x00, 0x84, 0x00, 0x01, 0x0a, 0x01, 0x05, 0x05, 0x01, 0x04, 0x0d, 0x0f, 0x09, 0x01, 0x07, 0x03,
+    0x03, 0x0f, 0x0f, 0x01, 0x07, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x02, 0x0a, 0x07, 0x04,
+    0x03, 0x05, 0x0f, 0x0f, 0x01, 0x00, 0x0a, 0x02, 0x0f, 0x0f, 0x0c, 0x05, 0x03, 0x06, 0x0e, 0x0f,
+    0x0a, 0x03, 0x01, 0x01, 0x07, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x02, 0x06, 0x02, 0x0a,
+    0x0d, 0x0f, 0x0d, 0x08, 0x01, 0x05, 0x03, 0x05, 0x0e, 0x04, 0x01, 0x05, 0x03, 0x0e, 0x0f, 0x06,
+    0x01, 0x04, 0x04, 0x08, 0x0f, 0x0f, 0x01, 0x01, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x07, 0x01, 0x03,
+    0x03, 0x08, 0x0f, 0x0e, 0x02, 0x02, 0x04, 0x01, 0x0f, 0x0f, 0x06, 0x03, 0x01, 0x02, 0x02, 0x02,
+    0x03, 0x09, 0x0f, 0x0d, 0x03, 0x03, 0x0b, 0x0f, 0x03, 0x02, 0x01, 0x04, 0x01, 0x0f, 0x0f, 0x05,
+    0x03, 0x03, 0x0d, 0x0f, 0x05, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x0d, 0x04, 0x03, 0x0d, 0x0f, 0x05,
+    0x03, 0x00, 0x01, 0x01, 0x00, 0x89, 0x00, 0x01, 0x05, 0x03, 0x00, 0x01, 0x02, 0x00, 0x89, 0x00,
+    0x01, 0x05, 0x01, 0x01, 0x0a, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x0f, 0x05, 0x01,
+    0x08, 0x03, 0x0d, 0x0f, 0x05, 0x01, 0x08, 0x03, 0x0d, 0x0f, 0x05, 0x01, 0x08, 0x03, 0x0d, 0x0f,
+    0x04, 0x03, 0x01, 0x01, 0x04, 0x00, 0x87, 0x00, 0x01, 0x04, 0x03, 0x01, 0x01, 0x08, 0x00, 0x87,
+    0x00, 0x01, 0x06, 0x01, 0x01, 0x08, 0x08, 0x0f, 0x0b, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x01,
+    0x03, 0x08, 0x0f, 0x0a, 0x01, 0x01, 0x03, 0x08, 0x0f, 0x0a, 0x01, 0x01, 0x08, 0x08, 0x0f, 0x0f,
+    0x0f, 0x0e, 0x0c, 0x08, 0x01, 0x03, 0x01, 0x01, 0x06, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x02, 0x01,
+    0x05, 0x05, 0x01, 0x05, 0x0d, 0x0f, 0x0d, 0x01, 0x07, 0x04, 0x02, 0x0f, 0x0f, 0x03, 0x01, 0x08,
+    0x03, 0x0d, 0x0f, 0x06, 0x01, 0x08, 0x03, 0x0d, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0b, 0x07, 0x04,
+    0x04, 0x03, 0x0f, 0x0f, 0x02, 0x01, 0x00, 0x0a, 0x02, 0x0f, 0x0f, 0x0c, 0x05, 0x03, 0x06, 0x0e,
+    0x0f, 0x0b, 0x03, 0x01, 0x01, 0x07, 0x00, 0x86, 0x00, 0x02, 0x0d, 0x02, 0x01, 0x02, 0x06, 0x02,
+    0x0a, 0x0d, 0x0f, 0x0c, 0x08, 0x01, 0x05, 0x03, 0x05, 0x0e, 0x05, 0x01, 0x04, 0x04, 0x01, 0x0e,
+    0x0f, 0x06, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x0d, 0x01, 0x03, 0x04, 0x04, 0x0f, 0x0f, 0x03, 0x01,
+    0x03, 0x03, 0x0e, 0x0f, 0x08, 0x01, 0x02, 0x07, 0x09, 0x0f, 0x0f, 0x0c, 0x0f, 0x0c, 0x06, 0x03,
+    0x01, 0x01, 0x02, 0x00, 0x87, 0x00, 0x01, 0x09, 0x01, 0x01, 0x0a, 0x0a, 0x0f, 0x0e, 0x05, 0x01,
+    0x02, 0x09, 0x0f, 0x0f, 0x04, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x06, 0x04, 0x03, 0x0b, 0x0f, 0x09,
+    0x02, 0x00, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x06, 0x0f, 0x0c, 0x02, 0x00, 0x04, 0x01,
+    0x0f, 0x0f, 0x01, 0x04, 0x03, 0x06, 0x0f, 0x0c, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x06, 0x04, 0x03,
+    0x0b, 0x0f, 0x09, 0x01, 0x01, 0x0a, 0x07, 0x0f, 0x0f, 0x06, 0x01, 0x02, 0x09, 0x0f, 0x0f, 0x02,
+    0x03, 0x02, 0x01, 0x0b, 0x00, 0x86, 0x00, 0x01, 0x06, 0x01, 0x03, 0x06, 0x06, 0x0c, 0x0e, 0x0d,
+    0x0a, 0x03, 0x03, 0x00, 0x01, 0x04, 0x00, 0x89, 0x00, 0x01, 0x05, 0x03, 0x00, 0x01, 0x06, 0x00,
+    0x89, 0x00, 0x01, 0x07, 0x01, 0x01, 0x0a, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x0f, 0x0f,
+    0x01, 0x01, 0x07, 0x03, 0x0d, 0x0f, 0x08, 0x01, 0x06, 0x04, 0x06, 0x0f, 0x0f, 0x01, 0x01, 0x06,
+    0x03, 0x0e, 0x0f, 0x08, 0x01, 0x05, 0x04, 0x07, 0x0f, 0x0e, 0x01, 0x01, 0x05, 0x03, 0x0e, 0x0f,
+    0x07, 0x01, 0x04, 0x03, 0x08, 0x0f, 0x0e, 0x01, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x07, 0x01, 0x03,
+    0x03, 0x08, 0x0f, 0x0e, 0x01, 0x02, 0x04, 0x01, 0x0f, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x09, 0x0f,
+    0x0e, 0x01, 0x02, 0x03, 0x0f, 0x0f, 0x06, 0x01, 0x02, 0x02, 0x0c, 0x0b, 0x01, 0x02, 0x06, 0x01,
+    0x09, 0x0d, 0x0f, 0x0c, 0x07, 0x03, 0x01, 0x01, 0x02, 0x00, 0x86, 0x00, 0x01, 0x0c, 0x01, 0x01,
+    0x09, 0x0b, 0x0f, 0x0e, 0x06, 0x03, 0x07, 0x0f, 0x0f, 0x07, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x05,
+    0x03, 0x03, 0x09, 0x0f, 0x0a, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x04, 0x03, 0x03, 0x08, 0x0f, 0x0a,
+    0x01, 0x01, 0x09, 0x09, 0x0f, 0x0d, 0x04, 0x00, 0x04, 0x0f, 0x0f, 0x05, 0x03, 0x02, 0x01, 0x0b,
+    0x00, 0x85, 0x00, 0x01, 0x07, 0x03, 0x01, 0x02, 0x01, 0x0d, 0x00, 0x85, 0x00, 0x01, 0x0a, 0x01,
+    0x01, 0x09, 0x0c, 0x0f, 0x0c, 0x03, 0x01, 0x04, 0x0e, 0x0f, 0x08, 0x02, 0x00, 0x04, 0x03, 0x0f,
+    0x0f, 0x01, 0x03, 0x03, 0x04, 0x0f, 0x0f, 0x02, 0x00, 0x03, 0x06, 0x0f, 0x0d, 0x04, 0x04, 0x01,
+    0x0f, 0x0f, 0x02, 0x02, 0x00, 0x04, 0x04, 0x0f, 0x0f, 0x01, 0x03, 0x03, 0x05, 0x0f, 0x0f, 0x01,
+    0x01, 0x09, 0x0e, 0x0f, 0x0d, 0x05, 0x03, 0x06, 0x0e, 0x0f, 0x0b, 0x03, 0x01, 0x01, 0x04, 0x00,
+    0x86, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x02, 0x07, 0x02, 0x0a, 0x0d, 0x0f, 0x0d, 0x08, 0x01, 0x01,
+    0x03, 0x06, 0x06, 0x0b, 0x0e, 0x0e, 0x0a, 0x03, 0x03, 0x02, 0x01, 0x0b, 0x00, 0x86, 0x00, 0x01,
+    0x06, 0x01, 0x01, 0x0a, 0x07, 0x0f, 0x0f, 0x06, 0x01, 0x02, 0x09, 0x0f, 0x0f, 0x02, 0x02, 0x01,
+    0x03, 0x0e, 0x0f, 0x06, 0x04, 0x03, 0x0b, 0x0f, 0x09, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01,
+    0x04, 0x03, 0x06, 0x0f, 0x0c, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x06, 0x0f,
+    0x0c, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x06, 0x04, 0x03, 0x0b, 0x0f, 0x0a, 0x01, 0x01, 0x0a, 0x09,
+    0x0f, 0x0f, 0x05, 0x01, 0x02, 0x09, 0x0f, 0x0f, 0x04, 0x03, 0x01, 0x02, 0x01, 0x0d, 0x00, 0x86,
+    0x00, 0x01, 0x0c, 0x01, 0x03, 0x07, 0x09, 0x0d, 0x0e, 0x0d, 0x0f, 0x0f, 0x03, 0x01, 0x06, 0x03,
+    0x0d, 0x0f, 0x09, 0x01, 0x05, 0x03, 0x08, 0x0f, 0x0e, 0x01, 0x04, 0x04, 0x03, 0x0f, 0x0f, 0x04,
+    0x01, 0x04, 0x03, 0x0c, 0x0f, 0x0a, 0x01, 0x04, 0x03, 0x09, 0x0c, 0x01, 0x01, 0x01, 0x03, 0x09,
+    0x0d, 0x02, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x06, 0x0a, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x03, 0x06, 0x0a, 0x01, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x07, 0x01, 0x01,
+    0x03, 0x09, 0x0d, 0x02, 0x01, 0x01, 0x03, 0x06, 0x0a, 0x01, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x07,
+    0x01, 0x01, 0x03, 0x09, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x05, 0x01,
+    0x01, 0x03, 0x0e, 0x0f, 0x06, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x05, 0x0f,
+    0x03, 0x01, 0x00, 0x03, 0x03, 0x0e, 0x08, 0x01, 0x00, 0x02, 0x02, 0x04, 0x01, 0x06, 0x03, 0x03,
+    0x0b, 0x03, 0x01, 0x05, 0x04, 0x07, 0x0f, 0x0f, 0x06, 0x01, 0x03, 0x05, 0x01, 0x0b, 0x0f, 0x0f,
+    0x07, 0x01, 0x02, 0x05, 0x04, 0x0e, 0x0f, 0x0d, 0x03, 0x01, 0x01, 0x04, 0x08, 0x0f, 0x0f, 0x09,
+    0x01, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x04, 0x0b, 0x0f, 0x0f, 0x06, 0x01, 0x02,
+    0x05, 0x07, 0x0f, 0x0f, 0x0b, 0x01, 0x01, 0x03, 0x05, 0x03, 0x0d, 0x0f, 0x0e, 0x04, 0x01, 0x05,
+    0x04, 0x0a, 0x0f, 0x0f, 0x05, 0x01, 0x06, 0x03, 0x05, 0x0e, 0x05, 0x03, 0x00, 0x01, 0x04, 0x00,
+    0x88, 0x00, 0x01, 0x06, 0x01, 0x00, 0x0a, 0x03, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x05, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x03, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x05,
+    0x03, 0x00, 0x01, 0x04, 0x00, 0x88, 0x00, 0x01, 0x06, 0x01, 0x00, 0x03, 0x01, 0x0b, 0x05, 0x01,
+    0x00, 0x04, 0x02, 0x0f, 0x0f, 0x09, 0x01, 0x01, 0x05, 0x04, 0x0e, 0x0f, 0x0d, 0x02, 0x01, 0x02,
+    0x05, 0x01, 0x0b, 0x0f, 0x0f, 0x06, 0x01, 0x04, 0x04, 0x07, 0x0f, 0x0f, 0x0b, 0x01, 0x05, 0x04,
+    0x04, 0x0f, 0x0f, 0x07, 0x01, 0x04, 0x05, 0x04, 0x0e, 0x0f, 0x0d, 0x01, 0x01, 0x03, 0x04, 0x08,
+    0x0f, 0x0f, 0x0a, 0x01, 0x01, 0x05, 0x02, 0x0c, 0x0f, 0x0f, 0x05, 0x01, 0x00, 0x05, 0x01, 0x0f,
+    0x0f, 0x0c, 0x02, 0x01, 0x00, 0x03, 0x02, 0x0e, 0x08, 0x01, 0x02, 0x06, 0x06, 0x0b, 0x0e, 0x0e,
+    0x0b, 0x04, 0x03, 0x00, 0x02, 0x01, 0x0c, 0x00, 0x86, 0x00, 0x01, 0x06, 0x01, 0x00, 0x09, 0x08,
+    0x0f, 0x0f, 0x08, 0x04, 0x05, 0x0b, 0x0f, 0x0f, 0x02, 0x00, 0x03, 0x03, 0x0b, 0x02, 0x04, 0x03,
+    0x0f, 0x0f, 0x03, 0x01, 0x06, 0x04, 0x01, 0x0f, 0x0f, 0x03, 0x01, 0x05, 0x04, 0x01, 0x0c, 0x0f,
+    0x0d, 0x01, 0x04, 0x05, 0x01, 0x0d, 0x0f, 0x0d, 0x01, 0x01, 0x04, 0x04, 0x0d, 0x0f, 0x0a, 0x01,
+    0x01, 0x03, 0x03, 0x01, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x02, 0x0f, 0x09, 0x01, 0x04, 0x02, 0x0c,
+    0x05, 0x00, 0x01, 0x03, 0x03, 0x01, 0x0a, 0x06, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x0f, 0x01, 0x03,
+    0x03, 0x03, 0x0d, 0x08, 0x01, 0x04, 0x08, 0x01, 0x08, 0x0d, 0x0f, 0x0e, 0x0c, 0x09, 0x03, 0x01,
+    0x03, 0x0a, 0x04, 0x0e, 0x0f, 0x0d, 0x0a, 0x09, 0x0c, 0x0f, 0x0f, 0x09, 0x02, 0x02, 0x04, 0x05,
+    0x0f, 0x0c, 0x02, 0x04, 0x04, 0x01, 0x09, 0x0f, 0x0a, 0x02, 0x02, 0x02, 0x0e, 0x0c, 0x08, 0x03,
+    0x07, 0x0f, 0x05, 0x01, 0x01, 0x0e, 0x08, 0x0f, 0x02, 0x00, 0x04, 0x0c, 0x0f, 0x0c, 0x03, 0x0d,
+    0x04, 0x00, 0x0c, 0x0d, 0x01, 0x01, 0x0f, 0x0d, 0x0b, 0x00, 0x04, 0x0f, 0x0d, 0x07, 0x09, 0x0e,
+    0x0f, 0x07, 0x00, 0x07, 0x0f, 0x01, 0x02, 0x01, 0x05, 0x0f, 0x08, 0x00, 0x0b, 0x0d, 0x03, 0x07,
+    0x05, 0x0f, 0x07, 0x00, 0x04, 0x0f, 0x03, 0x02, 0x00, 0x06, 0x01, 0x0f, 0x06, 0x00, 0x0e, 0x09,
+    0x04, 0x06, 0x0f, 0x07, 0x00, 0x05, 0x0f, 0x01, 0x02, 0x01, 0x05, 0x0f, 0x08, 0x00, 0x0c, 0x0b,
+    0x03, 0x06, 0x03, 0x0f, 0x07, 0x00, 0x09, 0x0f, 0x01, 0x01, 0x0e, 0x0d, 0x0b, 0x00, 0x06, 0x0f,
+    0x08, 0x02, 0x03, 0x0d, 0x0f, 0x08, 0x06, 0x0f, 0x08, 0x01, 0x01, 0x0d, 0x08, 0x0f, 0x02, 0x00,
+    0x09, 0x0f, 0x0f, 0x0f, 0x09, 0x0f, 0x0f, 0x0f, 0x09, 0x01, 0x01, 0x0c, 0x01, 0x0e, 0x0c, 0x00,
+    0x00, 0x01, 0x03, 0x01, 0x00, 0x03, 0x04, 0x01, 0x02, 0x02, 0x04, 0x05, 0x0f, 0x0c, 0x02, 0x05,
+    0x01, 0x03, 0x01, 0x03, 0x09, 0x05, 0x0e, 0x0f, 0x0d, 0x0a, 0x09, 0x0b, 0x0f, 0x0f, 0x01, 0x04,
+    0x08, 0x01, 0x08, 0x0d, 0x0f, 0x0f, 0x0d, 0x09, 0x02, 0x01, 0x06, 0x03, 0x07, 0x0e, 0x05, 0x01,
+    0x05, 0x04, 0x01, 0x0f, 0x0f, 0x0e, 0x01, 0x05, 0x05, 0x07, 0x0f, 0x0f, 0x0f, 0x05, 0x01, 0x05,
+    0x05, 0x0e, 0x0f, 0x0e, 0x0f, 0x0c, 0x01, 0x04, 0x07, 0x04, 0x0f, 0x0f, 0x04, 0x0f, 0x0f, 0x02,
+    0x01, 0x04, 0x07, 0x0b, 0x0f, 0x0b, 0x00, 0x0d, 0x0f, 0x09, 0x01, 0x03, 0x08, 0x02, 0x0f, 0x0f,
+    0x05, 0x00, 0x06, 0x0f, 0x0f, 0x01, 0x03, 0x09, 0x08, 0x0f, 0x0e, 0x00, 0x00, 0x01, 0x0f, 0x0f,
+    0x06, 0x02, 0x03, 0x03, 0x0e, 0x0f, 0x09, 0x03, 0x03, 0x0a, 0x0f, 0x0d, 0x01, 0x02, 0x0b, 0x05,
+    0x0f, 0x0f, 0x04, 0x01, 0x01, 0x01, 0x06, 0x0f, 0x0f, 0x03, 0x03, 0x02, 0x01, 0x0c, 0x00, 0x89,
+    0x00, 0x01, 0x0a, 0x03, 0x01, 0x01, 0x02, 0x00, 0x8b, 0x00, 0x01, 0x01, 0x02, 0x01, 0x03, 0x09,
+    0x0f, 0x0f, 0x06, 0x04, 0x01, 0x0f, 0x0f, 0x07, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x09, 0x07, 0x03,
+    0x0b, 0x0f, 0x0d, 0x02, 0x00, 0x04, 0x04, 0x0f, 0x0f, 0x02, 0x07, 0x04, 0x04, 0x0f, 0x0f, 0x02,
+    0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x03, 0x0d, 0x09, 0x01, 0x03, 0x00, 0x01, 0x0e, 0x00,
+    0x87, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x00, 0x0a, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x07, 0x0f,
+    0x0f, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x03, 0x06, 0x0f, 0x0e, 0x02, 0x00, 0x03,
+    0x0e, 0x0f, 0x04, 0x04, 0x03, 0x02, 0x0f, 0x0f, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x03,
+    0x05, 0x0f, 0x0d, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x03, 0x04, 0x03, 0x0e, 0x0f, 0x08, 0x03,
+    0x00, 0x01, 0x0e, 0x00, 0x87, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x0a, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e,
+    0x0e, 0x0f, 0x0f, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x04, 0x03, 0x0d, 0x0f,
+    0x07, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x05, 0x03, 0x06, 0x0f, 0x0c, 0x02, 0x00, 0x03, 0x0e,
+    0x0f, 0x04, 0x05, 0x03, 0x08, 0x0f, 0x0c, 0x01, 0x00, 0x0b, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03,
+    0x04, 0x07, 0x0f, 0x0f, 0x08, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x88, 0x00, 0x02, 0x0d, 0x01, 0x03,
+    0x00, 0x01, 0x0d, 0x00, 0x86, 0x00, 0x02, 0x0d, 0x08, 0x01, 0x04, 0x08, 0x01, 0x08, 0x0d, 0x0f,
+    0x0e, 0x0b, 0x08, 0x01, 0x03, 0x03, 0x02, 0x05, 0x0e, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x06, 0x01,
+    0x02, 0x0c, 0x06, 0x0f, 0x0f, 0x0d, 0x07, 0x04, 0x04, 0x07, 0x0e, 0x0f, 0x0f, 0x03, 0x02, 0x01,
+    0x04, 0x01, 0x0e, 0x0f, 0x0a, 0x06, 0x03, 0x08, 0x0d, 0x01, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x0e,
+    0x01, 0x01, 0x03, 0x0e, 0x0f, 0x06, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x03, 0x01, 0x00, 0x04,
+    0x02, 0x0f, 0x0f, 0x01, 0x01, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x0e, 0x0f,
+    0x06, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x0e, 0x02, 0x01, 0x04, 0x01, 0x0e, 0x0f, 0x0a, 0x06, 0x03,
+    0x08, 0x0d, 0x01, 0x01, 0x02, 0x0c, 0x06, 0x0f, 0x0f, 0x0d, 0x07, 0x04, 0x04, 0x07, 0x0e, 0x0f,
+    0x0f, 0x03, 0x03, 0x03, 0x02, 0x05, 0x0e, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x06, 0x01, 0x04, 0x08,
+    0x01, 0x09, 0x0d, 0x0f, 0x0e, 0x0b, 0x08, 0x01, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x85, 0x00, 0x03,
+    0x0d, 0x09, 0x01, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x05, 0x01, 0x00, 0x0b, 0x0e,
+    0x0f, 0x07, 0x03, 0x03, 0x04, 0x08, 0x0e, 0x0f, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04,
+    0x04, 0x05, 0x01, 0x0a, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x0e,
+    0x0f, 0x0a, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x06, 0x0f, 0x0e, 0x02, 0x00, 0x03,
+    0x0e, 0x0f, 0x04, 0x06, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x07,
+    0x03, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x04, 0x03, 0x0f, 0x0f, 0x01,
+    0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x06, 0x0f, 0x0e, 0x02, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x06, 0x03, 0x0e, 0x0f, 0x0a, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x05, 0x04, 0x0a, 0x0f,
+    0x0f, 0x01, 0x01, 0x00, 0x0b, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x04, 0x08, 0x0e, 0x0f, 0x0f, 0x06,
+    0x03, 0x00, 0x01, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x05, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x85, 0x00,
+    0x03, 0x0d, 0x09, 0x01, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x88, 0x00, 0x01, 0x04, 0x03, 0x00, 0x01,
+    0x0e, 0x00, 0x88, 0x00, 0x01, 0x06, 0x01, 0x00, 0x09, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x02, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00,
+    0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x08, 0x0e, 0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
+    0x00, 0x01, 0x0e, 0x00, 0x87, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x87, 0x00, 0x01,
+    0x0c, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03,
+    0x0e, 0x0f, 0x04, 0x01, 0x00, 0x09, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03,
+    0x00, 0x01, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x06, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x88, 0x00, 0x01,
+    0x04, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x88, 0x00, 0x01, 0x04, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x88,
+    0x00, 0x01, 0x06, 0x01, 0x00, 0x09, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01,
+    0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x01, 0x00, 0x08, 0x0e, 0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x0e,
+    0x00, 0x87, 0x00, 0x01, 0x0d, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x87, 0x00, 0x01, 0x0c, 0x01, 0x00,
+    0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04,
+    0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0d,
+    0x0f, 0x04, 0x01, 0x04, 0x08, 0x01, 0x08, 0x0d, 0x0f, 0x0e, 0x0b, 0x08, 0x01, 0x03, 0x03, 0x02,
+    0x05, 0x0e, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x06, 0x01, 0x02, 0x0c, 0x06, 0x0f, 0x0f, 0x0d, 0x07,
+    0x04, 0x04, 0x07, 0x0e, 0x0f, 0x0f, 0x03, 0x02, 0x01, 0x04, 0x01, 0x0e, 0x0f, 0x0a, 0x06, 0x03,
+    0x08, 0x0d, 0x01, 0x01, 0x01, 0x03, 0x09, 0x0f, 0x0e, 0x01, 0x01, 0x03, 0x0e, 0x0f, 0x06, 0x02,
+    0x00, 0x04, 0x01, 0x0f, 0x0f, 0x03, 0x04, 0x06, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00,
+    0x04, 0x02, 0x0f, 0x0f, 0x01, 0x03, 0x01, 0x02, 0x00, 0x86, 0x00, 0x01, 0x08, 0x04, 0x00, 0x04,
+    0x01, 0x0f, 0x0f, 0x03, 0x03, 0x02, 0x01, 0x0d, 0x00, 0x85, 0x00, 0x01, 0x09, 0x02, 0x01, 0x03,
+    0x0e, 0x0f, 0x06, 0x08, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x0e, 0x07, 0x04,
+    0x02, 0x0f, 0x0f, 0x03, 0x02, 0x01, 0x04, 0x01, 0x0e, 0x0f, 0x0a, 0x05, 0x04, 0x01, 0x0d, 0x0f,
+    0x0b, 0x01, 0x02, 0x0c, 0x06, 0x0f, 0x0f, 0x0d, 0x07, 0x04, 0x04, 0x07, 0x0e, 0x0f, 0x0f, 0x02,
+    0x03, 0x03, 0x02, 0x05, 0x0e, 0x00, 0x86, 0x00, 0x02, 0x0d, 0x03, 0x01, 0x04, 0x07, 0x01, 0x09,
+    0x0d, 0x0f, 0x0f, 0x0d, 0x08, 0x02, 0x00, 0x02, 0x08, 0x0d, 0x07, 0x03, 0x04, 0x0e, 0x04, 0x02,
+    0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x09, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04,
+    0x06, 0x03, 0x09, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x09, 0x0f, 0x09,
+    0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x09, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x06, 0x03, 0x09, 0x0f, 0x09, 0x01, 0x00, 0x0c, 0x0e, 0x0f, 0x05, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x0a, 0x0f, 0x09, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x8a, 0x00, 0x01, 0x09, 0x03, 0x00,
+    0x01, 0x0e, 0x00, 0x8a, 0x00, 0x01, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x09,
+    0x0f, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x09, 0x0f, 0x09, 0x02, 0x00, 0x03,
+    0x0e, 0x0f, 0x04, 0x06, 0x03, 0x09, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03,
+    0x09, 0x0f, 0x09, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x09, 0x0f, 0x09, 0x02, 0x00,
+    0x03, 0x0d, 0x0f, 0x04, 0x06, 0x03, 0x09, 0x0f, 0x08, 0x01, 0x00, 0x03, 0x08, 0x0d, 0x01, 0x01,
+    0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03,
+    0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01,
+    0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03,
+    0x0d, 0x0f, 0x04, 0x01, 0x07, 0x02, 0x09, 0x0d, 0x01, 0x07, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x07,
+    0x03, 0x0f, 0x0f, 0x04, 0x01, 0x07, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x07, 0x03, 0x0f, 0x0f, 0x04,
+    0x01, 0x07, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x07, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x07, 0x03, 0x0f,
+    0x0f, 0x04, 0x01, 0x07, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x07, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x07,
+    0x03, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x01, 0x07, 0x01, 0x03, 0x03, 0x04, 0x0f, 0x0f, 0x01,
+    0x00, 0x09, 0x07, 0x0f, 0x0e, 0x07, 0x03, 0x05, 0x0e, 0x0f, 0x0b, 0x03, 0x00, 0x02, 0x02, 0x0e,
+    0x00, 0x85, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x02, 0x06, 0x08, 0x0c, 0x0f, 0x0d, 0x0a, 0x01, 0x02,
+    0x00, 0x03, 0x08, 0x0d, 0x01, 0x04, 0x03, 0x02, 0x0d, 0x08, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04,
+    0x03, 0x04, 0x02, 0x0e, 0x0f, 0x09, 0x01, 0x00, 0x09, 0x0e, 0x0f, 0x04, 0x00, 0x00, 0x01, 0x0d,
+    0x0f, 0x0c, 0x01, 0x00, 0x09, 0x0e, 0x0f, 0x04, 0x00, 0x01, 0x0d, 0x0f, 0x0d, 0x01, 0x01, 0x00,
+    0x08, 0x0e, 0x0f, 0x04, 0x01, 0x0d, 0x0f, 0x0d, 0x01, 0x01, 0x00, 0x07, 0x0e, 0x0f, 0x05, 0x0c,
+    0x0f, 0x0e, 0x01, 0x01, 0x00, 0x06, 0x0e, 0x0f, 0x0e, 0x0f, 0x0f, 0x0c, 0x01, 0x00, 0x07, 0x0e,
+    0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x07, 0x01, 0x00, 0x08, 0x0e, 0x0f, 0x0f, 0x03, 0x07, 0x0f, 0x0f,
+    0x02, 0x01, 0x00, 0x08, 0x0e, 0x0f, 0x05, 0x00, 0x00, 0x0c, 0x0f, 0x0c, 0x01, 0x00, 0x09, 0x0e,
+    0x0f, 0x04, 0x00, 0x00, 0x02, 0x0f, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x03, 0x04,
+    0x07, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x03, 0x0c, 0x0f, 0x0c, 0x02,
+    0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x04, 0x02, 0x0f, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x0d, 0x0f,
+    0x04, 0x05, 0x03, 0x06, 0x0e, 0x02, 0x01, 0x00, 0x03, 0x08, 0x0d, 0x01, 0x01, 0x00, 0x03, 0x0e,
+    0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00,
+    0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04,
+    0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e,
+    0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00,
+    0x09, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x88,
+    0x00, 0x01, 0x06, 0x03, 0x00, 0x01, 0x0a, 0x00, 0x88, 0x00, 0x01, 0x04, 0x02, 0x01, 0x03, 0x01,
+    0x0d, 0x0b, 0x08, 0x03, 0x0b, 0x0d, 0x01, 0x02, 0x01, 0x04, 0x05, 0x0f, 0x0f, 0x06, 0x06, 0x04,
+    0x05, 0x0f, 0x0f, 0x06, 0x02, 0x01, 0x04, 0x07, 0x0f, 0x0f, 0x0c, 0x06, 0x04, 0x0b, 0x0f, 0x0f,
+    0x08, 0x02, 0x01, 0x05, 0x08, 0x0f, 0x0f, 0x0f, 0x02, 0x04, 0x05, 0x01, 0x0f, 0x0f, 0x0f, 0x09,
+    0x02, 0x01, 0x05, 0x09, 0x0f, 0x0f, 0x0f, 0x07, 0x04, 0x05, 0x06, 0x0f, 0x0f, 0x0f, 0x0a, 0x02,
+    0x01, 0x05, 0x0b, 0x0f, 0x0a, 0x0f, 0x0d, 0x04, 0x05, 0x0c, 0x0f, 0x0a, 0x0f, 0x0c, 0x01, 0x01,
+    0x0e, 0x0c, 0x0f, 0x05, 0x0d, 0x0f, 0x03, 0x00, 0x00, 0x02, 0x0f, 0x0e, 0x05, 0x0f, 0x0d, 0x01,
+    0x01, 0x0e, 0x0d, 0x0f, 0x04, 0x07, 0x0f, 0x09, 0x00, 0x00, 0x08, 0x0f, 0x08, 0x03, 0x0f, 0x0e,
+    0x01, 0x01, 0x0e, 0x0f, 0x0f, 0x03, 0x02, 0x0f, 0x0e, 0x00, 0x00, 0x0d, 0x0f, 0x03, 0x02, 0x0f,
+    0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x0f, 0x02, 0x00, 0x0c, 0x0f, 0x05, 0x03, 0x0f, 0x0d, 0x00, 0x01,
+    0x0f, 0x0f, 0x01, 0x01, 0x00, 0x10, 0x01, 0x0f, 0x0f, 0x00, 0x00, 0x06, 0x0f, 0x0a, 0x09, 0x0f,
+    0x07, 0x00, 0x00, 0x0f, 0x0f, 0x02, 0x03, 0x00, 0x06, 0x03, 0x0f, 0x0f, 0x00, 0x00, 0x01, 0x00,
+    0x84, 0x00, 0x06, 0x01, 0x00, 0x00, 0x0f, 0x0f, 0x03, 0x03, 0x00, 0x03, 0x04, 0x0f, 0x0e, 0x03,
+    0x04, 0x0b, 0x0f, 0x0f, 0x0c, 0x03, 0x03, 0x0e, 0x0f, 0x05, 0x03, 0x00, 0x03, 0x05, 0x0f, 0x0d,
+    0x03, 0x04, 0x05, 0x0f, 0x0f, 0x06, 0x03, 0x03, 0x0c, 0x0f, 0x06, 0x03, 0x00, 0x03, 0x06, 0x0f,
+    0x0b, 0x04, 0x02, 0x0d, 0x0d, 0x04, 0x03, 0x0a, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x08, 0x0d, 0x03,
+    0x06, 0x03, 0x02, 0x0e, 0x06, 0x02, 0x00, 0x04, 0x0e, 0x0f, 0x0e, 0x01, 0x05, 0x03, 0x07, 0x0f,
+    0x0c, 0x02, 0x00, 0x04, 0x0e, 0x0f, 0x0f, 0x0a, 0x05, 0x03, 0x07, 0x0f, 0x0c, 0x02, 0x00, 0x05,
+    0x0e, 0x0f, 0x0f, 0x0f, 0x05, 0x04, 0x03, 0x07, 0x0f, 0x0c, 0x02, 0x00, 0x06, 0x0e, 0x0f, 0x0c,
+    0x0f, 0x0f, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x0c, 0x02, 0x00, 0x06, 0x0e, 0x0f, 0x05, 0x0c, 0x0f,
+    0x0b, 0x03, 0x03, 0x07, 0x0f, 0x0c, 0x01, 0x00, 0x0c, 0x0e, 0x0f, 0x04, 0x02, 0x0f, 0x0f, 0x07,
+    0x00, 0x00, 0x07, 0x0f, 0x0c, 0x01, 0x00, 0x0c, 0x0e, 0x0f, 0x04, 0x00, 0x06, 0x0f, 0x0f, 0x03,
+    0x00, 0x07, 0x0f, 0x0c, 0x01, 0x00, 0x0c, 0x0e, 0x0f, 0x04, 0x00, 0x00, 0x0b, 0x0f, 0x0d, 0x00,
+    0x07, 0x0f, 0x0c, 0x01, 0x00, 0x0c, 0x0e, 0x0f, 0x04, 0x00, 0x00, 0x01, 0x0e, 0x0f, 0x09, 0x07,
+    0x0f, 0x0c, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x03, 0x06, 0x05, 0x0f, 0x0f, 0x0b, 0x0f, 0x0c,
+    0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x05, 0x09, 0x0f, 0x0f, 0x0f, 0x0c, 0x02, 0x00, 0x03,
+    0x0e, 0x0f, 0x04, 0x05, 0x04, 0x0d, 0x0f, 0x0f, 0x0c, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x05,
+    0x04, 0x03, 0x0f, 0x0f, 0x0c, 0x02, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x06, 0x03, 0x07, 0x0f, 0x0b,
+    0x01, 0x04, 0x08, 0x01, 0x08, 0x0d, 0x0f, 0x0f, 0x0d, 0x08, 0x01, 0x03, 0x03, 0x02, 0x05, 0x0e,
+    0x00, 0x86, 0x00, 0x02, 0x0e, 0x05, 0x01, 0x02, 0x0c, 0x06, 0x0f, 0x0f, 0x0d, 0x07, 0x04, 0x04,
+    0x07, 0x0d, 0x0f, 0x0f, 0x06, 0x02, 0x01, 0x04, 0x01, 0x0e, 0x0f, 0x0a, 0x06, 0x04, 0x0a, 0x0f,
+    0x0f, 0x01, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x0e, 0x08, 0x03, 0x0e, 0x0f, 0x09, 0x02, 0x01, 0x03,
+    0x0e, 0x0f, 0x06, 0x08, 0x03, 0x06, 0x0f, 0x0e, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x03, 0x08,
+    0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x08, 0x04, 0x01, 0x0f,
+    0x0f, 0x02, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x03, 0x08, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02,
+    0x01, 0x03, 0x0e, 0x0f, 0x06, 0x08, 0x03, 0x06, 0x0f, 0x0e, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x0e,
+    0x08, 0x03, 0x0e, 0x0f, 0x0a, 0x02, 0x01, 0x04, 0x01, 0x0f, 0x0f, 0x0a, 0x06, 0x04, 0x0a, 0x0f,
+    0x0f, 0x01, 0x01, 0x02, 0x0c, 0x06, 0x0f, 0x0f, 0x0d, 0x07, 0x04, 0x04, 0x07, 0x0d, 0x0f, 0x0f,
+    0x06, 0x03, 0x03, 0x02, 0x05, 0x0e, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x05, 0x01, 0x04, 0x08, 0x01,
+    0x09, 0x0d, 0x0f, 0x0f, 0x0d, 0x09, 0x01, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x03, 0x0d,
+    0x09, 0x01, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x87, 0x00, 0x02, 0x0e, 0x03, 0x01, 0x00, 0x0a, 0x0e,
+    0x0f, 0x07, 0x03, 0x03, 0x03, 0x06, 0x0e, 0x0f, 0x0d, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04,
+    0x04, 0x02, 0x0f, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x05, 0x03, 0x0b, 0x0f, 0x07,
+    0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x05, 0x03, 0x0a, 0x0f, 0x08, 0x02, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x05, 0x03, 0x0e, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x03, 0x05, 0x03, 0x0c,
+    0x0f, 0x0e, 0x01, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x06, 0x03, 0x00, 0x01, 0x0e,
+    0x00, 0x86, 0x00, 0x02, 0x0d, 0x04, 0x01, 0x00, 0x06, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x01,
+    0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01, 0x04, 0x08, 0x01, 0x08, 0x0d, 0x0f, 0x0f, 0x0d,
+    0x08, 0x01, 0x03, 0x03, 0x02, 0x05, 0x0e, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x05, 0x01, 0x02, 0x0c,
+    0x06, 0x0f, 0x0f, 0x0d, 0x07, 0x04, 0x04, 0x07, 0x0d, 0x0f, 0x0f, 0x06, 0x02, 0x01, 0x04, 0x01,
+    0x0e, 0x0f, 0x0a, 0x06, 0x04, 0x0a, 0x0f, 0x0f, 0x01, 0x02, 0x01, 0x03, 0x09, 0x0f, 0x0e, 0x08,
+    0x03, 0x0e, 0x0f, 0x09, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x06, 0x08, 0x03, 0x06, 0x0f, 0x0e, 0x02,
+    0x00, 0x04, 0x01, 0x0f, 0x0f, 0x03, 0x08, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x02,
+    0x0f, 0x0f, 0x01, 0x08, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x03, 0x08,
+    0x03, 0x03, 0x0f, 0x0f, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x06, 0x08, 0x03, 0x06, 0x0f, 0x0e, 0x02,
+    0x01, 0x03, 0x0a, 0x0f, 0x0d, 0x08, 0x03, 0x0d, 0x0f, 0x0a, 0x02, 0x01, 0x04, 0x02, 0x0f, 0x0f,
+    0x09, 0x06, 0x04, 0x09, 0x0f, 0x0f, 0x02, 0x01, 0x02, 0x0c, 0x08, 0x0f, 0x0f, 0x0d, 0x06, 0x03,
+    0x03, 0x06, 0x0d, 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x07, 0x00, 0x88, 0x00, 0x01, 0x07, 0x01,
+    0x04, 0x08, 0x03, 0x0a, 0x0e, 0x0f, 0x0f, 0x0f, 0x09, 0x02, 0x01, 0x07, 0x05, 0x01, 0x0f, 0x0f,
+    0x07, 0x01, 0x01, 0x08, 0x06, 0x07, 0x0f, 0x0f, 0x0f, 0x0e, 0x04, 0x01, 0x09, 0x05, 0x05, 0x0c,
+    0x0e, 0x0f, 0x05, 0x03, 0x00, 0x01, 0x08, 0x00, 0x85, 0x00, 0x03, 0x0e, 0x0b, 0x03, 0x03, 0x00,
+    0x01, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x05, 0x01, 0x00, 0x0a, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03,
+    0x05, 0x0c, 0x0f, 0x0e, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x04, 0x01, 0x0f, 0x0f, 0x04,
+    0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x05, 0x03, 0x0c, 0x0f, 0x07, 0x02, 0x00, 0x03, 0x0e, 0x0f,
+    0x04, 0x05, 0x03, 0x0e, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x03, 0x05, 0x01, 0x0a,
+    0x0f, 0x0f, 0x01, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x08, 0x03, 0x00, 0x01, 0x0e,
+    0x00, 0x87, 0x00, 0x01, 0x07, 0x01, 0x00, 0x09, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x05, 0x0f, 0x0f,
+    0x04, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x03, 0x03, 0x0b, 0x0f, 0x0d, 0x02, 0x00, 0x03, 0x0e,
+    0x0f, 0x04, 0x03, 0x04, 0x03, 0x0f, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x03,
+    0x0a, 0x0f, 0x0e, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x04, 0x04, 0x02, 0x0f, 0x0f, 0x05, 0x02,
+    0x00, 0x03, 0x0d, 0x0f, 0x04, 0x05, 0x03, 0x08, 0x0e, 0x02, 0x01, 0x03, 0x06, 0x07, 0x0c, 0x0e,
+    0x0e, 0x0c, 0x07, 0x03, 0x01, 0x02, 0x01, 0x0d, 0x00, 0x86, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x01,
+    0x0a, 0x09, 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x07, 0x0e, 0x0f, 0x06, 0x02, 0x01, 0x03, 0x0e, 0x0f,
+    0x06, 0x04, 0x02, 0x01, 0x05, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x05, 0x01, 0x01, 0x04, 0x0b, 0x0f,
+    0x0d, 0x03, 0x01, 0x01, 0x07, 0x03, 0x0f, 0x0f, 0x0f, 0x0d, 0x08, 0x03, 0x03, 0x02, 0x02, 0x03,
+    0x0b, 0x00, 0x84, 0x00, 0x02, 0x0d, 0x04, 0x01, 0x04, 0x07, 0x01, 0x06, 0x0b, 0x0f, 0x0f, 0x0f,
+    0x04, 0x01, 0x07, 0x04, 0x01, 0x0b, 0x0f, 0x0c, 0x01, 0x08, 0x03, 0x04, 0x0f, 0x0f, 0x02, 0x00,
+    0x03, 0x01, 0x0d, 0x08, 0x05, 0x03, 0x07, 0x0f, 0x0d, 0x01, 0x00, 0x0b, 0x03, 0x0f, 0x0f, 0x0e,
+    0x07, 0x04, 0x04, 0x08, 0x0f, 0x0f, 0x08, 0x03, 0x01, 0x01, 0x06, 0x00, 0x87, 0x00, 0x01, 0x0c,
+    0x01, 0x02, 0x07, 0x01, 0x08, 0x0c, 0x0e, 0x0e, 0x0b, 0x06, 0x03, 0x00, 0x01, 0x04, 0x00, 0x89,
+    0x00, 0x02, 0x0e, 0x02, 0x03, 0x00, 0x01, 0x06, 0x00, 0x8a, 0x00, 0x01, 0x04, 0x01, 0x01, 0x0a,
+    0x02, 0x03, 0x03, 0x06, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x02, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f,
+    0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x03,
+    0x0f, 0x0f, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04,
+    0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f,
+    0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x02,
+    0x0f, 0x0f, 0x02, 0x00, 0x03, 0x08, 0x0d, 0x01, 0x06, 0x03, 0x06, 0x0e, 0x02, 0x02, 0x00, 0x03,
+    0x0e, 0x0f, 0x04, 0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03,
+    0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00,
+    0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06,
+    0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02,
+    0x00, 0x03, 0x0e, 0x0f, 0x04, 0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0e, 0x0f, 0x05,
+    0x06, 0x03, 0x0c, 0x0f, 0x06, 0x02, 0x00, 0x03, 0x0d, 0x0f, 0x06, 0x06, 0x03, 0x0d, 0x0f, 0x05,
+    0x02, 0x00, 0x03, 0x0a, 0x0f, 0x09, 0x05, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x04, 0x06,
+    0x0f, 0x0f, 0x02, 0x04, 0x03, 0x09, 0x0f, 0x0e, 0x01, 0x01, 0x0a, 0x0d, 0x0f, 0x0e, 0x06, 0x02,
+    0x03, 0x09, 0x0f, 0x0f, 0x06, 0x03, 0x01, 0x02, 0x03, 0x0e, 0x00, 0x86, 0x00, 0x01, 0x09, 0x01,
+    0x03, 0x06, 0x08, 0x0c, 0x0f, 0x0d, 0x0b, 0x04, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x07, 0x08, 0x03,
+    0x06, 0x0e, 0x03, 0x02, 0x00, 0x04, 0x05, 0x0f, 0x0f, 0x01, 0x07, 0x03, 0x0e, 0x0f, 0x06, 0x02,
+    0x01, 0x03, 0x0f, 0x0f, 0x06, 0x06, 0x04, 0x04, 0x0f, 0x0f, 0x01, 0x02, 0x01, 0x03, 0x09, 0x0f,
+    0x0d, 0x06, 0x03, 0x0b, 0x0f, 0x0a, 0x02, 0x01, 0x04, 0x02, 0x0f, 0x0f, 0x03, 0x04, 0x04, 0x01,
+    0x0f, 0x0f, 0x04, 0x02, 0x02, 0x03, 0x0c, 0x0f, 0x09, 0x04, 0x03, 0x07, 0x0f, 0x0d, 0x02, 0x02,
+    0x03, 0x05, 0x0f, 0x0f, 0x04, 0x03, 0x0e, 0x0f, 0x07, 0x01, 0x03, 0x09, 0x0e, 0x0f, 0x06, 0x00,
+    0x00, 0x04, 0x0f, 0x0f, 0x01, 0x01, 0x03, 0x08, 0x08, 0x0f, 0x0c, 0x00, 0x00, 0x0a, 0x0f, 0x09,
+    0x01, 0x03, 0x08, 0x01, 0x0f, 0x0f, 0x03, 0x01, 0x0f, 0x0f, 0x03, 0x01, 0x04, 0x06, 0x0b, 0x0f,
+    0x09, 0x07, 0x0f, 0x0c, 0x01, 0x04, 0x06, 0x04, 0x0f, 0x0f, 0x0d, 0x0f, 0x06, 0x01, 0x05, 0x04,
+    0x0d, 0x0f, 0x0f, 0x0f, 0x01, 0x05, 0x04, 0x07, 0x0f, 0x0f, 0x09, 0x01, 0x06, 0x03, 0x0c, 0x0d,
+    0x01, 0x03, 0x00, 0x03, 0x05, 0x0e, 0x03, 0x05, 0x03, 0x0d, 0x0e, 0x03, 0x04, 0x03, 0x01, 0x0d,
+    0x09, 0x03, 0x00, 0x03, 0x09, 0x0f, 0x0a, 0x04, 0x04, 0x05, 0x0f, 0x0f, 0x09, 0x04, 0x03, 0x06,
+    0x0f, 0x0d, 0x03, 0x00, 0x03, 0x06, 0x0f, 0x0e, 0x04, 0x04, 0x09, 0x0f, 0x0f, 0x0d, 0x04, 0x03,
+    0x0a, 0x0f, 0x0a, 0x03, 0x00, 0x04, 0x02, 0x0f, 0x0f, 0x02, 0x03, 0x05, 0x0d, 0x0f, 0x0f, 0x0f,
+    0x01, 0x03, 0x03, 0x0e, 0x0f, 0x06, 0x03, 0x01, 0x06, 0x0d, 0x0f, 0x06, 0x00, 0x00, 0x01, 0x00,
+    0x84, 0x00, 0x07, 0x05, 0x00, 0x00, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x10, 0x09, 0x0f, 0x0a,
+    0x00, 0x00, 0x05, 0x0f, 0x0d, 0x0a, 0x0f, 0x09, 0x00, 0x00, 0x06, 0x0f, 0x0d, 0x01, 0x01, 0x10,
+    0x05, 0x0f, 0x0e, 0x00, 0x00, 0x09, 0x0f, 0x09, 0x05, 0x0f, 0x0d, 0x00, 0x00, 0x0a, 0x0f, 0x09,
+    0x01, 0x01, 0x10, 0x01, 0x0f, 0x0f, 0x02, 0x00, 0x0d, 0x0f, 0x05, 0x01, 0x0f, 0x0f, 0x01, 0x00,
+    0x0e, 0x0f, 0x05, 0x01, 0x02, 0x0f, 0x0d, 0x0f, 0x06, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x0d, 0x0f,
+    0x05, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0e, 0x09, 0x0f, 0x0a, 0x05, 0x0f, 0x0d, 0x00, 0x00,
+    0x09, 0x0f, 0x09, 0x06, 0x0f, 0x0d, 0x01, 0x02, 0x0e, 0x04, 0x0f, 0x0e, 0x09, 0x0f, 0x09, 0x00,
+    0x00, 0x05, 0x0f, 0x0d, 0x0a, 0x0f, 0x08, 0x01, 0x03, 0x0d, 0x0f, 0x0f, 0x0e, 0x0f, 0x05, 0x00,
+    0x00, 0x01, 0x0f, 0x0f, 0x0e, 0x0f, 0x04, 0x02, 0x03, 0x05, 0x0c, 0x0f, 0x0f, 0x0f, 0x01, 0x03,
+    0x04, 0x0d, 0x0f, 0x0f, 0x0f, 0x02, 0x03, 0x04, 0x08, 0x0f, 0x0f, 0x0d, 0x04, 0x04, 0x09, 0x0f,
+    0x0f, 0x0c, 0x02, 0x03, 0x04, 0x03, 0x0f, 0x0f, 0x08, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x07, 0x02,
+    0x01, 0x02, 0x0c, 0x0b, 0x06, 0x02, 0x0a, 0x0c, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x08, 0x04, 0x04,
+    0x07, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x0a, 0x08, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x02, 0x0f, 0x0f,
+    0x09, 0x01, 0x02, 0x08, 0x0d, 0x0f, 0x0d, 0x00, 0x00, 0x0c, 0x0f, 0x0d, 0x01, 0x02, 0x08, 0x03,
+    0x0f, 0x0f, 0x07, 0x07, 0x0f, 0x0f, 0x04, 0x03, 0x03, 0x01, 0x08, 0x00, 0x84, 0x00, 0x01, 0x09,
+    0x01, 0x04, 0x04, 0x0d, 0x0f, 0x0f, 0x0d, 0x01, 0x04, 0x04, 0x08, 0x0f, 0x0f, 0x09, 0x03, 0x03,
+    0x01, 0x02, 0x00, 0x84, 0x00, 0x01, 0x02, 0x01, 0x03, 0x06, 0x0c, 0x0f, 0x0e, 0x0d, 0x0f, 0x0c,
+    0x01, 0x02, 0x08, 0x07, 0x0f, 0x0f, 0x04, 0x03, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x0a, 0x02, 0x0f,
+    0x0f, 0x09, 0x00, 0x00, 0x09, 0x0f, 0x0f, 0x02, 0x02, 0x01, 0x03, 0x0c, 0x0f, 0x0e, 0x04, 0x03,
+    0x0d, 0x0f, 0x0c, 0x02, 0x00, 0x04, 0x04, 0x0f, 0x0f, 0x04, 0x04, 0x04, 0x03, 0x0f, 0x0f, 0x05,
+    0x02, 0x00, 0x03, 0x02, 0x0e, 0x08, 0x06, 0x03, 0x07, 0x0e, 0x02, 0x02, 0x00, 0x03, 0x03, 0x0e,
+    0x06, 0x06, 0x03, 0x05, 0x0e, 0x04, 0x02, 0x00, 0x04, 0x06, 0x0f, 0x0f, 0x03, 0x04, 0x04, 0x02,
+    0x0f, 0x0f, 0x06, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x0c, 0x04, 0x03, 0x0c, 0x0f, 0x0e, 0x01, 0x01,
+    0x0a, 0x03, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x04, 0x01, 0x02, 0x08, 0x09, 0x0f,
+    0x0f, 0x02, 0x01, 0x0f, 0x0f, 0x09, 0x01, 0x03, 0x07, 0x0d, 0x0f, 0x0c, 0x0b, 0x0f, 0x0e, 0x01,
+    0x03, 0x03, 0x01, 0x04, 0x00, 0x84, 0x00, 0x01, 0x04, 0x01, 0x04, 0x04, 0x09, 0x0f, 0x0f, 0x0a,
+    0x01, 0x04, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x04, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x04,
+    0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x04, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x04, 0x04, 0x01,
+    0x0f, 0x0f, 0x02, 0x01, 0x04, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x01, 0x05, 0x03, 0x0f, 0x0f, 0x01,
+    0x03, 0x01, 0x01, 0x09, 0x00, 0x88, 0x00, 0x01, 0x07, 0x03, 0x01, 0x01, 0x0c, 0x00, 0x88, 0x00,
+    0x01, 0x09, 0x01, 0x02, 0x09, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0c, 0x0f, 0x0f, 0x02, 0x01, 0x06,
+    0x04, 0x04, 0x0f, 0x0f, 0x08, 0x01, 0x06, 0x03, 0x0d, 0x0f, 0x0e, 0x01, 0x05, 0x04, 0x07, 0x0f,
+    0x0f, 0x05, 0x01, 0x04, 0x04, 0x02, 0x0f, 0x0f, 0x0b, 0x01, 0x04, 0x04, 0x0b, 0x0f, 0x0f, 0x02,
+    0x01, 0x03, 0x04, 0x04, 0x0f, 0x0f, 0x08, 0x01, 0x03, 0x03, 0x0d, 0x0f, 0x0d, 0x01, 0x02, 0x04,
+    0x08, 0x0f, 0x0f, 0x04, 0x01, 0x01, 0x04, 0x02, 0x0f, 0x0f, 0x0b, 0x01, 0x01, 0x09, 0x0b, 0x0f,
+    0x0f, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x03, 0x00, 0x89, 0x00, 0x01, 0x0e,
+    0x03, 0x00, 0x02, 0x02, 0x0e, 0x00, 0x88, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x06, 0x0a, 0x0f, 0x0f,
+    0x0f, 0x0d, 0x01, 0x03, 0x00, 0x01, 0x0e, 0x00, 0x84, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x0e,
+    0x0f, 0x07, 0x03, 0x01, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04,
+    0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e,
+    0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00,
+    0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04,
+    0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0e,
+    0x0f, 0x04, 0x01, 0x00, 0x06, 0x0e, 0x0f, 0x0f, 0x0f, 0x0d, 0x01, 0x03, 0x00, 0x01, 0x0c, 0x00,
+    0x84, 0x00, 0x01, 0x02, 0x01, 0x01, 0x04, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x03, 0x07, 0x0e,
+    0x01, 0x01, 0x00, 0x03, 0x0a, 0x0f, 0x08, 0x01, 0x00, 0x03, 0x05, 0x0f, 0x0d, 0x01, 0x01, 0x03,
+    0x0f, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x0a, 0x0f, 0x08, 0x01, 0x01, 0x03, 0x04, 0x0f, 0x0e, 0x01,
+    0x02, 0x03, 0x0e, 0x0f, 0x03, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x09, 0x01, 0x02, 0x03, 0x04, 0x0f,
+    0x0e, 0x01, 0x03, 0x03, 0x0e, 0x0f, 0x04, 0x01, 0x03, 0x03, 0x09, 0x0f, 0x0a, 0x01, 0x03, 0x03,
+    0x03, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x0d, 0x0f, 0x05, 0x01, 0x04, 0x03, 0x08, 0x0f, 0x0a, 0x01,
+    0x04, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x05, 0x03, 0x0d, 0x0f, 0x05, 0x01, 0x05, 0x03, 0x07, 0x0f,
+    0x0b, 0x01, 0x05, 0x03, 0x02, 0x0f, 0x0f, 0x01, 0x06, 0x02, 0x0a, 0x0d, 0x01, 0x00, 0x06, 0x01,
+    0x0e, 0x0f, 0x0f, 0x0f, 0x09, 0x03, 0x00, 0x01, 0x03, 0x00, 0x84, 0x00, 0x01, 0x0c, 0x01, 0x01,
+    0x05, 0x02, 0x03, 0x08, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06,
+    0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03,
+    0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c,
+    0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06,
+    0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03,
+    0x03, 0x06, 0x0f, 0x0c, 0x01, 0x00, 0x06, 0x02, 0x0e, 0x0f, 0x0f, 0x0f, 0x0c, 0x03, 0x00, 0x01,
+    0x03, 0x00, 0x84, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x04, 0x01, 0x03, 0x03, 0x03, 0x01, 0x05, 0x02,
+    0x04, 0x02, 0x01, 0x04, 0x03, 0x05, 0x0f, 0x0e, 0x01, 0x04, 0x04, 0x0e, 0x0f, 0x0f, 0x09, 0x01,
+    0x03, 0x06, 0x09, 0x0f, 0x0a, 0x0e, 0x0f, 0x03, 0x01, 0x02, 0x07, 0x03, 0x0f, 0x0e, 0x00, 0x05,
+    0x0f, 0x0d, 0x01, 0x02, 0x08, 0x0d, 0x0f, 0x05, 0x00, 0x00, 0x0b, 0x0f, 0x08, 0x02, 0x01, 0x03,
+    0x08, 0x0f, 0x0a, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01,
+    0x04, 0x03, 0x06, 0x0f, 0x0b, 0x02, 0x00, 0x03, 0x02, 0x0e, 0x05, 0x06, 0x02, 0x0a, 0x0a, 0x03,
+    0x01, 0x01, 0x0b, 0x00, 0x88, 0x00, 0x01, 0x0a, 0x03, 0x01, 0x01, 0x0b, 0x00, 0x88, 0x00, 0x01,
+    0x0b, 0x01, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x04, 0x08, 0x0f, 0x0c, 0x01, 0x01, 0x00, 0x05,
+    0x01, 0x0b, 0x0f, 0x0e, 0x03, 0x01, 0x02, 0x03, 0x06, 0x0e, 0x04, 0x01, 0x03, 0x09, 0x06, 0x0c,
+    0x0f, 0x0e, 0x09, 0x00, 0x06, 0x0d, 0x02, 0x03, 0x02, 0x01, 0x0a, 0x00, 0x85, 0x00, 0x04, 0x0c,
+    0x0c, 0x0f, 0x05, 0x01, 0x01, 0x0b, 0x06, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x06, 0x0e, 0x0f, 0x0f,
+    0x05, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x05, 0x02, 0x01, 0x02,
+    0x0f, 0x0f, 0x06, 0x03, 0x0d, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x06, 0x03, 0x0b,
+    0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0d, 0x0f, 0x05, 0x02, 0x01, 0x03, 0x0d,
+    0x0f, 0x07, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x05, 0x01, 0x01, 0x0b, 0x06, 0x0f, 0x0f, 0x07, 0x02,
+    0x01, 0x06, 0x0e, 0x0f, 0x0f, 0x05, 0x03, 0x02, 0x01, 0x0b, 0x00, 0x85, 0x00, 0x04, 0x0c, 0x0c,
+    0x0f, 0x05, 0x01, 0x03, 0x09, 0x06, 0x0c, 0x0f, 0x0c, 0x08, 0x00, 0x0a, 0x0f, 0x05, 0x01, 0x01,
+    0x02, 0x0c, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0f, 0x00, 0x06, 0x0b, 0x0f, 0x0c,
+    0x08, 0x03, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x09, 0x00, 0x85, 0x00, 0x02, 0x0d, 0x01, 0x01, 0x00,
+    0x0b, 0x01, 0x0f, 0x0f, 0x0f, 0x08, 0x02, 0x01, 0x05, 0x0e, 0x0f, 0x0a, 0x02, 0x00, 0x04, 0x01,
+    0x0f, 0x0f, 0x08, 0x04, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01,
+    0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x06,
+    0x02, 0x01, 0x03, 0x0e, 0x0f, 0x01, 0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x01, 0x03, 0x0b, 0x0f,
+    0x08, 0x04, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x0a, 0x03, 0x0f, 0x0f, 0x08, 0x02, 0x01,
+    0x05, 0x0e, 0x0f, 0x09, 0x03, 0x02, 0x01, 0x07, 0x00, 0x86, 0x00, 0x01, 0x0c, 0x01, 0x03, 0x06,
+    0x03, 0x0a, 0x0e, 0x0e, 0x0b, 0x06, 0x01, 0x03, 0x06, 0x04, 0x0b, 0x0e, 0x0f, 0x0c, 0x07, 0x03,
+    0x02, 0x01, 0x09, 0x00, 0x86, 0x00, 0x01, 0x07, 0x01, 0x01, 0x09, 0x05, 0x0f, 0x0f, 0x07, 0x01,
+    0x00, 0x04, 0x09, 0x03, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01,
+    0x00, 0x03, 0x02, 0x0f, 0x0e, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x07,
+    0x01, 0x01, 0x09, 0x05, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x04, 0x09, 0x03, 0x03, 0x02, 0x01, 0x09,
+    0x00, 0x86, 0x00, 0x01, 0x08, 0x01, 0x03, 0x06, 0x04, 0x0b, 0x0e, 0x0f, 0x0d, 0x07, 0x01, 0x09,
+    0x03, 0x06, 0x0e, 0x02, 0x01, 0x09, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x09, 0x03, 0x0b, 0x0f, 0x05,
+    0x01, 0x09, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x03, 0x09, 0x06, 0x0c, 0x0f, 0x0c, 0x08, 0x00, 0x0b,
+    0x0f, 0x05, 0x03, 0x02, 0x01, 0x0a, 0x00, 0x85, 0x00, 0x04, 0x0c, 0x0c, 0x0f, 0x05, 0x01, 0x01,
+    0x0b, 0x06, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x06, 0x0e, 0x0f, 0x0f, 0x05, 0x02, 0x01, 0x03, 0x0d,
+    0x0f, 0x07, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0d,
+    0x0f, 0x05, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x06, 0x03, 0x0b, 0x0f, 0x05, 0x02, 0x01, 0x02,
+    0x0f, 0x0f, 0x06, 0x03, 0x0e, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x04, 0x03, 0x04,
+    0x0f, 0x0f, 0x01, 0x01, 0x0a, 0x05, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x05, 0x0e, 0x0f, 0x07, 0x03,
+    0x02, 0x01, 0x09, 0x00, 0x86, 0x00, 0x01, 0x0b, 0x01, 0x03, 0x06, 0x04, 0x0b, 0x0e, 0x0e, 0x0b,
+    0x06, 0x01, 0x03, 0x06, 0x05, 0x0b, 0x0e, 0x0e, 0x0a, 0x03, 0x03, 0x02, 0x01, 0x0a, 0x00, 0x86,
+    0x00, 0x01, 0x06, 0x01, 0x01, 0x0a, 0x05, 0x0f, 0x0e, 0x05, 0x01, 0x01, 0x08, 0x0f, 0x0f, 0x02,
+    0x02, 0x01, 0x03, 0x0d, 0x0f, 0x04, 0x04, 0x03, 0x0a, 0x0f, 0x08, 0x01, 0x01, 0x0a, 0x0f, 0x0f,
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x0f, 0x0b, 0x03, 0x00, 0x01, 0x02, 0x00, 0x89, 0x00, 0x01,
+    0x08, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x08, 0x01, 0x01, 0x09,
+    0x05, 0x0f, 0x0f, 0x08, 0x01, 0x01, 0x04, 0x0a, 0x0a, 0x03, 0x02, 0x01, 0x09, 0x00, 0x86, 0x00,
+    0x01, 0x0d, 0x01, 0x03, 0x07, 0x04, 0x0b, 0x0e, 0x0f, 0x0d, 0x08, 0x01, 0x01, 0x03, 0x05, 0x03,
+    0x0b, 0x0e, 0x0f, 0x0b, 0x03, 0x02, 0x01, 0x02, 0x00, 0x84, 0x00, 0x01, 0x0a, 0x01, 0x02, 0x04,
+    0x08, 0x0f, 0x0c, 0x01, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x06, 0x03, 0x00, 0x01, 0x05, 0x00, 0x86,
+    0x00, 0x01, 0x06, 0x01, 0x00, 0x08, 0x05, 0x0e, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x05, 0x01, 0x02,
+    0x03, 0x0b, 0x0f, 0x05, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x05,
+    0x01, 0x02, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x02, 0x03, 0x0b,
+    0x0f, 0x05, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x02, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x02,
+    0x03, 0x0a, 0x0f, 0x05, 0x01, 0x03, 0x09, 0x06, 0x0c, 0x0f, 0x0e, 0x09, 0x00, 0x06, 0x0e, 0x02,
+    0x03, 0x02, 0x01, 0x0a, 0x00, 0x85, 0x00, 0x04, 0x0c, 0x0c, 0x0f, 0x05, 0x01, 0x01, 0x0b, 0x06,
+    0x0f, 0x0f, 0x07, 0x01, 0x01, 0x06, 0x0e, 0x0f, 0x0f, 0x05, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x07,
+    0x04, 0x04, 0x04, 0x0f, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0d, 0x0f, 0x05,
+    0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x06, 0x03, 0x0b, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f,
+    0x06, 0x03, 0x0d, 0x0f, 0x05, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x04, 0x04, 0x04, 0x0f, 0x0f,
+    0x05, 0x01, 0x01, 0x0b, 0x06, 0x0f, 0x0f, 0x07, 0x02, 0x01, 0x06, 0x0e, 0x0f, 0x0f, 0x05, 0x03,
+    0x02, 0x01, 0x0b, 0x00, 0x85, 0x00, 0x04, 0x0c, 0x0c, 0x0f, 0x05, 0x01, 0x03, 0x09, 0x06, 0x0c,
+    0x0f, 0x0c, 0x08, 0x00, 0x0d, 0x0f, 0x04, 0x01, 0x08, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x02,
+    0x09, 0x0a, 0x08, 0x03, 0x01, 0x00, 0x04, 0x0d, 0x0f, 0x0b, 0x03, 0x01, 0x01, 0x02, 0x00, 0x87,
+    0x00, 0x02, 0x0e, 0x01, 0x01, 0x02, 0x07, 0x01, 0x08, 0x0c, 0x0e, 0x0f, 0x0c, 0x08, 0x01, 0x01,
+    0x02, 0x0b, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0f, 0x02, 0x0a, 0x0e, 0x0e, 0x0b,
+    0x02, 0x03, 0x00, 0x01, 0x01, 0x00, 0x88, 0x00, 0x01, 0x03, 0x01, 0x00, 0x0a, 0x01, 0x0f, 0x0f,
+    0x0e, 0x04, 0x00, 0x02, 0x0c, 0x0f, 0x0c, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x04,
+    0x01, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x04, 0x03, 0x0d, 0x0f, 0x04,
+    0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0f,
+    0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f,
+    0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01,
+    0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x0b, 0x0f,
+    0x04, 0x01, 0x01, 0x03, 0x0a, 0x0d, 0x02, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x06, 0x01, 0x01, 0x03,
+    0x06, 0x0a, 0x01, 0x00, 0x01, 0x01, 0x02, 0x08, 0x0d, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01,
+    0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x0d, 0x0f,
+    0x03, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x03,
+    0x0d, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01,
+    0x01, 0x03, 0x0d, 0x0f, 0x03, 0x01, 0x03, 0x03, 0x07, 0x0e, 0x04, 0x01, 0x03, 0x03, 0x0d, 0x0f,
+    0x0a, 0x01, 0x03, 0x03, 0x04, 0x0a, 0x02, 0x00, 0x01, 0x03, 0x03, 0x05, 0x0e, 0x03, 0x01, 0x03,
+    0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07,
+    0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0a,
+    0x0f, 0x07, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03,
+    0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x03, 0x03, 0x0b, 0x0f, 0x06,
+    0x01, 0x02, 0x04, 0x02, 0x0f, 0x0f, 0x04, 0x01, 0x01, 0x04, 0x0d, 0x0f, 0x0f, 0x0d, 0x01, 0x01,
+    0x04, 0x0e, 0x0e, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f,
+    0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x02, 0x00, 0x03, 0x01,
+    0x0f, 0x0f, 0x03, 0x03, 0x02, 0x0d, 0x06, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0f, 0x00, 0x00, 0x02,
+    0x0e, 0x0f, 0x07, 0x01, 0x00, 0x08, 0x01, 0x0f, 0x0f, 0x00, 0x02, 0x0e, 0x0f, 0x0a, 0x01, 0x00,
+    0x07, 0x01, 0x0f, 0x0f, 0x02, 0x0e, 0x0f, 0x0a, 0x01, 0x00, 0x07, 0x01, 0x0f, 0x0f, 0x0e, 0x0f,
+    0x0f, 0x02, 0x03, 0x00, 0x01, 0x01, 0x00, 0x85, 0x00, 0x01, 0x0c, 0x01, 0x00, 0x08, 0x01, 0x0f,
+    0x0f, 0x0b, 0x02, 0x0e, 0x0f, 0x07, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x05, 0x0f,
+    0x0f, 0x03, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x03, 0x03, 0x09, 0x0f, 0x0d, 0x02, 0x00, 0x03,
+    0x01, 0x0f, 0x0f, 0x04, 0x03, 0x0d, 0x0f, 0x07, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x04, 0x03, 0x03,
+    0x0d, 0x06, 0x01, 0x01, 0x02, 0x0b, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03,
+    0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f,
+    0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03,
+    0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x0e, 0x0b, 0x0a, 0x04,
+    0x0c, 0x0f, 0x0d, 0x06, 0x00, 0x00, 0x09, 0x0e, 0x0e, 0x0a, 0x01, 0x05, 0x00, 0x01, 0x01, 0x00,
+    0x87, 0x00, 0x02, 0x07, 0x0b, 0x00, 0x84, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x10, 0x01, 0x0f, 0x0f,
+    0x0d, 0x02, 0x00, 0x08, 0x0f, 0x0f, 0x0f, 0x05, 0x00, 0x03, 0x0e, 0x0f, 0x07, 0x03, 0x00, 0x04,
+    0x01, 0x0f, 0x0f, 0x04, 0x03, 0x03, 0x0d, 0x0f, 0x0a, 0x03, 0x03, 0x06, 0x0f, 0x0b, 0x03, 0x00,
+    0x04, 0x01, 0x0f, 0x0f, 0x01, 0x03, 0x03, 0x0a, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x03,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x04, 0x03, 0x0a, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x03,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x04, 0x03, 0x0a, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x03,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x04, 0x03, 0x0a, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x03,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x04, 0x03, 0x0a, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x03,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x04, 0x03, 0x0a, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x0f, 0x0e, 0x03,
+    0x01, 0x02, 0x0f, 0x0f, 0x04, 0x03, 0x09, 0x0f, 0x06, 0x03, 0x03, 0x02, 0x0f, 0x0d, 0x01, 0x01,
+    0x08, 0x0b, 0x0b, 0x01, 0x0a, 0x0e, 0x0e, 0x0b, 0x02, 0x03, 0x00, 0x01, 0x01, 0x00, 0x88, 0x00,
+    0x01, 0x03, 0x01, 0x00, 0x0a, 0x01, 0x0f, 0x0f, 0x0e, 0x04, 0x00, 0x02, 0x0c, 0x0f, 0x0c, 0x02,
+    0x00, 0x04, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x01,
+    0x0f, 0x0f, 0x01, 0x04, 0x03, 0x0d, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03,
+    0x0c, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x05, 0x02, 0x00,
+    0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05,
+    0x03, 0x0c, 0x0f, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x05, 0x02,
+    0x01, 0x02, 0x0f, 0x0f, 0x05, 0x03, 0x0b, 0x0f, 0x04, 0x01, 0x03, 0x06, 0x04, 0x0b, 0x0e, 0x0e,
+    0x0b, 0x05, 0x03, 0x02, 0x01, 0x09, 0x00, 0x86, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x0a, 0x05, 0x0f,
+    0x0f, 0x07, 0x01, 0x01, 0x06, 0x0e, 0x0f, 0x07, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x04, 0x03,
+    0x04, 0x0f, 0x0f, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0d, 0x0f, 0x03, 0x02, 0x00, 0x03,
+    0x02, 0x0f, 0x0e, 0x06, 0x03, 0x0b, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0e,
+    0x0f, 0x03, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x04, 0x03, 0x04, 0x0f, 0x0f, 0x01, 0x01, 0x0a,
+    0x05, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x06, 0x0e, 0x0f, 0x07, 0x03, 0x02, 0x01, 0x09, 0x00, 0x86,
+    0x00, 0x01, 0x0b, 0x01, 0x03, 0x06, 0x04, 0x0b, 0x0e, 0x0e, 0x0b, 0x06, 0x01, 0x03, 0x06, 0x03,
+    0x0a, 0x0d, 0x0e, 0x0b, 0x06, 0x03, 0x02, 0x01, 0x07, 0x00, 0x86, 0x00, 0x01, 0x0c, 0x01, 0x01,
+    0x0a, 0x03, 0x0f, 0x0f, 0x08, 0x02, 0x01, 0x05, 0x0e, 0x0f, 0x08, 0x02, 0x01, 0x03, 0x0b, 0x0f,
+    0x08, 0x04, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x02, 0x01, 0x03, 0x0e, 0x0f, 0x02, 0x05, 0x03, 0x0c,
+    0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x06, 0x03, 0x0a, 0x0f, 0x06, 0x02, 0x00, 0x04,
+    0x01, 0x0f, 0x0f, 0x01, 0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x08,
+    0x04, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x0f, 0x0f, 0x0f, 0x08, 0x02, 0x01,
+    0x05, 0x0e, 0x0f, 0x0a, 0x03, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x09, 0x00, 0x85, 0x00, 0x02, 0x0d,
+    0x01, 0x01, 0x00, 0x09, 0x01, 0x0f, 0x0f, 0x00, 0x06, 0x0b, 0x0f, 0x0c, 0x08, 0x01, 0x00, 0x03,
+    0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01,
+    0x01, 0x02, 0x0c, 0x0a, 0x01, 0x03, 0x06, 0x04, 0x0b, 0x0e, 0x0e, 0x0b, 0x06, 0x03, 0x02, 0x01,
+    0x08, 0x00, 0x86, 0x00, 0x01, 0x0b, 0x01, 0x01, 0x0a, 0x05, 0x0f, 0x0f, 0x07, 0x01, 0x01, 0x06,
+    0x0e, 0x0f, 0x07, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x07, 0x04, 0x03, 0x04, 0x0f, 0x0f, 0x02, 0x01,
+    0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0e, 0x0f, 0x03, 0x02, 0x00, 0x03, 0x02, 0x0f, 0x0e, 0x06, 0x03,
+    0x0b, 0x0f, 0x05, 0x02, 0x01, 0x02, 0x0f, 0x0f, 0x06, 0x03, 0x0d, 0x0f, 0x05, 0x02, 0x01, 0x03,
+    0x0d, 0x0f, 0x07, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x05, 0x01, 0x01, 0x0b, 0x06, 0x0f, 0x0f, 0x07,
+    0x01, 0x01, 0x05, 0x0e, 0x0f, 0x0f, 0x05, 0x03, 0x02, 0x01, 0x0b, 0x00, 0x85, 0x00, 0x04, 0x0c,
+    0x0c, 0x0f, 0x05, 0x01, 0x03, 0x09, 0x06, 0x0c, 0x0f, 0x0c, 0x08, 0x00, 0x0b, 0x0f, 0x05, 0x01,
+    0x09, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x09, 0x03, 0x0b, 0x0f, 0x05, 0x01, 0x09, 0x03, 0x0b, 0x0f,
+    0x05, 0x01, 0x09, 0x03, 0x06, 0x0e, 0x02, 0x01, 0x03, 0x04, 0x08, 0x0c, 0x0f, 0x0d, 0x01, 0x02,
+    0x05, 0x0d, 0x0f, 0x0f, 0x0f, 0x0c, 0x01, 0x01, 0x04, 0x08, 0x0f, 0x0e, 0x03, 0x01, 0x01, 0x03,
+    0x0d, 0x0f, 0x05, 0x01, 0x01, 0x03, 0x0f, 0x0f, 0x01, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01,
+    0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f,
+    0x0f, 0x01, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x02, 0x0f, 0x0f, 0x01, 0x01, 0x06, 0x01,
+    0x0a, 0x0e, 0x0f, 0x0c, 0x07, 0x03, 0x01, 0x01, 0x0c, 0x00, 0x85, 0x00, 0x01, 0x05, 0x01, 0x00,
+    0x08, 0x02, 0x0f, 0x0f, 0x03, 0x01, 0x05, 0x09, 0x02, 0x01, 0x00, 0x04, 0x02, 0x0f, 0x0e, 0x01,
+    0x01, 0x01, 0x05, 0x0c, 0x0f, 0x0f, 0x09, 0x02, 0x01, 0x01, 0x06, 0x01, 0x08, 0x0f, 0x0f, 0x0f,
+    0x09, 0x01, 0x03, 0x05, 0x01, 0x07, 0x0e, 0x0f, 0x09, 0x01, 0x05, 0x03, 0x03, 0x0f, 0x0e, 0x01,
+    0x00, 0x08, 0x02, 0x09, 0x05, 0x01, 0x01, 0x09, 0x0f, 0x0c, 0x03, 0x00, 0x01, 0x05, 0x00, 0x86,
+    0x00, 0x01, 0x06, 0x01, 0x01, 0x06, 0x06, 0x0c, 0x0f, 0x0f, 0x0c, 0x05, 0x01, 0x02, 0x03, 0x03,
+    0x09, 0x01, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x06, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x07, 0x03, 0x00,
+    0x01, 0x05, 0x00, 0x84, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x00, 0x07, 0x05, 0x0e, 0x0f, 0x0f, 0x0f,
+    0x0d, 0x02, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x02,
+    0x03, 0x0a, 0x0f, 0x07, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x07,
+    0x01, 0x02, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x02, 0x03, 0x0a, 0x0f, 0x07, 0x01, 0x02, 0x03, 0x0a,
+    0x0f, 0x07, 0x01, 0x02, 0x03, 0x09, 0x0f, 0x06, 0x02, 0x01, 0x02, 0x0b, 0x0b, 0x05, 0x03, 0x07,
+    0x0d, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x00, 0x03,
+    0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03,
+    0x0c, 0x0f, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x00,
+    0x03, 0x01, 0x0f, 0x0f, 0x05, 0x03, 0x0c, 0x0f, 0x04, 0x02, 0x01, 0x03, 0x0f, 0x0f, 0x01, 0x04,
+    0x03, 0x0d, 0x0f, 0x03, 0x02, 0x01, 0x03, 0x0d, 0x0f, 0x05, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x01,
+    0x01, 0x01, 0x09, 0x08, 0x0f, 0x0e, 0x04, 0x00, 0x02, 0x0c, 0x0f, 0x0c, 0x03, 0x02, 0x01, 0x0d,
+    0x00, 0x85, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x03, 0x06, 0x07, 0x0c, 0x0f, 0x0d, 0x09, 0x01, 0x02,
+    0x00, 0x03, 0x06, 0x0e, 0x03, 0x05, 0x02, 0x09, 0x0d, 0x02, 0x00, 0x03, 0x08, 0x0f, 0x0a, 0x04,
+    0x04, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x03, 0x0f, 0x0f, 0x01, 0x03, 0x03, 0x09, 0x0f,
+    0x0b, 0x02, 0x01, 0x03, 0x0b, 0x0f, 0x08, 0x03, 0x03, 0x0f, 0x0f, 0x04, 0x01, 0x01, 0x08, 0x04,
+    0x0f, 0x0e, 0x00, 0x00, 0x06, 0x0f, 0x0d, 0x01, 0x02, 0x07, 0x0d, 0x0f, 0x06, 0x00, 0x0d, 0x0f,
+    0x06, 0x01, 0x02, 0x06, 0x07, 0x0f, 0x0c, 0x04, 0x0f, 0x0e, 0x01, 0x03, 0x05, 0x0f, 0x0f, 0x0d,
+    0x0f, 0x08, 0x01, 0x03, 0x05, 0x09, 0x0f, 0x0f, 0x0f, 0x01, 0x01, 0x03, 0x04, 0x02, 0x0f, 0x0f,
+    0x0a, 0x01, 0x04, 0x03, 0x0a, 0x0f, 0x02, 0x03, 0x00, 0x03, 0x04, 0x0e, 0x04, 0x04, 0x03, 0x07,
+    0x0e, 0x03, 0x04, 0x03, 0x08, 0x0d, 0x01, 0x03, 0x00, 0x03, 0x07, 0x0f, 0x0b, 0x04, 0x03, 0x0e,
+    0x0f, 0x0a, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x02, 0x02, 0x00, 0x0a, 0x02, 0x0f, 0x0f, 0x01, 0x00,
+    0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x06, 0x0f, 0x0d, 0x01, 0x01, 0x0f, 0x0c, 0x0f, 0x07,
+    0x00, 0x00, 0x0a, 0x0f, 0x0f, 0x0f, 0x05, 0x00, 0x00, 0x0c, 0x0f, 0x07, 0x01, 0x01, 0x0f, 0x06,
+    0x0f, 0x0c, 0x00, 0x00, 0x0f, 0x0f, 0x07, 0x0f, 0x0b, 0x00, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x02,
+    0x0d, 0x0f, 0x0f, 0x02, 0x06, 0x0f, 0x0b, 0x00, 0x0f, 0x0f, 0x01, 0x07, 0x0f, 0x0a, 0x01, 0x02,
+    0x0d, 0x09, 0x0f, 0x08, 0x0b, 0x0f, 0x05, 0x00, 0x0a, 0x0f, 0x07, 0x0d, 0x0f, 0x04, 0x01, 0x02,
+    0x0c, 0x03, 0x0f, 0x0e, 0x0f, 0x0e, 0x00, 0x00, 0x04, 0x0f, 0x0e, 0x0f, 0x0e, 0x02, 0x03, 0x04,
+    0x0d, 0x0f, 0x0f, 0x09, 0x03, 0x04, 0x0e, 0x0f, 0x0f, 0x08, 0x02, 0x03, 0x04, 0x07, 0x0f, 0x0f,
+    0x03, 0x03, 0x04, 0x08, 0x0f, 0x0f, 0x02, 0x02, 0x03, 0x03, 0x01, 0x0e, 0x0c, 0x04, 0x03, 0x02,
+    0x0f, 0x0b, 0x02, 0x00, 0x03, 0x04, 0x0e, 0x05, 0x04, 0x03, 0x04, 0x0e, 0x06, 0x01, 0x00, 0x0a,
+    0x06, 0x0f, 0x0f, 0x03, 0x00, 0x00, 0x02, 0x0e, 0x0f, 0x08, 0x01, 0x01, 0x08, 0x0b, 0x0f, 0x0e,
+    0x01, 0x00, 0x0d, 0x0f, 0x0c, 0x01, 0x01, 0x08, 0x01, 0x0d, 0x0f, 0x0c, 0x0a, 0x0f, 0x0e, 0x01,
+    0x03, 0x02, 0x01, 0x02, 0x00, 0x84, 0x00, 0x01, 0x03, 0x01, 0x03, 0x04, 0x08, 0x0f, 0x0f, 0x09,
+    0x03, 0x02, 0x01, 0x02, 0x00, 0x84, 0x00, 0x01, 0x03, 0x01, 0x02, 0x07, 0x0d, 0x0f, 0x0c, 0x0a,
+    0x0f, 0x0e, 0x01, 0x01, 0x01, 0x08, 0x0b, 0x0f, 0x0e, 0x01, 0x00, 0x0c, 0x0f, 0x0c, 0x01, 0x00,
+    0x0a, 0x06, 0x0f, 0x0f, 0x02, 0x00, 0x00, 0x01, 0x0e, 0x0f, 0x08, 0x02, 0x00, 0x03, 0x04, 0x0e,
+    0x04, 0x04, 0x03, 0x03, 0x0d, 0x06, 0x02, 0x00, 0x03, 0x06, 0x0e, 0x03, 0x05, 0x02, 0x0a, 0x0d,
+    0x02, 0x00, 0x03, 0x08, 0x0f, 0x0b, 0x04, 0x04, 0x02, 0x0f, 0x0f, 0x01, 0x02, 0x00, 0x04, 0x02,
+    0x0f, 0x0f, 0x02, 0x03, 0x03, 0x09, 0x0f, 0x0b, 0x01, 0x01, 0x09, 0x0b, 0x0f, 0x09, 0x00, 0x00,
+    0x01, 0x0f, 0x0f, 0x04, 0x01, 0x01, 0x08, 0x04, 0x0f, 0x0f, 0x00, 0x00, 0x07, 0x0f, 0x0d, 0x01,
+    0x02, 0x07, 0x0d, 0x0f, 0x07, 0x00, 0x0e, 0x0f, 0x06, 0x01, 0x02, 0x06, 0x06, 0x0f, 0x0d, 0x05,
+    0x0f, 0x0e, 0x01, 0x03, 0x05, 0x0e, 0x0f, 0x0e, 0x0f, 0x07, 0x01, 0x03, 0x05, 0x07, 0x0f, 0x0f,
+    0x0f, 0x01, 0x01, 0x03, 0x04, 0x01, 0x0f, 0x0f, 0x09, 0x01, 0x04, 0x03, 0x0e, 0x0f, 0x02, 0x01,
+    0x03, 0x03, 0x07, 0x0f, 0x0b, 0x01, 0x02, 0x04, 0x02, 0x0e, 0x0f, 0x04, 0x01, 0x00, 0x05, 0x05,
+    0x0e, 0x0f, 0x0f, 0x0b, 0x01, 0x00, 0x04, 0x06, 0x0f, 0x0e, 0x09, 0x03, 0x00, 0x01, 0x04, 0x00,
+    0x88, 0x00, 0x01, 0x04, 0x01, 0x00, 0x0a, 0x03, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f,
+    0x04, 0x01, 0x05, 0x04, 0x02, 0x0f, 0x0f, 0x09, 0x01, 0x05, 0x03, 0x0d, 0x0f, 0x0d, 0x01, 0x04,
+    0x04, 0x0a, 0x0f, 0x0f, 0x02, 0x01, 0x03, 0x04, 0x06, 0x0f, 0x0f, 0x05, 0x01, 0x02, 0x04, 0x02,
+    0x0f, 0x0f, 0x09, 0x01, 0x02, 0x03, 0x0d, 0x0f, 0x0d, 0x01, 0x01, 0x04, 0x0a, 0x0f, 0x0f, 0x02,
+    0x01, 0x00, 0x0a, 0x04, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x04, 0x03, 0x00, 0x01,
+    0x05, 0x00, 0x88, 0x00, 0x01, 0x05, 0x01, 0x01, 0x05, 0x04, 0x0c, 0x0f, 0x0d, 0x01, 0x03, 0x00,
+    0x01, 0x03, 0x00, 0x84, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x0a, 0x0f, 0x0e, 0x06, 0x01, 0x01,
+    0x00, 0x03, 0x0d, 0x0f, 0x07, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f,
+    0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01, 0x00, 0x03,
+    0x0d, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01,
+    0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f,
+    0x04, 0x01, 0x00, 0x03, 0x0d, 0x0f, 0x06, 0x01, 0x00, 0x04, 0x0b, 0x0f, 0x0c, 0x02, 0x01, 0x00,
+    0x06, 0x05, 0x0f, 0x0f, 0x0f, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x07, 0x0f, 0x0f, 0x0f, 0x02, 0x01,
+    0x03, 0x02, 0x02, 0x01, 0x01, 0x00, 0x02, 0x0a, 0x09, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00,
+    0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02,
+    0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d,
+    0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c,
+    0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01,
+    0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00, 0x02, 0x0d, 0x0c, 0x01, 0x00,
+    0x02, 0x04, 0x03, 0x01, 0x00, 0x05, 0x01, 0x0e, 0x0f, 0x0c, 0x03, 0x03, 0x00, 0x01, 0x03, 0x00,
+    0x84, 0x00, 0x01, 0x02, 0x01, 0x01, 0x05, 0x02, 0x06, 0x0e, 0x0f, 0x09, 0x01, 0x03, 0x03, 0x09,
+    0x0f, 0x0b, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03,
+    0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c,
+    0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06,
+    0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03, 0x03, 0x06, 0x0f, 0x0c, 0x01, 0x03,
+    0x03, 0x08, 0x0f, 0x0c, 0x01, 0x02, 0x04, 0x03, 0x0d, 0x0f, 0x0a, 0x01, 0x00, 0x06, 0x02, 0x0e,
+    0x0f, 0x0f, 0x0f, 0x04, 0x01, 0x00, 0x05, 0x03, 0x0f, 0x0f, 0x0f, 0x06, 0x01, 0x01, 0x02, 0x01,
+    0x02, 0x02, 0x02, 0x04, 0x08, 0x0d, 0x0b, 0x05, 0x04, 0x02, 0x0c, 0x04, 0x03, 0x01, 0x01, 0x0a,
+    0x00, 0x84, 0x00, 0x06, 0x0c, 0x02, 0x00, 0x06, 0x0f, 0x06, 0x01, 0x00, 0x0c, 0x01, 0x0f, 0x0c,
+    0x01, 0x03, 0x0b, 0x0f, 0x0f, 0x0e, 0x0f, 0x0e, 0x01, 0x02, 0x00, 0x03, 0x01, 0x0e, 0x04, 0x03,
+    0x05, 0x05, 0x0c, 0x0f, 0x0c, 0x02,
+};
+
+static const uint32_t lts20_atlas_index[] = {
+    0, 0, 83, 139, 289, 473, 678, 833,
+    867, 987, 1103, 1160, 1222, 1252, 1271, 1289,
+    1402, 1567, 1660, 1788, 1924, 2049, 2181, 2322,
+    2428, 2591, 2732, 2772, 2828, 2907, 2953, 3033,
+    3140, 3353, 3504, 3673, 3816, 3988, 4113, 4226,
+    4405, 4569, 4659, 4767, 4934, 5036, 5274, 5472,
+    5655, 5799, 6003, 6170, 6314, 6418, 6584, 6737,
+    6991, 7147, 7280, 7402, 7531, 7644, 7773, 7855,
+    7873, 7899, 8030, 8182, 8270, 8417, 8524, 8628,
+    8798, 8945, 9029, 9141, 9282, 9370, 9550, 9673,
+    9788, 9940, 10087, 10156, 10252, 10344, 10463, 10567,
+    10738, 10854, 10987, 11078, 11204, 11299, 11425,
+};
+
+static const glyph_atlas_t lts20_atlas = {
+    .index = lts20_atlas_index,
+    .data = lts20_atlas_data,
+};
+
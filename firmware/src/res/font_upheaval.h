@@ -488,6 +488,10 @@ static const lv_font_dsc_t upheaval_dsc[] = {
     {.bitmap_index = 1155, .adv_w = 192, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0}
 };
 
+#ifndef FONT_ATLAS_BUILD
+#include "font_upheaval_atlas.h"
+#endif
+
 static const lv_font_t lv_upheaval = {
     .range_start = 32,
     .range_length = 96,
@@ -496,4 +500,5 @@ static const lv_font_t lv_upheaval = {
     .base_line = 3,
     .dsc = upheaval_dsc,
     .bitmap = upheaval_bitmap,
+    .atlas = LV_FONT_ATLAS(upheaval_atlas),
 };
@@ -0,0 +1,259 @@
+/* Generated by font_atlas.c, glyph rows as alpha spans: span count,
+   then skip, length (bit 7 = solid) and alpha bytes unless solid. */
+
+#include <stdint.h>
+#include "../gfx.h"
+
+static const uint8_t upheaval_atlas_data[] = {
+    0x00, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x00, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x07,
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x07, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x03, 0x01, 0x84, 0x00, 0x01, 0x00, 0x00, 0x84, 0x03, 0x01, 0x84, 0x00, 0x01, 0x00, 0x00,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x03, 0x01, 0x84, 0x00, 0x01, 0x00, 0x00, 0x84, 0x03,
+    0x01, 0x84, 0x00, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x03, 0x01, 0x84,
+    0x00, 0x01, 0x00, 0x00, 0x84, 0x03, 0x01, 0x84, 0x00, 0x01, 0x00, 0x00, 0x84, 0x01, 0x04, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x8a, 0x01, 0x01, 0x8a, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00,
+    0x8a, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x05, 0x84, 0x02, 0x00,
+    0x84, 0x03, 0x85, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x02, 0x01, 0x04, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x85, 0x01, 0x04, 0x85, 0x01, 0x03, 0x85, 0x02, 0x02, 0x85, 0x00, 0x04,
+    0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x85, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84, 0x02, 0x00, 0x85,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x05, 0x02, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00,
+    0x87, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x8a, 0x01, 0x04, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x86, 0x01, 0x00, 0x87, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00,
+    0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x87, 0x01, 0x01, 0x86, 0x01, 0x00, 0x86,
+    0x01, 0x00, 0x87, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01,
+    0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00, 0x86, 0x01, 0x04, 0x01, 0x01, 0x01,
+    0x00, 0x09, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x89, 0x01, 0x01,
+    0x87, 0x01, 0x02, 0x85, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01,
+    0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x8b,
+    0x01, 0x00, 0x8b, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x08, 0x84, 0x01, 0x07, 0x85, 0x01, 0x06, 0x85, 0x01, 0x05, 0x85, 0x01, 0x04, 0x85, 0x01, 0x03,
+    0x85, 0x01, 0x02, 0x85, 0x01, 0x01, 0x85, 0x01, 0x00, 0x85, 0x01, 0x00, 0x84, 0x01, 0x01, 0x89,
+    0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x07, 0x84, 0x01, 0x07,
+    0x84, 0x01, 0x01, 0x8a, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x8b,
+    0x01, 0x00, 0x8b, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01,
+    0x04, 0x86, 0x01, 0x04, 0x86, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00,
+    0x8a, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x8a, 0x01, 0x07, 0x84, 0x01, 0x07,
+    0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x01, 0x8a, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01,
+    0x00, 0x8b, 0x01, 0x00, 0x8a, 0x01, 0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00,
+    0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x01, 0x06, 0x85,
+    0x01, 0x05, 0x85, 0x01, 0x04, 0x85, 0x01, 0x03, 0x85, 0x01, 0x02, 0x85, 0x01, 0x01, 0x85, 0x01,
+    0x00, 0x85, 0x01, 0x00, 0x84, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x01, 0x89, 0x01, 0x01, 0x89, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x01, 0x89, 0x01, 0x00,
+    0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01,
+    0x8a, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x04, 0x84, 0x01, 0x03, 0x85, 0x01, 0x02, 0x85, 0x01, 0x01,
+    0x85, 0x01, 0x00, 0x85, 0x01, 0x00, 0x85, 0x01, 0x01, 0x85, 0x01, 0x02, 0x85, 0x01, 0x03, 0x85,
+    0x01, 0x04, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x00, 0x00, 0x01, 0x00, 0x8b, 0x01, 0x00,
+    0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x85, 0x01, 0x01, 0x85, 0x01, 0x02, 0x85, 0x01, 0x03, 0x85,
+    0x01, 0x03, 0x85, 0x01, 0x02, 0x85, 0x01, 0x01, 0x85, 0x01, 0x00, 0x85, 0x01, 0x00, 0x84, 0x01,
+    0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01,
+    0x05, 0x86, 0x01, 0x04, 0x86, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x00, 0x01, 0x04, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8b, 0x01, 0x00, 0x8d, 0x02, 0x00,
+    0x84, 0x05, 0x84, 0x03, 0x00, 0x84, 0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x84, 0x03,
+    0x00, 0x84, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x84, 0x03, 0x00, 0x84, 0x00, 0x05,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x84, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x87, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0x8d, 0x01, 0x01, 0x8c, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00,
+    0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x02, 0x00,
+    0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8a, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00,
+    0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x02, 0x00,
+    0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x00,
+    0x89, 0x01, 0x00, 0x8a, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x89,
+    0x01, 0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x87, 0x01,
+    0x00, 0x87, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x8a, 0x01, 0x01,
+    0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00, 0x87,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x01, 0x8a, 0x01,
+    0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x85,
+    0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01,
+    0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a, 0x01, 0x03, 0x84, 0x01,
+    0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x00,
+    0x8a, 0x01, 0x00, 0x8a, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84,
+    0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x02, 0x00, 0x84, 0x03, 0x85, 0x03, 0x00, 0x84, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00, 0x8a, 0x01,
+    0x00, 0x89, 0x01, 0x00, 0x89, 0x01, 0x00, 0x8a, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x86,
+    0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0x02, 0x00, 0x84, 0x03, 0x85, 0x01, 0x00,
+    0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x05,
+    0x84, 0x02, 0x00, 0x85, 0x03, 0x85, 0x03, 0x00, 0x86, 0x00, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00,
+    0x8d, 0x01, 0x00, 0x8d, 0x03, 0x00, 0x84, 0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x84,
+    0x03, 0x00, 0x84, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x02, 0x00, 0x84, 0x05,
+    0x84, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x03, 0x00, 0x85, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x86, 0x00, 0x01, 0x00, 0x00,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x86, 0x03,
+    0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01,
+    0x89, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00,
+    0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x04, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b, 0x02,
+    0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a, 0x02,
+    0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00,
+    0x84, 0x03, 0x84, 0x01, 0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x8a, 0x01, 0x01, 0x8a, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00,
+    0x8a, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84,
+    0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x02,
+    0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00,
+    0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x03,
+    0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x89, 0x01, 0x00, 0x88, 0x01, 0x00, 0x87,
+    0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x84, 0x05, 0x84, 0x03,
+    0x00, 0x84, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x84, 0x00, 0x05,
+    0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x8d, 0x01, 0x00, 0x8d, 0x03, 0x00, 0x86,
+    0x00, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x85, 0x03, 0x85, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02,
+    0x00, 0x03, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x01, 0x02, 0x00, 0x84, 0x03, 0x84, 0x03,
+    0x00, 0x85, 0x00, 0x01, 0x00, 0x00, 0x85, 0x01, 0x01, 0x89, 0x01, 0x02, 0x87, 0x01, 0x02, 0x87,
+    0x01, 0x01, 0x89, 0x03, 0x00, 0x85, 0x00, 0x01, 0x00, 0x00, 0x85, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x03, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x01, 0x02, 0x00, 0x84, 0x04, 0x84,
+    0x02, 0x00, 0x84, 0x04, 0x84, 0x02, 0x00, 0x84, 0x04, 0x84, 0x03, 0x00, 0x85, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x85, 0x01, 0x01, 0x8a, 0x01, 0x02, 0x88, 0x01, 0x04, 0x84, 0x01, 0x04, 0x84, 0x01,
+    0x04, 0x84, 0x01, 0x04, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x01, 0x06, 0x85, 0x01, 0x05,
+    0x85, 0x01, 0x04, 0x85, 0x01, 0x03, 0x85, 0x01, 0x02, 0x85, 0x01, 0x01, 0x85, 0x01, 0x00, 0x8b,
+    0x01, 0x00, 0x8b, 0x01, 0x00, 0x87, 0x01, 0x00, 0x87, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00,
+    0x87, 0x01, 0x00, 0x84, 0x01, 0x00, 0x85, 0x01, 0x01, 0x85, 0x01, 0x02, 0x85, 0x01, 0x03, 0x85,
+    0x01, 0x04, 0x85, 0x01, 0x05, 0x85, 0x01, 0x06, 0x85, 0x01, 0x07, 0x85, 0x01, 0x08, 0x84, 0x01,
+    0x00, 0x87, 0x01, 0x00, 0x87, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03,
+    0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00, 0x87, 0x01, 0x03, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x85, 0x01, 0x01, 0x87, 0x01, 0x00, 0x89, 0x03, 0x00, 0x84, 0x00,
+    0x01, 0x00, 0x00, 0x84, 0x02, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x8b, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00,
+    0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00,
+    0x8a, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00,
+    0x8a, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x00, 0x89, 0x01, 0x00, 0x8a, 0x03, 0x00, 0x84,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x85, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x89, 0x01, 0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00, 0x87, 0x01, 0x00, 0x84, 0x01, 0x00,
+    0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x8a, 0x01, 0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00, 0x87, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x01, 0x8a, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00,
+    0x84, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x85, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00,
+    0x86, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01,
+    0x89, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01,
+    0x00, 0x8a, 0x01, 0x00, 0x8a, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03,
+    0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a, 0x01, 0x07, 0x84,
+    0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x01, 0x07, 0x84, 0x02,
+    0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x02,
+    0x00, 0x84, 0x03, 0x85, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x84,
+    0x00, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x89, 0x01, 0x00, 0x89, 0x01, 0x00,
+    0x8a, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x86, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x86, 0x02, 0x00, 0x84, 0x03, 0x85, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x8b, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x85, 0x03, 0x85, 0x03,
+    0x00, 0x86, 0x00, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00, 0x8d, 0x01, 0x00, 0x8d, 0x03, 0x00, 0x84,
+    0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x84, 0x03, 0x00, 0x84, 0x00, 0x05, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x84, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02,
+    0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x03, 0x00, 0x85, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x84, 0x03, 0x00, 0x86, 0x00, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b,
+    0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x86, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x85, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x01, 0x01, 0x89, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02,
+    0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8a,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x01, 0x89, 0x01,
+    0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x01, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8b, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x01, 0x8a, 0x01,
+    0x00, 0x8b, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x8a, 0x01, 0x01, 0x8a, 0x01, 0x07,
+    0x84, 0x01, 0x07, 0x84, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a, 0x01, 0x00, 0x8a,
+    0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01,
+    0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84,
+    0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03,
+    0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x01, 0x00, 0x8b, 0x01, 0x01, 0x89, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84,
+    0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x03,
+    0x00, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x85,
+    0x01, 0x00, 0x89, 0x01, 0x00, 0x88, 0x01, 0x00, 0x87, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00,
+    0x84, 0x05, 0x84, 0x02, 0x00, 0x84, 0x05, 0x84, 0x03, 0x00, 0x84, 0x00, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x84, 0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x84,
+    0x01, 0x00, 0x8d, 0x01, 0x00, 0x8d, 0x03, 0x00, 0x86, 0x00, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00,
+    0x85, 0x03, 0x85, 0x02, 0x00, 0x84, 0x05, 0x84, 0x02, 0x00, 0x03, 0x01, 0x01, 0x01, 0x05, 0x03,
+    0x01, 0x01, 0x01, 0x02, 0x00, 0x84, 0x03, 0x84, 0x03, 0x00, 0x85, 0x00, 0x01, 0x00, 0x00, 0x85,
+    0x01, 0x01, 0x89, 0x01, 0x02, 0x87, 0x01, 0x02, 0x87, 0x01, 0x01, 0x89, 0x03, 0x00, 0x85, 0x00,
+    0x01, 0x00, 0x00, 0x85, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x03, 0x01, 0x01, 0x01, 0x05,
+    0x03, 0x01, 0x01, 0x01, 0x02, 0x00, 0x84, 0x04, 0x84, 0x02, 0x00, 0x84, 0x04, 0x84, 0x02, 0x00,
+    0x84, 0x04, 0x84, 0x03, 0x00, 0x85, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x01, 0x01, 0x8a, 0x01,
+    0x02, 0x88, 0x01, 0x04, 0x84, 0x01, 0x04, 0x84, 0x01, 0x04, 0x84, 0x01, 0x04, 0x84, 0x01, 0x00,
+    0x8b, 0x01, 0x00, 0x8b, 0x01, 0x06, 0x85, 0x01, 0x05, 0x85, 0x01, 0x04, 0x85, 0x01, 0x03, 0x85,
+    0x01, 0x02, 0x85, 0x01, 0x01, 0x85, 0x01, 0x00, 0x8b, 0x01, 0x00, 0x8b, 0x01, 0x02, 0x86, 0x01,
+    0x01, 0x87, 0x01, 0x01, 0x84, 0x01, 0x01, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x01,
+    0x84, 0x01, 0x01, 0x84, 0x01, 0x01, 0x87, 0x01, 0x02, 0x86, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84,
+    0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01,
+    0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00, 0x84, 0x01, 0x00,
+    0x86, 0x01, 0x00, 0x87, 0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x04, 0x84, 0x01, 0x04, 0x84,
+    0x01, 0x03, 0x84, 0x01, 0x03, 0x84, 0x01, 0x00, 0x87, 0x01, 0x00, 0x86, 0x02, 0x02, 0x85, 0x03,
+    0x84, 0x03, 0x01, 0x87, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x89, 0x00, 0x01, 0x00,
+    0x00, 0x84, 0x03, 0x00, 0x84, 0x00, 0x01, 0x00, 0x00, 0x89, 0x03, 0x00, 0x84, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x87, 0x02, 0x00, 0x84, 0x03, 0x85, 0x01, 0x00, 0x8b, 0x03, 0x00, 0x03, 0x01, 0x00,
+    0x00, 0x00, 0x85, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x84, 0x03, 0x84, 0x02, 0x00, 0x84, 0x03, 0x84, 0x01, 0x00,
+    0x0b, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x0b, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x00,
+    0x00, 0x85, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x8b,
+};
+
+static const uint32_t upheaval_atlas_index[] = {
+    0, 1, 29, 49, 109, 151, 217, 259,
+    271, 301, 331, 375, 405, 429, 435, 447,
+    477, 519, 549, 579, 609, 647, 677, 711,
+    741, 779, 813, 843, 885, 915, 929, 959,
+    1000, 1064, 1106, 1144, 1182, 1232, 1262, 1292,
+    1336, 1382, 1412, 1446, 1502, 1532, 1595, 1655,
+    1697, 1731, 1785, 1827, 1857, 1887, 1933, 1984,
+    2047, 2107, 2149, 2179, 2209, 2239, 2269, 2303,
+    2309, 2321, 2363, 2401, 2439, 2489, 2519, 2549,
+    2593, 2639, 2669, 2703, 2759, 2789, 2852, 2912,
+    2954, 2988, 3042, 3084, 3114, 3144, 3190, 3241,
+    3304, 3364, 3406, 3436, 3466, 3502, 3532, 3576,
+};
+
+static const glyph_atlas_t upheaval_atlas = {
+    .index = upheaval_atlas_index,
+    .data = upheaval_atlas_data,
+};
+
@@ -11,7 +11,10 @@ void rle_init(rle_decoder_t *rle, const rle_src_t *src)
 {
     rle->src = *src;
     rle->pos = 0;
+    rle->value = 0;
     rle->counter = 0;
+    rle->remaining = false;
+    rle->literal = false;
 }
 
 bool rle_eof(rle_decoder_t *rle)
@@ -19,11 +22,33 @@ bool rle_eof(rle_decoder_t *rle)
     return (!rle->remaining) && (!rle->counter) && (rle->pos >= rle->src.size);
 }
 
+#define PACK_LITERAL_MAX 128
+#define PACK_REPEAT_MIN 2
+#define PACK_REPEAT_MAX (PACK_REPEAT_MIN + 127)
+
+/* Header below 0x80 is literal run of (h + 1), otherwise repeat run
+   of (h - 0x80 + 2), leaves counter for the values after this one */
+#define PACK_FETCH(type) \
+    { \
+        uint32_t header = ((const type *)rle->src.input)[rle->pos++]; \
+        rle->value = ((const type *)rle->src.input)[rle->pos++]; \
+        rle->literal = (header < 0x80); \
+        rle->counter = rle->literal ? header : header - 0x80 + PACK_REPEAT_MIN - 1; \
+    }
+
 #define RLE_GET_TEMPLATE(type) \
     if (rle->src.encoding == RLE_NONE) { \
-        return ((const type *)rle->src.input)[rle->pos++]; \
-    } \
-    if (rle->counter) { \
+        rle->value = ((const type *)rle->src.input)[rle->pos++]; \
+    } else if (rle->src.encoding == RLE_PACK) { \
+        if (rle->counter) { \
+            rle->counter--; \
+            if (rle->literal) { \
+                rle->value = ((const type *)rle->src.input)[rle->pos++]; \
+            } \
+        } else if (rle->pos < rle->src.size) { \
+            PACK_FETCH(type); \
+        } \
+    } else if (rle->counter) { \
         rle->counter--; \
     } else if (rle->pos < rle->src.size) { \
         rle->value = ((const type *)rle->src.input)[rle->pos++]; \
@@ -56,6 +81,58 @@ uint8_t rle_get_uint4(rle_decoder_t *rle)
     return rle->value >> 4;
 }
 
+/* A repeated byte with equal nibbles is one run of 2 * (counter + 1) */
+static inline uint32_t uniform_run(rle_decoder_t *rle, uint32_t len, uint8_t *value)
+{
+    *value = rle->value & 0x0f;
+    len += rle->counter * 2;
+    rle->counter = 0;
+    return len;
+}
+
+uint32_t rle_get_run_uint4(rle_decoder_t *rle, uint8_t *value)
+{
+    if (rle->remaining) {
+        rle->remaining = false;
+        if (rle->counter && !rle->literal && ((rle->value >> 4) == (rle->value & 0x0f))) {
+            return uniform_run(rle, 1, value);
+        }
+        *value = rle->value & 0x0f;
+        return 1;
+    }
+
+    if (rle->counter) {
+        if (rle->literal) {
+            rle->counter--;
+            rle->value = ((const uint8_t *)rle->src.input)[rle->pos++];
+        } else if ((rle->value >> 4) == (rle->value & 0x0f)) {
+            return uniform_run(rle, 0, value);
+        } else {
+            rle->counter--;
+        }
+    } else if (rle->pos < rle->src.size) {
+        const uint8_t *input = rle->src.input;
+        if (rle->src.encoding == RLE_PACK) {
+            PACK_FETCH(uint8_t);
+        } else {
+            rle->value = input[rle->pos++];
+            if ((rle->src.encoding == RLE_RLE) ||
+                ((rle->src.encoding == RLE_RLE_X) && (rle->value == rle->src.x))) {
+                rle->counter = input[rle->pos++];
+            }
+        }
+        if (!rle->literal && ((rle->value >> 4) == (rle->value & 0x0f))) {
+            return uniform_run(rle, 2, value);
+        }
+    } else {
+        return 0;
+    }
+
+    rle->remaining = true;
+    *value = rle->value >> 4;
+    return 1;
+}
+
 uint32_t rle_get(rle_decoder_t *rle)
 {
     if (rle->src.bits == 4) {
@@ -137,3 +214,46 @@ size_t rle_x_encode_uint16(uint16_t *output, const uint16_t *input, size_t size,
 {
     RLE_X_ENCODE(uint16_t, UINT16_MAX, x)
 }
+
+/* Repeats of 2 are only worth it when not breaking a literal run */
+#define RLE_PACK_ENCODE_TEMPLATE(type) \
+    size_t pos = 0; \
+    size_t i = 0; \
+    while (i < size) { \
+        size_t run = 1; \
+        while ((i + run < size) && (run < PACK_REPEAT_MAX) && \
+               (input[i + run] == input[i])) { \
+            run++; \
+        } \
+        if (run >= 3) { \
+            output[pos++] = 0x80 + run - PACK_REPEAT_MIN; \
+            output[pos++] = input[i]; \
+            i += run; \
+            continue; \
+        } \
+        size_t start = i; \
+        size_t len = 0; \
+        while ((i < size) && (len < PACK_LITERAL_MAX)) { \
+            if ((i + 2 < size) && (input[i] == input[i + 1]) && \
+                (input[i] == input[i + 2])) { \
+                break; \
+            } \
+            i++; \
+            len++; \
+        } \
+        output[pos++] = len - 1; \
+        for (size_t k = 0; k < len; k++) { \
+            output[pos++] = input[start + k]; \
+        } \
+    } \
+    return pos;
+
+size_t rle_pack_encode_uint8(uint8_t *output, const uint8_t *input, size_t size)
+{
+    RLE_PACK_ENCODE_TEMPLATE(uint8_t)
+}
+
+size_t rle_pack_encode_uint16(uint16_t *output, const uint16_t *input, size_t size)
+{
+    RLE_PACK_ENCODE_TEMPLATE(uint16_t)
+}
@@ -2,6 +2,8 @@
  * WHowe <github.com/whowechina>
  *
  * RLE is regular, RLE_X only encodes a special value
+ * RLE_PACK is PackBits style, a header tells either a literal run of
+ * 1..128 values or a repeat run of 2..129 values
  */
 
 #ifndef RLE_H
@@ -13,7 +15,8 @@
 typedef enum {
     RLE_NONE,
     RLE_RLE,
-    RLE_RLE_X
+    RLE_RLE_X,
+    RLE_PACK,
 } rle_encoding_t;
 
 typedef struct {
@@ -30,6 +33,7 @@ typedef struct {
     uint32_t value;
     uint32_t counter;
     bool remaining;
+    bool literal; // RLE_PACK only, counter is for literal values
 } rle_decoder_t;
 
 void rle_init(rle_decoder_t *rle, const rle_src_t *src);
@@ -41,6 +45,9 @@ uint16_t rle_get_uint16(rle_decoder_t *rle);
 uint8_t rle_get_uint4(rle_decoder_t *rle);
 uint32_t rle_get(rle_decoder_t *rle);
 
+/* Yields a run of the same 4 bit value, returns run length, 0 at the end */
+uint32_t rle_get_run_uint4(rle_decoder_t *rle, uint8_t *value);
+
 /* No protection, make sure output is large enough */
 size_t rle_encode_uint8(uint8_t *output, const uint8_t *input, size_t size);
 size_t rle_encode_uint16(uint16_t *output, const uint16_t *input, size_t size);
@@ -48,4 +55,8 @@ size_t rle_encode_uint16(uint16_t *output, const uint16_t *input, size_t size);
 size_t rle_x_encode_uint8(uint8_t *output, const uint8_t *input, size_t size, uint32_t x);
 size_t rle_x_encode_uint16(uint16_t *output, const uint16_t *input, size_t size, uint32_t x);
 
+/* Worst case output is size + size / 128 + 1 */
+size_t rle_pack_encode_uint8(uint8_t *output, const uint8_t *input, size_t size);
+size_t rle_pack_encode_uint16(uint16_t *output, const uint16_t *input, size_t size);
+
 #endif
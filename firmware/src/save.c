@@ -20,6 +20,8 @@
 #include "pico/multicore.h"
 #include "pico/unique_id.h"
 
+#include "logger.h"
+
 static struct {
     size_t size;
     size_t offset;
@@ -30,8 +32,11 @@ static int module_num = 0;
 static uint32_t my_magic = 0xcafecafe;
 
 #define SAVE_TIMEOUT_US 5000000
+/* a due erase waits this long at most for the idle check */
+#define SAVE_DEFER_MAX_US 60000000
 
 #define SAVE_SECTOR_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE)
+#define SAVE_PAGE_NUM (FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE)
 
 typedef struct __attribute ((packed)) {
     uint32_t magic;
@@ -44,29 +49,109 @@ static page_t default_data = {0};
 static int data_page = -1;
 
 static bool requesting_save = false;
+static bool requesting_now = false;
 static uint64_t requesting_time = 0;
+static bool rewrite_pending = false; /* sector erased, data only in RAM */
+
+static bool (*is_idle)();
+
+static struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint32_t hist[SAVE_STALL_BUCKETS];
+} stall;
+
+static const uint32_t stall_bucket_us[SAVE_STALL_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 20000, 50000, 100000
+};
 
-static mutex_t *io_lock;
+/* XIP is off while flash is erased or programmed, so this and the SDK flash
+   functions run from RAM with core0 interrupts off */
+static void __not_in_flash_func(flash_op)(bool erase, uint32_t offset, const uint8_t *data)
+{
+    uint32_t ints = save_and_disable_interrupts();
+    if (erase) {
+        flash_range_erase(offset, FLASH_SECTOR_SIZE);
+    } else {
+        flash_range_program(offset, data, FLASH_PAGE_SIZE);
+    }
+    restore_interrupts(ints);
+}
+
+/* core1 is parked only for the flash operation itself */
+static uint32_t flash_stall(bool erase, uint32_t offset, const uint8_t *data)
+{
+    bool lockout = multicore_lockout_victim_is_initialized(1);
+    uint64_t start = time_us_64();
+
+    if (lockout) {
+        multicore_lockout_start_blocking();
+    }
+    flash_op(erase, offset, data);
+    if (lockout) {
+        multicore_lockout_end_blocking();
+    }
+
+    uint32_t us = time_us_64() - start;
+    int bucket = 0;
+    while ((bucket < SAVE_STALL_BUCKETS - 1) && (us >= stall_bucket_us[bucket])) {
+        bucket++;
+    }
+    stall.hist[bucket]++;
+    stall.count++;
+    stall.last_us = us;
+    if (us > stall.max_us) {
+        stall.max_us = us;
+    }
+    return us;
+}
 
 static void save_program()
 {
     old_data = new_data;
+    rewrite_pending = false;
 
-    data_page = (data_page + 1) % (FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE);
-    printf("\nProgram Flash %d %8lx\n", data_page, old_data.magic);
-    if (mutex_enter_timeout_us(io_lock, 100000)) {
-        sleep_ms(10); /* wait for all io operations to finish */
-        uint32_t ints = save_and_disable_interrupts();
-        if (data_page == 0) {
-            flash_range_erase(SAVE_SECTOR_OFFSET, FLASH_SECTOR_SIZE);
-        }
-        flash_range_program(SAVE_SECTOR_OFFSET + data_page * FLASH_PAGE_SIZE,
-                            (uint8_t *)&old_data, FLASH_PAGE_SIZE);
-        restore_interrupts(ints);
-        mutex_exit(io_lock);
-    } else {
-        printf("Program Flash Failed.\n");
+    data_page++;
+    uint32_t us = flash_stall(false, SAVE_SECTOR_OFFSET + data_page * FLASH_PAGE_SIZE,
+                              (uint8_t *)&old_data);
+    LOG_INFO("\nProgram Flash %d %8lx, %ldus\n", data_page, old_data.magic, us);
+}
+
+/* a full sector is erased on its own, the data goes back on the next loop */
+static void save_erase()
+{
+    uint32_t us = flash_stall(true, SAVE_SECTOR_OFFSET, NULL);
+    LOG_INFO("\nErase Flash, %ldus\n", us);
+    data_page = -1;
+    rewrite_pending = true;
+}
+
+/* the sector is full, or holds no valid page and may not be blank */
+static bool erase_due()
+{
+    return (data_page >= SAVE_PAGE_NUM - 1) || ((data_page < 0) && !rewrite_pending);
+}
+
+static bool erase_allowed()
+{
+    if (requesting_now || !is_idle || is_idle()) {
+        return true;
     }
+    /* don't hold a changed config back forever */
+    return requesting_save &&
+           (time_us_64() - requesting_time > SAVE_TIMEOUT_US + SAVE_DEFER_MAX_US);
+}
+
+save_stat_t save_get_stat()
+{
+    save_stat_t stat = {
+        .count = stall.count,
+        .last_us = stall.last_us,
+        .max_us = stall.max_us,
+    };
+    memcpy(stat.hist, stall.hist, sizeof(stat.hist));
+    return stat;
 }
 
 static void load_default()
@@ -84,7 +169,7 @@ static const page_t *get_page(int id)
 
 static void save_load()
 {
-    for (int i = 0; i < FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE; i++) {
+    for (int i = 0; i < SAVE_PAGE_NUM; i++) {
         if (get_page(i)->magic != my_magic) {
             break;
         }
@@ -130,19 +215,34 @@ uint64_t board_id_64()
     return board_id.id64;
 }
 
-void save_init(uint32_t magic, mutex_t *locker)
+void save_init(uint32_t magic, bool (*idle)())
 {
     my_magic = magic;
-    io_lock = locker;
+    is_idle = idle;
     save_load();
     save_loop();
     save_loaded();
 }
 
+/* at most one flash operation per call, so core0 gets back to USB and NFC
+   between an erase and the program that follows it */
 void save_loop()
 {
+    if (erase_due()) {
+        if (erase_allowed()) {
+            save_erase();
+        }
+        return;
+    }
+
+    if (rewrite_pending) {
+        save_program();
+        return;
+    }
+
     if (requesting_save && (time_us_64() - requesting_time > SAVE_TIMEOUT_US)) {
         requesting_save = false;
+        requesting_now = false;
         /* only when data is actually changed */
         if (memcmp(&old_data, &new_data, sizeof(old_data)) == 0) {
             return;
@@ -172,6 +272,9 @@ void save_request(bool immediately)
     }
     if (immediately) {
         requesting_time = 0;
+        requesting_now = true;
+        /* the erase and the program after it, if the sector is full */
+        save_loop();
         save_loop();
     }
 }
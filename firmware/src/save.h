@@ -15,13 +15,25 @@
 uint32_t board_id_32();
 uint64_t board_id_64();
 
-/* It's safer to lock other I/O ops during saving, so we need a locker */
-typedef void (*io_locker_func)(bool pause);
-void save_init(uint32_t magic, mutex_t *lock);
+/* Core1 must be a multicore lockout victim, it's parked during flash ops.
+   A full sector is erased only when idle() says so, idle can be NULL. */
+void save_init(uint32_t magic, bool (*idle)());
 
 void save_loop();
 
 void *save_alloc(size_t size, void *def, void (*after_load)());
 void save_request(bool immediately);
 
+/* flash stall time histogram, buckets are <1, <2, <5, <10, <20, <50,
+   <100 and >=100 ms */
+#define SAVE_STALL_BUCKETS 8
+typedef struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint32_t hist[SAVE_STALL_BUCKETS];
+} save_stat_t;
+
+save_stat_t save_get_stat();
+
 #endif
@@ -19,6 +19,7 @@
 #include "hardware/pwm.h"
 
 #include "st7789.h"
+#include "blend.h"
 
 #define WIDTH 240
 #define HEIGHT 320
@@ -30,6 +31,8 @@ static struct {
     uint8_t ledk;
     int spi_dma;
     dma_channel_config spi_dma_cfg;
+    int ctrl_dma;
+    dma_channel_config ctrl_dma_cfg;
     int mem_dma;
     dma_channel_config mem_dma_cfg;    
 } ctx;
@@ -48,7 +51,107 @@ static struct {
     int y;
 } scroll;
 
-static uint16_t vram[HEIGHT * WIDTH];
+/* In band mode, frames are drawn band by band into two ping-pong
+   buffers, one band is sent while the next one is being drawn */
+#if ST7789_BAND_HEIGHT
+static uint16_t band_buf[2][ST7789_BAND_HEIGHT * WIDTH];
+static int band_idx;
+static uint16_t *vram = band_buf[0];
+#else
+static uint16_t frame_buf[HEIGHT * WIDTH];
+static uint16_t *vram = frame_buf;
+#endif
+
+/* rows of the frame held in vram */
+static struct {
+    int y0;
+    int h;
+} band = { 0, HEIGHT };
+
+/* Damaged areas in vram, flush only sends these windows */
+#define DAMAGE_MAX 16
+#define DAMAGE_GAP 8 // pixels this close to the open area join it
+#define DAMAGE_MERGE_SLACK 2048 // extra pixels allowed to save a window
+
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1; // inclusive
+    int16_t y1;
+} rect_t;
+
+typedef struct {
+    rect_t rects[DAMAGE_MAX];
+    int num;
+    bool full;
+} rect_list_t;
+
+static struct {
+    rect_list_t list;
+    rect_t open; // area being grown by single pixel writes
+    bool open_valid;
+} damage = { .list.full = true };
+
+/* Damage after st7789_overlay_begin() is also kept as overlay, so the
+   layer below knows what to restore in the next frame */
+static struct {
+    rect_list_t curr;
+    rect_list_t last;
+    bool active;
+} overlay;
+
+/* While recording, blending draws are kept in a buffer instead of vram,
+   replay draws them again at the scroll of that time */
+enum {
+    REC_SPAN,
+    REC_ALPHA,
+    REC_ALPHA4, // mixes packed in nibbles
+    REC_PIXELS,
+    REC_PIXELS_MIX,
+};
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+    uint16_t color;
+    uint8_t op;
+    uint8_t mix;
+    uint8_t bits;
+    uint8_t reserved;
+} record_t;
+
+static struct {
+    uint8_t *buf;
+    size_t size;
+    size_t used;
+    bool active;
+    bool failed;
+} record;
+
+typedef struct {
+    uint32_t count;
+    const void *addr;
+} dma_block_t;
+
+/* one block per row for partial width windows, plus a null block each */
+#define FLUSH_BLOCK_MAX (HEIGHT + DAMAGE_MAX * 2)
+
+static struct {
+    rect_t rects[DAMAGE_MAX];
+    int num;
+    int curr;
+    int block_start[DAMAGE_MAX];
+    dma_block_t blocks[FLUSH_BLOCK_MAX];
+    volatile bool busy;
+} flushing;
+
+static struct {
+    uint32_t frames;
+    uint32_t last_bytes;
+    uint32_t last_rects;
+    uint64_t total_bytes;
+} stat;
 
 static void send_cmd(uint8_t cmd, const void *data, size_t len)
 {
@@ -97,12 +200,32 @@ static void init_pwm()
     pwm_set_enabled(slice_num, true);
 }
 
+static void flush_irq();
+
 static void init_dma()
 {
     ctx.spi_dma = dma_claim_unused_channel(true);
+    ctx.ctrl_dma = dma_claim_unused_channel(true);
+
     ctx.spi_dma_cfg = dma_channel_get_default_config(ctx.spi_dma);
     channel_config_set_transfer_data_size(&ctx.spi_dma_cfg, DMA_SIZE_16);
     channel_config_set_dreq(&ctx.spi_dma_cfg, spi_get_dreq(ctx.spi, true));
+    channel_config_set_chain_to(&ctx.spi_dma_cfg, ctx.ctrl_dma);
+    channel_config_set_irq_quiet(&ctx.spi_dma_cfg, true); // irq on null trigger
+    dma_channel_configure(ctx.spi_dma, &ctx.spi_dma_cfg,
+                          &spi_get_hw(ctx.spi)->dr, NULL, 0, false);
+
+    /* control channel feeds (count, addr) blocks to the spi channel */
+    ctx.ctrl_dma_cfg = dma_channel_get_default_config(ctx.ctrl_dma);
+    channel_config_set_transfer_data_size(&ctx.ctrl_dma_cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctx.ctrl_dma_cfg, true);
+    channel_config_set_write_increment(&ctx.ctrl_dma_cfg, true);
+    channel_config_set_ring(&ctx.ctrl_dma_cfg, true, 3); // 2 words
+
+    dma_channel_set_irq1_enabled(ctx.spi_dma, true);
+    irq_add_shared_handler(DMA_IRQ_1, flush_irq,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
 
     ctx.mem_dma = dma_claim_unused_channel(true);
     ctx.mem_dma_cfg = dma_channel_get_default_config(ctx.mem_dma);
@@ -174,6 +297,10 @@ void st7789_crop(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool absolute)
     crop.w = w;
     crop.h = h;
     update_addr();
+    damage.list.full = true;
+#if !ST7789_BAND_HEIGHT
+    band.h = h;
+#endif
 }
 
 uint16_t st7789_get_crop_width()
@@ -191,30 +318,370 @@ void st7789_dimmer(uint8_t level)
     pwm_set_gpio_level(ctx.ledk, level);
 }
 
-void st7789_vsync()
+static inline int rect_area(const rect_t *r)
 {
-    dma_channel_wait_for_finish_blocking(ctx.spi_dma);
+    return (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
 }
 
-void st7789_flush(bool vsync)
+static inline rect_t rect_union(const rect_t *a, const rect_t *b)
+{
+    return (rect_t) {
+        .x0 = a->x0 < b->x0 ? a->x0 : b->x0,
+        .y0 = a->y0 < b->y0 ? a->y0 : b->y0,
+        .x1 = a->x1 > b->x1 ? a->x1 : b->x1,
+        .y1 = a->y1 > b->y1 ? a->y1 : b->y1,
+    };
+}
+
+static inline bool rect_contains(const rect_t *a, const rect_t *b)
+{
+    return (b->x0 >= a->x0) && (b->x1 <= a->x1) &&
+           (b->y0 >= a->y0) && (b->y1 <= a->y1);
+}
+
+/* r must be clipped already */
+static void rect_list_add(rect_list_t *list, rect_t r)
 {
-    if (dma_channel_is_busy(ctx.spi_dma)) {
+    if (list->full) {
         return;
     }
 
+    if (rect_area(&r) == crop.w * crop.h) {
+        list->full = true;
+        return;
+    }
+
+    for (int i = 0; i < list->num; i++) {
+        if (rect_contains(&list->rects[i], &r)) {
+            return;
+        }
+    }
+
+    if (list->num < DAMAGE_MAX) {
+        list->rects[list->num++] = r;
+        return;
+    }
+
+    /* list is full, grow the one that grows the least */
+    int best = 0;
+    int best_growth = INT32_MAX;
+    for (int i = 0; i < list->num; i++) {
+        rect_t u = rect_union(&list->rects[i], &r);
+        int growth = rect_area(&u) - rect_area(&list->rects[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    list->rects[best] = rect_union(&list->rects[best], &r);
+}
+
+static void damage_add(rect_t r)
+{
+    r.x0 = r.x0 < 0 ? 0 : r.x0;
+    r.y0 = r.y0 < 0 ? 0 : r.y0;
+    r.x1 = r.x1 >= crop.w ? crop.w - 1 : r.x1;
+    r.y1 = r.y1 >= crop.h ? crop.h - 1 : r.y1;
+    if ((r.x0 > r.x1) || (r.y0 > r.y1)) {
+        return;
+    }
+
+    if (overlay.active) {
+        rect_list_add(&overlay.curr, r);
+    }
+    rect_list_add(&damage.list, r);
+}
+
+static void damage_all()
+{
+    damage.list.full = true;
+    if (overlay.active) {
+        overlay.curr.full = true;
+    }
+}
+
+static void damage_close_open()
+{
+    if (damage.open_valid) {
+        damage.open_valid = false;
+        damage_add(damage.open);
+    }
+}
+
+static inline void damage_span(int x0, int x1, int y)
+{
+    if (damage.list.full && !overlay.active) {
+        return;
+    }
+
+    rect_t *o = &damage.open;
+    if (damage.open_valid) {
+        if ((x1 >= o->x0 - DAMAGE_GAP) && (x0 <= o->x1 + DAMAGE_GAP) &&
+            (y >= o->y0 - DAMAGE_GAP) && (y <= o->y1 + DAMAGE_GAP)) {
+            o->x0 = x0 < o->x0 ? x0 : o->x0;
+            o->x1 = x1 > o->x1 ? x1 : o->x1;
+            o->y0 = y < o->y0 ? y : o->y0;
+            o->y1 = y > o->y1 ? y : o->y1;
+            return;
+        }
+        damage_close_open();
+    }
+
+    *o = (rect_t) { x0, y, x1, y };
+    damage.open_valid = true;
+}
+
+static inline void damage_pixel(int x, int y)
+{
+    damage_span(x, x, y);
+}
+
+void st7789_damage(int x, int y, int w, int h)
+{
+    if ((w > 0) && (h > 0)) {
+        damage_add((rect_t) { x, y, x + w - 1, y + h - 1 });
+    }
+}
+
+void st7789_overlay_begin()
+{
+    damage_close_open();
+    overlay.active = true;
+}
+
+static void overlay_end()
+{
+    overlay.last = overlay.curr;
+    overlay.curr.num = 0;
+    overlay.curr.full = false;
+}
+
+bool st7789_last_overlay(int i, int *x, int *y, int *w, int *h)
+{
+    if (overlay.last.full) {
+        if (i > 0) {
+            return false;
+        }
+        *x = 0;
+        *y = 0;
+        *w = crop.w;
+        *h = crop.h;
+        return true;
+    }
+    if (i >= overlay.last.num) {
+        return false;
+    }
+    const rect_t *r = &overlay.last.rects[i];
+    *x = r->x0;
+    *y = r->y0;
+    *w = r->x1 - r->x0 + 1;
+    *h = r->y1 - r->y0 + 1;
+    return true;
+}
+
+static void merge_damage()
+{
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < damage.list.num && !merged; i++) {
+            for (int j = i + 1; j < damage.list.num; j++) {
+                rect_t *a = &damage.list.rects[i];
+                rect_t *b = &damage.list.rects[j];
+                rect_t u = rect_union(a, b);
+                if (rect_area(&u) <= rect_area(a) + rect_area(b) + DAMAGE_MERGE_SLACK) {
+                    *a = u;
+                    *b = damage.list.rects[--damage.list.num];
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void build_blocks()
+{
+    int n = 0;
+    for (int i = 0; i < flushing.num; i++) {
+        rect_t *r = &flushing.rects[i];
+        int w = r->x1 - r->x0 + 1;
+        int h = r->y1 - r->y0 + 1;
+
+        /* full width rows are contiguous, widen if running out of blocks */
+        int reserve = (flushing.num - i - 1) * 2;
+        if ((w != crop.w) && (n + h + 1 + reserve > FLUSH_BLOCK_MAX)) {
+            r->x0 = 0;
+            r->x1 = crop.w - 1;
+            w = crop.w;
+        }
+
+        flushing.block_start[i] = n;
+        if (w == crop.w) {
+            flushing.blocks[n++] = (dma_block_t) { w * h, &vram[r->y0 * crop.w] };
+        } else {
+            for (int y = r->y0; y <= r->y1; y++) {
+                flushing.blocks[n++] = (dma_block_t) { w, &vram[y * crop.w + r->x0] };
+            }
+        }
+        flushing.blocks[n++] = (dma_block_t) { 0, NULL };
+    }
+}
+
+static void start_window(const rect_t *r, int block)
+{
+    while (spi_is_busy(ctx.spi)) {
+        tight_loop_contents();
+    }
+
+    uint16_t xs = crop.x + crop.vx + r->x0;
+    uint16_t xe = crop.x + crop.vx + r->x1;
+    uint8_t ca[] = { xs >> 8, xs & 0xff, xe >> 8, xe & 0xff };
+    send_cmd(0x2a, ca, sizeof(ca));
+
+    uint16_t ys = crop.y + crop.vy + r->y0;
+    uint16_t ye = crop.y + crop.vy + r->y1;
+    uint8_t ra[] = { ys >> 8, ys & 0xff, ye >> 8, ye & 0xff };
+    send_cmd(0x2b, ra, sizeof(ra));
+
     send_cmd(0x2c, NULL, 0);
     spi_set_format(ctx.spi, 16, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
 
-    dma_channel_configure(ctx.spi_dma, &ctx.spi_dma_cfg,
-                          &spi_get_hw(ctx.spi)->dr, // write to
-                          vram, // read from
-                          crop.w * crop.h, // element count
-                          true); // start right now
+    dma_channel_configure(ctx.ctrl_dma, &ctx.ctrl_dma_cfg,
+                          &dma_hw->ch[ctx.spi_dma].al3_transfer_count,
+                          &flushing.blocks[block], 2, true);
+}
+
+static void flush_irq()
+{
+    if (!dma_channel_get_irq1_status(ctx.spi_dma)) {
+        return;
+    }
+    dma_channel_acknowledge_irq1(ctx.spi_dma);
+
+    flushing.curr++;
+    if (flushing.curr < flushing.num) {
+        start_window(&flushing.rects[flushing.curr],
+                     flushing.block_start[flushing.curr]);
+    } else {
+        flushing.busy = false;
+    }
+}
+
+void st7789_vsync()
+{
+    while (flushing.busy) {
+        tight_loop_contents();
+    }
+}
+
+void st7789_flush(bool vsync)
+{
+    if (flushing.busy) {
+        overlay.active = false;
+        return;
+    }
+
+    damage_close_open();
+    overlay.active = false;
+
+    if (damage.list.full) {
+        flushing.rects[0] = (rect_t) { 0, 0, crop.w - 1, crop.h - 1 };
+        flushing.num = 1;
+    } else {
+        merge_damage();
+        memcpy(flushing.rects, damage.list.rects, sizeof(rect_t) * damage.list.num);
+        flushing.num = damage.list.num;
+    }
+
+    damage.list.num = 0;
+    damage.list.full = false;
+    overlay_end();
+
+    build_blocks();
+
+    uint32_t bytes = 0;
+    for (int i = 0; i < flushing.num; i++) {
+        bytes += rect_area(&flushing.rects[i]) * 2;
+    }
+    stat.frames++;
+    stat.last_bytes = bytes;
+    stat.last_rects = flushing.num;
+    stat.total_bytes += bytes;
+
+    if (flushing.num == 0) {
+        return;
+    }
+
+    flushing.curr = 0;
+    flushing.busy = true;
+    start_window(&flushing.rects[0], flushing.block_start[0]);
+
     if (vsync) {
         st7789_vsync();
     }
 }
 
+#if ST7789_BAND_HEIGHT
+static void flush_band()
+{
+    st7789_vsync();
+
+    flushing.rects[0] = (rect_t) { 0, band.y0, crop.w - 1, band.y0 + band.h - 1 };
+    flushing.num = 1;
+    flushing.curr = 0;
+    flushing.blocks[0] = (dma_block_t) { crop.w * band.h, vram };
+    flushing.blocks[1] = (dma_block_t) { 0, NULL };
+    flushing.block_start[0] = 0;
+    flushing.busy = true;
+    start_window(&flushing.rects[0], 0);
+}
+#endif
+
+void st7789_render(void (*draw)())
+{
+#if ST7789_BAND_HEIGHT
+    for (int y = 0; y < crop.h; y += ST7789_BAND_HEIGHT) {
+        band.y0 = y;
+        band.h = crop.h - y < ST7789_BAND_HEIGHT ? crop.h - y : ST7789_BAND_HEIGHT;
+        vram = band_buf[band_idx];
+        draw();
+        flush_band();
+        band_idx ^= 1;
+    }
+    overlay.active = false;
+    overlay_end();
+
+    stat.frames++;
+    stat.last_bytes = crop.w * crop.h * 2;
+    stat.last_rects = (crop.h + ST7789_BAND_HEIGHT - 1) / ST7789_BAND_HEIGHT;
+    stat.total_bytes += stat.last_bytes;
+#else
+    draw();
+    st7789_flush(false);
+#endif
+}
+
+int st7789_band_top()
+{
+    return record.active ? 0 : band.y0;
+}
+
+int st7789_band_bottom()
+{
+    return record.active ? crop.h : band.y0 + band.h;
+}
+
+st7789_stat_t st7789_get_stat()
+{
+    return (st7789_stat_t) {
+        .frames = stat.frames,
+        .last_bytes = stat.last_bytes,
+        .last_rects = stat.last_rects,
+        .avg_bytes = stat.frames ? stat.total_bytes / stat.frames : 0,
+    };
+}
+
 static void vram_dma(uint32_t offset, const void *src, bool inc, size_t pixels)
 {
     channel_config_set_read_increment(&ctx.mem_dma_cfg, inc);
@@ -227,10 +694,10 @@ void static inline put_pixel(int x, int y, uint16_t color)
 {
     x += scroll.x;
     y += scroll.y;
-    if ((x < 0) || (x >= crop.w) || (y < 0) || (y >= crop.h)) {
+    if ((x < 0) || (x >= crop.w) || (y < band.y0) || (y >= band.y0 + band.h)) {
         return;
     }
-    vram[y * crop.w + x] = color;
+    vram[(y - band.y0) * crop.w + x] = color;
 }
 
 static void soft_fill(uint16_t *pattern, size_t size)
@@ -243,20 +710,29 @@ static void soft_fill(uint16_t *pattern, size_t size)
         return;
     }
 
-    int p = 0;
+    st7789_damage(x, y, w, h);
+
+    int j0 = band.y0 > y ? band.y0 - y : 0;
+    int j1 = band.y0 + band.h < y + h ? band.y0 + band.h - y : h;
     for (int i = 0; i < w; i++) {
-        for (int j = 0; j < h; j++) {
-            vram[(y + j) * crop.w + x + i] = pattern[p];
-            p = (p + 1) % size;
+        for (int j = j0; j < j1; j++) {
+            int p = (i * h + j) % size;
+            vram[(y + j - band.y0) * crop.w + x + i] = pattern[p];
         }
     }
 }
 
 void st7789_clear(uint16_t color, bool raw)
 {
+    if (record.active) {
+        record.failed = true;
+        return;
+    }
+
     if (raw || !(scroll.x || scroll.y)) {
         uint32_t c32 = (color << 16) | color;
-        vram_dma(0, &c32, false, crop.w * crop.h);
+        vram_dma(0, &c32, false, crop.w * band.h);
+        damage_all();
         return;
     }
 
@@ -265,6 +741,20 @@ void st7789_clear(uint16_t color, bool raw)
 
 void st7789_fill(uint16_t *pattern, size_t size, bool raw)
 {
+    if (record.active) {
+        record.failed = true;
+        return;
+    }
+
+#if ST7789_BAND_HEIGHT
+    if (raw || !(scroll.x || scroll.y)) {
+        int start = band.y0 * crop.w;
+        for (int i = 0; i < crop.w * band.h; i++) {
+            vram[i] = pattern[(start + i) % size];
+        }
+        return;
+    }
+#else
     if (raw || !(scroll.x || scroll.y)) {
         int remain = crop.w * crop.h;
         int offset = 0;
@@ -274,15 +764,41 @@ void st7789_fill(uint16_t *pattern, size_t size, bool raw)
             offset += to_copy;
             remain -= to_copy;
         }
+        damage_all();
         return;
     }
+#endif
 
     soft_fill(pattern, size);
 }
 
 void st7789_vramcpy(uint32_t offset, const void *src, size_t pixels)
 {
+    if (record.active) {
+        record.failed = true;
+        return;
+    }
+
+#if ST7789_BAND_HEIGHT
+    int start = band.y0 * crop.w;
+    int end = start + crop.w * band.h;
+    for (int i = 0; i < pixels; i++) {
+        int pos = offset + i;
+        if ((pos >= start) && (pos < end)) {
+            vram[pos - start] = ((const uint16_t *)src)[i];
+        }
+    }
+#else
     vram_dma(offset, src, true, pixels);
+
+    int y0 = offset / crop.w;
+    int y1 = (offset + pixels - 1) / crop.w;
+    if (y0 == y1) {
+        st7789_damage(offset % crop.w, y0, pixels, 1);
+    } else {
+        st7789_damage(0, y0, crop.w, y1 - y0 + 1);
+    }
+#endif
 }
 
 void st7789_scroll(int dx, int dy)
@@ -291,34 +807,66 @@ void st7789_scroll(int dx, int dy)
     scroll.y = dy;
 }
 
+/* data is rounded up to keep records 2 bytes aligned */
+static void *record_add(uint8_t op, int x, int y, int w, uint16_t color,
+                        uint8_t mix, uint8_t bits, size_t data)
+{
+    size_t size = sizeof(record_t) + ((data + 1) & ~1);
+    if (w <= 0) {
+        return NULL;
+    }
+    if (record.failed || (record.used + size > record.size)) {
+        record.failed = true;
+        return NULL;
+    }
+
+    record_t *rec = (record_t *)(record.buf + record.used);
+    *rec = (record_t) { x, y, w, color, op, mix, bits, 0 };
+    record.used += size;
+    return rec + 1;
+}
+
 void static inline mix_pixel(int x, int y, uint16_t color, uint8_t mix, uint8_t bits)
 {
     if (mix == 0) {
         return;
     }
 
+    if (record.active) {
+        record_add(REC_SPAN, x, y, 1, color, mix, bits, 0);
+        return;
+    }
+
     x += scroll.x;
     y += scroll.y;
-    if ((x < 0) || (x >= crop.w) || (y < 0) || (y >= crop.h)) {
+    if ((x < 0) || (x >= crop.w) || (y < band.y0) || (y >= band.y0 + band.h)) {
         return;
     }
 
+    damage_pixel(x, y);
+
+    uint16_t *dot = &vram[(y - band.y0) * crop.w + x];
     if (mix == (1L << bits) - 1) {
-        vram[y * crop.w + x] = color;
+        *dot = color;
         return;
     }
 
-    uint16_t bg = vram[y * crop.w + x];
-    uint16_t bg_ratio = (1L << bits) - mix;
-    uint8_t r = ((bg >> 11) * bg_ratio + (color >> 11) * mix) >> bits;
-    uint8_t g = (((bg >> 5) & 0x3f) * bg_ratio + ((color >> 5) & 0x3f) * mix) >> bits;
-    uint8_t b = ((bg & 0x1f) * bg_ratio + (color & 0x1f) * mix) >> bits;
-    vram[y * crop.w + x] = (r << 11) | (g << 5) | b;
+    *dot = blend_mix(*dot, color, mix, bits);
 }
 
 void st7789_pixel_raw(int x, int y, uint16_t color)
 {
-    vram[y * crop.w + x] = color;
+    if (record.active) {
+        record.failed = true;
+        return;
+    }
+#if ST7789_BAND_HEIGHT
+    if ((y < band.y0) || (y >= band.y0 + band.h)) {
+        return;
+    }
+#endif
+    damage_pixel(x, y);
+    vram[(y - band.y0) * crop.w + x] = color;
 }
 
 void st7789_pixel(int x, int y, uint16_t color, uint8_t mix, uint8_t bits)
@@ -326,11 +874,116 @@ void st7789_pixel(int x, int y, uint16_t color, uint8_t mix, uint8_t bits)
     mix_pixel(x, y, color, mix, bits);
 }
 
-void st7789_hline(int x, int y, uint16_t w, uint16_t color, uint8_t mix)
+/* clips a row once, skip tells how many leading pixels were cut */
+static inline uint16_t *clip_span(int *x, int y, int *w, int *skip)
 {
-    for (int i = 0; i < w; i++) {
-        mix_pixel(x + i, y, color, mix, 8);
+    *skip = 0;
+    if ((y < band.y0) || (y >= band.y0 + band.h)) {
+        return NULL;
+    }
+    if (*x < 0) {
+        *skip = -*x;
+        *w += *x;
+        *x = 0;
+    }
+    if (*x + *w > crop.w) {
+        *w = crop.w - *x;
     }
+    if (*w <= 0) {
+        return NULL;
+    }
+
+    damage_span(*x, *x + *w - 1, y);
+    return &vram[(y - band.y0) * crop.w + *x];
+}
+
+void st7789_span_raw(int x, int y, int w, uint16_t color)
+{
+    if (record.active) {
+        record.failed = true;
+        return;
+    }
+
+    int skip;
+    uint16_t *dot = clip_span(&x, y, &w, &skip);
+    if (dot) {
+        blend_fill(dot, color, w);
+    }
+}
+
+void st7789_span(int x, int y, int w, uint16_t color, uint8_t mix, uint8_t bits)
+{
+    if (mix == 0) {
+        return;
+    }
+
+    if (record.active) {
+        record_add(REC_SPAN, x, y, w, color, mix, bits, 0);
+        return;
+    }
+
+    int skip;
+    x += scroll.x;
+    y += scroll.y;
+    uint16_t *dot = clip_span(&x, y, &w, &skip);
+    if (dot) {
+        blend_row_const(dot, w, color, mix, bits);
+    }
+}
+
+void st7789_span_alpha(int x, int y, int w, uint16_t color, const uint8_t *mix, uint8_t bits)
+{
+    if (record.active) {
+        if (bits > 4) {
+            uint8_t *data = record_add(REC_ALPHA, x, y, w, color, 0, bits, w);
+            if (data) {
+                memcpy(data, mix, w);
+            }
+            return;
+        }
+        uint8_t *data = record_add(REC_ALPHA4, x, y, w, color, 0, bits, (w + 1) / 2);
+        for (int i = 0; data && (i < w); i++) {
+            data[i / 2] = (i & 1) ? data[i / 2] | mix[i] : mix[i] << 4;
+        }
+        return;
+    }
+
+    int skip;
+    x += scroll.x;
+    y += scroll.y;
+    uint16_t *dot = clip_span(&x, y, &w, &skip);
+    if (dot) {
+        blend_row_alpha(dot, w, color, mix + skip, bits);
+    }
+}
+
+void st7789_span_pixels(int x, int y, int w, const uint16_t *pixels,
+                        const uint8_t *mix, uint8_t bits)
+{
+    if (record.active) {
+        uint8_t op = mix ? REC_PIXELS_MIX : REC_PIXELS;
+        uint8_t *data = record_add(op, x, y, w, 0, 0, bits, w * (mix ? 3 : 2));
+        if (data) {
+            memcpy(data, pixels, w * 2);
+            if (mix) {
+                memcpy(data + w * 2, mix, w);
+            }
+        }
+        return;
+    }
+
+    int skip;
+    x += scroll.x;
+    y += scroll.y;
+    uint16_t *dot = clip_span(&x, y, &w, &skip);
+    if (dot) {
+        blend_row_pixels(dot, w, pixels + skip, mix ? mix + skip : NULL, bits);
+    }
+}
+
+void st7789_hline(int x, int y, uint16_t w, uint16_t color, uint8_t mix)
+{
+    st7789_span(x, y, w, color, mix, 8);
 }
 
 void st7789_vline(int x, int y, uint16_t h, uint16_t color, uint8_t mix)
@@ -343,9 +996,7 @@ void st7789_vline(int x, int y, uint16_t h, uint16_t color, uint8_t mix)
 void st7789_bar(int x, int y, uint16_t w, uint16_t h, uint16_t color, uint8_t mix)
 {
     for (int i = 0; i < h; i++) {
-        for (int j = 0; j < w; j++) {
-            mix_pixel(x + j, y + i, color, mix, 8);
-        }
+        st7789_span(x, y + i, w, color, mix, 8);
     }
 }
 
@@ -372,7 +1023,61 @@ void st7789_line(int x0, int y0, int x1, int y1, uint16_t color, uint8_t mix)
     }
 }
 
+void st7789_record_begin(void *buf, size_t size)
+{
+    record.buf = buf;
+    record.size = size;
+    record.used = 0;
+    record.failed = false;
+    record.active = true;
+}
+
+size_t st7789_record_end()
+{
+    record.active = false;
+    return record.failed ? 0 : record.used;
+}
+
+void st7789_replay(const void *buf, size_t len)
+{
+    const uint8_t *pos = buf;
+    const uint8_t *end = pos + len;
+
+    while (pos < end) {
+        const record_t *rec = (const record_t *)pos;
+        const uint8_t *data = pos + sizeof(record_t);
+        size_t size = 0;
+
+        if (rec->op == REC_SPAN) {
+            st7789_span(rec->x, rec->y, rec->w, rec->color, rec->mix, rec->bits);
+        } else if (rec->op == REC_ALPHA) {
+            st7789_span_alpha(rec->x, rec->y, rec->w, rec->color, data, rec->bits);
+            size = rec->w;
+        } else if (rec->op == REC_ALPHA4) {
+            uint8_t mix[64];
+            for (int i = 0; i < rec->w; i += sizeof(mix)) {
+                int count = rec->w - i < sizeof(mix) ? rec->w - i : sizeof(mix);
+                for (int j = 0; j < count; j++) {
+                    int k = i + j;
+                    mix[j] = (k & 1) ? data[k / 2] & 0x0f : data[k / 2] >> 4;
+                }
+                st7789_span_alpha(rec->x + i, rec->y, count, rec->color, mix, rec->bits);
+            }
+            size = (rec->w + 1) / 2;
+        } else if (rec->op == REC_PIXELS) {
+            st7789_span_pixels(rec->x, rec->y, rec->w, (const uint16_t *)data, NULL, 0);
+            size = rec->w * 2;
+        } else if (rec->op == REC_PIXELS_MIX) {
+            st7789_span_pixels(rec->x, rec->y, rec->w, (const uint16_t *)data,
+                               data + rec->w * 2, rec->bits);
+            size = rec->w * 3;
+        }
+
+        pos = data + ((size + 1) & ~1);
+    }
+}
+
 uint16_t *st7789_vram(uint16_t x, uint16_t y)
 {
-    return &vram[y * crop.w + x];
+    return &vram[(y - band.y0) * crop.w + x];
 }
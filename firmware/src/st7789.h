@@ -5,11 +5,20 @@
  * LEDK is driven by PWM to adjust brightness
  */
 
+#ifndef ST7789_H
+#define ST7789_H
+
 #include <stdint.h>
 #include <stdbool.h>
 
 #include "hardware/spi.h"
 
+/* Band rendering: 0 keeps a full frame vram, otherwise only two bands of
+   this many rows are kept and frames are drawn through st7789_render() */
+#ifndef ST7789_BAND_HEIGHT
+#define ST7789_BAND_HEIGHT 0
+#endif
+
 void st7789_reset();
 void st7789_init_spi(spi_inst_t *port, uint8_t sck, uint8_t tx, uint8_t csn);
 void st7789_init(spi_inst_t *port, uint8_t dc, uint8_t rst, uint8_t ledk);
@@ -18,21 +27,60 @@ uint16_t st7789_get_crop_width();
 uint16_t st7789_get_crop_height();
 void st7789_dimmer(uint8_t level);
 void st7789_vsync();
+
+/* only damaged areas since last flush are sent */
 void st7789_flush(bool vsync);
 
+/* draw is called once per band in band mode, it must be repeatable */
+void st7789_render(void (*draw)());
+int st7789_band_top();
+int st7789_band_bottom();
+
+typedef struct {
+    uint32_t frames;
+    uint32_t last_bytes;
+    uint32_t last_rects;
+    uint32_t avg_bytes;
+} st7789_stat_t;
+
+st7789_stat_t st7789_get_stat();
+
 #define st7789_rgb32(r, g, b) ((r << 16) | (g << 8) | b)
 #define st7789_rgb565(rgb32) ((rgb32 >> 8) & 0xf800) | ((rgb32 >> 5) & 0x0780) | ((rgb32 >> 3) & 0x001f)
 #define st7789_gray(value) ((value >> 3 << 11) | (value >> 3 << 6) | (value >> 3))  
 
 void st7789_clear(uint16_t color, bool raw);
 void st7789_fill(uint16_t *pattern, size_t size, bool raw);
+/* writing through vram pointer directly needs st7789_damage(),
+   in band mode only rows in current band are valid */
 uint16_t *st7789_vram(uint16_t x, uint16_t y);
+void st7789_damage(int x, int y, int w, int h);
+
+/* Damage from here to the flush is also remembered as overlay, a layer
+   drawn below it can restore those areas in the next frame */
+void st7789_overlay_begin();
+bool st7789_last_overlay(int i, int *x, int *y, int *w, int *h);
 void st7789_vramcpy(uint32_t offset, const void *src, size_t count);
+
+/* Recording keeps blending draws (pixel, span, line, bar...) in buf
+   instead of drawing them, raw draws, clear and fill can't be recorded.
+   End returns bytes used, 0 if anything didn't make it. Replay draws
+   them again at current scroll. */
+void st7789_record_begin(void *buf, size_t size);
+size_t st7789_record_end();
+void st7789_replay(const void *buf, size_t len);
 void st7789_pixel_raw(int x, int y, uint16_t color);
 void st7789_pixel(int x, int y, uint16_t color, uint8_t mix, uint8_t bits);
+void st7789_span_raw(int x, int y, int w, uint16_t color);
+void st7789_span(int x, int y, int w, uint16_t color, uint8_t mix, uint8_t bits);
+void st7789_span_alpha(int x, int y, int w, uint16_t color, const uint8_t *mix, uint8_t bits);
+void st7789_span_pixels(int x, int y, int w, const uint16_t *pixels,
+                        const uint8_t *mix, uint8_t bits);
 void st7789_hline(int x, int y, uint16_t w, uint16_t color, uint8_t mix);
 void st7789_vline(int x, int y, uint16_t h, uint16_t color, uint8_t mix);
 void st7789_bar(int x, int y, uint16_t w, uint16_t h, uint16_t color, uint8_t mix);
 void st7789_line(int x0, int y0, int x1, int y1, uint16_t color, uint8_t mix);
 
 void st7789_scroll(int dx, int dy);
+
+#endif
@@ -97,7 +97,7 @@ extern "C" {
 
 //------------- CLASS -------------//
 #define CFG_TUD_HID 3
-#define CFG_TUD_CDC 2
+#define CFG_TUD_CDC 3
 #define CFG_TUD_MSC 0
 #define CFG_TUD_MIDI 0
 #define CFG_TUD_VENDOR 0
@@ -106,13 +106,16 @@ uint8_t const* tud_hid_descriptor_report_cb(uint8_t itf)
 enum { ITF_NUM_CARDIO, ITF_NUM_NKRO, ITF_NUM_LIGHT,
        ITF_NUM_CLI, ITF_NUM_CLI_DATA,
        ITF_NUM_AIME, ITF_NUM_AIME_DATA,
+       ITF_NUM_AIME2, ITF_NUM_AIME2_DATA,
        ITF_NUM_TOTAL };
 
-#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + TUD_HID_DESC_LEN * 3 + TUD_CDC_DESC_LEN * 2)
+#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + TUD_HID_DESC_LEN * 2 + \
+                          TUD_HID_INOUT_DESC_LEN + TUD_CDC_DESC_LEN * 3)
 
 #define EPNUM_CARDIO 0x81
 #define EPNUM_KEY 0x82
 #define EPNUM_LIGHT 0x83
+#define EPNUM_LIGHT_OUT 0x03
 
 #define EPNUM_CLI_NOTIF 0x85
 #define EPNUM_CLI_OUT   0x06
@@ -122,6 +125,10 @@ enum { ITF_NUM_CARDIO, ITF_NUM_NKRO, ITF_NUM_LIGHT,
 #define EPNUM_AIME_OUT   0x08
 #define EPNUM_AIME_IN    0x88
 
+#define EPNUM_AIME2_NOTIF 0x89
+#define EPNUM_AIME2_OUT   0x0a
+#define EPNUM_AIME2_IN    0x8a
+
 uint8_t const desc_configuration_dev[] = {
     // Config number, interface count, string index, total length, attribute,
     // power in mA
@@ -138,15 +145,19 @@ uint8_t const desc_configuration_dev[] = {
                        sizeof(desc_hid_report_nkro), EPNUM_KEY,
                        CFG_TUD_HID_EP_BUFSIZE, 1),
 
-    TUD_HID_DESCRIPTOR(ITF_NUM_LIGHT, 6, HID_ITF_PROTOCOL_NONE,
-                       sizeof(desc_hid_report_light), EPNUM_LIGHT,
-                       CFG_TUD_HID_EP_BUFSIZE, 4),
+    /* lights take an OUT endpoint, so hosts can stream zone reports */
+    TUD_HID_INOUT_DESCRIPTOR(ITF_NUM_LIGHT, 6, HID_ITF_PROTOCOL_NONE,
+                             sizeof(desc_hid_report_light), EPNUM_LIGHT_OUT,
+                             EPNUM_LIGHT, CFG_TUD_HID_EP_BUFSIZE, 1),
 
     TUD_CDC_DESCRIPTOR(ITF_NUM_CLI, 7, EPNUM_CLI_NOTIF,
                        8, EPNUM_CLI_OUT, EPNUM_CLI_IN, 64),
 
     TUD_CDC_DESCRIPTOR(ITF_NUM_AIME, 8, EPNUM_AIME_NOTIF,
                        8, EPNUM_AIME_OUT, EPNUM_AIME_IN, 64),
+
+    TUD_CDC_DESCRIPTOR(ITF_NUM_AIME2, 12, EPNUM_AIME2_NOTIF,
+                       8, EPNUM_AIME2_OUT, EPNUM_AIME2_IN, 64),
 };
 
 // Invoked when received GET CONFIGURATION DESCRIPTOR
@@ -176,6 +187,7 @@ const char *string_desc_arr[] = {
     "AIC Pico Red Light",
     "AIC Pico Green Light",
     "AIC Pico Blue Light",
+    "AIC Pico AIME Port 2",
 };
 
 // Invoked when received GET STRING DESCRIPTOR request
@@ -8,8 +8,16 @@ enum {
     REPORT_ID_EAMU = 1,
     REPORT_ID_FELICA = 2,
     REPORT_ID_LIGHTS = 3,
+    REPORT_ID_LIGHTS_ZONE = 4,
 };
 
+/* Zone lighting report: first pixel, count, then RGB triplets. Count with
+   bit 7 set fills (count & 0x7f) pixels with the first triplet. Pixels are
+   the WS2812 strip, then the PWM LEDs from the board's RGB_NUM on. */
+#define LIGHT_ZONE_RGB_MAX 20
+#define LIGHT_ZONE_FILL 0x80
+#define LIGHT_ZONE_REPORT_SIZE (2 + LIGHT_ZONE_RGB_MAX * 3)
+
 #define AIC_PICO_REPORT_DESC_CARDIO                        \
     HID_USAGE_PAGE_N(0xffca, 2),                           \
     HID_USAGE(0x01),                                       \
@@ -79,6 +87,13 @@ enum {
       HID_OUTPUT(HID_DATA | HID_VARIABLE | HID_ABSOLUTE),  \
       HID_REPORT_COUNT(15), HID_REPORT_SIZE(8),            \
       HID_INPUT(HID_CONSTANT | HID_VARIABLE | HID_ABSOLUTE), \
+                                                           \
+      HID_REPORT_ID(REPORT_ID_LIGHTS_ZONE)                 \
+      HID_USAGE_PAGE_N(HID_USAGE_PAGE_VENDOR, 2),          \
+      HID_USAGE(0x01),                                     \
+      HID_LOGICAL_MIN(0x00), HID_LOGICAL_MAX_N(0x00ff, 2), \
+      HID_REPORT_COUNT(LIGHT_ZONE_REPORT_SIZE), HID_REPORT_SIZE(8), \
+      HID_OUTPUT(HID_DATA | HID_VARIABLE | HID_ABSOLUTE),  \
       HID_COLLECTION_END
 
 #endif
\ No newline at end of file
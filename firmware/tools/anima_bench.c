@@ -0,0 +1,215 @@
+/*
+ * Anima decode and blit benchmark for AIC Pico
+ * WHowe <github.com/whowechina>
+ * Compares per-pixel decoding against run/span decoding on the host,
+ * also checks that both produce the same frame.
+ * Build: gcc -O2 -I../src -o anima_bench anima_bench.c
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "../src/rle.c"
+#include "../src/res/anima_star.h"
+#include "../src/res/anima_light.h"
+#include "../src/res/anima_glow.h"
+
+#define WIDTH 240
+#define HEIGHT 280
+
+static uint16_t vram[HEIGHT * WIDTH];
+static uint16_t vram_ref[HEIGHT * WIDTH];
+static uint16_t pallete[16];
+
+static void rle_frame(rle_decoder_t *rle, const anima_t *ani, int frame)
+{
+    rle_init(rle, &(rle_src_t){ ani->data + ani->index[frame % ani->frames],
+                                ani->encoding, 4, ani->size, 0x00 });
+}
+
+static uint16_t mix_color(uint16_t bg, uint16_t color, uint8_t mix, uint8_t bits)
+{
+    uint16_t bg_ratio = (1L << bits) - mix;
+    uint8_t r = ((bg >> 11) * bg_ratio + (color >> 11) * mix) >> bits;
+    uint8_t g = (((bg >> 5) & 0x3f) * bg_ratio + ((color >> 5) & 0x3f) * mix) >> bits;
+    uint8_t b = ((bg & 0x1f) * bg_ratio + (color & 0x1f) * mix) >> bits;
+    return (r << 11) | (g << 5) | b;
+}
+
+/* per pixel calls, as the firmware used to do */
+__attribute__((noinline)) static void pixel_raw(uint16_t *buf, int x, int y, uint16_t color)
+{
+    buf[y * WIDTH + x] = color;
+}
+
+__attribute__((noinline)) static void pixel_mix(uint16_t *buf, int x, int y,
+                                                uint16_t color, uint8_t mix)
+{
+    if ((mix == 0) || (x >= WIDTH) || (y >= HEIGHT)) {
+        return;
+    }
+    uint16_t *dot = &buf[y * WIDTH + x];
+    *dot = (mix == 15) ? color : mix_color(*dot, color, mix, 4);
+}
+
+static void draw_pixels(uint16_t *buf, const anima_t *ani, int frame)
+{
+    rle_decoder_t rle;
+    rle_frame(&rle, ani, frame);
+    for (int j = 0; j < ani->height; j++) {
+        for (int i = 0; i < ani->width; i++) {
+            pixel_raw(buf, i, j, pallete[rle_get_uint4(&rle)]);
+        }
+    }
+}
+
+static void mix_pixels(uint16_t *buf, const anima_t *ani, int frame)
+{
+    rle_decoder_t rle;
+    rle_frame(&rle, ani, frame);
+    for (int j = 0; j < ani->height; j++) {
+        for (int i = 0; i < ani->width; i++) {
+            pixel_mix(buf, i, j, 0xffff, rle_get_uint4(&rle));
+        }
+    }
+}
+
+/* run and span, same as gfx.c and st7789.c */
+static inline void fill16(uint16_t *dst, uint16_t color, int count)
+{
+    if ((count > 0) && ((uintptr_t)dst & 2)) {
+        *dst++ = color;
+        count--;
+    }
+    uint32_t c32 = (color << 16) | color;
+    uint32_t *dst32 = (uint32_t *)dst;
+    for (; count >= 2; count -= 2) {
+        *dst32++ = c32;
+    }
+    if (count) {
+        *(uint16_t *)dst32 = color;
+    }
+}
+
+static void draw_spans(uint16_t *buf, const anima_t *ani, int frame)
+{
+    rle_decoder_t rle;
+    rle_frame(&rle, ani, frame);
+    int i = 0;
+    int j = 0;
+    while (j < ani->height) {
+        uint8_t value;
+        uint32_t len = rle_get_run_uint4(&rle, &value);
+        if (len == 0) {
+            break;
+        }
+        while ((len > 0) && (j < ani->height)) {
+            int span = ani->width - i < len ? ani->width - i : len;
+            fill16(&buf[j * WIDTH + i], pallete[value], span);
+            i += span;
+            len -= span;
+            if (i == ani->width) {
+                i = 0;
+                j++;
+            }
+        }
+    }
+}
+
+static void mix_spans(uint16_t *buf, const anima_t *ani, int frame)
+{
+    rle_decoder_t rle;
+    rle_frame(&rle, ani, frame);
+    int pos = 0;
+    int total = ani->width * ani->height;
+    while (pos < total) {
+        uint8_t value;
+        uint32_t len = rle_get_run_uint4(&rle, &value);
+        if (len == 0) {
+            break;
+        }
+        if (value == 0) {
+            pos += len;
+            continue;
+        }
+        while ((len > 0) && (pos < total)) {
+            int i = pos % ani->width;
+            int span = ani->width - i < len ? ani->width - i : len;
+            uint16_t *dot = &buf[(pos / ani->width) * WIDTH + i];
+            if (value == 15) {
+                fill16(dot, 0xffff, span);
+            } else {
+                for (int k = 0; k < span; k++) {
+                    dot[k] = mix_color(dot[k], 0xffff, value, 4);
+                }
+            }
+            pos += span;
+            len -= span;
+        }
+    }
+}
+
+typedef void (*blit_func)(uint16_t *buf, const anima_t *ani, int frame);
+
+static double bench(blit_func func, const anima_t *ani, int rounds)
+{
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int r = 0; r < rounds; r++) {
+        for (int f = 0; f < ani->frames; f++) {
+            func(vram, ani, f);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double us = (t1.tv_sec - t0.tv_sec) * 1e6 + (t1.tv_nsec - t0.tv_nsec) / 1e3;
+    return us / rounds / ani->frames;
+}
+
+static bool verify(blit_func ref, blit_func test, const anima_t *ani)
+{
+    for (int f = 0; f < ani->frames; f++) {
+        memset(vram_ref, 0x55, sizeof(vram_ref));
+        memset(vram, 0x55, sizeof(vram));
+        ref(vram_ref, ani, f);
+        test(vram, ani, f);
+        if (memcmp(vram, vram_ref, sizeof(vram)) != 0) {
+            printf("  Mismatch at frame %d\n", f);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void run(const char *name, const anima_t *ani, bool mix, int rounds)
+{
+    blit_func ref = mix ? mix_pixels : draw_pixels;
+    blit_func test = mix ? mix_spans : draw_spans;
+
+    printf("%s (%dx%d, %ld frames, %s):\n", name, ani->width, ani->height,
+           (long)ani->frames, mix ? "mix" : "draw");
+    bool ok = verify(ref, test, ani);
+    double t_ref = bench(ref, ani, rounds);
+    double t_test = bench(test, ani, rounds);
+    printf("  per pixel: %8.2f us/frame\n", t_ref);
+    printf("  run/span:  %8.2f us/frame (x%.1f) %s\n", t_test, t_ref / t_test,
+           ok ? "OK" : "MISMATCH");
+}
+
+int main(int argc, char *argv[])
+{
+    int rounds = argc > 1 ? atoi(argv[1]) : 50;
+
+    for (int i = 0; i < 16; i++) {
+        pallete[i] = i * 0x1111;
+    }
+
+    run("anima_star", &anima_star, false, rounds);
+    run("anima_light", &anima_light, false, rounds);
+    run("anima_glow", &anima_glow, true, rounds * 10);
+
+    return 0;
+}
@@ -81,6 +81,7 @@ int main()
     printf("    .index = %s_index,\n", name);
     printf("    .data = %s_data,\n", name);
     printf("    .size = sizeof(%s_data),\n", name);
+    printf("    .encoding = RLE_RLE_X,\n");
     printf("};\n");
 
     fprintf(stderr, "Frame count: %d\n", frame_count);
@@ -0,0 +1,229 @@
+/*
+ * Delta anima conversion tool for AIC Pico
+ * WHowe <github.com/whowechina>
+ * Re-encodes a full frame anima (4bpp, RLE X=0 per frame) into keyframes
+ * and delta frames for the anima player. A delta frame is a list of
+ * changed row spans against the previous frame, each span is y, x, width
+ * (16 bit little endian) and raw 4bpp pixels. Spans start at even x with
+ * even width, a y of 0xffff ends the frame. A frame becomes a delta only
+ * when it's smaller than its keyframe, or always with -d.
+ * Build: gcc -O2 -I../src -o anima_delta anima_delta.c
+ * Usage: ./anima_delta <star|light|glow> [key_interval] [-d] > ../src/res/anima_xxx.h
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../src/rle.c"
+#include "../src/res/anima_star.h"
+#include "../src/res/anima_light.h"
+#include "../src/res/anima_glow.h"
+
+/* a new span costs 6 bytes of header, that's 12 pixels */
+#define SPAN_GAP 12
+#define FRAME_MAX (240 * 280 / 2)
+
+static uint8_t frames[2][FRAME_MAX];
+static uint8_t check[FRAME_MAX];
+static uint8_t key_buf[FRAME_MAX * 2];
+static uint8_t delta_buf[FRAME_MAX * 2];
+static uint8_t output[8 * 1024 * 1024];
+static uint32_t index_table[1024];
+static uint8_t delta_map[128];
+
+static void decode_frame(const anima_t *ani, int frame, uint8_t *out)
+{
+    rle_decoder_t rle;
+    rle_init(&rle, &(rle_src_t){ ani->data + ani->index[frame], ani->encoding,
+                                 4, ani->size, 0x00 });
+    for (int i = 0; i < ani->width * ani->height / 2; i++) {
+        out[i] = rle_get_uint8(&rle);
+    }
+}
+
+static inline void put16(uint8_t *out, size_t *pos, uint16_t value)
+{
+    out[(*pos)++] = value & 0xff;
+    out[(*pos)++] = value >> 8;
+}
+
+/* works on bytes, so spans are always 2 pixels aligned */
+static size_t encode_delta(const uint8_t *prev, const uint8_t *curr, int width, int height,
+                           uint8_t *out)
+{
+    size_t pos = 0;
+    int stride = width / 2;
+    for (int y = 0; y < height; y++) {
+        const uint8_t *a = prev + y * stride;
+        const uint8_t *b = curr + y * stride;
+        int i = 0;
+        while (i < stride) {
+            if (a[i] == b[i]) {
+                i++;
+                continue;
+            }
+            int start = i;
+            int end = i + 1;
+            for (int j = end; j < stride; j++) {
+                if (a[j] != b[j]) {
+                    if (j - end > SPAN_GAP / 2) {
+                        break;
+                    }
+                    end = j + 1;
+                }
+            }
+            put16(out, &pos, y);
+            put16(out, &pos, start * 2);
+            put16(out, &pos, (end - start) * 2);
+            memcpy(out + pos, b + start, end - start);
+            pos += end - start;
+            i = end;
+        }
+    }
+    put16(out, &pos, 0xffff);
+    return pos;
+}
+
+static void decode_key(const uint8_t *data, size_t size, int frame_size, uint8_t *out)
+{
+    rle_decoder_t rle;
+    rle_init(&rle, &(rle_src_t){ data, RLE_RLE_X, 4, size, 0x00 });
+    for (int i = 0; i < frame_size; i++) {
+        out[i] = rle_get_uint8(&rle);
+    }
+}
+
+static void apply_delta(const uint8_t *data, int width, uint8_t *out)
+{
+    while (true) {
+        uint16_t y = data[0] | (data[1] << 8);
+        if (y == 0xffff) {
+            break;
+        }
+        uint16_t x = data[2] | (data[3] << 8);
+        uint16_t w = data[4] | (data[5] << 8);
+        memcpy(out + (y * width + x) / 2, data + 6, w / 2);
+        data += 6 + w / 2;
+    }
+}
+
+static void print_data(const char *name, size_t size)
+{
+    printf("const uint8_t %s_data[] = {", name);
+    for (size_t i = 0; i < size; i++) {
+        if ((i & 15) == 0) {
+            printf("\n   ");
+        }
+        printf(" 0x%02x,", output[i]);
+    }
+    printf("\n};\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const anima_t *ani = NULL;
+    const char *name = NULL;
+    int key_interval = 0;
+    bool force_delta = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "star") == 0) {
+            ani = &anima_star;
+            name = "anima_star";
+        } else if (strcmp(argv[i], "light") == 0) {
+            ani = &anima_light;
+            name = "anima_light";
+        } else if (strcmp(argv[i], "glow") == 0) {
+            ani = &anima_glow;
+            name = "anima_glow";
+        } else if (strcmp(argv[i], "-d") == 0) {
+            force_delta = true;
+        } else {
+            key_interval = atoi(argv[i]);
+        }
+    }
+
+    if (!ani || (ani->width * ani->height / 2 > FRAME_MAX) || (ani->frames > 1024)) {
+        fprintf(stderr, "Usage: %s <star|light|glow> [key_interval] [-d]\n", argv[0]);
+        return 1;
+    }
+    if (key_interval <= 0) {
+        key_interval = ani->frames;
+    }
+
+    int frame_size = ani->width * ani->height / 2;
+    size_t pos = 0;
+    int delta_num = 0;
+
+    for (int f = 0; f < ani->frames; f++) {
+        uint8_t *curr = frames[f & 1];
+        uint8_t *prev = frames[(f & 1) ^ 1];
+        decode_frame(ani, f, curr);
+
+        size_t key_size = rle_x_encode_uint8(key_buf, curr, frame_size, 0);
+        size_t delta_size = SIZE_MAX;
+        if (f % key_interval) {
+            delta_size = encode_delta(prev, curr, ani->width, ani->height, delta_buf);
+        }
+
+        index_table[f] = pos;
+        bool delta = (delta_size != SIZE_MAX) && (force_delta || (delta_size < key_size));
+        if (delta) {
+            memcpy(output + pos, delta_buf, delta_size);
+            pos += delta_size;
+            delta_map[f / 8] |= 1 << (f % 8);
+            delta_num++;
+            apply_delta(output + index_table[f], ani->width, check);
+        } else {
+            memcpy(output + pos, key_buf, key_size);
+            pos += key_size;
+            decode_key(output + index_table[f], key_size, frame_size, check);
+        }
+
+        /* the player must get exactly the same frame back */
+        if (memcmp(check, curr, frame_size) != 0) {
+            fprintf(stderr, "Frame %d mismatch\n", f);
+            return 1;
+        }
+    }
+
+    printf("/* Generated by anima_delta.c, 4 bit per pixel, RLE X=0 keyframes,\n"
+           "   %d of %d frames are row span deltas. */\n\n", delta_num, (int)ani->frames);
+    printf("#include <stdint.h>\n");
+    printf("#include \"../gfx.h\"\n\n");
+    print_data(name, pos);
+
+    printf("const uint32_t %s_index[] = {", name);
+    for (int f = 0; f < ani->frames; f++) {
+        printf("%s %u,", (f & 7) ? "" : "\n   ", index_table[f]);
+    }
+    printf("\n};\n\n");
+
+    if (delta_num) {
+        printf("const uint8_t %s_delta_map[] = {\n   ", name);
+        for (int i = 0; i < (ani->frames + 7) / 8; i++) {
+            printf(" 0x%02x,", delta_map[i]);
+        }
+        printf("\n};\n\n");
+    }
+
+    printf("const anima_t %s = {\n", name);
+    printf("    .width = %d,\n", ani->width);
+    printf("    .height = %d,\n", ani->height);
+    printf("    .frames = %d,\n", (int)ani->frames);
+    printf("    .size = sizeof(%s_data),\n", name);
+    printf("    .index = %s_index,\n", name);
+    printf("    .data = %s_data,\n", name);
+    printf("    .encoding = RLE_RLE_X,\n");
+    if (delta_num) {
+        printf("    .delta_map = %s_delta_map,\n", name);
+    }
+    printf("};\n");
+
+    fprintf(stderr, "%s: %d frames, %d deltas, %u -> %zu bytes\n",
+            name, (int)ani->frames, delta_num, (unsigned)ani->size, pos);
+    return 0;
+}
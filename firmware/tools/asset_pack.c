@@ -0,0 +1,758 @@
+/*
+ * Asset packer for AIC Pico
+ * WHowe <github.com/whowechina>
+ * Packs images, animas and fonts into one blob with a typed index
+ * (image_t, anima_t and lv_font_t tables pointing into the blob).
+ * Every pixel stream is encoded with RLE, RLE X and PACK, the smallest
+ * one wins, decoding is verified and timed with the firmware's rle.c.
+ *
+ * Sources:
+ *   -b                           re-pack the built-in res/ assets
+ *   image:<name>:<file.pam>      RGB or RGBA PAM (P7) image
+ *   anima:<name>:<h>:<file.pgm>  PGM (P5) strip, frames of height h stacked
+ * PNG or GIF can be converted first, e.g. "convert logo.png logo.pam".
+ *
+ * Build: gcc -O2 -I../src -o asset_pack asset_pack.c
+ * Usage: ./asset_pack -b image:logo:logo.pam > ../src/res/assets.h
+ * The header goes to stdout, the report goes to stderr.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#include "../src/rle.c"
+#include "../src/res/resource.h"
+
+#define MAX_ASSETS 64
+#define MAX_FRAMES 256
+#define BLOB_MAX (4 * 1024 * 1024)
+
+typedef enum {
+    ASSET_IMAGE,
+    ASSET_ANIMA,
+    ASSET_FONT,
+} asset_type_t;
+
+/* raw values, one per pixel, decoded from sources */
+typedef struct {
+    uint32_t *values;
+    size_t count;
+    int bits;
+} stream_t;
+
+/* an encoded stream, offset is in the blob */
+typedef struct {
+    rle_encoding_t encoding;
+    uint32_t x;
+    uint32_t offset;
+    uint32_t size;
+    double ns_per_value;
+} packed_t;
+
+typedef struct {
+    asset_type_t type;
+    char name[32];
+    int width;
+    int height;
+
+    /* image */
+    stream_t pixels;
+    stream_t alpha;
+    uint32_t pallete[256];
+    int pallete_size;
+    packed_t packed_pixels;
+    packed_t packed_alpha;
+    uint32_t pallete_offset;
+
+    /* anima */
+    int frames;
+    stream_t frame[MAX_FRAMES];
+    uint32_t frame_offset[MAX_FRAMES];
+    rle_encoding_t anima_encoding;
+    uint32_t data_offset;
+    uint32_t data_size;
+
+    /* font, glyphs are random accessed so bitmaps are not compressed */
+    const lv_font_t *font;
+    uint32_t bitmap_offset;
+    uint32_t bitmap_size;
+
+    uint32_t raw_size;
+    uint32_t packed_size;
+} asset_t;
+
+static asset_t assets[MAX_ASSETS];
+static int asset_num = 0;
+
+static uint8_t blob[BLOB_MAX];
+static uint32_t blob_size = 0;
+
+static uint8_t work[BLOB_MAX];
+static uint8_t best[BLOB_MAX];
+
+static const char *encoding_name[] = { "NONE", "RLE", "RLE_X", "PACK" };
+static const char *encoding_symbol[] = { "RLE_NONE", "RLE_RLE", "RLE_RLE_X", "RLE_PACK" };
+
+static asset_t *new_asset(asset_type_t type, const char *name)
+{
+    if (asset_num >= MAX_ASSETS) {
+        fprintf(stderr, "Too many assets\n");
+        exit(1);
+    }
+    asset_t *asset = &assets[asset_num++];
+    memset(asset, 0, sizeof(*asset));
+    asset->type = type;
+    snprintf(asset->name, sizeof(asset->name), "%s", name);
+    return asset;
+}
+
+static void stream_alloc(stream_t *stream, size_t count, int bits)
+{
+    stream->values = calloc(count, sizeof(uint32_t));
+    stream->count = count;
+    stream->bits = bits;
+}
+
+static uint32_t blob_append(const void *data, size_t size)
+{
+    blob_size = (blob_size + 3) & ~3;
+    if (blob_size + size > BLOB_MAX) {
+        fprintf(stderr, "Blob overflow\n");
+        exit(1);
+    }
+    uint32_t offset = blob_size;
+    memcpy(blob + offset, data, size);
+    blob_size += size;
+    return offset;
+}
+
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Raw layout, 4bpp is packed high nibble first */
+static size_t stream_raw(const stream_t *stream, uint8_t *output)
+{
+    if (stream->bits == 4) {
+        memset(output, 0, (stream->count + 1) / 2);
+        for (size_t i = 0; i < stream->count; i++) {
+            output[i / 2] |= (stream->values[i] & 0x0f) << ((i & 1) ? 0 : 4);
+        }
+        return (stream->count + 1) / 2;
+    } else if (stream->bits == 8) {
+        for (size_t i = 0; i < stream->count; i++) {
+            output[i] = stream->values[i];
+        }
+        return stream->count;
+    }
+    uint16_t *output16 = (uint16_t *)output;
+    for (size_t i = 0; i < stream->count; i++) {
+        output16[i] = stream->values[i];
+    }
+    return stream->count * 2;
+}
+
+static uint32_t most_frequent(const uint8_t *data, size_t size, int bits)
+{
+    static uint32_t hist[65536];
+    memset(hist, 0, sizeof(hist));
+    size_t units = bits == 16 ? size / 2 : size;
+    uint32_t best_value = 0;
+    for (size_t i = 0; i < units; i++) {
+        uint32_t v = bits == 16 ? ((const uint16_t *)data)[i] : data[i];
+        if (++hist[v] > hist[best_value]) {
+            best_value = v;
+        }
+    }
+    return best_value;
+}
+
+/* Returns size in bytes */
+static size_t encode(const stream_t *stream, rle_encoding_t encoding, uint32_t x, uint8_t *output)
+{
+    static uint8_t raw[BLOB_MAX];
+    size_t size = stream_raw(stream, raw);
+    bool wide = (stream->bits == 16);
+
+    switch (encoding) {
+        case RLE_NONE:
+            memcpy(output, raw, size);
+            return size;
+        case RLE_RLE:
+            return wide ? rle_encode_uint16((uint16_t *)output, (uint16_t *)raw, size / 2) * 2
+                        : rle_encode_uint8(output, raw, size);
+        case RLE_RLE_X:
+            return wide ? rle_x_encode_uint16((uint16_t *)output, (uint16_t *)raw, size / 2, x) * 2
+                        : rle_x_encode_uint8(output, raw, size, x);
+        case RLE_PACK:
+            return wide ? rle_pack_encode_uint16((uint16_t *)output, (uint16_t *)raw, size / 2) * 2
+                        : rle_pack_encode_uint8(output, raw, size);
+    }
+    return 0;
+}
+
+static rle_src_t make_src(const uint8_t *data, rle_encoding_t encoding,
+                          int bits, size_t size, uint32_t x)
+{
+    return (rle_src_t) { .input = data, .encoding = encoding, .bits = bits,
+                         .size = bits == 16 ? size / 2 : size, .x = x };
+}
+
+static bool verify(const stream_t *stream, const rle_src_t *src)
+{
+    rle_decoder_t rle;
+    rle_init(&rle, src);
+    for (size_t i = 0; i < stream->count; i++) {
+        if (rle_get(&rle) != stream->values[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static double decode_time(const stream_t *stream, const rle_src_t *src)
+{
+    volatile uint32_t sink = 0;
+    int rounds = 0;
+    double start = now_ns();
+    double elapsed;
+    do {
+        rle_decoder_t rle;
+        rle_init(&rle, src);
+        for (size_t i = 0; i < stream->count; i++) {
+            sink += rle_get(&rle);
+        }
+        rounds++;
+        elapsed = now_ns() - start;
+    } while (elapsed < 2e6);
+    (void)sink;
+    return elapsed / rounds / stream->count;
+}
+
+/* Tries every codec, the smallest goes into the blob, ties go to the faster one */
+static packed_t pack_stream(const char *name, const stream_t *stream)
+{
+    const rle_encoding_t candidates[] = { RLE_NONE, RLE_RLE, RLE_RLE_X, RLE_PACK };
+    packed_t result = { 0 };
+    size_t raw_size = stream_raw(stream, work);
+    uint32_t x = most_frequent(work, raw_size, stream->bits);
+
+    fprintf(stderr, "  %-22s %7zu", name, raw_size);
+    for (int i = 0; i < 4; i++) {
+        rle_encoding_t encoding = candidates[i];
+        size_t size = encode(stream, encoding, x, work);
+        rle_src_t src = make_src(work, encoding, stream->bits, size, x);
+        if (!verify(stream, &src)) {
+            fprintf(stderr, "\n%s: %s round trip failed\n", name, encoding_name[encoding]);
+            exit(1);
+        }
+        double ns = decode_time(stream, &src);
+        fprintf(stderr, " %7zu(%4.1fns)", size, ns);
+        if ((i == 0) || (size < result.size) ||
+            ((size == result.size) && (ns < result.ns_per_value))) {
+            result = (packed_t) { encoding, x, 0, size, ns };
+            memcpy(best, work, size);
+        }
+    }
+
+    result.offset = blob_append(best, result.size);
+    fprintf(stderr, "  -> %-5s %5.1f%%\n", encoding_name[result.encoding],
+            100.0 * result.size / raw_size);
+    return result;
+}
+
+/* Anima frames share one encoding, RLE X is always with x = 0 */
+static void pack_anima(asset_t *asset)
+{
+    const rle_encoding_t candidates[] = { RLE_RLE, RLE_RLE_X, RLE_PACK };
+    size_t best_total = SIZE_MAX;
+    double best_ns = 0;
+
+    fprintf(stderr, "  %-22s %7zu", asset->name,
+            asset->frames * stream_raw(&asset->frame[0], work));
+    fprintf(stderr, " %15s", "-");
+    for (int i = 0; i < 3; i++) {
+        size_t total = 0;
+        double ns = 0;
+        for (int f = 0; f < asset->frames; f++) {
+            size_t size = encode(&asset->frame[f], candidates[i], 0, work);
+            rle_src_t src = make_src(work, candidates[i], 4, size, 0);
+            if (!verify(&asset->frame[f], &src)) {
+                fprintf(stderr, "\n%s: %s round trip failed at frame %d\n",
+                        asset->name, encoding_name[candidates[i]], f);
+                exit(1);
+            }
+            ns += decode_time(&asset->frame[f], &src);
+            total += size;
+        }
+        ns /= asset->frames;
+        fprintf(stderr, " %7zu(%4.1fns)", total, ns);
+        if ((total < best_total) || ((total == best_total) && (ns < best_ns))) {
+            best_total = total;
+            best_ns = ns;
+            asset->anima_encoding = candidates[i];
+        }
+    }
+
+    blob_size = (blob_size + 3) & ~3;
+    asset->data_offset = blob_size;
+    for (int f = 0; f < asset->frames; f++) {
+        size_t size = encode(&asset->frame[f], asset->anima_encoding, 0, work);
+        asset->frame_offset[f] = blob_size - asset->data_offset;
+        memcpy(blob + blob_size, work, size);
+        blob_size += size;
+    }
+    asset->data_size = blob_size - asset->data_offset;
+    asset->raw_size = asset->frames * ((asset->width * asset->height + 1) / 2);
+    asset->packed_size = asset->data_size;
+    fprintf(stderr, "  -> %-5s %5.1f%%\n", encoding_name[asset->anima_encoding],
+            100.0 * asset->packed_size / asset->raw_size);
+}
+
+static void pack_image(asset_t *asset)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "%s", asset->name);
+    asset->packed_pixels = pack_stream(name, &asset->pixels);
+    asset->raw_size = stream_raw(&asset->pixels, work);
+    asset->packed_size = asset->packed_pixels.size;
+
+    if (asset->alpha.values) {
+        snprintf(name, sizeof(name), "%s.alpha", asset->name);
+        asset->packed_alpha = pack_stream(name, &asset->alpha);
+        asset->raw_size += stream_raw(&asset->alpha, work);
+        asset->packed_size += asset->packed_alpha.size;
+    }
+
+    if (asset->pallete_size) {
+        asset->pallete_offset = blob_append(asset->pallete, asset->pallete_size * 4);
+        asset->raw_size += asset->pallete_size * 4;
+        asset->packed_size += asset->pallete_size * 4;
+    }
+}
+
+static void pack_font(asset_t *asset)
+{
+    const lv_font_t *font = asset->font;
+    uint32_t size = 0;
+    for (int i = 0; i < font->range_length; i++) {
+        const lv_font_dsc_t *dsc = &font->dsc[i];
+        uint32_t end = dsc->bitmap_index +
+                       (dsc->box_w * dsc->box_h * font->bit_per_pixel + 7) / 8;
+        size = end > size ? end : size;
+    }
+    asset->bitmap_offset = blob_append(font->bitmap, size);
+    asset->bitmap_size = size;
+    asset->raw_size = asset->packed_size = size;
+    fprintf(stderr, "  %-22s %7u  stored as is\n", asset->name, size);
+}
+
+/* Built-in assets, decoded back to raw values */
+
+static void load_builtin_image(const char *name, const image_t *img)
+{
+    asset_t *asset = new_asset(ASSET_IMAGE, name);
+    asset->width = img->width;
+    asset->height = img->height;
+
+    size_t count = img->width * img->height;
+    rle_decoder_t rle;
+
+    stream_alloc(&asset->pixels, count, img->pixels.bits);
+    rle_init(&rle, &img->pixels);
+    uint32_t max = 0;
+    for (size_t i = 0; i < count; i++) {
+        asset->pixels.values[i] = rle_get(&rle);
+        max = asset->pixels.values[i] > max ? asset->pixels.values[i] : max;
+    }
+
+    if (img->pallete) {
+        asset->pallete_size = max + 1;
+        memcpy(asset->pallete, img->pallete, asset->pallete_size * 4);
+    } else if (img->alpha.input) {
+        stream_alloc(&asset->alpha, count, img->alpha.bits);
+        rle_init(&rle, &img->alpha);
+        for (size_t i = 0; i < count; i++) {
+            asset->alpha.values[i] = rle_get(&rle);
+        }
+    }
+}
+
+static void load_builtin_anima(const char *name, const anima_t *ani)
+{
+    asset_t *asset = new_asset(ASSET_ANIMA, name);
+    asset->width = ani->width;
+    asset->height = ani->height;
+    asset->frames = ani->frames;
+
+    size_t count = ani->width * ani->height;
+    for (int f = 0; f < ani->frames; f++) {
+        rle_decoder_t rle;
+        rle_init(&rle, &(rle_src_t){ ani->data + ani->index[f], ani->encoding,
+                                     4, ani->size, 0x00 });
+        stream_alloc(&asset->frame[f], count, 4);
+        for (size_t i = 0; i < count; i++) {
+            asset->frame[f].values[i] = rle_get_uint4(&rle);
+        }
+    }
+}
+
+static void load_builtin_font(const char *name, const lv_font_t *font)
+{
+    asset_t *asset = new_asset(ASSET_FONT, name);
+    asset->font = font;
+}
+
+static void load_builtin()
+{
+    load_builtin_anima("star", &anima_star);
+    load_builtin_anima("light", &anima_light);
+    load_builtin_anima("glow", &anima_glow);
+
+    load_builtin_image("aime_reader", &image_aime_reader);
+    load_builtin_image("bana_reader", &image_bana_reader);
+    load_builtin_image("aic_generic", &image_aic_generic);
+    load_builtin_image("aic_bana", &image_aic_bana);
+    load_builtin_image("aic_konami", &image_aic_konami);
+    load_builtin_image("aic_sega", &image_aic_sega);
+    load_builtin_image("aic_nesica", &image_aic_nesica);
+    load_builtin_image("mifare", &image_mifare);
+    load_builtin_image("bana", &image_bana);
+    load_builtin_image("aime", &image_aime);
+    load_builtin_image("nesica", &image_nesica);
+    load_builtin_image("vicinity", &image_vicinity);
+    load_builtin_image("eamuse", &image_eamuse);
+
+    load_builtin_font("conthrax", &lv_conthrax);
+    load_builtin_font("lts13", &lv_lts13);
+    load_builtin_font("lts14", &lv_lts14);
+    load_builtin_font("lts16", &lv_lts16);
+    load_builtin_font("lts18", &lv_lts18);
+    load_builtin_font("lts20", &lv_lts20);
+    load_builtin_font("upheaval", &lv_upheaval);
+}
+
+/* Netpbm sources */
+
+static uint8_t *read_file(const char *path, size_t *size)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "Can't open %s\n", path);
+        exit(1);
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t *data = malloc(*size + 1);
+    if (fread(data, 1, *size, fp) != *size) {
+        fprintf(stderr, "Can't read %s\n", path);
+        exit(1);
+    }
+    fclose(fp);
+    data[*size] = 0;
+    return data;
+}
+
+/* P7 header is "KEY value" lines until ENDHDR */
+static const uint8_t *parse_pam(const uint8_t *data, int *width, int *height, int *depth)
+{
+    const char *p = (const char *)data;
+    if (strncmp(p, "P7\n", 3) != 0) {
+        return NULL;
+    }
+    *width = *height = *depth = 0;
+    while ((p = strchr(p, '\n')) != NULL) {
+        p++;
+        sscanf(p, "WIDTH %d", width);
+        sscanf(p, "HEIGHT %d", height);
+        sscanf(p, "DEPTH %d", depth);
+        if (strncmp(p, "ENDHDR\n", 7) == 0) {
+            return (const uint8_t *)p + 7;
+        }
+    }
+    return NULL;
+}
+
+/* P5 header is "P5 width height maxval" with whitespace and comments */
+static const uint8_t *parse_pgm(const uint8_t *data, int *width, int *height)
+{
+    const char *p = (const char *)data;
+    if (strncmp(p, "P5", 2) != 0) {
+        return NULL;
+    }
+    p += 2;
+    int fields[3];
+    for (int i = 0; i < 3; i++) {
+        while (isspace((uint8_t)*p) || (*p == '#')) {
+            if (*p == '#') {
+                p = strchr(p, '\n');
+            }
+            p++;
+        }
+        fields[i] = strtol(p, (char **)&p, 10);
+    }
+    if (fields[2] != 255) {
+        return NULL;
+    }
+    *width = fields[0];
+    *height = fields[1];
+    return (const uint8_t *)p + 1;
+}
+
+/* RGB565 is in the same byte order as the pallete (see image_conv.c),
+   alpha is 4bpp and is only kept when not fully opaque */
+static void load_pam_image(const char *name, const char *path)
+{
+    size_t size;
+    uint8_t *data = read_file(path, &size);
+    int width, height, depth;
+    const uint8_t *pixels = parse_pam(data, &width, &height, &depth);
+    if (!pixels || ((depth != 3) && (depth != 4))) {
+        fprintf(stderr, "%s: only RGB or RGBA PAM is supported\n", path);
+        exit(1);
+    }
+
+    asset_t *asset = new_asset(ASSET_IMAGE, name);
+    asset->width = width;
+    asset->height = height;
+
+    size_t count = width * height;
+    stream_alloc(&asset->pixels, count, 16);
+    stream_alloc(&asset->alpha, count, 4);
+
+    bool opaque = true;
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *c = pixels + i * depth;
+        asset->pixels.values[i] = (c[0] >> 3) | ((c[1] >> 2) << 5) | ((c[2] >> 3) << 11);
+        uint8_t a = (depth == 4) ? c[3] : 0xff;
+        asset->alpha.values[i] = a >> 4;
+        opaque &= (a == 0xff);
+    }
+
+    if (opaque) {
+        free(asset->alpha.values);
+        memset(&asset->alpha, 0, sizeof(asset->alpha));
+    }
+    free(data);
+}
+
+static void load_pgm_anima(const char *name, int frame_height, const char *path)
+{
+    size_t size;
+    uint8_t *data = read_file(path, &size);
+    int width, height;
+    const uint8_t *pixels = parse_pgm(data, &width, &height);
+    if (!pixels || (frame_height <= 0) || (height % frame_height)) {
+        fprintf(stderr, "%s: needs 8bit PGM, height a multiple of %d\n", path, frame_height);
+        exit(1);
+    }
+
+    asset_t *asset = new_asset(ASSET_ANIMA, name);
+    asset->width = width;
+    asset->height = frame_height;
+    asset->frames = height / frame_height;
+    if (asset->frames > MAX_FRAMES) {
+        fprintf(stderr, "%s: too many frames\n", path);
+        exit(1);
+    }
+
+    size_t count = width * frame_height;
+    for (int f = 0; f < asset->frames; f++) {
+        stream_alloc(&asset->frame[f], count, 4);
+        for (size_t i = 0; i < count; i++) {
+            asset->frame[f].values[i] = pixels[f * count + i] >> 4;
+        }
+    }
+    free(data);
+}
+
+/* Output */
+
+static void upper_name(char *out, const char *prefix, const char *name)
+{
+    int len = sprintf(out, "%s", prefix);
+    for (const char *p = name; *p; p++) {
+        out[len++] = isalnum((uint8_t)*p) ? toupper((uint8_t)*p) : '_';
+    }
+    out[len] = 0;
+}
+
+static void print_src(const char *field, const packed_t *packed, int bits)
+{
+    printf("    .%s = {\n", field);
+    printf("        .input = asset_blob + 0x%x,\n", packed->offset);
+    printf("        .encoding = %s,\n", encoding_symbol[packed->encoding]);
+    printf("        .bits = %d,\n", bits);
+    printf("        .size = %u,\n", packed->size);
+    printf("        .x = 0x%x,\n", packed->x);
+    printf("    },\n");
+}
+
+static void print_enum(asset_type_t type, const char *prefix)
+{
+    char name[64];
+    printf("enum {\n");
+    for (int i = 0; i < asset_num; i++) {
+        if (assets[i].type == type) {
+            upper_name(name, prefix, assets[i].name);
+            printf("    %s,\n", name);
+        }
+    }
+    upper_name(name, prefix, "NUM");
+    printf("    %s\n};\n\n", name);
+}
+
+static void print_header()
+{
+    printf("/* Generated by asset_pack.c, do not edit. */\n\n");
+    printf("#include <stdint.h>\n");
+    printf("#include \"../gfx.h\"\n\n");
+
+    printf("static const uint8_t asset_blob[] __attribute__((aligned(4))) = {");
+    for (uint32_t i = 0; i < blob_size; i++) {
+        if ((i & 15) == 0) {
+            printf("\n   ");
+        }
+        printf(" 0x%02x,", blob[i]);
+    }
+    printf("\n};\n\n");
+
+    char name[64];
+
+    print_enum(ASSET_IMAGE, "ASSET_IMAGE_");
+    printf("const image_t asset_images[] = {\n");
+    for (int i = 0; i < asset_num; i++) {
+        asset_t *a = &assets[i];
+        if (a->type != ASSET_IMAGE) {
+            continue;
+        }
+        upper_name(name, "ASSET_IMAGE_", a->name);
+        printf("[%s] = {\n", name);
+        printf("    .width = %d,\n", a->width);
+        printf("    .height = %d,\n", a->height);
+        print_src("pixels", &a->packed_pixels, a->pixels.bits);
+        if (a->pallete_size) {
+            printf("    .pallete = (const uint32_t *)(asset_blob + 0x%x),\n", a->pallete_offset);
+        }
+        if (a->alpha.values) {
+            print_src("alpha", &a->packed_alpha, a->alpha.bits);
+        }
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    print_enum(ASSET_ANIMA, "ASSET_ANIMA_");
+    for (int i = 0; i < asset_num; i++) {
+        asset_t *a = &assets[i];
+        if (a->type != ASSET_ANIMA) {
+            continue;
+        }
+        printf("static const uint32_t asset_%s_index[] = {", a->name);
+        for (int f = 0; f < a->frames; f++) {
+            printf("%s %u,", (f & 7) ? "" : "\n   ", a->frame_offset[f]);
+        }
+        printf("\n};\n\n");
+    }
+    printf("const anima_t asset_animas[] = {\n");
+    for (int i = 0; i < asset_num; i++) {
+        asset_t *a = &assets[i];
+        if (a->type != ASSET_ANIMA) {
+            continue;
+        }
+        upper_name(name, "ASSET_ANIMA_", a->name);
+        printf("[%s] = {\n", name);
+        printf("    .width = %d,\n", a->width);
+        printf("    .height = %d,\n", a->height);
+        printf("    .frames = %d,\n", a->frames);
+        printf("    .size = %u,\n", a->data_size);
+        printf("    .index = asset_%s_index,\n", a->name);
+        printf("    .data = asset_blob + 0x%x,\n", a->data_offset);
+        printf("    .encoding = %s,\n", encoding_symbol[a->anima_encoding]);
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    print_enum(ASSET_FONT, "ASSET_FONT_");
+    for (int i = 0; i < asset_num; i++) {
+        asset_t *a = &assets[i];
+        if (a->type != ASSET_FONT) {
+            continue;
+        }
+        printf("static const lv_font_dsc_t asset_%s_dsc[] = {\n", a->name);
+        for (int g = 0; g < a->font->range_length; g++) {
+            const lv_font_dsc_t *d = &a->font->dsc[g];
+            printf("    {%u, %u, %u, %u, %d, %d},\n", d->bitmap_index, d->adv_w,
+                   d->box_w, d->box_h, d->ofs_x, d->ofs_y);
+        }
+        printf("};\n\n");
+    }
+    printf("const lv_font_t asset_fonts[] = {\n");
+    for (int i = 0; i < asset_num; i++) {
+        asset_t *a = &assets[i];
+        if (a->type != ASSET_FONT) {
+            continue;
+        }
+        upper_name(name, "ASSET_FONT_", a->name);
+        printf("[%s] = {\n", name);
+        printf("    .range_start = %d,\n", a->font->range_start);
+        printf("    .range_length = %d,\n", a->font->range_length);
+        printf("    .bit_per_pixel = %d,\n", a->font->bit_per_pixel);
+        printf("    .line_height = %d,\n", a->font->line_height);
+        printf("    .base_line = %d,\n", a->font->base_line);
+        printf("    .dsc = asset_%s_dsc,\n", a->name);
+        printf("    .bitmap = asset_blob + 0x%x,\n", a->bitmap_offset);
+        printf("},\n");
+    }
+    printf("};\n");
+}
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        char name[32], path[256];
+        int frame_height;
+        if (strcmp(argv[i], "-b") == 0) {
+            load_builtin();
+        } else if (sscanf(argv[i], "image:%31[^:]:%255s", name, path) == 2) {
+            load_pam_image(name, path);
+        } else if (sscanf(argv[i], "anima:%31[^:]:%d:%255s", name, &frame_height, path) == 3) {
+            load_pgm_anima(name, frame_height, path);
+        } else {
+            fprintf(stderr, "Usage: %s [-b] [image:<name>:<file.pam>] "
+                            "[anima:<name>:<height>:<file.pgm>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "  %-22s %7s %15s %15s %15s %15s\n", "asset", "raw",
+            "NONE", "RLE", "RLE_X", "PACK");
+    for (int i = 0; i < asset_num; i++) {
+        if (assets[i].type == ASSET_IMAGE) {
+            pack_image(&assets[i]);
+        } else if (assets[i].type == ASSET_ANIMA) {
+            pack_anima(&assets[i]);
+        } else {
+            pack_font(&assets[i]);
+        }
+    }
+
+    uint32_t raw = 0, packed = 0;
+    for (int i = 0; i < asset_num; i++) {
+        raw += assets[i].raw_size;
+        packed += assets[i].packed_size;
+    }
+    fprintf(stderr, "Total: %u -> %u bytes (%.1f%%), blob %u bytes\n",
+            raw, packed, raw ? 100.0 * packed / raw : 0, blob_size);
+
+    print_header();
+    return 0;
+}
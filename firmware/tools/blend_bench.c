@@ -0,0 +1,286 @@
+/*
+ * Blending kernel benchmark for AIC Pico
+ * WHowe <github.com/whowechina>
+ * Compares the old per-pixel mixing against the row kernels in blend.h
+ * for bars, glyphs and images, and reports the largest channel error.
+ * Build: gcc -O2 -I../src -o blend_bench blend_bench.c
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "../src/rle.c"
+#include "../src/blend.h"
+#include "../src/res/font_conthrax.h"
+#include "../src/res/image_aic_sega.h"
+#include "../src/res/image_aime_reader.h"
+
+#define WIDTH 240
+#define HEIGHT 280
+
+static uint16_t vram[HEIGHT * WIDTH];
+static uint16_t vram_ref[HEIGHT * WIDTH];
+static uint16_t background[HEIGHT * WIDTH];
+
+/* the old per-pixel path, clipping and mixing for every pixel */
+__attribute__((noinline)) static void mix_pixel(uint16_t *buf, int x, int y,
+                                                uint16_t color, uint8_t mix, uint8_t bits)
+{
+    if (mix == 0) {
+        return;
+    }
+    if ((x < 0) || (x >= WIDTH) || (y < 0) || (y >= HEIGHT)) {
+        return;
+    }
+    if (mix == (1L << bits) - 1) {
+        buf[y * WIDTH + x] = color;
+        return;
+    }
+    uint16_t bg = buf[y * WIDTH + x];
+    uint16_t bg_ratio = (1L << bits) - mix;
+    uint8_t r = ((bg >> 11) * bg_ratio + (color >> 11) * mix) >> bits;
+    uint8_t g = (((bg >> 5) & 0x3f) * bg_ratio + ((color >> 5) & 0x3f) * mix) >> bits;
+    uint8_t b = ((bg & 0x1f) * bg_ratio + (color & 0x1f) * mix) >> bits;
+    buf[y * WIDTH + x] = (r << 11) | (g << 5) | b;
+}
+
+/* row clipping done once, as st7789.c does */
+static uint16_t *clip_row(uint16_t *buf, int *x, int y, int *w, int *skip)
+{
+    *skip = 0;
+    if ((y < 0) || (y >= HEIGHT)) {
+        return NULL;
+    }
+    if (*x < 0) {
+        *skip = -*x;
+        *w += *x;
+        *x = 0;
+    }
+    if (*x + *w > WIDTH) {
+        *w = WIDTH - *x;
+    }
+    return *w > 0 ? &buf[y * WIDTH + *x] : NULL;
+}
+
+/* Bars */
+static void bar_pixels(uint16_t *buf)
+{
+    for (int i = 0; i < 200; i++) {
+        for (int j = 0; j < 201; j++) {
+            mix_pixel(buf, 19 + j, 40 + i, 0x3a5f, 0x90, 8);
+        }
+    }
+}
+
+static void bar_spans(uint16_t *buf)
+{
+    for (int i = 0; i < 200; i++) {
+        int x = 19, w = 201, skip;
+        uint16_t *dst = clip_row(buf, &x, 40 + i, &w, &skip);
+        if (dst) {
+            blend_row_const(dst, w, 0x3a5f, 0x90, 8);
+        }
+    }
+}
+
+/* Glyphs, the keypad digits */
+static uint8_t glyph_mix(const lv_font_t *font, const lv_font_dsc_t *dsc, int i, int j)
+{
+    const uint8_t *bitmap = font->bitmap + dsc->bitmap_index;
+    uint8_t bpp = font->bit_per_pixel;
+    uint32_t bits = (i * dsc->box_w + j) * bpp;
+    return (bitmap[bits / 8] >> ((8 - bpp) - (bits % 8))) & ((1 << bpp) - 1);
+}
+
+static void glyph_pixels(uint16_t *buf)
+{
+    const lv_font_t *font = &lv_conthrax;
+    for (int c = 0; c < 12; c++) {
+        const lv_font_dsc_t *dsc = font->dsc + c % font->range_length;
+        int x = (c % 3) * 80 + 24 + dsc->ofs_x;
+        int y = (c / 3) * 70 + 26;
+        for (int i = 0; i < dsc->box_h; i++) {
+            for (int j = 0; j < dsc->box_w; j++) {
+                mix_pixel(buf, x + j, y + i, 0xfd20, glyph_mix(font, dsc, i, j),
+                          font->bit_per_pixel);
+            }
+        }
+    }
+}
+
+static void glyph_spans(uint16_t *buf)
+{
+    const lv_font_t *font = &lv_conthrax;
+    uint8_t mix[64];
+    for (int c = 0; c < 12; c++) {
+        const lv_font_dsc_t *dsc = font->dsc + c % font->range_length;
+        int x0 = (c % 3) * 80 + 24 + dsc->ofs_x;
+        int y = (c / 3) * 70 + 26;
+        for (int i = 0; i < dsc->box_h; i++) {
+            for (int j = 0; j < dsc->box_w; j += 64) {
+                int count = dsc->box_w - j < 64 ? dsc->box_w - j : 64;
+                for (int k = 0; k < count; k++) {
+                    mix[k] = glyph_mix(font, dsc, i, j + k);
+                }
+                int x = x0 + j, w = count, skip;
+                uint16_t *dst = clip_row(buf, &x, y + i, &w, &skip);
+                if (dst) {
+                    blend_row_alpha(dst, w, 0xfd20, mix + skip, font->bit_per_pixel);
+                }
+            }
+        }
+    }
+}
+
+/* Images, palette with alpha */
+static void image_pixels_of(uint16_t *buf, const image_t *img)
+{
+    rle_decoder_t pixels_rle;
+    rle_decoder_t alpha_rle;
+    rle_init(&pixels_rle, &img->pixels);
+    if (img->alpha.input) {
+        rle_init(&alpha_rle, &img->alpha);
+    }
+    int x = 120 - img->width / 2;
+    int y = 140 - img->height / 2;
+    for (int i = 0; i < img->height; i++) {
+        for (int j = 0; j < img->width; j++) {
+            uint32_t pixel = rle_get(&pixels_rle);
+            uint32_t mix = 0xff;
+            uint32_t mixbits = 8;
+            if (img->alpha.input) {
+                mix = rle_get(&alpha_rle);
+                mixbits = img->alpha.bits;
+            }
+            if (img->pallete) {
+                pixel = img->pallete[pixel];
+                if (!img->alpha.input) {
+                    mix = pixel >> 16;
+                }
+            }
+            mix_pixel(buf, x + j, y + i, pixel, mix, mixbits);
+        }
+    }
+}
+
+static void image_spans_of(uint16_t *buf, const image_t *img)
+{
+    rle_decoder_t pixels_rle;
+    rle_decoder_t alpha_rle;
+    rle_init(&pixels_rle, &img->pixels);
+    if (img->alpha.input) {
+        rle_init(&alpha_rle, &img->alpha);
+    }
+    bool has_mix = img->alpha.input || img->pallete;
+    uint8_t mixbits = img->alpha.input ? img->alpha.bits : 8;
+    uint16_t pixels[64];
+    uint8_t mix[64];
+    int x0 = 120 - img->width / 2;
+    int y = 140 - img->height / 2;
+    for (int i = 0; i < img->height; i++) {
+        for (int j = 0; j < img->width; j += 64) {
+            int count = img->width - j < 64 ? img->width - j : 64;
+            for (int k = 0; k < count; k++) {
+                uint32_t pixel = rle_get(&pixels_rle);
+                if (img->pallete) {
+                    pixel = img->pallete[pixel];
+                    mix[k] = pixel >> 16;
+                }
+                if (img->alpha.input) {
+                    mix[k] = rle_get(&alpha_rle);
+                }
+                pixels[k] = pixel;
+            }
+            int x = x0 + j, w = count, skip;
+            uint16_t *dst = clip_row(buf, &x, y + i, &w, &skip);
+            if (dst) {
+                blend_row_pixels(dst, w, pixels + skip,
+                                 has_mix ? mix + skip : NULL, mixbits);
+            }
+        }
+    }
+}
+
+static void image_pixels(uint16_t *buf)
+{
+    image_pixels_of(buf, &image_aic_sega);
+    image_pixels_of(buf, &image_aime_reader);
+}
+
+static void image_spans(uint16_t *buf)
+{
+    image_spans_of(buf, &image_aic_sega);
+    image_spans_of(buf, &image_aime_reader);
+}
+
+typedef void (*draw_func)(uint16_t *buf);
+
+static double bench(draw_func func, int rounds)
+{
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int r = 0; r < rounds; r++) {
+        memcpy(vram, background, sizeof(vram));
+        func(vram);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    struct timespec c0, c1;
+    clock_gettime(CLOCK_MONOTONIC, &c0);
+    for (int r = 0; r < rounds; r++) {
+        memcpy(vram, background, sizeof(vram));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &c1);
+    double us = (t1.tv_sec - t0.tv_sec) * 1e6 + (t1.tv_nsec - t0.tv_nsec) / 1e3;
+    us -= (c1.tv_sec - c0.tv_sec) * 1e6 + (c1.tv_nsec - c0.tv_nsec) / 1e3;
+    return us / rounds;
+}
+
+static int max_error()
+{
+    int worst = 0;
+    for (int i = 0; i < HEIGHT * WIDTH; i++) {
+        uint16_t a = vram[i];
+        uint16_t b = vram_ref[i];
+        int dr = abs((a >> 11) - (b >> 11));
+        int dg = abs(((a >> 5) & 0x3f) - ((b >> 5) & 0x3f));
+        int db = abs((a & 0x1f) - (b & 0x1f));
+        int d = dr > dg ? dr : dg;
+        d = d > db ? d : db;
+        worst = d > worst ? d : worst;
+    }
+    return worst;
+}
+
+static void run(const char *name, draw_func ref, draw_func test, int rounds)
+{
+    memcpy(vram_ref, background, sizeof(vram_ref));
+    memcpy(vram, background, sizeof(vram));
+    ref(vram_ref);
+    test(vram);
+    int error = max_error();
+
+    double t_ref = bench(ref, rounds);
+    double t_test = bench(test, rounds);
+    printf("%-8s per pixel: %8.2f us, row kernel: %8.2f us (x%.1f), max error %d LSB\n",
+           name, t_ref, t_test, t_ref / t_test, error);
+}
+
+int main(int argc, char *argv[])
+{
+    int rounds = argc > 1 ? atoi(argv[1]) : 500;
+
+    srand(1);
+    for (int i = 0; i < HEIGHT * WIDTH; i++) {
+        background[i] = rand();
+    }
+
+    run("bar", bar_pixels, bar_spans, rounds);
+    run("glyph", glyph_pixels, glyph_spans, rounds);
+    run("image", image_pixels, image_spans, rounds);
+
+    return 0;
+}
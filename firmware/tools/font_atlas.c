@@ -0,0 +1,246 @@
+/*
+ * Glyph atlas generator for AIC Pico
+ * WHowe <github.com/whowechina>
+ * Converts font glyph bitmaps into per-row alpha spans, so the firmware
+ * blits spans instead of extracting bits pixel by pixel. Each glyph row is
+ * a span count, then per span: skip (pixels after previous span or row
+ * start), length (bit 7 set = solid, full alpha) and one alpha byte per
+ * pixel unless solid. Every glyph is decoded back and checked.
+ * Build: gcc -O2 -DFONT_ATLAS_BUILD -I../src -o font_atlas font_atlas.c
+ * Usage: ./font_atlas <ltsaeada|conthrax|upheaval> > ../src/res/font_xxx_atlas.h
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "../src/res/font_conthrax.h"
+#include "../src/res/font_ltsaeada.h"
+#include "../src/res/font_upheaval.h"
+
+/* zero gaps shorter than this stay inside a span, a new span costs 2 bytes
+   and a blit call */
+#define SPAN_GAP 3
+/* full alpha runs this long become solid spans */
+#define SOLID_MIN 4
+#define SPAN_MAX 127
+
+static const struct {
+    const char *family;
+    const char *name;
+    const lv_font_t *font;
+} fonts[] = {
+    { "conthrax", "conthrax", &lv_conthrax },
+    { "ltsaeada", "lts13", &lv_lts13 },
+    { "ltsaeada", "lts14", &lv_lts14 },
+    { "ltsaeada", "lts16", &lv_lts16 },
+    { "ltsaeada", "lts18", &lv_lts18 },
+    { "ltsaeada", "lts20", &lv_lts20 },
+    { "upheaval", "upheaval", &lv_upheaval },
+};
+
+static uint8_t output[256 * 1024];
+static uint32_t index_table[256];
+
+static void glyph_row(const lv_font_t *font, const lv_font_dsc_t *dsc, int row, uint8_t *alpha)
+{
+    const uint8_t *bitmap = font->bitmap + dsc->bitmap_index;
+    uint8_t bpp = font->bit_per_pixel;
+    for (int j = 0; j < dsc->box_w; j++) {
+        uint32_t bits = (row * dsc->box_w + j) * bpp;
+        alpha[j] = (bitmap[bits / 8] >> ((8 - bpp) - (bits % 8))) & ((1 << bpp) - 1);
+    }
+}
+
+static int solid_run(const uint8_t *alpha, int start, int end, uint8_t max)
+{
+    int len = 0;
+    while ((start + len < end) && (alpha[start + len] == max)) {
+        len++;
+    }
+    return len;
+}
+
+static void put_span(size_t *pos, int *count, int skip, int len, bool solid,
+                     const uint8_t *alpha)
+{
+    output[(*pos)++] = skip;
+    output[(*pos)++] = len | (solid ? 0x80 : 0);
+    if (!solid) {
+        memcpy(output + *pos, alpha, len);
+        *pos += len;
+    }
+    (*count)++;
+}
+
+/* splits [start, end) into alpha and solid spans */
+static void encode_ink(size_t *pos, int *count, int *cursor, const uint8_t *alpha,
+                       int start, int end, uint8_t max)
+{
+    int x = start;
+    int piece = start;
+    while (x < end) {
+        int solid = solid_run(alpha, x, end, max);
+        if (solid < SOLID_MIN) {
+            x += solid ? solid : 1;
+            continue;
+        }
+        while (piece < x) {
+            int len = x - piece < SPAN_MAX ? x - piece : SPAN_MAX;
+            put_span(pos, count, piece - *cursor, len, false, alpha + piece);
+            piece += len;
+            *cursor = piece;
+        }
+        while (solid > 0) {
+            int len = solid < SPAN_MAX ? solid : SPAN_MAX;
+            put_span(pos, count, x - *cursor, len, true, NULL);
+            x += len;
+            solid -= len;
+            *cursor = x;
+        }
+        piece = x;
+    }
+    while (piece < end) {
+        int len = end - piece < SPAN_MAX ? end - piece : SPAN_MAX;
+        put_span(pos, count, piece - *cursor, len, false, alpha + piece);
+        piece += len;
+        *cursor = piece;
+    }
+}
+
+static void encode_row(size_t *pos, const uint8_t *alpha, int width, uint8_t max)
+{
+    size_t count_pos = (*pos)++;
+    int count = 0;
+    int cursor = 0;
+    int x = 0;
+    while (x < width) {
+        if (alpha[x] == 0) {
+            x++;
+            continue;
+        }
+        int start = x;
+        int end = x + 1;
+        for (int j = end; j < width; j++) {
+            if (alpha[j]) {
+                if (j - end >= SPAN_GAP) {
+                    break;
+                }
+                end = j + 1;
+            }
+        }
+        encode_ink(pos, &count, &cursor, alpha, start, end, max);
+        x = end;
+    }
+    output[count_pos] = count;
+}
+
+static const uint8_t *decode_row(const uint8_t *data, uint8_t *alpha, int width, uint8_t max)
+{
+    memset(alpha, 0, width);
+    int count = *data++;
+    int x = 0;
+    for (int i = 0; i < count; i++) {
+        x += *data++;
+        int len = *data & 0x7f;
+        bool solid = *data++ & 0x80;
+        if (solid) {
+            memset(alpha + x, max, len);
+        } else {
+            memcpy(alpha + x, data, len);
+            data += len;
+        }
+        x += len;
+    }
+    return data;
+}
+
+static bool encode_font(const lv_font_t *font, size_t *size)
+{
+    uint8_t max = (1 << font->bit_per_pixel) - 1;
+    uint8_t alpha[256];
+    uint8_t check[256];
+    size_t pos = 0;
+
+    for (int g = 0; g < font->range_length; g++) {
+        const lv_font_dsc_t *dsc = &font->dsc[g];
+        if (dsc->box_w > sizeof(alpha)) {
+            return false;
+        }
+        index_table[g] = pos;
+        for (int i = 0; i < dsc->box_h; i++) {
+            glyph_row(font, dsc, i, alpha);
+            size_t row_pos = pos;
+            encode_row(&pos, alpha, dsc->box_w, max);
+            decode_row(output + row_pos, check, dsc->box_w, max);
+            if (memcmp(alpha, check, dsc->box_w) != 0) {
+                return false;
+            }
+        }
+    }
+    *size = pos;
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <ltsaeada|conthrax|upheaval>\n", argv[0]);
+        return 1;
+    }
+
+    bool found = false;
+    for (int f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        if (strcmp(fonts[f].family, argv[1]) != 0) {
+            continue;
+        }
+
+        const lv_font_t *font = fonts[f].font;
+        const char *name = fonts[f].name;
+        size_t size;
+        if (!encode_font(font, &size)) {
+            fprintf(stderr, "%s: glyph mismatch\n", name);
+            return 1;
+        }
+
+        if (!found) {
+            printf("/* Generated by font_atlas.c, glyph rows as alpha spans: span count,\n"
+                   "   then skip, length (bit 7 = solid) and alpha bytes unless solid. */\n\n");
+            printf("#include <stdint.h>\n");
+            printf("#include \"../gfx.h\"\n\n");
+            found = true;
+        }
+
+        printf("static const uint8_t %s_atlas_data[] = {", name);
+        for (size_t i = 0; i < size; i++) {
+            printf("%s 0x%02x,", (i & 15) ? "" : "\n   ", output[i]);
+        }
+        printf("\n};\n\n");
+
+        printf("static const uint32_t %s_atlas_index[] = {", name);
+        for (int g = 0; g < font->range_length; g++) {
+            printf("%s %u,", (g & 7) ? "" : "\n   ", index_table[g]);
+        }
+        printf("\n};\n\n");
+
+        printf("static const glyph_atlas_t %s_atlas = {\n", name);
+        printf("    .index = %s_atlas_index,\n", name);
+        printf("    .data = %s_atlas_data,\n", name);
+        printf("};\n\n");
+
+        size_t bitmap = 0;
+        for (int g = 0; g < font->range_length; g++) {
+            const lv_font_dsc_t *dsc = &font->dsc[g];
+            bitmap += (dsc->box_w * dsc->box_h * font->bit_per_pixel + 7) / 8;
+        }
+        fprintf(stderr, "%s: %zu bytes bitmap -> %zu bytes atlas\n", name, bitmap, size);
+    }
+
+    if (!found) {
+        fprintf(stderr, "Unknown font %s\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
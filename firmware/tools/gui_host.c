@@ -0,0 +1,532 @@
+/*
+ * GUI Host Harness for AIC Pico
+ * WHowe <github.com/whowechina>
+ * Builds gfx.c, rle.c, st7789.c and gui.c for Linux on top of host/host_sdk.h,
+ * frames are flushed through the real damage and DMA path into a simulated
+ * panel. Renders GUI pages, card splashes and slide phases at fixed virtual
+ * times, compares them against golden hashes (gui_golden.txt), and checks
+ * the panel always matches vram, and that glyph atlas spans draw the same
+ * as glyph bitmaps. With -b it also times primitives and pages.
+ * Build: gcc -O2 -Ihost -I../src -I../include -o gui_host gui_host.c
+ *        (add -DST7789_BAND_HEIGHT=40 to check band mode, same goldens)
+ * Usage: ./gui_host [-g gui_golden.txt] [-u] [-o ppm_dir] [-b]
+ *        -u rewrites the golden file, -o dumps every frame as PPM
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+/* config.c sizes the light defaults from the board */
+#define BOARD_AIC_PICO
+
+#include "host_sdk.h"
+
+#include "../src/rle.c"
+#include "../src/gfx.c"
+#include "../src/st7789.c"
+#include "../src/config.c"
+#include "../src/lib/mode.c"
+#include "../src/cst816t.h"
+#include "../src/gui.h"
+
+/* things gui.c needs from the rest of the firmware */
+static bool host_aime_active;
+static bool host_bana_active;
+const char *built_time = "Jan 01 2024 00:00:00";
+
+aic_runtime_t aic_runtime = { .touch = true };
+
+/* defaults only, nothing is loaded */
+static void (*host_after_load)();
+
+void *save_alloc(size_t size, void *def, void (*after_load)())
+{
+    static uint8_t data[1024];
+    memcpy(data, def, size);
+    host_after_load = after_load;
+    return data;
+}
+
+void save_request(bool immediately)
+{
+}
+
+uint64_t board_id_64()
+{
+    return 0xe6614103e7452d2full;
+}
+
+bool aime_is_active()
+{
+    return host_aime_active;
+}
+
+bool bana_is_active()
+{
+    return host_bana_active;
+}
+
+const char *nfc_module_name()
+{
+    return "PN532";
+}
+
+const char *nfc_module_version()
+{
+    return "1.6";
+}
+
+void cst816t_init_i2c(i2c_inst_t *i2c, uint8_t scl, uint8_t sda)
+{
+}
+
+void cst816t_init(i2c_inst_t *i2c, uint8_t trst, uint8_t tint)
+{
+}
+
+void cst816t_crop(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2,
+                  uint16_t width, uint16_t height)
+{
+}
+
+cst816t_report_t cst816t_read()
+{
+    return (cst816t_report_t) { 0 };
+}
+
+uint32_t cst816t_dropped()
+{
+    return 0;
+}
+
+/* same as light.c */
+uint32_t rgb32_from_hsv(uint8_t h, uint8_t s, uint8_t v)
+{
+    uint32_t region, remainder, p, q, t;
+
+    if (s == 0) {
+        return v << 16 | v << 8 | v;
+    }
+
+    region = h / 43;
+    remainder = (h % 43) * 6;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 0:
+            return v << 16 | t << 8 | p;
+        case 1:
+            return q << 16 | v << 8 | p;
+        case 2:
+            return p << 16 | v << 8 | t;
+        case 3:
+            return p << 16 | q << 8 | v;
+        case 4:
+            return t << 16 | p << 8 | v;
+        default:
+            return v << 16 | p << 8 | q;
+    }
+}
+
+#include "../src/gui.c"
+
+/* gui_init() crops the panel to this */
+#define LCD_Y 20
+#define LCD_W 240
+#define LCD_H 280
+
+#define GOLDEN_MAX 256
+
+static struct {
+    char name[GOLDEN_MAX][48];
+    uint32_t hash[GOLDEN_MAX];
+    int num;
+} golden, result;
+
+static const char *ppm_dir;
+static int failures;
+
+static double now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t panel_hash()
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (int y = 0; y < LCD_H; y++) {
+        const uint8_t *row = (const uint8_t *)host_panel.ram[LCD_Y + y];
+        for (int i = 0; i < LCD_W * 2; i++) {
+            hash = (hash ^ row[i]) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+static void dump_ppm(const char *name)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", ppm_dir, name);
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        fprintf(stderr, "Can't write %s\n", path);
+        return;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", LCD_W, LCD_H);
+    for (int y = 0; y < LCD_H; y++) {
+        for (int x = 0; x < LCD_W; x++) {
+            uint16_t c = host_panel.ram[LCD_Y + y][x];
+            uint8_t rgb[3] = { (c >> 11) << 3 | (c >> 13),
+                               ((c >> 5) & 0x3f) << 2 | ((c >> 9) & 0x03),
+                               (c & 0x1f) << 3 | ((c >> 2) & 0x07) };
+            fwrite(rgb, 1, 3, fp);
+        }
+    }
+    fclose(fp);
+}
+
+/* damage tracking must never leave the panel behind vram */
+static void check_panel(const char *name)
+{
+#if !ST7789_BAND_HEIGHT
+    int bad = 0;
+    for (int y = 0; y < LCD_H; y++) {
+        if (memcmp(host_panel.ram[LCD_Y + y], &vram[y * LCD_W], LCD_W * 2) != 0) {
+            bad++;
+        }
+    }
+    if (bad) {
+        printf("%-28s PANEL: %d rows differ from vram\n", name, bad);
+        failures++;
+    }
+#endif
+}
+
+/* glyph atlas spans must draw exactly what the glyph bitmaps do */
+static void check_atlas(const char *name, const lv_font_t *font, const char *text)
+{
+#if !ST7789_BAND_HEIGHT
+    /* layouts are cached by font address, so every copy gets its own */
+    static lv_font_t copies[16];
+    static int copy_num;
+    static uint16_t ref[LCD_W * LCD_H];
+    lv_font_t *bitmap = &copies[copy_num++ % 16];
+    *bitmap = *font;
+    bitmap->atlas = NULL;
+
+    st7789_scroll(0, 0);
+    for (int i = 0; i < LCD_W * LCD_H; i++) {
+        vram[i] = 0x39e7;
+    }
+    gfx_text_draw(120, 100, text, bitmap, 0xfd20, ALIGN_CENTER);
+    memcpy(ref, vram, sizeof(ref));
+
+    for (int i = 0; i < LCD_W * LCD_H; i++) {
+        vram[i] = 0x39e7;
+    }
+    gfx_text_draw(120, 100, text, font, 0xfd20, ALIGN_CENTER);
+    if (memcmp(ref, vram, sizeof(ref)) != 0) {
+        printf("%-28s ATLAS: differs from bitmap\n", name);
+        failures++;
+    }
+#endif
+}
+
+static void run_frame(uint64_t t)
+{
+    host_time_us = t;
+    update_frame();
+    st7789_render(render_frame);
+}
+
+static void shot(const char *name, uint64_t t)
+{
+    run_frame(t);
+    check_panel(name);
+
+    uint32_t hash = panel_hash();
+    if (result.num < GOLDEN_MAX) {
+        snprintf(result.name[result.num], sizeof(result.name[0]), "%s", name);
+        result.hash[result.num++] = hash;
+    }
+    if (ppm_dir) {
+        dump_ppm(name);
+    }
+
+    for (int i = 0; i < golden.num; i++) {
+        if (strcmp(golden.name[i], name) == 0) {
+            if (golden.hash[i] != hash) {
+                printf("%-28s FAIL %08x, golden %08x\n", name, hash, golden.hash[i]);
+                failures++;
+            }
+            return;
+        }
+    }
+    if (golden.num) {
+        printf("%-28s NEW %08x\n", name, hash);
+    }
+}
+
+static const struct {
+    nfc_card_name card;
+    const char *name;
+} cards[] = {
+    { CARD_AIC, "aic" },
+    { CARD_AIC_SEGA, "aic_sega" },
+    { CARD_AIC_KONAMI, "aic_konami" },
+    { CARD_AIC_BANA, "aic_bana" },
+    { CARD_AIC_NESICA, "aic_nesica" },
+    { CARD_MIFARE, "mifare" },
+    { CARD_AIME, "aime" },
+    { CARD_BANA, "bana" },
+    { CARD_NESICA, "nesica" },
+    { CARD_VICINITY, "vicinity" },
+    { CARD_EAMUSE, "eamuse" },
+};
+
+static void slide_shots(const char *name, slide_dir_t dir, int new_page,
+                        const uint8_t *curve, size_t curve_len, uint64_t *t)
+{
+    host_time_us = *t;
+    start_slide(dir, new_page, curve, curve_len);
+
+    const int phases[] = { 0, 3, 8, 13, 20, 26 };
+    for (int i = 0; i < sizeof(phases) / sizeof(phases[0]); i++) {
+        if (phases[i] >= curve_len) {
+            break;
+        }
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%s_%02d", name, phases[i]);
+        shot(buf, *t + phases[i] * ANIMA_STEP_US + 1);
+    }
+    *t += curve_len * ANIMA_STEP_US + 1000;
+}
+
+/* frames follow each other like on the device, so the background player
+   and damage tracking carry state from one shot to the next */
+static void run_scenes()
+{
+    uint64_t t = 1000000;
+
+    host_time_us = t;
+    config_init();
+    host_after_load();
+    gui_init();
+
+    /* there's a splash for the first 3 seconds */
+    shot("boot", t);
+    shot("home", t += 3000000);
+    shot("home_later", t += 500000);
+
+    tap.key = 4;
+    tap.seq++;
+    shot("home_tap", t += 20000);
+    shot("home_glow", t += 6 * ANIMA_STEP_US);
+    shot("home_glow_end", t += 40 * ANIMA_STEP_US);
+
+    host_aime_active = true;
+    shot("home_aime", t += 20000);
+    host_aime_active = false;
+    host_bana_active = true;
+    shot("home_bana", t += 20000);
+    host_bana_active = false;
+
+    for (int i = 0; i < sizeof(cards) / sizeof(cards[0]); i++) {
+        char buf[48];
+        host_time_us = t += 20000;
+        gui_report_card(cards[i].card);
+        snprintf(buf, sizeof(buf), "card_%s", cards[i].name);
+        shot(buf, t += 200000);
+    }
+    shot("card_end", t += 3000000);
+
+    curr_page = 1;
+    shot("status", t += 20000);
+    curr_page = 2;
+    shot("credits", t += 20000);
+    curr_page = 0;
+    shot("home_back", t += 20000);
+
+    t += 20000;
+    slide_shots("slide_right", SLIDE_RIGHT, 1, scroll_curve, sizeof(scroll_curve), &t);
+    slide_shots("slide_right2", SLIDE_RIGHT, 2, scroll_curve, sizeof(scroll_curve), &t);
+    slide_shots("hit_right", HIT_RIGHT, 2, spring_curve, sizeof(spring_curve), &t);
+    slide_shots("slide_left", SLIDE_LEFT, 1, scroll_curve, sizeof(scroll_curve), &t);
+    slide_shots("slide_left2", SLIDE_LEFT, 0, scroll_curve, sizeof(scroll_curve), &t);
+    slide_shots("hit_left", HIT_LEFT, 0, spring_curve, sizeof(spring_curve), &t);
+    shot("slide_end", t);
+}
+
+static void load_golden(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return;
+    }
+    char line[128];
+    while (fgets(line, sizeof(line), fp) && (golden.num < GOLDEN_MAX)) {
+        if (line[0] == '#') {
+            continue;
+        }
+        if (sscanf(line, "%47s %x", golden.name[golden.num], &golden.hash[golden.num]) == 2) {
+            golden.num++;
+        }
+    }
+    fclose(fp);
+}
+
+static void save_golden(const char *path)
+{
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        fprintf(stderr, "Can't write %s\n", path);
+        return;
+    }
+    fprintf(fp, "# Generated by gui_host -u, FNV-1a of each 240x280 RGB565 frame\n");
+    for (int i = 0; i < result.num; i++) {
+        fprintf(fp, "%s %08x\n", result.name[i], result.hash[i]);
+    }
+    fclose(fp);
+}
+
+#define BENCH(label, count, pixels, code) do { \
+    double start = now_ns(); \
+    for (int n_ = 0; n_ < (count); n_++) { code; } \
+    double ns = (now_ns() - start) / (count); \
+    double px_ = (pixels); \
+    printf("  %-30s %9.0f ns", label, ns); \
+    if (px_ > 0) { printf("  %6.2f ns/px", ns / px_); } \
+    printf("\n"); \
+} while (0)
+
+static void bench()
+{
+    uint8_t mix4[64];
+    uint8_t mix8[64];
+    uint16_t pixels[64];
+    for (int i = 0; i < 64; i++) {
+        mix4[i] = i % 16;
+        mix8[i] = i * 4;
+        pixels[i] = i * 1021;
+    }
+
+    st7789_scroll(0, 0);
+    printf("Primitives:\n");
+    BENCH("span const 240", 20000, 240, st7789_span(0, n_ % 280, 240, 0x1234, 128, 8));
+    BENCH("span opaque 240", 20000, 240, st7789_span(0, n_ % 280, 240, 0x1234, 255, 8));
+    BENCH("span_alpha 64 (4bit)", 20000, 64, st7789_span_alpha(10, n_ % 280, 64, 0xffff, mix4, 4));
+    BENCH("span_pixels 64", 20000, 64, st7789_span_pixels(10, n_ % 280, 64, pixels, NULL, 0));
+    BENCH("span_pixels 64 + mix", 20000, 64, st7789_span_pixels(10, n_ % 280, 64, pixels, mix8, 8));
+    BENCH("pixel", 100000, 0, st7789_pixel(n_ % 240, n_ % 280, 0x1234, 100, 8));
+
+    lv_font_t conthrax_bitmap = lv_conthrax;
+    lv_font_t lts18_bitmap = lv_lts18;
+    conthrax_bitmap.atlas = NULL;
+    lts18_bitmap.atlas = NULL;
+    BENCH("char conthrax (bitmap)", 2000, 0, gfx_char_draw(20, 20, '5', &conthrax_bitmap, 0xffff));
+    BENCH("char conthrax", 2000, 0, gfx_char_draw(20, 20, '5', &lv_conthrax, 0xffff));
+    BENCH("text conthrax (bitmap)", 2000, 0,
+          gfx_text_draw(120, 60, "789\n456\n123", &conthrax_bitmap, 0xffff, ALIGN_CENTER));
+    BENCH("text conthrax", 2000, 0,
+          gfx_text_draw(120, 60, "789\n456\n123", &lv_conthrax, 0xffff, ALIGN_CENTER));
+    BENCH("text lts18 (bitmap)", 2000, 0,
+          gfx_text_draw(120, 60, "Backlight: 200", &lts18_bitmap, 0xffff, ALIGN_CENTER));
+    BENCH("text lts18", 2000, 0,
+          gfx_text_draw(120, 60, "Backlight: 200", &lv_lts18, 0xffff, ALIGN_CENTER));
+    BENCH("text lts18 cached", 2000, 0,
+          gfx_text_draw_cached(120, 60, "Backlight: 200", &lv_lts18, 0xffff, ALIGN_CENTER));
+    BENCH("image aic_sega", 200, 0, gfx_img_draw(10, 70, &image_aic_sega));
+    BENCH("image aic_sega cached", 200, 0, gfx_img_draw_cached(10, 70, &image_aic_sega));
+    BENCH("anima glow mix", 2000, 0, gfx_anima_mix(&anima_glow, 20, 20, 5, 0xffff));
+    BENCH("anima star draw", 200, 240 * 280, gfx_anima_draw(&anima_star, 0, 0, n_, pixels));
+
+#if GUI_BACKGROUND_PLAYER
+    background.repaint = true;
+    BENCH("anima player repaint", 200, 240 * 280,
+          background.repaint = true; gfx_anima_player_draw(&background, 0, 0));
+#endif
+
+    printf("Pages (render only, into vram):\n");
+    const char *names[] = { "home", "status", "credits" };
+    for (int i = 0; i < PAGE_NUM; i++) {
+        BENCH(names[i], 200, 0, pages[i].render());
+    }
+
+    printf("Frames (update, render, flush to panel):\n");
+    uint64_t t = host_time_us + 1000000;
+    for (int i = 0; i < PAGE_NUM; i++) {
+        curr_page = i;
+        BENCH(names[i], 200, 0, run_frame(t += 20000));
+    }
+    curr_page = 0;
+    host_time_us = t;
+    start_slide(SLIDE_RIGHT, 1, scroll_curve, sizeof(scroll_curve));
+    BENCH("slide home -> status", 27, 0, run_frame(t += ANIMA_STEP_US));
+}
+
+int main(int argc, char *argv[])
+{
+    const char *golden_path = "gui_golden.txt";
+    bool update = false;
+    bool do_bench = false;
+
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-g") == 0) && (i + 1 < argc)) {
+            golden_path = argv[++i];
+        } else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)) {
+            ppm_dir = argv[++i];
+        } else if (strcmp(argv[i], "-u") == 0) {
+            update = true;
+        } else if (strcmp(argv[i], "-b") == 0) {
+            do_bench = true;
+        } else {
+            fprintf(stderr, "Usage: %s [-g golden] [-u] [-o ppm_dir] [-b]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (!update) {
+        load_golden(golden_path);
+        if (!golden.num) {
+            printf("No golden in %s, hashes are printed only\n", golden_path);
+        }
+    }
+
+    run_scenes();
+
+    const char *printable = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLM\n"
+                            "NOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+    check_atlas("atlas conthrax", &lv_conthrax, "0123456789\n:;");
+    check_atlas("atlas lts13", &lv_lts13, printable);
+    check_atlas("atlas lts14", &lv_lts14, printable);
+    check_atlas("atlas lts16", &lv_lts16, printable);
+    check_atlas("atlas lts18", &lv_lts18, printable);
+    check_atlas("atlas lts20", &lv_lts20, printable);
+    check_atlas("atlas upheaval", &lv_upheaval, printable);
+
+    if (update) {
+        save_golden(golden_path);
+        printf("%d goldens written to %s\n", result.num, golden_path);
+    } else if (!golden.num) {
+        for (int i = 0; i < result.num; i++) {
+            printf("%-28s %08x\n", result.name[i], result.hash[i]);
+        }
+    } else {
+        printf("%d frames, %d failures\n", result.num, failures);
+    }
+
+    if (do_bench) {
+        bench();
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,460 @@
+/*
+ * Host Stand-in for the Pico SDK
+ * WHowe <github.com/whowechina>
+ * Just enough of the SDK for st7789.c, gfx.c and gui.c to build on Linux.
+ * SPI writes go to a simulated ST7789 panel (CASET, RASET, RAMWR), DMA
+ * is done at once when triggered, chained control blocks included, and
+ * DMA IRQ handlers are called when the chain ends. Time is virtual.
+ * Everything is static, for single translation unit tools.
+ */
+
+#ifndef HOST_SDK_H
+#define HOST_SDK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef unsigned int uint;
+
+/* time */
+static uint64_t host_time_us;
+
+static inline uint64_t time_us_64()
+{
+    return host_time_us;
+}
+
+static inline uint32_t time_us_32()
+{
+    return host_time_us;
+}
+
+static inline void sleep_ms(uint32_t ms)
+{
+    host_time_us += ms * 1000ULL;
+}
+
+static inline void sleep_us(uint64_t us)
+{
+    host_time_us += us;
+}
+
+static inline void tight_loop_contents()
+{
+}
+
+/* gpio */
+#define GPIO_OUT 1
+#define GPIO_IN 0
+#define GPIO_FUNC_SPI 1
+#define GPIO_FUNC_PWM 4
+#define GPIO_DRIVE_STRENGTH_12MA 3
+
+static bool host_gpio[32];
+
+static inline void gpio_init(uint gpio)
+{
+}
+
+static inline void gpio_set_dir(uint gpio, bool out)
+{
+}
+
+static inline void gpio_set_function(uint gpio, int fn)
+{
+}
+
+static inline void gpio_set_drive_strength(uint gpio, int strength)
+{
+}
+
+static inline void gpio_put(uint gpio, bool value)
+{
+    host_gpio[gpio & 31] = value;
+}
+
+static inline bool gpio_get(uint gpio)
+{
+    return host_gpio[gpio & 31];
+}
+
+/* simulated panel, driven by the SPI writes below */
+#define HOST_PANEL_WIDTH 240
+#define HOST_PANEL_HEIGHT 320
+
+static struct {
+    uint16_t ram[HOST_PANEL_HEIGHT][HOST_PANEL_WIDTH];
+    uint8_t cmd;
+    uint8_t param[4];
+    int param_num;
+    uint16_t xs, xe, ys, ye;
+    int x, y;
+    bool writing;
+    uint64_t pixels; // total pixels written
+} host_panel;
+
+static void host_panel_cmd(uint8_t cmd)
+{
+    host_panel.cmd = cmd;
+    host_panel.param_num = 0;
+    host_panel.writing = (cmd == 0x2c);
+    if (host_panel.writing) {
+        host_panel.x = host_panel.xs;
+        host_panel.y = host_panel.ys;
+    }
+}
+
+static void host_panel_param(uint8_t value)
+{
+    if (host_panel.param_num < 4) {
+        host_panel.param[host_panel.param_num++] = value;
+    }
+    if (host_panel.param_num == 4) {
+        uint16_t start = (host_panel.param[0] << 8) | host_panel.param[1];
+        uint16_t end = (host_panel.param[2] << 8) | host_panel.param[3];
+        if (host_panel.cmd == 0x2a) {
+            host_panel.xs = start;
+            host_panel.xe = end;
+        } else if (host_panel.cmd == 0x2b) {
+            host_panel.ys = start;
+            host_panel.ye = end;
+        }
+    }
+}
+
+static void host_panel_pixel(uint16_t color)
+{
+    if (!host_panel.writing) {
+        return;
+    }
+    if ((host_panel.x < HOST_PANEL_WIDTH) && (host_panel.y < HOST_PANEL_HEIGHT)) {
+        host_panel.ram[host_panel.y][host_panel.x] = color;
+    }
+    host_panel.pixels++;
+    if (++host_panel.x > host_panel.xe) {
+        host_panel.x = host_panel.xs;
+        if (++host_panel.y > host_panel.ye) {
+            host_panel.y = host_panel.ys;
+        }
+    }
+}
+
+/* spi, the panel's DC pin is the only gpio that matters */
+typedef struct {
+    volatile uint32_t dr;
+} spi_hw_t;
+
+typedef struct {
+    spi_hw_t hw;
+    uint8_t bits;
+} spi_inst_t;
+
+static spi_inst_t host_spi[2];
+#define spi0 (&host_spi[0])
+#define spi1 (&host_spi[1])
+
+#ifndef HOST_PANEL_DC
+#define HOST_PANEL_DC 8
+#endif
+
+typedef enum { SPI_CPOL_0, SPI_CPOL_1 } spi_cpol_t;
+typedef enum { SPI_CPHA_0, SPI_CPHA_1 } spi_cpha_t;
+typedef enum { SPI_LSB_FIRST, SPI_MSB_FIRST } spi_order_t;
+
+static inline uint spi_init(spi_inst_t *spi, uint baudrate)
+{
+    return baudrate;
+}
+
+static inline void spi_set_format(spi_inst_t *spi, uint bits, spi_cpol_t cpol,
+                                  spi_cpha_t cpha, spi_order_t order)
+{
+    spi->bits = bits;
+}
+
+static inline spi_hw_t *spi_get_hw(spi_inst_t *spi)
+{
+    return &spi->hw;
+}
+
+static inline uint spi_get_dreq(spi_inst_t *spi, bool is_tx)
+{
+    return 0;
+}
+
+static inline bool spi_is_busy(const spi_inst_t *spi)
+{
+    return false;
+}
+
+static inline int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (!host_gpio[HOST_PANEL_DC]) {
+            host_panel_cmd(src[i]);
+        } else if (host_panel.writing && (i + 1 < len)) {
+            host_panel_pixel((src[i] << 8) | src[i + 1]);
+            i++;
+        } else {
+            host_panel_param(src[i]);
+        }
+    }
+    return len;
+}
+
+/* irq */
+#define DMA_IRQ_0 11
+#define DMA_IRQ_1 12
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+typedef void (*irq_handler_t)();
+static irq_handler_t host_irq_handler[32];
+
+static inline void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t priority)
+{
+    host_irq_handler[num & 31] = handler;
+}
+
+static inline void irq_set_enabled(uint num, bool enabled)
+{
+}
+
+/* dma */
+#define HOST_DMA_CHANNELS 12
+
+enum dma_channel_transfer_size {
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+typedef struct {
+    enum dma_channel_transfer_size size;
+    bool read_inc;
+    bool write_inc;
+    int chain_to;
+} dma_channel_config;
+
+typedef struct {
+    volatile uint32_t al3_transfer_count;
+    volatile uint32_t al3_read_addr_trig;
+} dma_channel_hw_t;
+
+typedef struct {
+    dma_channel_hw_t ch[HOST_DMA_CHANNELS];
+} dma_hw_t;
+
+static dma_hw_t host_dma_hw;
+#define dma_hw (&host_dma_hw)
+
+static struct {
+    bool claimed;
+    bool irq1_enabled;
+    bool irq1_status;
+    dma_channel_config cfg;
+    volatile void *write;
+} host_dma[HOST_DMA_CHANNELS];
+
+static inline int dma_claim_unused_channel(bool required)
+{
+    for (int i = 0; i < HOST_DMA_CHANNELS; i++) {
+        if (!host_dma[i].claimed) {
+            host_dma[i].claimed = true;
+            return i;
+        }
+    }
+    return -1;
+}
+
+static inline dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    return (dma_channel_config) { DMA_SIZE_32, true, false, channel };
+}
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c,
+                                                        enum dma_channel_transfer_size size)
+{
+    c->size = size;
+}
+
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool inc)
+{
+    c->read_inc = inc;
+}
+
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool inc)
+{
+    c->write_inc = inc;
+}
+
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+}
+
+static inline void channel_config_set_chain_to(dma_channel_config *c, uint chain_to)
+{
+    c->chain_to = chain_to;
+}
+
+static inline void channel_config_set_irq_quiet(dma_channel_config *c, bool quiet)
+{
+}
+
+static inline void channel_config_set_ring(dma_channel_config *c, bool write, uint bits)
+{
+}
+
+static inline void dma_channel_set_irq1_enabled(uint channel, bool enabled)
+{
+    host_dma[channel].irq1_enabled = enabled;
+}
+
+static inline bool dma_channel_get_irq1_status(uint channel)
+{
+    return host_dma[channel].irq1_status;
+}
+
+static inline void dma_channel_acknowledge_irq1(uint channel)
+{
+    host_dma[channel].irq1_status = false;
+}
+
+static inline void dma_channel_wait_for_finish_blocking(uint channel)
+{
+}
+
+/* a control block as written by a control channel, count then address */
+typedef struct {
+    uint32_t count;
+    const void *addr;
+} host_dma_block_t;
+
+static void host_dma_to_spi(int channel, const void *src, uint32_t count)
+{
+    const uint8_t *p8 = src;
+    const uint16_t *p16 = src;
+    enum dma_channel_transfer_size size = host_dma[channel].cfg.size;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t value = size == DMA_SIZE_8 ? p8[i] : p16[i];
+        if (size == DMA_SIZE_8) {
+            host_panel_param(value);
+        } else {
+            host_panel_pixel(value);
+        }
+    }
+}
+
+static void host_dma_transfer(int channel, const void *read, uint32_t count)
+{
+    dma_channel_config *cfg = &host_dma[channel].cfg;
+    volatile void *write = host_dma[channel].write;
+
+    /* a control channel writing (count, addr) into another channel */
+    for (int i = 0; i < HOST_DMA_CHANNELS; i++) {
+        if (write != &dma_hw->ch[i].al3_transfer_count) {
+            continue;
+        }
+        const host_dma_block_t *block = read;
+        for (; block->count; block++) {
+            host_dma_to_spi(i, block->addr, block->count);
+        }
+        /* null trigger, irq quiet channels raise their irq here */
+        if (host_dma[i].irq1_enabled) {
+            host_dma[i].irq1_status = true;
+            if (host_irq_handler[DMA_IRQ_1]) {
+                host_irq_handler[DMA_IRQ_1]();
+            }
+        }
+        return;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        if (write == &host_spi[i].hw.dr) {
+            host_dma_to_spi(channel, read, count);
+            return;
+        }
+    }
+
+    /* memory to memory */
+    int unit = 1 << cfg->size;
+    const uint8_t *src = read;
+    uint8_t *dst = (uint8_t *)write;
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy(dst, src, unit);
+        src += cfg->read_inc ? unit : 0;
+        dst += cfg->write_inc ? unit : 0;
+    }
+}
+
+static inline void dma_channel_configure(uint channel, const dma_channel_config *config,
+                                         volatile void *write_addr, const volatile void *read_addr,
+                                         uint transfer_count, bool trigger)
+{
+    host_dma[channel].cfg = *config;
+    host_dma[channel].write = write_addr;
+    if (trigger && read_addr) {
+        host_dma_transfer(channel, (const void *)read_addr, transfer_count);
+    }
+}
+
+/* pwm */
+typedef struct {
+    float div;
+} pwm_config;
+
+static inline uint pwm_gpio_to_slice_num(uint gpio)
+{
+    return (gpio >> 1) & 7;
+}
+
+static inline pwm_config pwm_get_default_config()
+{
+    return (pwm_config) { 1.f };
+}
+
+static inline void pwm_config_set_clkdiv(pwm_config *c, float div)
+{
+    c->div = div;
+}
+
+static inline void pwm_init(uint slice, pwm_config *c, bool start)
+{
+}
+
+static inline void pwm_set_wrap(uint slice, uint16_t wrap)
+{
+}
+
+static inline void pwm_set_enabled(uint slice, bool enabled)
+{
+}
+
+static inline void pwm_set_gpio_level(uint gpio, uint16_t level)
+{
+}
+
+/* i2c, only the type for the touch sensor header */
+typedef struct {
+    int index;
+} i2c_inst_t;
+
+static i2c_inst_t host_i2c[2];
+#define i2c0 (&host_i2c[0])
+#define i2c1 (&host_i2c[1])
+
+/* multicore */
+typedef struct {
+    int owner;
+} mutex_t;
+
+static inline void mutex_enter_blocking(mutex_t *mtx)
+{
+}
+
+static inline void mutex_exit(mutex_t *mtx)
+{
+}
+
+#endif